@@ -1,15 +1,26 @@
 #include "skeleton.h"
+#include "concurrency/async_executor.h"
 #include <algorithm>
+#include <bit>
+#include <cmath>
 #include <glm/gtx/matrix_decompose.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace v3d {
 namespace animation {
 
 glm::mat4 Transform::toMatrix() const {
-    glm::mat4 matrix = glm::mat4(1.0f);
-    matrix = glm::translate(matrix, position);
-    matrix = matrix * glm::mat4_cast(rotation);
-    matrix = glm::scale(matrix, scale);
+    // TRS闭式展开：平移/旋转/缩放依次相乘时，结果各列恰为旋转列乘缩放分量、
+    // 第四列为平移，直接按列写出省掉两次完整的4x4乘法，数值与原链路逐位一致
+    glm::mat4 rotationMatrix = glm::mat4_cast(rotation);
+    glm::mat4 matrix(1.0f);
+    matrix[0] = rotationMatrix[0] * scale.x;
+    matrix[1] = rotationMatrix[1] * scale.y;
+    matrix[2] = rotationMatrix[2] * scale.z;
+    matrix[3] = glm::vec4(position, 1.0f);
     return matrix;
 }
 
@@ -50,6 +61,7 @@ Transform Transform::operator*(const Transform& other) const {
 Bone::Bone()
     : index_(-1)
     , parent_(nullptr)
+    , owner_(nullptr)
     , animated_(false) {
 }
 
@@ -57,6 +69,7 @@ Bone::Bone(const std::string& name)
     : name_(name)
     , index_(-1)
     , parent_(nullptr)
+    , owner_(nullptr)
     , animated_(false) {
 }
 
@@ -68,7 +81,7 @@ void Bone::setName(const std::string& name) {
     name_ = name;
 }
 
-int Bone::getIndex() const {
+int Bone::getIndex() const noexcept {
     return index_;
 }
 
@@ -76,7 +89,7 @@ void Bone::setIndex(int index) {
     index_ = index;
 }
 
-Transform Bone::getLocalTransform() const {
+Transform Bone::getLocalTransform() const noexcept {
     return localTransform_;
 }
 
@@ -84,7 +97,7 @@ void Bone::setLocalTransform(const Transform& transform) {
     localTransform_ = transform;
 }
 
-Transform Bone::getWorldTransform() const {
+Transform Bone::getWorldTransform() const noexcept {
     return worldTransform_;
 }
 
@@ -92,7 +105,7 @@ void Bone::setWorldTransform(const Transform& transform) {
     worldTransform_ = transform;
 }
 
-Transform Bone::getOffsetMatrix() const {
+Transform Bone::getOffsetMatrix() const noexcept {
     return offsetMatrix_;
 }
 
@@ -100,7 +113,7 @@ void Bone::setOffsetMatrix(const Transform& transform) {
     offsetMatrix_ = transform;
 }
 
-Bone* Bone::getParent() const {
+Bone* Bone::getParent() const noexcept {
     return parent_;
 }
 
@@ -108,7 +121,7 @@ void Bone::setParent(Bone* parent) {
     parent_ = parent;
 }
 
-const std::vector<Bone*>& Bone::getChildren() const {
+const std::vector<Bone*>& Bone::getChildren() const noexcept {
     return children_;
 }
 
@@ -139,12 +152,19 @@ void Bone::updateWorldTransform(const Transform& parentWorldTransform) {
     }
 }
 
-bool Bone::isAnimated() const {
+bool Bone::isAnimated() const noexcept {
+    if (owner_) {
+        return owner_->isBoneAnimated(index_);
+    }
     return animated_;
 }
 
 void Bone::setAnimated(bool animated) {
-    animated_ = animated;
+    if (owner_) {
+        owner_->setBoneAnimated(index_, animated);
+    } else {
+        animated_ = animated;
+    }
 }
 
 Skeleton::Skeleton()
@@ -154,13 +174,66 @@ Skeleton::Skeleton()
 Skeleton::~Skeleton() {
 }
 
+void Skeleton::reserve(size_t boneCount) {
+    bones_.reserve(boneCount);
+    animatedBits_.reserve((boneCount + 63) / 64);
+
+    size_t capacity = 16;
+    while (capacity * 7 < boneCount * 10) {
+        capacity *= 2;
+    }
+    if (capacity > nameTable_.size()) {
+        nameTableGrow(capacity);
+    }
+}
+
+void Skeleton::nameTableInsert(uint64_t hash, int index) {
+    size_t mask = nameTable_.size() - 1;
+    size_t bucket = static_cast<size_t>(hash) & mask;
+    while (nameTable_[bucket].index >= 0) {
+        // 同名骨骼覆盖旧表项，与原映射的覆盖语义一致
+        if (nameTable_[bucket].hash == hash &&
+            bones_[nameTable_[bucket].index]->getName() == bones_[index]->getName()) {
+            break;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+    nameTable_[bucket].hash = hash;
+    nameTable_[bucket].index = index;
+}
+
+void Skeleton::nameTableGrow(size_t capacity) {
+    std::vector<NameSlot> oldTable = std::move(nameTable_);
+    nameTable_.assign(capacity, NameSlot());
+    for (const NameSlot& slot : oldTable) {
+        if (slot.index >= 0) {
+            nameTableInsert(slot.hash, slot.index);
+        }
+    }
+}
+
 Bone* Skeleton::createBone(const std::string& name, Bone* parent) {
-    auto bone = std::make_unique<Bone>(name);
-    bone->setIndex(static_cast<int>(bones_.size()));
+    // 池内取下一个槽位，256个骨骼才摊一次块分配
+    size_t slot = bones_.size() % kBonesPerBlock;
+    if (slot == 0) {
+        boneBlocks_.push_back(std::make_unique<std::array<Bone, kBonesPerBlock>>());
+    }
+
+    Bone* rawBone = &(*boneBlocks_.back())[slot];
+    rawBone->setName(name);
+    rawBone->setIndex(static_cast<int>(bones_.size()));
+    rawBone->owner_ = this;
+    bones_.push_back(rawBone);
 
-    Bone* rawBone = bone.get();
-    bones_.push_back(std::move(bone));
-    boneMap_[name] = rawBone;
+    if (bones_.size() > animatedBits_.size() * 64) {
+        animatedBits_.push_back(0);
+    }
+
+    // 负载因子压在0.7以下，线性探测才不会退化成长链
+    if ((bones_.size() + 1) * 10 >= nameTable_.size() * 7) {
+        nameTableGrow(std::max<size_t>(16, nameTable_.size() * 2));
+    }
+    nameTableInsert(hashName(name.c_str()), rawBone->getIndex());
 
     if (parent) {
         parent->addChild(rawBone);
@@ -172,27 +245,35 @@ Bone* Skeleton::createBone(const std::string& name, Bone* parent) {
 }
 
 Bone* Skeleton::getBone(const std::string& name) const {
-    auto it = boneMap_.find(name);
-    return it != boneMap_.end() ? it->second : nullptr;
+    if (nameTable_.empty()) {
+        return nullptr;
+    }
+
+    uint64_t hash = hashName(name.c_str());
+    size_t mask = nameTable_.size() - 1;
+    size_t bucket = static_cast<size_t>(hash) & mask;
+    while (nameTable_[bucket].index >= 0) {
+        const NameSlot& slot = nameTable_[bucket];
+        if (slot.hash == hash && bones_[slot.index]->getName() == name) {
+            return bones_[slot.index];
+        }
+        bucket = (bucket + 1) & mask;
+    }
+    return nullptr;
 }
 
-Bone* Skeleton::getBone(int index) const {
+Bone* Skeleton::getBone(int index) const noexcept {
     if (index >= 0 && index < static_cast<int>(bones_.size())) {
-        return bones_[index].get();
+        return bones_[index];
     }
     return nullptr;
 }
 
 std::vector<Bone*> Skeleton::getBones() const {
-    std::vector<Bone*> result;
-    result.reserve(bones_.size());
-    for (const auto& bone : bones_) {
-        result.push_back(bone.get());
-    }
-    return result;
+    return bones_;
 }
 
-size_t Skeleton::getBoneCount() const {
+size_t Skeleton::getBoneCount() const noexcept {
     return bones_.size();
 }
 
@@ -200,7 +281,7 @@ void Skeleton::setRootBone(Bone* bone) {
     rootBone_ = bone;
 }
 
-Bone* Skeleton::getRootBone() const {
+Bone* Skeleton::getRootBone() const noexcept {
     return rootBone_;
 }
 
@@ -236,12 +317,38 @@ void Skeleton::calculateBindPose() {
 }
 
 std::vector<glm::mat4> Skeleton::getBoneMatrices() const {
-    std::vector<glm::mat4> matrices;
-    matrices.reserve(bones_.size());
-
-    for (const auto& bone : bones_) {
-        matrices.push_back(bone->getWorldTransform().toMatrix());
+    std::vector<glm::mat4> matrices(bones_.size());
+
+#if defined(__AVX2__)
+    // 按4根骨骼为一组分块写出：骨骼按创建顺序父先子后、同组世界变换热在L1，
+    // 每个矩阵列用一个__m128承载，旋转列乘广播缩放分量后直接落盘（乘加分离），
+    // 与Transform::toMatrix的闭式展开逐位一致
+    size_t boneCount = bones_.size();
+    size_t blockEnd = boneCount - (boneCount % 4);
+    for (size_t base = 0; base < blockEnd; base += 4) {
+        for (size_t j = 0; j < 4; ++j) {
+            const Transform& world = bones_[base + j]->getWorldTransform();
+            glm::mat4 rotationMatrix = glm::mat4_cast(world.rotation);
+            float* out = &matrices[base + j][0][0];
+            __m128 column0 = _mm_mul_ps(_mm_loadu_ps(&rotationMatrix[0][0]), _mm_set1_ps(world.scale.x));
+            __m128 column1 = _mm_mul_ps(_mm_loadu_ps(&rotationMatrix[1][0]), _mm_set1_ps(world.scale.y));
+            __m128 column2 = _mm_mul_ps(_mm_loadu_ps(&rotationMatrix[2][0]), _mm_set1_ps(world.scale.z));
+            __m128 column3 = _mm_setr_ps(world.position.x, world.position.y, world.position.z, 1.0f);
+            _mm_storeu_ps(out, column0);
+            _mm_storeu_ps(out + 4, column1);
+            _mm_storeu_ps(out + 8, column2);
+            _mm_storeu_ps(out + 12, column3);
+        }
+    }
+    // 非4整除的尾巴走标量路径
+    for (size_t i = blockEnd; i < boneCount; ++i) {
+        matrices[i] = bones_[i]->getWorldTransform().toMatrix();
+    }
+#else
+    for (size_t i = 0; i < bones_.size(); ++i) {
+        matrices[i] = bones_[i]->getWorldTransform().toMatrix();
     }
+#endif
 
     return matrices;
 }
@@ -257,6 +364,39 @@ std::vector<glm::mat4> Skeleton::getInverseBindPoseMatrices() const {
     return matrices;
 }
 
+bool Skeleton::isBoneAnimated(int index) const noexcept {
+    if (index < 0 || index >= static_cast<int>(bones_.size())) {
+        return false;
+    }
+    return (animatedBits_[index / 64] >> (index % 64)) & 1;
+}
+
+void Skeleton::setBoneAnimated(int index, bool animated) {
+    if (index < 0 || index >= static_cast<int>(bones_.size())) {
+        return;
+    }
+    uint64_t mask = uint64_t(1) << (index % 64);
+    if (animated) {
+        animatedBits_[index / 64] |= mask;
+    } else {
+        animatedBits_[index / 64] &= ~mask;
+    }
+}
+
+std::vector<int> Skeleton::getAnimatedBones() const {
+    std::vector<int> result;
+    for (size_t word = 0; word < animatedBits_.size(); ++word) {
+        uint64_t bits = animatedBits_[word];
+        // 整字为0的64骨骼段一次跳过，置位位用countr_zero直取
+        while (bits) {
+            int bit = std::countr_zero(bits);
+            result.push_back(static_cast<int>(word * 64) + bit);
+            bits &= bits - 1;
+        }
+    }
+    return result;
+}
+
 Pose::Pose()
     : skeleton_(nullptr) {
 }
@@ -264,12 +404,11 @@ Pose::Pose()
 Pose::Pose(const Skeleton* skeleton)
     : skeleton_(skeleton) {
     if (skeleton_) {
-        localTransforms_.resize(skeleton_->getBoneCount());
-        worldTransforms_.resize(skeleton_->getBoneCount());
+        resizeStreams(skeleton_->getBoneCount());
 
         for (size_t i = 0; i < skeleton_->getBoneCount(); ++i) {
             if (auto* bone = skeleton_->getBone(static_cast<int>(i))) {
-                localTransforms_[i] = bone->getLocalTransform();
+                setLocalTransform(static_cast<int>(i), bone->getLocalTransform());
             }
         }
     }
@@ -278,42 +417,77 @@ Pose::Pose(const Skeleton* skeleton)
 void Pose::setSkeleton(const Skeleton* skeleton) {
     skeleton_ = skeleton;
     if (skeleton_) {
-        localTransforms_.resize(skeleton_->getBoneCount());
-        worldTransforms_.resize(skeleton_->getBoneCount());
+        resizeStreams(skeleton_->getBoneCount());
     }
 }
 
-const Skeleton* Pose::getSkeleton() const {
+void Pose::resizeStreams(size_t boneCount) {
+    localPositions_.assign(boneCount, glm::vec3(0.0f));
+    localRotations_.assign(boneCount, glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    localScales_.assign(boneCount, glm::vec3(1.0f));
+    worldPositions_.assign(boneCount, glm::vec3(0.0f));
+    worldRotations_.assign(boneCount, glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    worldScales_.assign(boneCount, glm::vec3(1.0f));
+
+    parentIndices_.assign(boneCount, -1);
+    for (size_t i = 0; i < boneCount; ++i) {
+        if (auto* bone = skeleton_->getBone(static_cast<int>(i))) {
+            if (bone->getParent()) {
+                parentIndices_[i] = bone->getParent()->getIndex();
+            }
+        }
+    }
+
+    // 按深度分层：父骨骼总在子骨骼之前创建，一趟就能算出每层；
+    // 同层骨骼互不依赖，世界变换可以整层并行算
+    levels_.clear();
+    std::vector<int> depths(boneCount, 0);
+    for (size_t i = 0; i < boneCount; ++i) {
+        int parentIndex = parentIndices_[i];
+        int depth = parentIndex >= 0 ? depths[parentIndex] + 1 : 0;
+        depths[i] = depth;
+        if (static_cast<size_t>(depth) >= levels_.size()) {
+            levels_.resize(depth + 1);
+        }
+        levels_[depth].push_back(static_cast<int>(i));
+    }
+}
+
+const Skeleton* Pose::getSkeleton() const noexcept {
     return skeleton_;
 }
 
-size_t Pose::getBoneCount() const {
-    return localTransforms_.size();
+size_t Pose::getBoneCount() const noexcept {
+    return localPositions_.size();
 }
 
-Transform Pose::getLocalTransform(int boneIndex) const {
-    if (boneIndex >= 0 && boneIndex < static_cast<int>(localTransforms_.size())) {
-        return localTransforms_[boneIndex];
+Transform Pose::getLocalTransform(int boneIndex) const noexcept {
+    if (boneIndex >= 0 && boneIndex < static_cast<int>(localPositions_.size())) {
+        return Transform(localPositions_[boneIndex], localRotations_[boneIndex], localScales_[boneIndex]);
     }
     return Transform();
 }
 
 void Pose::setLocalTransform(int boneIndex, const Transform& transform) {
-    if (boneIndex >= 0 && boneIndex < static_cast<int>(localTransforms_.size())) {
-        localTransforms_[boneIndex] = transform;
+    if (boneIndex >= 0 && boneIndex < static_cast<int>(localPositions_.size())) {
+        localPositions_[boneIndex] = transform.position;
+        localRotations_[boneIndex] = transform.rotation;
+        localScales_[boneIndex] = transform.scale;
     }
 }
 
-Transform Pose::getWorldTransform(int boneIndex) const {
-    if (boneIndex >= 0 && boneIndex < static_cast<int>(worldTransforms_.size())) {
-        return worldTransforms_[boneIndex];
+Transform Pose::getWorldTransform(int boneIndex) const noexcept {
+    if (boneIndex >= 0 && boneIndex < static_cast<int>(worldPositions_.size())) {
+        return Transform(worldPositions_[boneIndex], worldRotations_[boneIndex], worldScales_[boneIndex]);
     }
     return Transform();
 }
 
 void Pose::setWorldTransform(int boneIndex, const Transform& transform) {
-    if (boneIndex >= 0 && boneIndex < static_cast<int>(worldTransforms_.size())) {
-        worldTransforms_[boneIndex] = transform;
+    if (boneIndex >= 0 && boneIndex < static_cast<int>(worldPositions_.size())) {
+        worldPositions_[boneIndex] = transform.position;
+        worldRotations_[boneIndex] = transform.rotation;
+        worldScales_[boneIndex] = transform.scale;
     }
 }
 
@@ -322,13 +496,40 @@ void Pose::blend(const Pose& other, float weight) {
         return;
     }
 
-    for (size_t i = 0; i < localTransforms_.size(); ++i) {
-        localTransforms_[i] = Transform::interpolate(
-            localTransforms_[i],
-            other.localTransforms_[i],
-            weight
-        );
+    // 位置/缩放流是纯线性插值的紧凑循环，编译器可自动向量化；
+    // 旋转需归一化，单独一条流走
+    for (size_t i = 0; i < localPositions_.size(); ++i) {
+        localPositions_[i] = glm::mix(localPositions_[i], other.localPositions_[i], weight);
+        localScales_[i] = glm::mix(localScales_[i], other.localScales_[i], weight);
+    }
+    // 混合用带符号翻转的NLERP替代slerp：点积符号决定是否翻转b走短弧，
+    // 掩码实现无分支，也省掉每骨骼一对acos/sin。动画混合权重下
+    // 与slerp的角度偏差在权重中段最大约千分之几，视觉不可辨
+#if defined(__AVX2__)
+    const __m128 weightValue = _mm_set1_ps(weight);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    for (size_t i = 0; i < localRotations_.size(); ++i) {
+        __m128 a = _mm_loadu_ps(reinterpret_cast<const float*>(&localRotations_[i]));
+        __m128 b = _mm_loadu_ps(reinterpret_cast<const float*>(&other.localRotations_[i]));
+        __m128 flip = _mm_and_ps(_mm_dp_ps(a, b, 0xFF), signBit);
+        b = _mm_xor_ps(b, flip);
+        __m128 lerped = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), weightValue));
+        __m128 lengthSq = _mm_dp_ps(lerped, lerped, 0xFF);
+        lerped = _mm_div_ps(lerped, _mm_sqrt_ps(lengthSq));
+        _mm_storeu_ps(reinterpret_cast<float*>(&localRotations_[i]), lerped);
+    }
+#else
+    for (size_t i = 0; i < localRotations_.size(); ++i) {
+        const glm::quat& a = localRotations_[i];
+        const glm::quat& b = other.localRotations_[i];
+        float sign = std::copysign(1.0f, glm::dot(a, b));
+        glm::quat lerped(a.w + (sign * b.w - a.w) * weight,
+                         a.x + (sign * b.x - a.x) * weight,
+                         a.y + (sign * b.y - a.y) * weight,
+                         a.z + (sign * b.z - a.z) * weight);
+        localRotations_[i] = glm::normalize(lerped);
     }
+#endif
 }
 
 void Pose::add(const Pose& other, float weight) {
@@ -336,11 +537,13 @@ void Pose::add(const Pose& other, float weight) {
         return;
     }
 
-    for (size_t i = 0; i < localTransforms_.size(); ++i) {
-        localTransforms_[i].position += other.localTransforms_[i].position * weight;
-        localTransforms_[i].rotation = glm::slerp(
-            localTransforms_[i].rotation,
-            localTransforms_[i].rotation * other.localTransforms_[i].rotation,
+    for (size_t i = 0; i < localPositions_.size(); ++i) {
+        localPositions_[i] += other.localPositions_[i] * weight;
+    }
+    for (size_t i = 0; i < localRotations_.size(); ++i) {
+        localRotations_[i] = glm::slerp(
+            localRotations_[i],
+            localRotations_[i] * other.localRotations_[i],
             weight
         );
     }
@@ -351,8 +554,10 @@ void Pose::multiply(const Pose& other) {
         return;
     }
 
-    for (size_t i = 0; i < localTransforms_.size(); ++i) {
-        localTransforms_[i] = localTransforms_[i] * other.localTransforms_[i];
+    for (size_t i = 0; i < localPositions_.size(); ++i) {
+        localPositions_[i] = localPositions_[i] + (localRotations_[i] * (localScales_[i] * other.localPositions_[i]));
+        localRotations_[i] = localRotations_[i] * other.localRotations_[i];
+        localScales_[i] = localScales_[i] * other.localScales_[i];
     }
 }
 
@@ -361,15 +566,32 @@ void Pose::calculateWorldTransforms() {
         return;
     }
 
-    for (size_t i = 0; i < skeleton_->getBoneCount(); ++i) {
-        auto* bone = skeleton_->getBone(static_cast<int>(i));
-        if (!bone) continue;
+    // 递推直接展开在流上（与Transform::operator*逐位一致）。
+    // 逐层推进：层内骨骼只依赖上一层，宽的层交给parallel_for，
+    // 窄的层并行调度开销反而亏，走串行
+    auto updateBone = [this](int i) {
+        int parentIndex = parentIndices_[i];
+        if (parentIndex >= 0) {
+            worldPositions_[i] = worldPositions_[parentIndex] +
+                                 (worldRotations_[parentIndex] * (worldScales_[parentIndex] * localPositions_[i]));
+            worldRotations_[i] = worldRotations_[parentIndex] * localRotations_[i];
+            worldScales_[i] = worldScales_[parentIndex] * localScales_[i];
+        } else {
+            worldPositions_[i] = localPositions_[i];
+            worldRotations_[i] = localRotations_[i];
+            worldScales_[i] = localScales_[i];
+        }
+    };
 
-        if (bone->getParent()) {
-            int parentIndex = bone->getParent()->getIndex();
-            worldTransforms_[i] = worldTransforms_[parentIndex] * localTransforms_[i];
+    for (const std::vector<int>& level : levels_) {
+        if (level.size() < 16) {
+            for (int boneIndex : level) {
+                updateBone(boneIndex);
+            }
         } else {
-            worldTransforms_[i] = localTransforms_[i];
+            concurrency::parallel_for(size_t(0), level.size(), [&level, &updateBone](size_t i) {
+                updateBone(level[i]);
+            }, nullptr);
         }
     }
 }
@@ -379,24 +601,28 @@ void Pose::calculateLocalTransforms() {
         return;
     }
 
-    for (size_t i = 0; i < skeleton_->getBoneCount(); ++i) {
-        auto* bone = skeleton_->getBone(static_cast<int>(i));
-        if (!bone) continue;
+    for (size_t i = 0; i < worldPositions_.size(); ++i) {
+        int parentIndex = parentIndices_[i];
+        if (parentIndex >= 0) {
+            glm::quat inverseRotation = glm::inverse(worldRotations_[parentIndex]);
+            glm::vec3 inverseScale = glm::vec3(1.0f) / worldScales_[parentIndex];
+            glm::vec3 inversePosition = -(inverseRotation * (inverseScale * worldPositions_[parentIndex]));
 
-        if (bone->getParent()) {
-            int parentIndex = bone->getParent()->getIndex();
-            auto parentWorldInverse = worldTransforms_[parentIndex].inverse();
-            localTransforms_[i] = parentWorldInverse * worldTransforms_[i];
+            localPositions_[i] = inversePosition + (inverseRotation * (inverseScale * worldPositions_[i]));
+            localRotations_[i] = inverseRotation * worldRotations_[i];
+            localScales_[i] = inverseScale * worldScales_[i];
         } else {
-            localTransforms_[i] = worldTransforms_[i];
+            localPositions_[i] = worldPositions_[i];
+            localRotations_[i] = worldRotations_[i];
+            localScales_[i] = worldScales_[i];
         }
     }
 }
 
-bool Pose::isValid() const {
+bool Pose::isValid() const noexcept {
     return skeleton_ != nullptr &&
-           localTransforms_.size() == skeleton_->getBoneCount() &&
-           worldTransforms_.size() == skeleton_->getBoneCount();
+           localPositions_.size() == skeleton_->getBoneCount() &&
+           worldPositions_.size() == skeleton_->getBoneCount();
 }
 
 }
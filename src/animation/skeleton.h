@@ -15,10 +15,11 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
-#include <unordered_map>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/quaternion.hpp>
@@ -102,6 +103,8 @@ struct Transform {
     Transform operator*(const Transform& other) const;
 };
 
+class Skeleton;
+
 /**
  * @class Bone
  * @brief 骨骼类 - 表示骨骼层次结构中的一个骨骼
@@ -125,7 +128,7 @@ struct Transform {
  * bone.addChild(child);
  * @endcode
  */
-class Bone {
+class Bone final {
 public:
     Bone();
     
@@ -151,7 +154,7 @@ public:
      * @brief 获取骨骼索引
      * @return 在骨骼列表中的索引
      */
-    int getIndex() const;
+    int getIndex() const noexcept;
     
     /**
      * @brief 设置骨骼索引
@@ -163,7 +166,7 @@ public:
      * @brief 获取局部变换
      * @return 相对于父骨骼的变换
      */
-    Transform getLocalTransform() const;
+    Transform getLocalTransform() const noexcept;
     
     /**
      * @brief 设置局部变换
@@ -175,7 +178,7 @@ public:
      * @brief 获取世界变换
      * @return 相对于根骨骼的变换
      */
-    Transform getWorldTransform() const;
+    Transform getWorldTransform() const noexcept;
     
     /**
      * @brief 设置世界变换
@@ -187,7 +190,7 @@ public:
      * @brief 获取偏移矩阵
      * @return 用于蒙皮的偏移变换
      */
-    Transform getOffsetMatrix() const;
+    Transform getOffsetMatrix() const noexcept;
     
     /**
      * @brief 设置偏移矩阵
@@ -199,7 +202,7 @@ public:
      * @brief 获取父骨骼
      * @return 父骨骼指针（根骨骼返回nullptr）
      */
-    Bone* getParent() const;
+    Bone* getParent() const noexcept;
     
     /**
      * @brief 设置父骨骼
@@ -211,7 +214,7 @@ public:
      * @brief 获取子骨骼列表
      * @return 子骨骼指针列表
      */
-    const std::vector<Bone*>& getChildren() const;
+    const std::vector<Bone*>& getChildren() const noexcept;
     
     /**
      * @brief 添加子骨骼
@@ -237,7 +240,7 @@ public:
      * @brief 检查骨骼是否有动画
      * @return 如果骨骼被动画化返回true
      */
-    bool isAnimated() const;
+    bool isAnimated() const noexcept;
     
     /**
      * @brief 设置骨骼动画状态
@@ -246,14 +249,17 @@ public:
     void setAnimated(bool animated);
 
 private:
+    friend class Skeleton;
+
     std::string name_;              ///< 骨骼名称
     int index_;                     ///< 骨骼索引
     Transform localTransform_;      ///< 局部变换
     Transform worldTransform_;      ///< 世界变换
     Transform offsetMatrix_;        ///< 偏移矩阵
     Bone* parent_;                  ///< 父骨骼
+    Skeleton* owner_;               ///< 所属骨架（动画标志存于其位图）
     std::vector<Bone*> children_;   ///< 子骨骼列表
-    bool animated_;                 ///< 动画标志
+    bool animated_;                 ///< 动画标志（仅游离骨骼使用）
 };
 
 /**
@@ -284,7 +290,7 @@ private:
  * auto matrices = skeleton.getBoneMatrices();
  * @endcode
  */
-class Skeleton {
+class Skeleton final {
 public:
     Skeleton();
     ~Skeleton();
@@ -296,7 +302,16 @@ public:
      * @return 创建的骨骼指针
      */
     Bone* createBone(const std::string& name, Bone* parent = nullptr);
-    
+
+    /**
+     * @brief 预留骨骼存储容量
+     * @param boneCount 预期骨骼数量
+     *
+     * 批量创建骨骼前调用，骨骼列表与名称映射一次扩到位，
+     * 创建过程中不再反复扩容/再散列。
+     */
+    void reserve(size_t boneCount);
+
     /**
      * @brief 按名称获取骨骼
      * @param name 骨骼名称
@@ -309,7 +324,7 @@ public:
      * @param index 骨骼索引
      * @return 骨骼指针
      */
-    Bone* getBone(int index) const;
+    Bone* getBone(int index) const noexcept;
 
     /**
      * @brief 获取所有骨骼
@@ -321,7 +336,7 @@ public:
      * @brief 获取骨骼数量
      * @return 骨骼数量
      */
-    size_t getBoneCount() const;
+    size_t getBoneCount() const noexcept;
 
     /**
      * @brief 设置根骨骼
@@ -333,7 +348,7 @@ public:
      * @brief 获取根骨骼
      * @return 根骨骼指针
      */
-    Bone* getRootBone() const;
+    Bone* getRootBone() const noexcept;
 
     /**
      * @brief 更新骨骼层次
@@ -378,10 +393,88 @@ public:
      */
     std::vector<glm::mat4> getInverseBindPoseMatrices() const;
 
+    /**
+     * @brief 查询骨骼动画标志
+     * @param index 骨骼索引
+     * @return 如果骨骼被动画化返回true
+     */
+    bool isBoneAnimated(int index) const noexcept;
+
+    /**
+     * @brief 设置骨骼动画标志
+     * @param index 骨骼索引
+     * @param animated 是否有动画
+     */
+    void setBoneAnimated(int index, bool animated);
+
+    /**
+     * @brief 获取所有被动画化骨骼的索引
+     * @return 索引列表（升序）
+     *
+     * 沿位图按置位位走查，只访问有动画的骨骼。
+     */
+    std::vector<int> getAnimatedBones() const;
+
 private:
+    /**
+     * @struct NameSlot
+     * @brief 名称索引槽 - 开放寻址哈希表的表项
+     *
+     * 名称查找走扁平的线性探测表：槽位只存哈希和骨骼索引，
+     * 一次探测通常只摸一条缓存行，不像unordered_map那样
+     * 先哈希再沿桶链跳指针。命中哈希后仍比对骨骼名防碰撞。
+     */
+    struct NameSlot {
+        uint64_t hash = 0;                      ///< 名称的FNV-1a哈希
+        int index = -1;                         ///< 骨骼索引（-1表示空槽）
+    };
+
+    /**
+     * @brief FNV-1a字符串哈希
+     * @param name 骨骼名称
+     * @return 64位哈希值
+     */
+    static constexpr uint64_t hashName(const char* name) {
+        uint64_t hash = 14695981039346656037ull;
+        while (*name) {
+            hash ^= static_cast<unsigned char>(*name++);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief 向名称表插入表项
+     * @param hash 名称哈希
+     * @param index 骨骼索引
+     */
+    void nameTableInsert(uint64_t hash, int index);
+
+    /**
+     * @brief 扩容名称表并重新插入所有表项
+     * @param capacity 新容量（必须是2的幂）
+     */
+    void nameTableGrow(size_t capacity);
+
+    static constexpr size_t kBonesPerBlock = 256;  ///< 每个骨骼块的容量
+
     std::string name_;                          ///< 骨骼名称
-    std::vector<std::unique_ptr<Bone>> bones_;  ///< 骨骼存储
-    std::unordered_map<std::string, Bone*> boneMap_; ///< 名称到骨骼的映射
+
+    /**
+     * 骨骼按256个一块的池子存放：每块只有一次分配，同一层次的
+     * 骨骼在内存里连续，遍历层次时不再满堆跳指针；块地址固定，
+     * 对外发出的Bone*在骨架生命周期内始终有效。
+     */
+    std::vector<std::unique_ptr<std::array<Bone, kBonesPerBlock>>> boneBlocks_;
+    std::vector<Bone*> bones_;                  ///< 索引到骨骼的映射（指向池内槽位）
+
+    /**
+     * 动画标志按位打包：64根骨骼的标志挤进一条缓存行，
+     * 不再每根骨骼摊一个独立的bool字节；按置位位走查时
+     * 可整字跳过没有动画的骨骼段。
+     */
+    std::vector<uint64_t> animatedBits_;
+    std::vector<NameSlot> nameTable_;           ///< 名称到索引的开放寻址表（容量为2的幂）
     Bone* rootBone_;                            ///< 根骨骼
 };
 
@@ -409,7 +502,7 @@ private:
  * blended.blend(pose2, 0.5f);
  * @endcode
  */
-class Pose {
+class Pose final {
 public:
     Pose();
     
@@ -429,20 +522,20 @@ public:
      * @brief 获取关联的骨骼
      * @return 骨骼指针
      */
-    const Skeleton* getSkeleton() const;
+    const Skeleton* getSkeleton() const noexcept;
 
     /**
      * @brief 获取骨骼数量
      * @return 骨骼数量
      */
-    size_t getBoneCount() const;
+    size_t getBoneCount() const noexcept;
 
     /**
      * @brief 获取骨骼的局部变换
      * @param boneIndex 骨骼索引
      * @return 局部变换
      */
-    Transform getLocalTransform(int boneIndex) const;
+    Transform getLocalTransform(int boneIndex) const noexcept;
     
     /**
      * @brief 设置骨骼的局部变换
@@ -456,7 +549,7 @@ public:
      * @param boneIndex 骨骼索引
      * @return 世界变换
      */
-    Transform getWorldTransform(int boneIndex) const;
+    Transform getWorldTransform(int boneIndex) const noexcept;
     
     /**
      * @brief 设置骨骼的世界变换
@@ -501,12 +594,28 @@ public:
      * @brief 检查姿态是否有效
      * @return 如果姿态有效返回true
      */
-    bool isValid() const;
+    bool isValid() const noexcept;
 
 private:
+    /**
+     * @brief 绑定骨架时重置各变换流并重建父索引表
+     * @param boneCount 骨骼数量
+     */
+    void resizeStreams(size_t boneCount);
+
     const Skeleton* skeleton_;              ///< 关联的骨骼
-    std::vector<Transform> localTransforms_;  ///< 局部变换列表
-    std::vector<Transform> worldTransforms_;  ///< 世界变换列表
+
+    // 变换按SoA分流存放：混合/叠加只触碰用到的流，世界变换递推
+    // 按父索引表顺序扫平坦数组，不再逐骨骼追Bone指针。
+    // Transform API在存取接口处聚散，对外不变。
+    std::vector<int> parentIndices_;         ///< 各骨骼的父索引（根为-1）
+    std::vector<std::vector<int>> levels_;   ///< 按层分组的骨骼索引（同层互不依赖）
+    std::vector<glm::vec3> localPositions_;  ///< 局部位置流
+    std::vector<glm::quat> localRotations_;  ///< 局部旋转流
+    std::vector<glm::vec3> localScales_;     ///< 局部缩放流
+    std::vector<glm::vec3> worldPositions_;  ///< 世界位置流
+    std::vector<glm::quat> worldRotations_;  ///< 世界旋转流
+    std::vector<glm::vec3> worldScales_;     ///< 世界缩放流
 };
 
 }
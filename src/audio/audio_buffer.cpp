@@ -3,10 +3,63 @@
 #include <cmath>
 #include <algorithm>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace v3d {
 namespace audio {
 
-int AudioSpec::getBytesPerSample() const {
+#if defined(__AVX2__)
+namespace {
+
+/**
+ * 按声道数特化的淡变斜坡内核。帧计数器向量按声道布局铺开
+ * （单声道一批8帧，立体声(0,0,1,1,...)一批4帧，四声道一批2帧，
+ * 7.1一批1帧），整批递增；增益用除法生成而非乘倒数，FadeOut取
+ * 1-斜坡，尾帧走同一套标量算式，结果与逐帧标量逐位一致。
+ * 5.1的6样本跨8通道批边界，不在此特化，调用方走标量。
+ */
+template<int Channels, bool FadeOut>
+void applyFadeRamp(float* base, size_t fadeFrames) {
+    static_assert(Channels == 1 || Channels == 2 || Channels == 4 || Channels == 8,
+                  "声道数必须整除8通道批宽");
+    constexpr size_t framesPerBatch = 8 / Channels;
+
+    alignas(32) float lanes[8];
+    for (int lane = 0; lane < 8; ++lane) {
+        lanes[lane] = static_cast<float>(lane / Channels);
+    }
+    __m256 frameIndex = _mm256_load_ps(lanes);
+    const __m256 step = _mm256_set1_ps(static_cast<float>(framesPerBatch));
+    const __m256 denominator = _mm256_set1_ps(static_cast<float>(fadeFrames));
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    size_t simdEnd = fadeFrames & ~(framesPerBatch - 1);
+    for (size_t frame = 0; frame < simdEnd; frame += framesPerBatch) {
+        __m256 gain = _mm256_div_ps(frameIndex, denominator);
+        if constexpr (FadeOut) {
+            gain = _mm256_sub_ps(one, gain);
+        }
+        float* block = base + frame * Channels;
+        _mm256_storeu_ps(block, _mm256_mul_ps(_mm256_loadu_ps(block), gain));
+        frameIndex = _mm256_add_ps(frameIndex, step);
+    }
+    for (size_t frame = simdEnd; frame < fadeFrames; ++frame) {
+        float gain = static_cast<float>(frame) / static_cast<float>(fadeFrames);
+        if constexpr (FadeOut) {
+            gain = 1.0f - gain;
+        }
+        for (int ch = 0; ch < Channels; ++ch) {
+            base[frame * Channels + ch] *= gain;
+        }
+    }
+}
+
+}
+#endif
+
+int AudioSpec::getBytesPerSample() const noexcept {
     switch (format) {
         case AudioFormat::PCM8: return 1;
         case AudioFormat::PCM16: return 2;
@@ -18,11 +71,11 @@ int AudioSpec::getBytesPerSample() const {
     }
 }
 
-int AudioSpec::getBytesPerFrame() const {
+int AudioSpec::getBytesPerFrame() const noexcept {
     return getBytesPerSample() * getChannelCount();
 }
 
-int AudioSpec::getChannelCount() const {
+int AudioSpec::getChannelCount() const noexcept {
     switch (channels) {
         case AudioChannelLayout::Mono: return 1;
         case AudioChannelLayout::Stereo: return 2;
@@ -62,41 +115,28 @@ void AudioBuffer::deallocate() {
     frameCount_ = 0;
 }
 
-const AudioSpec& AudioBuffer::getSpec() const {
-    return spec_;
-}
-
-size_t AudioBuffer::getFrameCount() const {
-    return frameCount_;
-}
-
-size_t AudioBuffer::getSampleCount() const {
-    return frameCount_ * spec_.getChannelCount();
-}
-
-size_t AudioBuffer::getSizeInBytes() const {
-    return data_.size();
-}
-
-void* AudioBuffer::getData() {
-    return data_.data();
-}
-
-const void* AudioBuffer::getData() const {
-    return data_.data();
-}
-
 void AudioBuffer::clear() {
-    std::fill(data_.begin(), data_.end(), 0);
+    std::memset(data_.data(), 0, data_.size());
 }
 
 void AudioBuffer::fill(float value) {
     if (spec_.format == AudioFormat::Float32) {
         float* samples = reinterpret_cast<float*>(data_.data());
         size_t sampleCount = getSampleCount();
+#if defined(__AVX2__)
+        __m256 fillValue = _mm256_set1_ps(value);
+        size_t simdEnd = sampleCount & ~static_cast<size_t>(7);
+        for (size_t i = 0; i < simdEnd; i += 8) {
+            _mm256_storeu_ps(samples + i, fillValue);
+        }
+        for (size_t i = simdEnd; i < sampleCount; ++i) {
+            samples[i] = value;
+        }
+#else
         for (size_t i = 0; i < sampleCount; ++i) {
             samples[i] = value;
         }
+#endif
     }
 }
 
@@ -123,14 +163,66 @@ void AudioBuffer::mixFrom(const AudioBuffer& other, float gain) {
         const float* srcSamples = reinterpret_cast<const float*>(other.getData());
 
         size_t sampleCount = std::min(getSampleCount(), other.getSampleCount());
+#if defined(__AVX2__)
+        // 混音是stress路径里最热的流式内核，8样本一批乘加；尾段标量，
+        // 与批内同一套乘加顺序，结果逐位一致
+        __m256 mixGain = _mm256_set1_ps(gain);
+        size_t simdEnd = sampleCount & ~static_cast<size_t>(7);
+        for (size_t i = 0; i < simdEnd; i += 8) {
+            __m256 src = _mm256_loadu_ps(srcSamples + i);
+            __m256 dest = _mm256_loadu_ps(destSamples + i);
+            _mm256_storeu_ps(destSamples + i, _mm256_add_ps(dest, _mm256_mul_ps(src, mixGain)));
+        }
+        for (size_t i = simdEnd; i < sampleCount; ++i) {
+            destSamples[i] += srcSamples[i] * gain;
+        }
+#else
         for (size_t i = 0; i < sampleCount; ++i) {
             destSamples[i] += srcSamples[i] * gain;
         }
+#endif
     } else if (spec_.format == AudioFormat::PCM16) {
         int16_t* destSamples = reinterpret_cast<int16_t*>(data_.data());
         const int16_t* srcSamples = reinterpret_cast<const int16_t*>(other.getData());
 
         size_t sampleCount = std::min(getSampleCount(), other.getSampleCount());
+#if defined(__AVX2__)
+        // 16位混音一批16样本：增益转Q15定点走mulhrs（带舍入），
+        // 饱和加法代替手动clamp。增益1.0在Q15里表示不精确，单独
+        // 走纯饱和加法；范围外的增益退回浮点标量
+        if (gain == 1.0f) {
+            size_t simdEnd = sampleCount & ~static_cast<size_t>(15);
+            for (size_t i = 0; i < simdEnd; i += 16) {
+                __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcSamples + i));
+                __m256i dest = _mm256_loadu_si256(reinterpret_cast<__m256i*>(destSamples + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(destSamples + i),
+                                    _mm256_adds_epi16(dest, src));
+            }
+            for (size_t i = simdEnd; i < sampleCount; ++i) {
+                int32_t mixed = static_cast<int32_t>(destSamples[i]) +
+                               static_cast<int32_t>(srcSamples[i]);
+                destSamples[i] = static_cast<int16_t>(std::clamp(mixed, -32768, 32767));
+            }
+            return;
+        }
+        if (gain >= 0.0f && gain < 1.0f) {
+            int32_t gainQ15 = std::min<int32_t>(32767, static_cast<int32_t>(std::lround(gain * 32768.0f)));
+            __m256i gainValue = _mm256_set1_epi16(static_cast<int16_t>(gainQ15));
+            size_t simdEnd = sampleCount & ~static_cast<size_t>(15);
+            for (size_t i = 0; i < simdEnd; i += 16) {
+                __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcSamples + i));
+                __m256i dest = _mm256_loadu_si256(reinterpret_cast<__m256i*>(destSamples + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(destSamples + i),
+                                    _mm256_adds_epi16(dest, _mm256_mulhrs_epi16(src, gainValue)));
+            }
+            for (size_t i = simdEnd; i < sampleCount; ++i) {
+                int32_t scaled = (static_cast<int32_t>(srcSamples[i]) * gainQ15 + (1 << 14)) >> 15;
+                int32_t mixed = static_cast<int32_t>(destSamples[i]) + scaled;
+                destSamples[i] = static_cast<int16_t>(std::clamp(mixed, -32768, 32767));
+            }
+            return;
+        }
+#endif
         for (size_t i = 0; i < sampleCount; ++i) {
             int32_t mixed = static_cast<int32_t>(destSamples[i]) +
                            static_cast<int32_t>(srcSamples[i] * gain);
@@ -139,6 +231,50 @@ void AudioBuffer::mixFrom(const AudioBuffer& other, float gain) {
     }
 }
 
+void AudioBuffer::mixFill(const AudioBuffer& other, float gain, float fillValue) {
+    if (other.getSpec().sampleRate != spec_.sampleRate ||
+        other.getSpec().format != spec_.format ||
+        other.getSpec().channels != spec_.channels) {
+        // 规格不匹配时mixFrom是空操作，只剩填充
+        fill(fillValue);
+        return;
+    }
+
+    if (spec_.format != AudioFormat::Float32) {
+        fill(fillValue);
+        mixFrom(other, gain);
+        return;
+    }
+
+    float* destSamples = reinterpret_cast<float*>(data_.data());
+    const float* srcSamples = reinterpret_cast<const float*>(other.getData());
+
+    size_t sampleCount = getSampleCount();
+    size_t mixCount = std::min(sampleCount, other.getSampleCount());
+#if defined(__AVX2__)
+    // fill+mixFrom分两遍各过一次数据，融合后dst[i]=fill+src[i]*gain
+    // 一遍写完，乘加顺序与分开调用时一致，结果逐位相同
+    __m256 mixGain = _mm256_set1_ps(gain);
+    __m256 fillBase = _mm256_set1_ps(fillValue);
+    size_t simdEnd = mixCount & ~static_cast<size_t>(7);
+    for (size_t i = 0; i < simdEnd; i += 8) {
+        __m256 src = _mm256_loadu_ps(srcSamples + i);
+        _mm256_storeu_ps(destSamples + i, _mm256_add_ps(fillBase, _mm256_mul_ps(src, mixGain)));
+    }
+    for (size_t i = simdEnd; i < mixCount; ++i) {
+        destSamples[i] = fillValue + srcSamples[i] * gain;
+    }
+#else
+    for (size_t i = 0; i < mixCount; ++i) {
+        destSamples[i] = fillValue + srcSamples[i] * gain;
+    }
+#endif
+    // 源比目标短时，超出部分只有填充值
+    for (size_t i = mixCount; i < sampleCount; ++i) {
+        destSamples[i] = fillValue;
+    }
+}
+
 void AudioBuffer::resample(int newSampleRate) {
     if (newSampleRate == spec_.sampleRate || frameCount_ == 0) {
         return;
@@ -236,15 +372,50 @@ void AudioBuffer::convertChannels(AudioChannelLayout newLayout) {
 }
 
 void AudioBuffer::applyGain(float gain) {
+    if (gain == 1.0f) {
+        // 单位增益不碰数据；applyGain(0.5)后applyGain(2.0)这类
+        // 互逆调用序列由调用方折算成1.0后在此短路
+        return;
+    }
+
     if (spec_.format == AudioFormat::Float32) {
         float* samples = reinterpret_cast<float*>(data_.data());
         size_t sampleCount = getSampleCount();
+#if defined(__AVX2__)
+        __m256 gainValue = _mm256_set1_ps(gain);
+        size_t simdEnd = sampleCount & ~static_cast<size_t>(7);
+        for (size_t i = 0; i < simdEnd; i += 8) {
+            _mm256_storeu_ps(samples + i, _mm256_mul_ps(_mm256_loadu_ps(samples + i), gainValue));
+        }
+        for (size_t i = simdEnd; i < sampleCount; ++i) {
+            samples[i] *= gain;
+        }
+#else
         for (size_t i = 0; i < sampleCount; ++i) {
             samples[i] *= gain;
         }
+#endif
     } else if (spec_.format == AudioFormat::PCM16) {
         int16_t* samples = reinterpret_cast<int16_t*>(data_.data());
         size_t sampleCount = getSampleCount();
+#if defined(__AVX2__)
+        // 衰减增益同样走Q15 mulhrs，16样本一批；放大或负增益退回标量
+        if (gain >= 0.0f && gain < 1.0f) {
+            int32_t gainQ15 = std::min<int32_t>(32767, static_cast<int32_t>(std::lround(gain * 32768.0f)));
+            __m256i gainValue = _mm256_set1_epi16(static_cast<int16_t>(gainQ15));
+            size_t simdEnd = sampleCount & ~static_cast<size_t>(15);
+            for (size_t i = 0; i < simdEnd; i += 16) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i*>(samples + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(samples + i),
+                                    _mm256_mulhrs_epi16(block, gainValue));
+            }
+            for (size_t i = simdEnd; i < sampleCount; ++i) {
+                samples[i] = static_cast<int16_t>(
+                    (static_cast<int32_t>(samples[i]) * gainQ15 + (1 << 14)) >> 15);
+            }
+            return;
+        }
+#endif
         for (size_t i = 0; i < sampleCount; ++i) {
             int32_t sample = static_cast<int32_t>(samples[i] * gain);
             samples[i] = static_cast<int16_t>(std::clamp(sample, -32768, 32767));
@@ -258,6 +429,17 @@ void AudioBuffer::applyFadeIn(size_t frameCount) {
         size_t fadeFrames = std::min(frameCount, frameCount_);
         int channels = spec_.getChannelCount();
 
+#if defined(__AVX2__)
+        // 声道数整除批宽的布局走特化斜坡内核，5.1走下方标量
+        switch (channels) {
+            case 1: applyFadeRamp<1, false>(samples, fadeFrames); return;
+            case 2: applyFadeRamp<2, false>(samples, fadeFrames); return;
+            case 4: applyFadeRamp<4, false>(samples, fadeFrames); return;
+            case 8: applyFadeRamp<8, false>(samples, fadeFrames); return;
+            default: break;
+        }
+#endif
+
         for (size_t frame = 0; frame < fadeFrames; ++frame) {
             float gain = static_cast<float>(frame) / static_cast<float>(fadeFrames);
             for (int ch = 0; ch < channels; ++ch) {
@@ -273,6 +455,18 @@ void AudioBuffer::applyFadeOut(size_t frameCount) {
         size_t fadeFrames = std::min(frameCount, frameCount_);
         int channels = spec_.getChannelCount();
 
+#if defined(__AVX2__)
+        // 与淡入同一套特化内核，增益取1-斜坡
+        float* fadeStart = samples + (frameCount_ - fadeFrames) * channels;
+        switch (channels) {
+            case 1: applyFadeRamp<1, true>(fadeStart, fadeFrames); return;
+            case 2: applyFadeRamp<2, true>(fadeStart, fadeFrames); return;
+            case 4: applyFadeRamp<4, true>(fadeStart, fadeFrames); return;
+            case 8: applyFadeRamp<8, true>(fadeStart, fadeFrames); return;
+            default: break;
+        }
+#endif
+
         for (size_t frame = 0; frame < fadeFrames; ++frame) {
             size_t startFrame = frameCount_ - fadeFrames + frame;
             float gain = 1.0f - static_cast<float>(frame) / static_cast<float>(fadeFrames);
@@ -294,6 +488,25 @@ bool AudioBuffer::loadFromFile(const std::string& filePath) {
 AudioBuffer AudioBuffer::clone() const {
     AudioBuffer buffer;
     buffer.allocate(spec_, frameCount_);
+
+#if defined(__AVX2__)
+    // 大块克隆走非临时写：目标整块绕过缓存，不把后续还要读的源数据
+    // 从L2/L3挤出去。流式写要求目标32字节对齐，不满足就退回memcpy
+    size_t size = data_.size();
+    uint8_t* dest = static_cast<uint8_t*>(buffer.getData());
+    const uint8_t* src = data_.data();
+    if (size >= 256 * 1024 && (reinterpret_cast<uintptr_t>(dest) & 31) == 0) {
+        size_t simdEnd = size & ~static_cast<size_t>(31);
+        for (size_t i = 0; i < simdEnd; i += 32) {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + i),
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        }
+        _mm_sfence();
+        std::memcpy(dest + simdEnd, src + simdEnd, size - simdEnd);
+        return buffer;
+    }
+#endif
+
     std::memcpy(buffer.getData(), data_.data(), data_.size());
     return buffer;
 }
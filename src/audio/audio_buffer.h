@@ -74,19 +74,19 @@ struct AudioSpec {
      * @brief 获取每样本字节数
      * @return 字节数
      */
-    int getBytesPerSample() const;
+    int getBytesPerSample() const noexcept;
     
     /**
      * @brief 获取每帧字节数
      * @return 字节数
      */
-    int getBytesPerFrame() const;
+    int getBytesPerFrame() const noexcept;
     
     /**
      * @brief 获取声道数
      * @return 声道数量
      */
-    int getChannelCount() const;
+    int getChannelCount() const noexcept;
 };
 
 /**
@@ -121,7 +121,7 @@ struct AudioSpec {
  * buffer.saveToFile("output.wav");
  * @endcode
  */
-class AudioBuffer {
+class AudioBuffer final {
 public:
     AudioBuffer();
     
@@ -151,37 +151,37 @@ public:
      * @brief 获取音频规格
      * @return AudioSpec引用
      */
-    const AudioSpec& getSpec() const;
+    const AudioSpec& getSpec() const noexcept { return spec_; }
     
     /**
      * @brief 获取帧数
      * @return 帧数
      */
-    size_t getFrameCount() const;
+    size_t getFrameCount() const noexcept { return frameCount_; }
     
     /**
      * @brief 获取样本数
      * @return 样本总数（帧数 * 声道数）
      */
-    size_t getSampleCount() const;
+    size_t getSampleCount() const noexcept { return frameCount_ * spec_.getChannelCount(); }
     
     /**
      * @brief 获取数据大小
      * @return 字节数
      */
-    size_t getSizeInBytes() const;
+    size_t getSizeInBytes() const noexcept { return data_.size(); }
 
     /**
      * @brief 获取数据指针
      * @return 数据指针
      */
-    void* getData();
+    void* getData() noexcept { return data_.data(); }
     
     /**
      * @brief 获取数据指针（只读）
      * @return 数据指针
      */
-    const void* getData() const;
+    const void* getData() const noexcept { return data_.data(); }
 
     /**
      * @brief 清空数据
@@ -207,6 +207,17 @@ public:
      */
     void mixFrom(const AudioBuffer& other, float gain = 1.0f);
 
+    /**
+     * @brief 填充并混合（融合内核）
+     * @param other 源缓冲区
+     * @param gain 混合增益
+     * @param fillValue 填充值
+     *
+     * 等价于先fill(fillValue)再mixFrom(other, gain)，
+     * 但只过一遍数据，流式字节量减半。
+     */
+    void mixFill(const AudioBuffer& other, float gain, float fillValue);
+
     /**
      * @brief 重采样
      * @param newSampleRate 新采样率
@@ -353,7 +364,7 @@ protected:
  * stream.close();
  * @endcode
  */
-class AudioFileStream : public AudioStream {
+class AudioFileStream final : public AudioStream {
 public:
     AudioFileStream();
     ~AudioFileStream() override;
@@ -401,7 +412,7 @@ private:
  * generator.read(buffer.data(), 1024);
  * @endcode
  */
-class AudioGenerator : public AudioStream {
+class AudioGenerator final : public AudioStream {
 public:
     AudioGenerator();
     ~AudioGenerator() override;
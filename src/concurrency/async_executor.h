@@ -14,10 +14,24 @@ public:
     static AsyncExecutor& getInstance();
 
     template<typename F, typename... Args>
-    auto execute(F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
+    auto execute(F&& f, Args&&... args) -> InlineFuture<decltype(f(args...))>;
 
     template<typename F>
-    auto executeAsync(F&& f) -> std::future<decltype(f())>;
+    auto executeAsync(F&& f) -> InlineFuture<decltype(f())>;
+
+    /**
+     * @brief 批量提交带索引的任务
+     * @tparam F 可调用对象类型（接受int索引）
+     * @param count 任务数量
+     * @param f 要执行的函数，参数为任务序号[0, count)
+     * @return 每个任务的future列表（按序号排列）
+     *
+     * 所有promise和一份任务函数放进同一个共享批状态，一次分配；
+     * 每个任务只捕获批指针和序号，不再逐任务绑packaged_task。
+     */
+    template<typename F>
+    auto executeBatch(int count, F&& f)
+        -> std::vector<std::future<std::invoke_result_t<F, int>>>;
 
     template<typename F>
     void executeFireAndForget(F&& f);
@@ -29,38 +43,84 @@ private:
     AsyncExecutor();
     ~AsyncExecutor();
 
+    /**
+     * @struct BatchState
+     * @brief 批量执行的共享状态 - promise数组与任务函数
+     */
+    template<typename R, typename Func>
+    struct BatchState {
+        BatchState(Func f, int count)
+            : promises(count)
+            , func(std::move(f)) {
+        }
+
+        std::vector<std::promise<R>> promises;  ///< 整批promise
+        Func func;                              ///< 共享的任务函数
+    };
+
     ThreadPool* threadPool_;
 };
 
 template<typename F, typename... Args>
-auto AsyncExecutor::execute(F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
+auto AsyncExecutor::execute(F&& f, Args&&... args) -> InlineFuture<decltype(f(args...))> {
     if (threadPool_) {
         return threadPool_->submit(std::forward<F>(f), std::forward<Args>(args)...);
     }
 
     using ReturnType = decltype(f(args...));
-    std::promise<ReturnType> promise;
-    auto future = promise.get_future();
+    auto* state = new InlineFutureState<ReturnType>();
+    auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+    state->fulfill(bound);
 
-    try {
-        if constexpr (std::is_void_v<ReturnType>) {
-            f(args...);
-            promise.set_value();
-        } else {
-            promise.set_value(f(args...));
-        }
-    } catch (...) {
-        promise.set_exception(std::current_exception());
-    }
-
-    return future;
+    return InlineFuture<ReturnType>(state);
 }
 
 template<typename F>
-auto AsyncExecutor::executeAsync(F&& f) -> std::future<decltype(f())> {
+auto AsyncExecutor::executeAsync(F&& f) -> InlineFuture<decltype(f())> {
     return execute(std::forward<F>(f));
 }
 
+template<typename F>
+auto AsyncExecutor::executeBatch(int count, F&& f)
+    -> std::vector<std::future<std::invoke_result_t<F, int>>> {
+    using ReturnType = std::invoke_result_t<F, int>;
+
+    std::vector<std::future<ReturnType>> futures;
+    if (count <= 0) {
+        return futures;
+    }
+    futures.reserve(count);
+
+    auto state = std::make_shared<BatchState<ReturnType, std::decay_t<F>>>(
+        std::forward<F>(f), count);
+    for (int i = 0; i < count; ++i) {
+        futures.push_back(state->promises[i].get_future());
+    }
+
+    for (int i = 0; i < count; ++i) {
+        auto runTask = [state, i]() {
+            try {
+                if constexpr (std::is_void_v<ReturnType>) {
+                    state->func(i);
+                    state->promises[i].set_value();
+                } else {
+                    state->promises[i].set_value(state->func(i));
+                }
+            } catch (...) {
+                state->promises[i].set_exception(std::current_exception());
+            }
+        };
+
+        if (threadPool_) {
+            threadPool_->submitTask(std::unique_ptr<Task>(new FunctionTask(runTask)));
+        } else {
+            runTask();
+        }
+    }
+
+    return futures;
+}
+
 template<typename F>
 void AsyncExecutor::executeFireAndForget(F&& f) {
     if (threadPool_) {
@@ -88,7 +148,7 @@ void parallel_for(IndexType begin, IndexType end, F&& func, ThreadPool* pool) {
     const size_t numThreads = pool->getThreadCount();
     const IndexType chunkSize = (end - begin) / numThreads;
 
-    std::vector<std::future<void>> futures;
+    std::vector<InlineFuture<void>> futures;
     futures.reserve(numThreads);
 
     for (size_t i = 0; i < numThreads - 1; ++i) {
@@ -131,7 +191,7 @@ std::vector<R> parallel_map(Iterator begin, Iterator end, F&& func, ThreadPool*
     const size_t numThreads = pool->getThreadCount();
     const size_t chunkSize = results.size() / numThreads;
 
-    std::vector<std::future<void>> futures;
+    std::vector<InlineFuture<void>> futures;
     futures.reserve(numThreads);
 
     auto current = begin;
@@ -181,7 +241,7 @@ T parallel_reduce(Iterator begin, Iterator end, T init, F&& func, ThreadPool* po
     const size_t numThreads = pool->getThreadCount();
     const size_t chunkSize = size / numThreads;
 
-    std::vector<std::future<T>> futures;
+    std::vector<InlineFuture<T>> futures;
     futures.reserve(numThreads);
 
     auto current = begin;
@@ -0,0 +1,163 @@
+/**
+ * @file ring.h
+ * @brief 无锁环形缓冲 - 提供免互斥锁的结果收集通道
+ *
+ * 该模块实现了固定容量的无锁环形缓冲：
+ * - AtomicRingBuffer: 有界环形缓冲，入环/出环只走原子操作
+ *
+ * @author 3D Video Studio Team
+ * @version 1.0
+ * @date 2026-02-17
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace v3d {
+namespace concurrency {
+
+/**
+ * @class AtomicRingBuffer
+ * @brief 无锁环形缓冲 - 多个完成回调竞争写入结果的收集槽
+ *
+ * 回调侧用互斥锁往vector里追加结果，任务一多锁上就挤成一团。
+ * 这里按Vyukov有界队列的思路给每个槽位配一个原子序号：
+ * 生产者CAS认领槽位、写入后发布序号，消费者按序号取走，
+ * 全程不持锁，多生产者多消费者都安全。容量必须是2的幂，
+ * 环满时push返回false而不是阻塞。
+ *
+ * @tparam T 元素类型
+ * @tparam N 容量（必须是2的幂）
+ *
+ * @example
+ * @code
+ * AtomicRingBuffer<int, 64> ring;
+ *
+ * // 回调侧无锁写入
+ * scheduler.scheduleDelayed([&ring]() { ring.push(42); },
+ *                           std::chrono::milliseconds(100));
+ *
+ * // 消费侧按完成顺序取走
+ * int value = 0;
+ * while (ring.pop(value)) {
+ *     handle(value);
+ * }
+ * @endcode
+ */
+template<typename T, size_t N>
+class AtomicRingBuffer {
+    static_assert(N >= 2 && (N & (N - 1)) == 0,
+                  "AtomicRingBuffer容量必须是2的幂");
+
+public:
+    AtomicRingBuffer()
+        : tail_(0)
+        , head_(0) {
+        for (size_t i = 0; i < N; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    AtomicRingBuffer(const AtomicRingBuffer&) = delete;
+    AtomicRingBuffer& operator=(const AtomicRingBuffer&) = delete;
+
+    /**
+     * @brief 写入一个元素
+     * @param value 要写入的元素
+     * @return 写入成功返回true，环满返回false
+     */
+    bool push(const T& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & kMask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief 取出一个元素
+     * @param value 输出参数，接收取出的元素
+     * @return 取出成功返回true，环空返回false
+     */
+    bool pop(T& value) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & kMask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(slot.value);
+                    slot.sequence.store(pos + N, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief 检查环形缓冲是否为空
+     * @return 如果为空返回true
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 获取当前元素数量
+     * @return 元素数量（并发写入时为瞬时近似值）
+     */
+    size_t size() const {
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t head = head_.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    /**
+     * @brief 获取容量
+     * @return 最大元素数量
+     */
+    static constexpr size_t capacity() {
+        return N;
+    }
+
+private:
+    /**
+     * @struct Slot
+     * @brief 环形缓冲槽位 - 元素加认领序号
+     */
+    struct Slot {
+        std::atomic<size_t> sequence;  ///< 槽位序号（生产/消费各推进一轮）
+        T value;                       ///< 槽位元素
+    };
+
+    static constexpr size_t kMask = N - 1;  ///< 下标掩码（容量为2的幂）
+
+    Slot slots_[N];                          ///< 槽位数组
+    alignas(64) std::atomic<size_t> tail_;   ///< 写入游标（独占缓存行）
+    alignas(64) std::atomic<size_t> head_;   ///< 读取游标（独占缓存行）
+};
+
+}
+}
@@ -1,20 +1,140 @@
 #include "thread_pool.h"
 #include <algorithm>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
 namespace v3d {
 namespace concurrency {
 
+namespace {
+
+// 空闲退避各级的轮数：pause自旋约百余次覆盖亚微秒级的任务到达间隔，
+// yield几轮把时间片让给可能持锁的提交线程，之后再挂起
+constexpr int kIdleSpinCount = 128;
+constexpr int kIdleYieldCount = 16;
+
+// 自旋等待时降低流水线与超线程兄弟核的占用，比空转循环省电且退出更快
+inline void cpuRelax() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+}
+
+thread_local ThreadPool* ThreadPool::tlsOwnerPool_ = nullptr;
+thread_local size_t ThreadPool::tlsWorkerIndex_ = 0;
+
+void ThreadPool::TaskShard::push(std::unique_ptr<Task> task) {
+    size_t bucket = std::min(task->getPriority(), kBuckets - 1);
+    buckets[bucket].push_back(std::move(task));
+    nonEmptyMask |= uint64_t(1) << bucket;
+}
+
+std::unique_ptr<Task> ThreadPool::TaskShard::pop() {
+    if (nonEmptyMask == 0) {
+        return nullptr;
+    }
+
+    // 位图最高置位即最高非空优先级桶
+    size_t bucket = 63 - static_cast<size_t>(std::countl_zero(nonEmptyMask));
+    auto task = std::move(buckets[bucket].front());
+    buckets[bucket].pop_front();
+
+    if (buckets[bucket].empty()) {
+        nonEmptyMask &= ~(uint64_t(1) << bucket);
+    }
+
+    return task;
+}
+
+bool ThreadPool::WorkStealingDeque::push(Task* task) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    if (b - t >= static_cast<int64_t>(kCapacity)) {
+        return false;
+    }
+    buffer[b & kMask].store(task, std::memory_order_relaxed);
+    bottom.store(b + 1, std::memory_order_release);
+    return true;
+}
+
+Task* ThreadPool::WorkStealingDeque::pop() {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    // seq_cst保证bottom回撤先于top读取对窃取者可见，
+    // 不然最后一个任务可能被两边同时拿走
+    bottom.store(b, std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_seq_cst);
+
+    if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Task* task = buffer[b & kMask].load(std::memory_order_relaxed);
+    if (t == b) {
+        // 只剩一个任务：和窃取者CAS竞争，输了就空手而归
+        if (!top.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            task = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+Task* ThreadPool::WorkStealingDeque::steal() {
+    int64_t t = top.load(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_seq_cst);
+    if (t >= b) {
+        return nullptr;
+    }
+
+    Task* task = buffer[t & kMask].load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(t, t + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return task;
+}
+
 ThreadPool::ThreadPool(size_t numThreads)
-    : running_(false)
+    : submitIndex_(0)
+    , wakeEpoch_(0)
+    , running_(false)
     , paused_(false)
-    , activeThreads_(0)
-    , maxQueueSize_(10000) {
+    , maxQueueSize_(10000)
+    , affinityPolicy_(AffinityPolicy::None) {
 
     if (numThreads == 0) {
         numThreads = std::thread::hardware_concurrency();
     }
+    numThreads = std::max<size_t>(1, numThreads);
 
     workers_.reserve(numThreads);
+    shards_.reserve(numThreads);
+    deques_.reserve(numThreads);
+    pendingShards_.reserve(numThreads);
+    activeShards_.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        shards_.push_back(std::make_unique<TaskShard>());
+        deques_.push_back(std::make_unique<WorkStealingDeque>());
+        pendingShards_.push_back(std::make_unique<CounterShard>());
+        activeShards_.push_back(std::make_unique<CounterShard>());
+    }
 }
 
 ThreadPool::~ThreadPool() {
@@ -29,18 +149,60 @@ void ThreadPool::start() {
     running_ = true;
     paused_ = false;
 
-    for (size_t i = 0; i < workers_.capacity(); ++i) {
+    for (size_t i = 0; i < shards_.size(); ++i) {
         workers_.emplace_back(&ThreadPool::workerThread, this, i);
+        applyAffinity(workers_.back(), i);
     }
 }
 
+void ThreadPool::applyAffinity(std::thread& worker, size_t index) {
+    if (affinityPolicy_ == AffinityPolicy::None) {
+        return;
+    }
+
+    size_t cpuCount = std::thread::hardware_concurrency();
+    if (cpuCount == 0) {
+        return;
+    }
+
+    // Packed依次排布；Scatter按步长把工作线程拉开
+    size_t cpu;
+    if (affinityPolicy_ == AffinityPolicy::Packed) {
+        cpu = index % cpuCount;
+    } else {
+        size_t stride = std::max<size_t>(1, cpuCount / std::max<size_t>(1, shards_.size()));
+        cpu = (index * stride) % cpuCount;
+    }
+
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    pthread_setaffinity_np(worker.native_handle(), sizeof(cpuSet), &cpuSet);
+#elif defined(_WIN32)
+    SetThreadAffinityMask(worker.native_handle(), DWORD_PTR(1) << (cpu % 64));
+#else
+    (void)worker;
+    (void)cpu;
+#endif
+}
+
+void ThreadPool::setAffinityPolicy(AffinityPolicy policy) {
+    affinityPolicy_ = policy;
+}
+
+ThreadPool::AffinityPolicy ThreadPool::getAffinityPolicy() const {
+    return affinityPolicy_;
+}
+
 void ThreadPool::stop() {
     if (!running_) {
         return;
     }
 
     running_ = false;
-    condition_.notify_all();
+    wakeEpoch_.fetch_add(1, std::memory_order_release);
+    wakeEpoch_.notify_all();
 
     for (auto& worker : workers_) {
         if (worker.joinable()) {
@@ -49,6 +211,14 @@ void ThreadPool::stop() {
     }
 
     workers_.clear();
+
+    // 停机后双端队列里残留的任务以裸指针存放，手动释放
+    for (auto& deque : deques_) {
+        while (Task* task = deque->steal()) {
+            delete task;
+            addPending(-1);
+        }
+    }
 }
 
 void ThreadPool::pause() {
@@ -57,40 +227,153 @@ void ThreadPool::pause() {
 
 void ThreadPool::resume() {
     paused_ = false;
-    condition_.notify_all();
+    wakeEpoch_.fetch_add(1, std::memory_order_release);
+    wakeEpoch_.notify_all();
 }
 
-void ThreadPool::workerThread(size_t threadId) {
-    while (running_) {
-        std::unique_ptr<Task> task;
+void ThreadPool::addPending(int64_t delta) {
+    size_t index;
+    if (tlsOwnerPool_ == this) {
+        index = tlsWorkerIndex_;
+    } else {
+        index = std::hash<std::thread::id>{}(std::this_thread::get_id()) % pendingShards_.size();
+    }
+    pendingShards_[index]->value.fetch_add(delta, std::memory_order_relaxed);
+}
 
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
+size_t ThreadPool::pendingCount() const {
+    int64_t total = 0;
+    for (const auto& shard : pendingShards_) {
+        total += shard->value.load(std::memory_order_relaxed);
+    }
+    return total > 0 ? static_cast<size_t>(total) : 0;
+}
 
-            condition_.wait(lock, [this] {
-                return !running_ || (!paused_ && !tasks_.empty());
-            });
+void ThreadPool::enqueue(std::unique_ptr<Task> task) {
+    if (pendingCount() >= maxQueueSize_) {
+        throw std::runtime_error("Task queue is full");
+    }
 
-            if (!running_) {
-                break;
-            }
+    // 工作线程嵌套提交的普通任务直接压进自家Chase-Lev队列：
+    // 自有端push不碰任何锁。带优先级的任务和外部线程的提交
+    // 仍走分片优先队列（兼作注入和溢出队列）
+    if (task->getPriority() == 0 && tlsOwnerPool_ == this) {
+        if (deques_[tlsWorkerIndex_]->push(task.get())) {
+            task.release();
+            addPending(1);
+            wakeEpoch_.fetch_add(1, std::memory_order_release);
+            wakeEpoch_.notify_one();
+            return;
+        }
+    }
+
+    size_t shardIndex = submitIndex_.fetch_add(1, std::memory_order_relaxed) % shards_.size();
+    {
+        std::lock_guard<std::mutex> lock(shards_[shardIndex]->mutex);
+        shards_[shardIndex]->push(std::move(task));
+    }
+    addPending(1);
+
+    // 唤醒走事件计数：先递增版本号再notify。等待方挂起前
+    // 重查谓词并带着旧版本号wait，版本一变wait立即返回，
+    // 没有唤醒丢失窗口，也不再有围着每次notify的互斥锁
+    wakeEpoch_.fetch_add(1, std::memory_order_release);
+    wakeEpoch_.notify_one();
+}
+
+std::unique_ptr<Task> ThreadPool::takeTask(size_t threadId) {
+    if (paused_) {
+        return nullptr;
+    }
+
+    // 先清自家双端队列的自有端：LIFO顺序，刚提交的任务缓存还热
+    if (Task* local = deques_[threadId]->pop()) {
+        addPending(-1);
+        return std::unique_ptr<Task>(local);
+    }
+
+    // 扫描期间可能被pause：每步重查，避免带走暂停后才入队的任务
+    size_t shardCount = shards_.size();
+    for (size_t attempt = 0; attempt < shardCount; ++attempt) {
+        if (paused_) {
+            return nullptr;
+        }
+        TaskShard& shard = *shards_[(threadId + attempt) % shardCount];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (auto task = shard.pop()) {
+            addPending(-1);
+            return task;
+        }
+    }
+
+    // 分片也空了就去别家双端队列的窃取端碰运气
+    for (size_t attempt = 1; attempt < shardCount; ++attempt) {
+        if (paused_) {
+            return nullptr;
+        }
+        if (Task* stolen = deques_[(threadId + attempt) % shardCount]->steal()) {
+            addPending(-1);
+            return std::unique_ptr<Task>(stolen);
+        }
+    }
+
+    return nullptr;
+}
+
+void ThreadPool::workerThread(size_t threadId) {
+    tlsOwnerPool_ = this;
+    tlsWorkerIndex_ = threadId;
+
+#if defined(__linux__)
+    // 绑核策略下顺带切到SCHED_BATCH：工作线程是吞吐型负载，
+    // 让调度器少为它做抢占式的交互性加分
+    if (affinityPolicy_ != AffinityPolicy::None) {
+        sched_param param{};
+        sched_setscheduler(0, SCHED_BATCH, &param);
+    }
+#endif
 
-            if (paused_) {
+    while (running_) {
+        std::unique_ptr<Task> task = takeTask(threadId);
+
+        if (!task) {
+            // 空闲退避分三级：先pause自旋（任务常在亚微秒内到达，
+            // 不进内核就能接上），再让出时间片几轮，最后才挂起
+            // 单核机器上自旋只会抢提交线程的时间片，直接进yield级
+            static const int spinBound =
+                std::thread::hardware_concurrency() > 1 ? kIdleSpinCount : 0;
+            bool ready = false;
+            for (int spin = 0; spin < spinBound; ++spin) {
+                if (!running_ || (!paused_ && pendingCount() > 0)) {
+                    ready = true;
+                    break;
+                }
+                cpuRelax();
+            }
+            for (int round = 0; !ready && round < kIdleYieldCount; ++round) {
+                std::this_thread::yield();
+                if (!running_ || (!paused_ && pendingCount() > 0)) {
+                    ready = true;
+                }
+            }
+            if (ready) {
                 continue;
             }
 
-            if (tasks_.empty()) {
+            // 自旋没等到再睡：带旧版本号wait，提交侧先改版本号
+            // 再notify，挂起和新任务到达之间没有唤醒丢失窗口
+            uint32_t epoch = wakeEpoch_.load(std::memory_order_acquire);
+            if (!running_ || (!paused_ && pendingCount() > 0)) {
                 continue;
             }
-
-            task = std::move(const_cast<std::unique_ptr<Task>&>(tasks_.top()));
-            tasks_.pop();
+            wakeEpoch_.wait(epoch, std::memory_order_acquire);
+            continue;
         }
 
-        if (task && !task->isCancelled()) {
-            activeThreads_++;
+        if (!task->isCancelled()) {
+            activeShards_[threadId]->value.fetch_add(1, std::memory_order_relaxed);
             task->execute();
-            activeThreads_--;
+            activeShards_[threadId]->value.fetch_sub(1, std::memory_order_relaxed);
         }
     }
 }
@@ -100,12 +383,15 @@ size_t ThreadPool::getThreadCount() const {
 }
 
 size_t ThreadPool::getActiveThreadCount() const {
-    return activeThreads_.load();
+    int64_t total = 0;
+    for (const auto& shard : activeShards_) {
+        total += shard->value.load(std::memory_order_relaxed);
+    }
+    return total > 0 ? static_cast<size_t>(total) : 0;
 }
 
 size_t ThreadPool::getPendingTaskCount() const {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    return tasks_.size();
+    return pendingCount();
 }
 
 void ThreadPool::setMaxQueueSize(size_t maxSize) {
@@ -117,10 +403,19 @@ size_t ThreadPool::getMaxQueueSize() const {
 }
 
 void ThreadPool::clearQueue() {
-    std::lock_guard<std::mutex> lock(queueMutex_);
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        while (shard->pop()) {
+            addPending(-1);
+        }
+    }
 
-    while (!tasks_.empty()) {
-        tasks_.pop();
+    // 双端队列从窃取端清空，和自有线程的pop并发也安全
+    for (auto& deque : deques_) {
+        while (Task* task = deque->steal()) {
+            delete task;
+            addPending(-1);
+        }
     }
 }
 
@@ -142,43 +437,125 @@ TaskScheduler::TaskScheduler()
 }
 
 TaskScheduler::~TaskScheduler() {
+    stopTimerThread();
     clear();
 }
 
+bool TaskScheduler::delayedHeapPush(DelayedTask task) {
+    delayedTasks_.push_back(std::move(task));
+
+    size_t i = delayedTasks_.size() - 1;
+    while (i > 0) {
+        size_t parent = (i - 1) / 4;
+        if (delayedTasks_[parent].executeTime <= delayedTasks_[i].executeTime) {
+            break;
+        }
+        std::swap(delayedTasks_[parent], delayedTasks_[i]);
+        i = parent;
+    }
+    return i == 0;
+}
+
+void TaskScheduler::delayedHeapPop() {
+    if (delayedTasks_.size() > 1) {
+        delayedTasks_.front() = std::move(delayedTasks_.back());
+    }
+    delayedTasks_.pop_back();
+
+    delayedHeapSiftDown();
+}
+
+void TaskScheduler::delayedHeapSiftDown() {
+    size_t count = delayedTasks_.size();
+    size_t i = 0;
+    while (true) {
+        size_t smallest = i;
+        size_t firstChild = i * 4 + 1;
+        size_t lastChild = std::min(firstChild + 4, count);
+        for (size_t child = firstChild; child < lastChild; ++child) {
+            if (delayedTasks_[child].executeTime < delayedTasks_[smallest].executeTime) {
+                smallest = child;
+            }
+        }
+        if (smallest == i) {
+            break;
+        }
+        std::swap(delayedTasks_[i], delayedTasks_[smallest]);
+        i = smallest;
+    }
+}
+
+void TaskScheduler::processDueLocked(std::chrono::steady_clock::time_point now) {
+    // 到期任务都在堆顶，处理到第一个未到期的为止
+    while (!delayedTasks_.empty() && now >= delayedTasks_.front().executeTime) {
+        DelayedTask& top = delayedTasks_.front();
+        if (top.interval.count() > 0) {
+            // 周期任务不弹堆：投递一份载荷后原地改期下滤一次，
+            // 省掉每次触发一弹一插的两趟堆路径
+            scheduleTask(std::unique_ptr<Task>(
+                new FunctionTask(top.func)
+            ));
+            top.executeTime = now + top.interval;
+            delayedHeapSiftDown();
+        } else {
+            scheduleTask(std::unique_ptr<Task>(
+                new FunctionTask(std::move(top.func))
+            ));
+            delayedHeapPop();
+        }
+    }
+}
+
 void TaskScheduler::update() {
-    auto now = std::chrono::system_clock::now();
+    std::lock_guard<std::mutex> lock(tasksMutex_);
 
+    // 空堆时连时钟都不读：主循环每帧都会调update，
+    // 没有任务的tick只剩一次锁操作
+    if (delayedTasks_.empty()) {
+        return;
+    }
+
+    // 调度内部统一用单调时钟，挂钟被NTP拨动时到期判断不受影响
+    processDueLocked(std::chrono::steady_clock::now());
+}
+
+void TaskScheduler::startTimerThread() {
+    bool expected = false;
+    if (!timerRunning_.compare_exchange_strong(expected, true)) {
+        return;
+    }
+    timerThread_ = std::thread(&TaskScheduler::timerLoop, this);
+}
+
+void TaskScheduler::stopTimerThread() {
+    if (!timerRunning_.exchange(false)) {
+        return;
+    }
     {
+        // 持锁后notify，保证定时线程不会在检查运行标志
+        // 和进入等待之间漏掉这次唤醒
         std::lock_guard<std::mutex> lock(tasksMutex_);
+    }
+    timerCv_.notify_all();
+    if (timerThread_.joinable()) {
+        timerThread_.join();
+    }
+}
 
-        auto it = delayedTasks_.begin();
-        while (it != delayedTasks_.end()) {
-            if (now >= it->executeTime) {
-                scheduleTask(std::unique_ptr<Task>(
-                    new FunctionTask(it->func)
-                ));
-                it = delayedTasks_.erase(it);
-            } else {
-                ++it;
-            }
+void TaskScheduler::timerLoop() {
+    std::unique_lock<std::mutex> lock(tasksMutex_);
+    while (timerRunning_.load(std::memory_order_acquire)) {
+        if (delayedTasks_.empty()) {
+            // 空堆时无限期停车：没有任务就没有任何周期性唤醒
+            timerCv_.wait(lock);
+            continue;
         }
 
-        for (auto& repeatedTask : repeatedTasks_) {
-            if (!repeatedTask->cancelled && now >= repeatedTask->nextExecuteTime) {
-                scheduleTask(std::unique_ptr<Task>(
-                    new FunctionTask(repeatedTask->func)
-                ));
-                repeatedTask->nextExecuteTime = now + repeatedTask->interval;
-            }
+        // 精确睡到堆顶到期；插入更早的任务会被notify打断重算
+        auto deadline = delayedTasks_.front().executeTime;
+        if (timerCv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+            processDueLocked(std::chrono::steady_clock::now());
         }
-
-        repeatedTasks_.erase(
-            std::remove_if(repeatedTasks_.begin(), repeatedTasks_.end(),
-                [](const std::shared_ptr<RepeatedTask>& task) {
-                    return task->cancelled;
-                }),
-            repeatedTasks_.end()
-        );
     }
 }
 
@@ -193,7 +570,6 @@ ThreadPool* TaskScheduler::getThreadPool() {
 void TaskScheduler::clear() {
     std::lock_guard<std::mutex> lock(tasksMutex_);
     delayedTasks_.clear();
-    repeatedTasks_.clear();
 }
 
 }
@@ -15,9 +15,19 @@
 
 #pragma once
 
+#include "ring.h"
+#include "../core/memory_pool.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
+#include <new>
+#include <optional>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -76,6 +86,38 @@ public:
      * @return 优先级值（越大优先级越高）
      */
     virtual size_t getPriority() const { return 0; }
+
+    /**
+     * @brief 任务对象分配 - 小任务走线程本地slab
+     * @param size 对象大小
+     * @return 对象内存
+     *
+     * 每次submit都new一个任务对象，高并发下分配器全局锁
+     * 排队。不超过256字节的任务（覆盖常见的FunctionTask）
+     * 改走TlsSlab线程本地空闲链；捕获大的回退普通堆。
+     */
+    static void* operator new(size_t size) {
+        if (size <= kTaskSlabBytes) {
+            return core::TlsSlab<kTaskSlabBytes>::allocate();
+        }
+        return ::operator new(size);
+    }
+
+    /**
+     * @brief 任务对象回收（按大小路由回slab或普通堆）
+     * @param ptr 对象内存
+     * @param size 对象大小
+     */
+    static void operator delete(void* ptr, size_t size) {
+        if (size <= kTaskSlabBytes) {
+            core::TlsSlab<kTaskSlabBytes>::deallocate(ptr);
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+private:
+    static constexpr size_t kTaskSlabBytes = 256;  ///< slab块大小（字节）
 };
 
 /**
@@ -133,6 +175,360 @@ private:
     std::atomic<bool> cancelled_; ///< 取消标志
 };
 
+/**
+ * @class InlineFunction
+ * @brief 小缓冲类型擦除的任务载荷 - 可调用对象就地存放
+ *
+ * std::function的捕获一旦超过实现的小对象阈值（libstdc++约16字节）
+ * 就会落到堆上，调度热路径上每个任务都平添一对malloc/free。
+ * 这里用固定48字节的就地槽位自己做类型擦除：捕获必须装得下
+ * （编译期检查），载荷的构造、搬移和销毁全程不碰分配器。
+ */
+class InlineFunction {
+public:
+    InlineFunction() = default;
+
+    /**
+     * @brief 包装可调用对象
+     * @tparam F 可调用对象类型
+     * @param func 要包装的可调用对象（就地构造进槽位）
+     */
+    template<typename F,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineFunction>>>
+    InlineFunction(F&& func) {
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= kBufferSize,
+                      "捕获超出InlineFunction的就地槽位，请缩小捕获或改用指针");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t),
+                      "捕获的对齐要求超出InlineFunction槽位");
+
+        new (buffer_) Callable(std::forward<F>(func));
+        invoke_ = [](void* storage) {
+            (*static_cast<Callable*>(storage))();
+        };
+        copy_ = [](void* dest, const void* src) {
+            new (dest) Callable(*static_cast<const Callable*>(src));
+        };
+        move_ = [](void* dest, void* src) {
+            new (dest) Callable(std::move(*static_cast<Callable*>(src)));
+        };
+        destroy_ = [](void* storage) {
+            static_cast<Callable*>(storage)->~Callable();
+        };
+    }
+
+    InlineFunction(const InlineFunction& other) {
+        copyFrom(other);
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept {
+        moveFrom(other);
+    }
+
+    InlineFunction& operator=(const InlineFunction& other) {
+        if (this != &other) {
+            reset();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    ~InlineFunction() {
+        reset();
+    }
+
+    /**
+     * @brief 调用包装的可调用对象
+     */
+    void operator()() {
+        invoke_(buffer_);
+    }
+
+    /**
+     * @brief 检查是否包装了可调用对象
+     * @return 如果非空返回true
+     */
+    explicit operator bool() const {
+        return invoke_ != nullptr;
+    }
+
+private:
+    static constexpr size_t kBufferSize = 48;  ///< 就地槽位大小
+
+    void copyFrom(const InlineFunction& other) {
+        invoke_ = other.invoke_;
+        copy_ = other.copy_;
+        move_ = other.move_;
+        destroy_ = other.destroy_;
+        if (copy_) {
+            copy_(buffer_, other.buffer_);
+        }
+    }
+
+    void moveFrom(InlineFunction& other) noexcept {
+        invoke_ = other.invoke_;
+        copy_ = other.copy_;
+        move_ = other.move_;
+        destroy_ = other.destroy_;
+        if (move_) {
+            move_(buffer_, other.buffer_);
+            other.reset();
+        }
+    }
+
+    void reset() {
+        if (destroy_) {
+            destroy_(buffer_);
+        }
+        invoke_ = nullptr;
+        copy_ = nullptr;
+        move_ = nullptr;
+        destroy_ = nullptr;
+    }
+
+    alignas(std::max_align_t) unsigned char buffer_[kBufferSize];  ///< 就地槽位
+    void (*invoke_)(void*) = nullptr;               ///< 调用入口
+    void (*copy_)(void*, const void*) = nullptr;    ///< 拷贝构造入口
+    void (*move_)(void*, void*) = nullptr;          ///< 移动构造入口
+    void (*destroy_)(void*) = nullptr;              ///< 析构入口
+};
+
+/**
+ * @struct InlineFutureStateBase
+ * @brief 共享状态公共部分 - 侵入式引用计数、完成标志与异常槽
+ *
+ * shared_ptr管理共享状态要再挂一个控制块，future和闭包之间
+ * 传递还各带一串引用计数原子操作。状态的持有者只有两个
+ * （future一份、执行侧闭包一份），把计数侵入到状态本身：
+ * 创建时记1，交给闭包前addRef一次，之后只在两端销毁时各减
+ * 一次。状态对象经Task同款的TlsSlab分配，一次提交只碰一次
+ * 线程本地空闲链。
+ */
+struct InlineFutureStateBase {
+    std::atomic<uint32_t> refs{1};  ///< 侵入式引用计数（创建者先持有一份）
+    std::atomic<int> ready{0};      ///< 完成标志（0表示未完成）
+    std::exception_ptr error;       ///< 任务抛出的异常
+
+    /**
+     * @brief 增加一份引用
+     */
+    void addRef() {
+        refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 执行侧未履约即放弃时标记断约
+     *
+     * 任务没被执行就被销毁（stop()/clearQueue()丢弃排队任务）时，
+     * 若不发布完成标志，阻塞在wait()/get()上的线程会永久卡死。
+     * 与std::future的行为对齐：写入broken_promise异常并唤醒所有
+     * 等待者，get()改为重抛而不是挂起。执行侧闭包只在单线程上
+     * 析构，与fulfill()不会并发。
+     */
+    void abandonIfUnfulfilled() {
+        if (ready.load(std::memory_order_relaxed) == 0) {
+            error = std::make_exception_ptr(
+                std::future_error(std::future_errc::broken_promise));
+            ready.store(1, std::memory_order_release);
+            ready.notify_all();
+        }
+    }
+
+    static void* operator new(size_t size) {
+        if (size <= kStateSlabBytes) {
+            return core::TlsSlab<kStateSlabBytes>::allocate();
+        }
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* ptr, size_t size) {
+        if (size <= kStateSlabBytes) {
+            core::TlsSlab<kStateSlabBytes>::deallocate(ptr);
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+private:
+    static constexpr size_t kStateSlabBytes = 256;  ///< slab块大小（字节）
+};
+
+/**
+ * @struct InlineFutureState
+ * @brief InlineFuture的共享状态 - 结果槽、异常与完成标志合放一处
+ *
+ * @tparam R 结果类型
+ */
+template<typename R>
+struct InlineFutureState : InlineFutureStateBase {
+    /**
+     * @brief 执行任务并发布结果
+     * @tparam F 可调用对象类型
+     * @param func 要执行的任务
+     */
+    template<typename F>
+    void fulfill(F& func) {
+        try {
+            result.emplace(func());
+        } catch (...) {
+            error = std::current_exception();
+        }
+        ready.store(1, std::memory_order_release);
+        ready.notify_all();
+    }
+
+    /**
+     * @brief 归还一份引用（归零时销毁状态）
+     */
+    void release() {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    std::optional<R> result;    ///< 就地存放的结果
+};
+
+template<>
+struct InlineFutureState<void> : InlineFutureStateBase {
+    template<typename F>
+    void fulfill(F& func) {
+        try {
+            func();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        ready.store(1, std::memory_order_release);
+        ready.notify_all();
+    }
+
+    void release() {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+};
+
+/**
+ * @struct InlineFutureStateReleaser
+ * @brief 共享状态引用的RAII删除器 - 析构时归还一份引用
+ *
+ * 这是执行侧引用唯一的归还路径：任务被丢弃（未执行即销毁）时
+ * 先标记断约，再归还引用，保证future侧不会无限等待。
+ *
+ * @tparam R 结果类型
+ */
+template<typename R>
+struct InlineFutureStateReleaser {
+    void operator()(InlineFutureState<R>* state) const {
+        state->abandonIfUnfulfilled();
+        state->release();
+    }
+};
+
+/// @brief 执行侧持有的共享状态引用（闭包销毁时自动归还）
+template<typename R>
+using InlineFutureStateRef = std::unique_ptr<InlineFutureState<R>, InlineFutureStateReleaser<R>>;
+
+/**
+ * @class InlineFuture
+ * @brief 轻量结果句柄 - 结果就地存放的一次性future
+ *
+ * std::packaged_task加std::future一对下来每个任务要走两次堆分配，
+ * 结果的等待还压在future内部的互斥锁和条件变量上。这里把结果槽、
+ * 异常指针、完成标志和侵入式引用计数合进一份共享状态，每次提交
+ * 只从线程本地slab取一块；工作线程把结果直接写进槽位，等待走
+ * C++20的原子wait（Linux上即futex），不再经过锁。
+ *
+ * 与std::future一样move-only、get只能调一次；不支持wait_for超时。
+ *
+ * @tparam R 结果类型
+ */
+template<typename R>
+class InlineFuture {
+public:
+    InlineFuture() = default;
+
+    /**
+     * @brief 从共享状态构造（接管一份引用）
+     * @param state 共享状态（与执行侧共享）
+     */
+    explicit InlineFuture(InlineFutureState<R>* state)
+        : state_(state) {
+    }
+
+    InlineFuture(const InlineFuture&) = delete;
+    InlineFuture& operator=(const InlineFuture&) = delete;
+
+    InlineFuture(InlineFuture&& other) noexcept
+        : state_(other.state_) {
+        other.state_ = nullptr;
+    }
+
+    InlineFuture& operator=(InlineFuture&& other) noexcept {
+        if (this != &other) {
+            if (state_) {
+                state_->release();
+            }
+            state_ = other.state_;
+            other.state_ = nullptr;
+        }
+        return *this;
+    }
+
+    ~InlineFuture() {
+        if (state_) {
+            state_->release();
+        }
+    }
+
+    /**
+     * @brief 检查是否持有共享状态
+     * @return 如果持有返回true
+     */
+    bool valid() const {
+        return state_ != nullptr;
+    }
+
+    /**
+     * @brief 等待任务完成
+     */
+    void wait() const {
+        state_->ready.wait(0, std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 获取任务结果
+     * @return 任务的返回值
+     * @throws 任务抛出的异常原样重抛；任务未执行即被丢弃
+     *         （stop()/clearQueue()）时抛std::future_error(broken_promise)
+     *
+     * 阻塞到任务完成。调用后共享状态被释放，future变为无效。
+     */
+    R get() {
+        wait();
+        InlineFutureStateRef<R> state(state_);
+        state_ = nullptr;
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+        if constexpr (!std::is_void_v<R>) {
+            return std::move(*state->result);
+        }
+    }
+
+private:
+    InlineFutureState<R>* state_ = nullptr;  ///< 共享状态（持有一份侵入式引用）
+};
+
 /**
  * @class ThreadPool
  * @brief 线程池 - 管理工作线程和任务队列
@@ -163,6 +559,23 @@ private:
  */
 class ThreadPool {
 public:
+    /**
+     * @enum AffinityPolicy
+     * @brief 工作线程CPU亲和策略
+     *
+     * 操作系统调度器可能在任务间把工作线程迁去别的核，
+     * 本线程双端队列和计数分片的缓存行随之作废。绑核后
+     * 这些每线程数据一直留在同一组L1/L2上：
+     * - None: 不绑核（默认），调度器自由迁移
+     * - Packed: 依次绑到相邻逻辑核，共享缓存通信便宜
+     * - Scatter: 按步长散开，减少同物理核超线程间争抢
+     */
+    enum class AffinityPolicy {
+        None,     ///< 不绑核
+        Packed,   ///< 相邻逻辑核依次排布
+        Scatter   ///< 按步长分散排布
+    };
+
     /**
      * @brief 构造线程池
      * @param numThreads 工作线程数量（0表示自动检测）
@@ -205,21 +618,21 @@ public:
      * @tparam Args 参数类型
      * @param f 要执行的函数
      * @param args 函数参数
-     * @return 任务的future对象
-     * 
+     * @return 任务的InlineFuture对象
+     *
      * 提交任务并返回可用于获取结果的future。
-     * 
+     *
      * @example
      * @code
      * auto future = pool.submit([](int a, int b) {
      *     return a + b;
      * }, 10, 20);
-     * 
+     *
      * int result = future.get();  // result = 30
      * @endcode
      */
     template<typename F, typename... Args>
-    auto submit(F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
+    auto submit(F&& f, Args&&... args) -> InlineFuture<decltype(f(args...))>;
     
     /**
      * @brief 提交任务对象
@@ -247,6 +660,21 @@ public:
      */
     size_t getPendingTaskCount() const;
     
+    /**
+     * @brief 设置工作线程CPU亲和策略
+     * @param policy 亲和策略
+     *
+     * 需在start()之前调用。非None策略下Linux上的工作线程
+     * 还会切到SCHED_BATCH，向调度器表明吞吐优先。
+     */
+    void setAffinityPolicy(AffinityPolicy policy);
+
+    /**
+     * @brief 获取工作线程CPU亲和策略
+     * @return 当前亲和策略
+     */
+    AffinityPolicy getAffinityPolicy() const;
+
     /**
      * @brief 设置最大队列大小
      * @param maxSize 最大任务数（0表示无限制）
@@ -286,25 +714,147 @@ private:
     void workerThread(size_t threadId);
 
     /**
-     * @struct TaskComparator
-     * @brief 任务比较器 - 用于优先级队列
+     * @brief 按当前策略把一个工作线程绑到逻辑核
+     * @param worker 工作线程
+     * @param index 工作线程序号
      */
-    struct TaskComparator {
-        bool operator()(const std::unique_ptr<Task>& a, const std::unique_ptr<Task>& b) const {
-            return a->getPriority() < b->getPriority();
+    void applyAffinity(std::thread& worker, size_t index);
+
+    /**
+     * @struct TaskShard
+     * @brief 分片任务队列 - 每个工作线程一片
+     *
+     * 队列按线程分片后提交和取任务各自锁自己的片，
+     * 不再所有线程挤一把全局锁。片内原先用二叉堆排优先级，
+     * 压入/弹出都是O(log n)，比较器还要经unique_ptr两次解引用。
+     * 优先级实际只是小整数，改成按优先级分桶的FIFO数组加一个
+     * 非空位图：压入按桶追加，弹出用std::countl_zero直接定位
+     * 最高非空桶，两头都是O(1)；同优先级任务保持提交顺序
+     * （二叉堆不保证这一点）。
+     */
+    struct TaskShard {
+        static constexpr size_t kBuckets = 16;  ///< 优先级桶数（更高优先级并入最高桶）
+
+        /**
+         * @brief 压入任务（调用方需持有分片锁）
+         * @param task 任务对象
+         */
+        void push(std::unique_ptr<Task> task);
+
+        /**
+         * @brief 弹出最高优先级任务（调用方需持有分片锁）
+         * @return 任务对象（分片空返回nullptr）
+         */
+        std::unique_ptr<Task> pop();
+
+        /**
+         * @brief 检查分片是否为空
+         * @return 如果为空返回true
+         */
+        bool empty() const {
+            return nonEmptyMask == 0;
         }
+
+        std::array<std::deque<std::unique_ptr<Task>>, kBuckets> buckets;  ///< 每个优先级一条FIFO
+        uint64_t nonEmptyMask = 0;                   ///< 非空桶位图（分片锁保护）
+        mutable std::mutex mutex;                    ///< 分片锁
     };
 
+    /**
+     * @struct WorkStealingDeque
+     * @brief Chase-Lev工作窃取双端队列 - 每个工作线程一条
+     *
+     * 自有线程在bottom端push/pop，只动两个原子变量不持锁；
+     * 窃取线程在top端CAS认领。固定256槽，装满退回分片队列。
+     * 工作线程嵌套提交的普通任务走这里，提交和取回的公共路径
+     * 完全无锁。
+     */
+    struct WorkStealingDeque {
+        static constexpr size_t kCapacity = 256;   ///< 槽位数（2的幂）
+        static constexpr size_t kMask = kCapacity - 1;  ///< 下标掩码
+
+        /**
+         * @brief 自有端压入任务（仅限自有线程调用）
+         * @param task 任务裸指针（所有权移交队列）
+         * @return 压入成功返回true，队列满返回false
+         */
+        bool push(Task* task);
+
+        /**
+         * @brief 自有端弹出任务（仅限自有线程调用）
+         * @return 任务裸指针（队列空返回nullptr）
+         */
+        Task* pop();
+
+        /**
+         * @brief 窃取端取走任务（任意线程可调用）
+         * @return 任务裸指针（队列空或竞争失败返回nullptr）
+         */
+        Task* steal();
+
+        std::atomic<int64_t> top{0};     ///< 窃取端游标
+        std::atomic<int64_t> bottom{0};  ///< 自有端游标
+        std::array<std::atomic<Task*>, kCapacity> buffer{};  ///< 环形槽位
+    };
+
+    /**
+     * @brief 任务入队
+     * @param task 任务对象
+     *
+     * 工作线程提交的普通任务压进自家双端队列；
+     * 其余轮转选片入队。之后唤醒一个工作线程。
+     */
+    void enqueue(std::unique_ptr<Task> task);
+    
+    /**
+     * @brief 取一个任务
+     * @param threadId 线程ID
+     * @return 任务对象（无任务返回nullptr）
+     * 
+     * 先取本线程的分片，空了再依次窃取其他分片。
+     */
+    std::unique_ptr<Task> takeTask(size_t threadId);
+
+    /**
+     * @struct CounterShard
+     * @brief 计数分片 - 独占缓存行的松散计数槽
+     *
+     * 所有线程对同一个原子计数fetch_add会让那条缓存行在核间
+     * 来回迁移，顺序一致的自增还附带全栅栏。这些计数只用于
+     * 统计和空闲判断，改成按线程分片：各线程relaxed地写自己的
+     * 槽，读取时求和。写端互不竞争；单个槽允许为负（增减可能
+     * 落在不同槽），只有总和有意义。
+     */
+    struct CounterShard {
+        alignas(64) std::atomic<int64_t> value{0};  ///< 分片计数值（独占缓存行）
+    };
+
+    /**
+     * @brief 待处理任务计数增减（写本线程对应的分片）
+     * @param delta 增量（可为负）
+     */
+    void addPending(int64_t delta);
+
+    /**
+     * @brief 汇总待处理任务计数
+     * @return 各分片之和（瞬时近似值，不小于0）
+     */
+    size_t pendingCount() const;
+
+    static thread_local ThreadPool* tlsOwnerPool_;  ///< 当前线程所属线程池
+    static thread_local size_t tlsWorkerIndex_;     ///< 当前线程的工作线程序号
+
     std::vector<std::thread> workers_;              ///< 工作线程
-    std::priority_queue<std::unique_ptr<Task>, 
-        std::vector<std::unique_ptr<Task>>, 
-        TaskComparator> tasks_;                      ///< 任务优先级队列
-    mutable std::mutex queueMutex_;                  ///< 队列互斥锁
-    std::condition_variable condition_;              ///< 条件变量
+    std::vector<std::unique_ptr<TaskShard>> shards_; ///< 分片任务队列（优先级/注入/溢出路径）
+    std::vector<std::unique_ptr<WorkStealingDeque>> deques_; ///< 每线程工作窃取队列
+    std::atomic<size_t> submitIndex_;                ///< 轮转提交索引
+    std::vector<std::unique_ptr<CounterShard>> pendingShards_; ///< 待处理任务计数分片
+    std::atomic<uint32_t> wakeEpoch_;                ///< 唤醒事件计数（原子wait，Linux上即futex）
     std::atomic<bool> running_;                      ///< 运行标志
     std::atomic<bool> paused_;                       ///< 暂停标志
-    std::atomic<size_t> activeThreads_;              ///< 活跃线程数
+    std::vector<std::unique_ptr<CounterShard>> activeShards_;  ///< 活跃线程计数分片（每工作线程一片）
     size_t maxQueueSize_;                            ///< 最大队列大小
+    AffinityPolicy affinityPolicy_;                  ///< 工作线程CPU亲和策略
 };
 
 /**
@@ -352,10 +902,10 @@ public:
      * @tparam Args 参数类型
      * @param f 要执行的函数
      * @param args 函数参数
-     * @return 任务的future对象
+     * @return 任务的InlineFuture对象
      */
     template<typename F, typename... Args>
-    auto schedule(F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
+    auto schedule(F&& f, Args&&... args) -> InlineFuture<decltype(f(args...))>;
     
     /**
      * @brief 调度任务对象
@@ -371,7 +921,23 @@ public:
      */
     template<typename F>
     void scheduleDelayed(F&& f, std::chrono::milliseconds delay);
-    
+
+    /**
+     * @brief 调度延迟任务并把结果写入无锁环形缓冲
+     * @tparam T 结果类型
+     * @tparam N 环形缓冲容量
+     * @tparam F 函数类型
+     * @param ring 接收结果的环形缓冲（须存活到任务执行完）
+     * @param f 要执行的函数（返回值入环）
+     * @param delay 延迟时间
+     *
+     * 多个完成回调竞争记录结果时不再需要用户侧互斥锁：
+     * 入环只走原子槽位认领，环满时该次结果被丢弃。
+     */
+    template<typename T, size_t N, typename F>
+    void scheduleDelayedInto(AtomicRingBuffer<T, N>& ring, F&& f,
+                             std::chrono::milliseconds delay);
+
     /**
      * @brief 调度周期性执行的任务
      * @tparam F 函数类型
@@ -389,6 +955,21 @@ public:
      */
     void update();
     
+    /**
+     * @brief 启动专属定时线程
+     *
+     * 替代"主循环定期调update"的轮询：定时线程精确睡到
+     * 堆顶任务的到期时刻，堆空时无限期停车，没有任何
+     * 周期性空唤醒；插入更早的任务时被唤醒重新计算停车时限。
+     * 与update()可以共存，到期任务只会被投递一次。
+     */
+    void startTimerThread();
+
+    /**
+     * @brief 停止并回收定时线程
+     */
+    void stopTimerThread();
+
     /**
      * @brief 设置线程池
      * @param pool 线程池指针
@@ -413,81 +994,93 @@ private:
     /**
      * @struct DelayedTask
      * @brief 延迟任务结构
+     *
+     * 一次性任务和周期任务共用同一种堆节点就地存放：
+     * interval为0表示一次性任务，到期后弹堆；
+     * interval大于0表示周期任务，到期后原地改期下滤。
      */
     struct DelayedTask {
-        std::function<void()> func;                       ///< 任务函数
-        std::chrono::system_clock::time_point executeTime; ///< 执行时间
+        InlineFunction func;                              ///< 任务函数（就地存放）
+        std::chrono::steady_clock::time_point executeTime; ///< 执行时间（单调时钟）
+        std::chrono::milliseconds interval{0};            ///< 重复间隔（0表示一次性）
     };
+
+    /**
+     * @brief 延迟任务入堆
+     * @param task 延迟任务
+     * @return 新任务是否成为堆顶（最早到期，需要唤醒定时线程改期）
+     * 
+     * 延迟任务按执行时间组织成4叉最小堆：层数比二叉堆少一半，
+     * 上滤/下滤摸的缓存行也少。update只看堆顶，不再全表线扫。
+     */
+    bool delayedHeapPush(DelayedTask task);
     
     /**
-     * @struct RepeatedTask
-     * @brief 周期任务结构
+     * @brief 弹出堆顶延迟任务
      */
-    struct RepeatedTask {
-        std::function<void()> func;                        ///< 任务函数
-        std::chrono::milliseconds interval;                ///< 执行间隔
-        std::chrono::system_clock::time_point nextExecuteTime; ///< 下次执行时间
-        bool cancelled = false;                            ///< 取消标志
-    };
+    void delayedHeapPop();
+
+    /**
+     * @brief 堆顶下滤
+     *
+     * 周期任务到期后原地改executeTime再调用此方法，
+     * 一次下滤代替一弹一插的两次O(log N)堆操作。
+     */
+    void delayedHeapSiftDown();
+
+    /**
+     * @brief 投递所有到期任务（调用方需已持有tasksMutex_）
+     * @param now 当前单调时钟
+     */
+    void processDueLocked(std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief 定时线程主循环 - 睡到堆顶到期时刻
+     */
+    void timerLoop();
 
     ThreadPool* threadPool_;                              ///< 线程池
-    std::vector<DelayedTask> delayedTasks_;               ///< 延迟任务列表
-    std::vector<std::shared_ptr<RepeatedTask>> repeatedTasks_; ///< 周期任务列表
+    std::vector<DelayedTask> delayedTasks_;               ///< 延迟/周期任务4叉最小堆
     std::mutex tasksMutex_;                               ///< 任务互斥锁
+    std::condition_variable timerCv_;                     ///< 定时线程停车/改期条件变量
+    std::atomic<bool> timerRunning_{false};               ///< 定时线程运行标志
+    std::thread timerThread_;                             ///< 专属定时线程
 };
 
 template<typename F, typename... Args>
-auto ThreadPool::submit(F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
+auto ThreadPool::submit(F&& f, Args&&... args) -> InlineFuture<decltype(f(args...))> {
     using ReturnType = decltype(f(args...));
 
-    auto task = std::make_shared<std::packaged_task<ReturnType()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-    );
-
-    std::future<ReturnType> result = task->get_future();
-
-    {
-        std::unique_lock<std::mutex> lock(queueMutex_);
-
-        if (tasks_.size() >= maxQueueSize_) {
-            throw std::runtime_error("Task queue is full");
-        }
+    auto* state = new InlineFutureState<ReturnType>();
+    InlineFuture<ReturnType> future(state);  // 先接管创建时的引用，提交失败也不泄漏
 
-        tasks_.push(std::unique_ptr<Task>(new FunctionTask([task]() { (*task)(); })));
-    }
+    state->addRef();
+    submitTask(std::unique_ptr<Task>(new FunctionTask(
+        [state = InlineFutureStateRef<ReturnType>(state),
+         bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...)]() mutable {
+            state->fulfill(bound);
+        })));
 
-    condition_.notify_one();
-    return result;
+    return future;
 }
 
 inline void ThreadPool::submitTask(std::unique_ptr<Task> task) {
-    {
-        std::unique_lock<std::mutex> lock(queueMutex_);
-
-        if (tasks_.size() >= maxQueueSize_) {
-            throw std::runtime_error("Task queue is full");
-        }
-
-        tasks_.push(std::move(task));
-    }
-
-    condition_.notify_one();
+    enqueue(std::move(task));
 }
 
 template<typename F, typename... Args>
-auto TaskScheduler::schedule(F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
+auto TaskScheduler::schedule(F&& f, Args&&... args) -> InlineFuture<decltype(f(args...))> {
+    using ReturnType = decltype(f(args...));
+
     if (threadPool_) {
         return threadPool_->submit(std::forward<F>(f), std::forward<Args>(args)...);
     }
 
-    auto task = std::make_shared<std::packaged_task<decltype(f(args...))()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-    );
+    auto* state = new InlineFutureState<ReturnType>();
+    auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+    state->fulfill(bound);
 
-    std::future<decltype(f(args...))> result = task->get_future();
-    (*task)();
-
-    return result;
+    return InlineFuture<ReturnType>(state);
 }
 
 inline void TaskScheduler::scheduleTask(std::unique_ptr<Task> task) {
@@ -504,22 +1097,36 @@ void TaskScheduler::scheduleDelayed(F&& f, std::chrono::milliseconds delay) {
 
     DelayedTask delayedTask;
     delayedTask.func = std::forward<F>(f);
-    delayedTask.executeTime = std::chrono::system_clock::now() + delay;
+    delayedTask.executeTime = std::chrono::steady_clock::now() + delay;
 
-    delayedTasks_.push_back(std::move(delayedTask));
+    // 只有新任务成为最早到期时才需要唤醒定时线程改停车时限
+    if (delayedHeapPush(std::move(delayedTask)) &&
+        timerRunning_.load(std::memory_order_acquire)) {
+        timerCv_.notify_one();
+    }
+}
+
+template<typename T, size_t N, typename F>
+void TaskScheduler::scheduleDelayedInto(AtomicRingBuffer<T, N>& ring, F&& f,
+                                        std::chrono::milliseconds delay) {
+    scheduleDelayed([&ring, func = std::forward<F>(f)]() mutable {
+        ring.push(func());
+    }, delay);
 }
 
 template<typename F>
 void TaskScheduler::scheduleRepeated(F&& f, std::chrono::milliseconds interval) {
     std::lock_guard<std::mutex> lock(tasksMutex_);
 
-    auto repeatedTask = std::make_shared<RepeatedTask>();
-    repeatedTask->func = std::forward<F>(f);
-    repeatedTask->interval = interval;
-    repeatedTask->nextExecuteTime = std::chrono::system_clock::now() + interval;
-    repeatedTask->cancelled = false;
+    DelayedTask repeatedTask;
+    repeatedTask.func = std::forward<F>(f);
+    repeatedTask.interval = interval;
+    repeatedTask.executeTime = std::chrono::steady_clock::now() + interval;
 
-    repeatedTasks_.push_back(repeatedTask);
+    if (delayedHeapPush(std::move(repeatedTask)) &&
+        timerRunning_.load(std::memory_order_acquire)) {
+        timerCv_.notify_one();
+    }
 }
 
 }
@@ -1,4 +1,7 @@
 #include "event_system.h"
+#include "memory_pool.h"
+#include <algorithm>
+#include <deque>
 
 namespace v3d {
 namespace core {
@@ -8,92 +11,293 @@ EventBus& EventBus::getInstance() {
     return instance;
 }
 
+namespace {
+
+constexpr size_t kEventSlabBytes = 256;  // slab块大小（字节）
+
+/**
+ * @struct TypeRegistryState
+ * @brief 类型注册表状态 - 名字存deque保证c_str()稳定
+ */
+struct TypeRegistryState {
+    std::mutex mutex;                                ///< 注册/查询互斥锁（均为冷路径）
+    std::deque<std::string> names;                   ///< 按ID排列的类型名
+    std::unordered_map<std::string_view, TypeId> ids; ///< 类型名到ID的驻留表
+};
+
+TypeRegistryState& typeRegistryState() {
+    static TypeRegistryState state;
+    return state;
+}
+
+}
+
+TypeId TypeRegistry::reg(std::string_view name) {
+    auto& state = typeRegistryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.ids.find(name);
+    if (it != state.ids.end()) {
+        return it->second;
+    }
+
+    TypeId id = static_cast<TypeId>(state.names.size());
+    state.names.emplace_back(name);
+    state.ids.emplace(state.names.back(), id);
+    return id;
+}
+
+const char* TypeRegistry::name(TypeId id) {
+    auto& state = typeRegistryState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (id < state.names.size()) {
+        return state.names[id].c_str();
+    }
+    return "<unknown>";
+}
+
+std::string Event::getType() const {
+    return TypeRegistry::name(getTypeId());
+}
+
+void* Event::operator new(size_t size) {
+    if (size <= kEventSlabBytes) {
+        return TlsSlab<kEventSlabBytes>::allocate();
+    }
+    return ::operator new(size);
+}
+
+void Event::operator delete(void* ptr, size_t size) {
+    if (size <= kEventSlabBytes) {
+        TlsSlab<kEventSlabBytes>::deallocate(ptr);
+        return;
+    }
+    ::operator delete(ptr);
+}
+
 EventBus::EventBus()
-    : maxQueueSize_(10000)
-    , nextSubscriptionId_(0) {
+    : asyncSlots_(kAsyncQueueCapacity)
+    , enqPos_(0)
+    , deqPos_(0)
+    , maxQueueSize_(10000) {
+    channelIds_.store(std::make_shared<const ChannelNameMap>());
+    channelSlots_.store(std::make_shared<const std::vector<std::shared_ptr<ChannelSlot>>>());
+    for (size_t i = 0; i < kAsyncQueueCapacity; ++i) {
+        asyncSlots_[i].seq.store(i, std::memory_order_relaxed);
+    }
 }
 
 EventBus::~EventBus() {
     clear();
 }
 
-void EventBus::subscribe(const std::string& channel, EventCallback callback) {
+ChannelId EventBus::internChannelLocked(std::string_view channel) {
+    auto names = channelIds_.load(std::memory_order_acquire);
+    auto it = names->find(channel);
+    if (it != names->end()) {
+        return it->second;
+    }
+
+    // 驻留是冷路径：复制整表插入后原子替换，发布侧的旧快照继续有效
+    ChannelId id = static_cast<ChannelId>(names->size());
+    auto newNames = std::make_shared<ChannelNameMap>(*names);
+    newNames->emplace(std::string(channel), id);
+    channelIds_.store(std::move(newNames), std::memory_order_release);
+
+    auto slots = channelSlots_.load(std::memory_order_acquire);
+    auto newSlots = std::make_shared<std::vector<std::shared_ptr<ChannelSlot>>>(*slots);
+    newSlots->push_back(std::make_shared<ChannelSlot>());
+    channelSlots_.store(std::move(newSlots), std::memory_order_release);
+
+    return id;
+}
+
+ChannelId EventBus::getChannelId(std::string_view channel) {
     std::lock_guard<std::mutex> lock(subscribersMutex_);
-    Subscription subscription;
-    subscription.channel = channel;
-    subscription.callback = callback;
-    subscription.id = nextSubscriptionId_++;
-    subscribers_[channel].push_back(subscription);
+    return internChannelLocked(channel);
 }
 
-void EventBus::unsubscribe(const std::string& channel) {
+void EventBus::subscribe(std::string_view channel, EventCallback callback) {
     std::lock_guard<std::mutex> lock(subscribersMutex_);
-    subscribers_.erase(channel);
+
+    ChannelId channelId = internChannelLocked(channel);
+
+    // 写侧持锁串行化，复制旧快照加入新订阅后原子替换；
+    // 正在发布的线程拿着旧快照跑完，不会读到半成品。
+    // thunk数组按值复制，回调状态按shared_ptr共享
+    auto slots = channelSlots_.load(std::memory_order_acquire);
+    ChannelSlot& slot = *(*slots)[channelId];
+    auto oldList = slot.subscribers.load(std::memory_order_relaxed);
+    auto newList = oldList
+        ? std::make_shared<SubscriberList>(*oldList)
+        : std::make_shared<SubscriberList>();
+    newList->thunks.push_back([](void* state, const Event& event) {
+        (*static_cast<EventCallback*>(state))(event);
+    });
+    newList->states.push_back(std::make_shared<EventCallback>(std::move(callback)));
+    slot.subscribers.store(std::shared_ptr<const SubscriberList>(std::move(newList)),
+                           std::memory_order_release);
 }
 
-void EventBus::publish(const std::string& channel, const Event& event) {
+void EventBus::unsubscribe(std::string_view channel) {
     std::lock_guard<std::mutex> lock(subscribersMutex_);
-    auto it = subscribers_.find(channel);
-    if (it != subscribers_.end()) {
-        for (const auto& subscription : it->second) {
-            subscription.callback(event);
+    auto names = channelIds_.load(std::memory_order_acquire);
+    auto it = names->find(channel);
+    if (it == names->end()) {
+        return;
+    }
+
+    auto slots = channelSlots_.load(std::memory_order_acquire);
+    (*slots)[it->second]->subscribers.store(nullptr, std::memory_order_release);
+}
+
+void EventBus::publish(std::string_view channel, const Event& event) {
+    // 发布全程无锁：驻留表和订阅列表各做一次原子快照加载。
+    // 透明查找：string_view直接进驻留表，不构造临时std::string
+    auto names = channelIds_.load(std::memory_order_acquire);
+    auto idIt = names->find(channel);
+    if (idIt == names->end()) {
+        return;
+    }
+
+    publish(idIt->second, event);
+}
+
+void EventBus::publish(ChannelId channel, const Event& event) {
+    auto slots = channelSlots_.load(std::memory_order_acquire);
+    if (channel >= slots->size()) {
+        return;
+    }
+
+    auto subscribers = (*slots)[channel]->subscribers.load(std::memory_order_acquire);
+    if (!subscribers) {
+        return;
+    }
+
+    // SoA分发：顺序扫thunk和状态两条窄数组，预取前方槽位
+    const size_t count = subscribers->thunks.size();
+    const HandlerThunk* thunks = subscribers->thunks.data();
+    const std::shared_ptr<void>* states = subscribers->states.data();
+    for (size_t i = 0; i < count; ++i) {
+#if defined(__GNUC__)
+        if (i + 4 < count) {
+            __builtin_prefetch(&thunks[i + 4]);
+            __builtin_prefetch(&states[i + 4]);
         }
+#endif
+        thunks[i](states[i].get(), event);
     }
 }
 
-void EventBus::publishAsync(const std::string& channel, std::unique_ptr<Event> event) {
-    std::lock_guard<std::mutex> lock(queueMutex_);
+EventBus::AsyncSlot* EventBus::claimAsyncSlot(uint64_t& posOut) {
+    size_t effectiveCap = std::min(maxQueueSize_.load(), kAsyncQueueCapacity);
+
+    // 生产侧CAS认领槽位后由调用方写入并发布序号，多个发布线程
+    // 之间不持锁；环满（逻辑上限或物理容量）时认领失败
+    uint64_t pos = enqPos_.load(std::memory_order_relaxed);
+    for (;;) {
+        if (pos - deqPos_.load(std::memory_order_acquire) >= effectiveCap) {
+            return nullptr;
+        }
 
-    if (eventQueue_.size() >= maxQueueSize_) {
-        eventQueue_.pop();
+        AsyncSlot& slot = asyncSlots_[pos & kAsyncQueueMask];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq == pos) {
+            if (enqPos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                posOut = pos;
+                return &slot;
+            }
+        } else if (seq < pos) {
+            return nullptr;
+        } else {
+            pos = enqPos_.load(std::memory_order_relaxed);
+        }
     }
+}
 
-    QueuedEvent queuedEvent;
-    queuedEvent.channel = channel;
-    queuedEvent.event = std::move(event);
+void EventBus::publishAsync(std::string_view channel, std::unique_ptr<Event> event) {
+    // 先驻留频道名（单独持订阅锁），队列里只存整数ID
+    ChannelId channelId = getChannelId(channel);
+
+    uint64_t pos = 0;
+    AsyncSlot* slot = claimAsyncSlot(pos);
+    if (!slot) {
+        return;
+    }
 
-    eventQueue_.push(std::move(queuedEvent));
-    queueCondition_.notify_one();
+    slot->event = event.release();
+    slot->destroy = nullptr;
+    slot->channel = channelId;
+    slot->seq.store(pos + 1, std::memory_order_release);
 }
 
 void EventBus::processEvents() {
-    std::unique_lock<std::mutex> lock(queueMutex_);
+    // 消费锁只串行化并发的processEvents调用，不挡生产侧
+    std::lock_guard<std::mutex> lock(consumeMutex_);
 
-    while (!eventQueue_.empty()) {
-        QueuedEvent queuedEvent = std::move(eventQueue_.front());
-        eventQueue_.pop();
-
-        lock.unlock();
+    for (;;) {
+        uint64_t pos = deqPos_.load(std::memory_order_relaxed);
+        AsyncSlot& slot = asyncSlots_[pos & kAsyncQueueMask];
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
 
-        publish(queuedEvent.channel, *queuedEvent.event);
+        // 内联事件的存储随槽位复用，必须在归还槽位前分发并析构
+        publish(slot.channel, *slot.event);
+        if (slot.destroy) {
+            slot.destroy(slot.storage);
+        } else {
+            delete slot.event;
+        }
 
-        lock.lock();
+        slot.seq.store(pos + kAsyncQueueCapacity, std::memory_order_release);
+        deqPos_.store(pos + 1, std::memory_order_release);
     }
 }
 
 void EventBus::clear() {
-    std::lock(subscribersMutex_, queueMutex_);
+    std::lock(subscribersMutex_, consumeMutex_);
     std::lock_guard<std::mutex> subLock(subscribersMutex_, std::adopt_lock);
-    std::lock_guard<std::mutex> queueLock(queueMutex_, std::adopt_lock);
-    
-    subscribers_.clear();
-    while (!eventQueue_.empty()) {
-        eventQueue_.pop();
+    std::lock_guard<std::mutex> queueLock(consumeMutex_, std::adopt_lock);
+
+    // 驻留表和槽位数组保留，已发出的频道ID保持有效；只清订阅
+    auto slots = channelSlots_.load(std::memory_order_acquire);
+    for (const auto& slot : *slots) {
+        slot->subscribers.store(nullptr, std::memory_order_release);
+    }
+
+    // 以消费者身份清环，释放残留事件
+    for (;;) {
+        uint64_t pos = deqPos_.load(std::memory_order_relaxed);
+        AsyncSlot& slot = asyncSlots_[pos & kAsyncQueueMask];
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+        if (slot.destroy) {
+            slot.destroy(slot.storage);
+        } else {
+            delete slot.event;
+        }
+        slot.seq.store(pos + kAsyncQueueCapacity, std::memory_order_release);
+        deqPos_.store(pos + 1, std::memory_order_release);
     }
 }
 
-size_t EventBus::getSubscriberCount(const std::string& channel) const {
-    std::lock_guard<std::mutex> lock(subscribersMutex_);
-    auto it = subscribers_.find(channel);
-    if (it != subscribers_.end()) {
-        return it->second.size();
+size_t EventBus::getSubscriberCount(std::string_view channel) const {
+    auto names = channelIds_.load(std::memory_order_acquire);
+    auto idIt = names->find(channel);
+    if (idIt == names->end()) {
+        return 0;
     }
-    return 0;
+
+    auto slots = channelSlots_.load(std::memory_order_acquire);
+    auto subscribers = (*slots)[idIt->second]->subscribers.load(std::memory_order_acquire);
+    return subscribers ? subscribers->thunks.size() : 0;
 }
 
 size_t EventBus::getPendingEventCount() const {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    return eventQueue_.size();
+    uint64_t enq = enqPos_.load(std::memory_order_acquire);
+    uint64_t deq = deqPos_.load(std::memory_order_acquire);
+    return enq >= deq ? static_cast<size_t>(enq - deq) : 0;
 }
 
 void EventBus::setMaxQueueSize(size_t maxSize) {
@@ -117,7 +321,7 @@ EventDispatcher::~EventDispatcher() {
 
 void EventDispatcher::dispatch(const Event& event) {
     std::lock_guard<std::mutex> lock(listenersMutex_);
-    auto it = listeners_.find(event.getType());
+    auto it = listeners_.find(event.getTypeId());
     if (it != listeners_.end()) {
         for (const auto& callback : it->second) {
             callback(event);
@@ -127,16 +331,19 @@ void EventDispatcher::dispatch(const Event& event) {
 
 void EventDispatcher::addListener(const std::string& eventType, EventCallback callback) {
     std::lock_guard<std::mutex> lock(listenersMutex_);
-    listeners_[eventType].push_back(callback);
+    listeners_[TypeRegistry::reg(eventType)].push_back(callback);
 }
 
 void EventDispatcher::removeAllListeners(const std::string& eventType) {
     std::lock_guard<std::mutex> lock(listenersMutex_);
-    listeners_.erase(eventType);
+    listeners_.erase(TypeRegistry::reg(eventType));
 }
 
 void EventDispatcher::clearListeners() {
     std::lock_guard<std::mutex> lock(listenersMutex_);
+    for (auto& handlers : listenersByIndex_) {
+        handlers.clear();
+    }
     listeners_.clear();
 }
 
@@ -14,47 +14,109 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include <functional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 #include <memory>
 #include <mutex>
 #include <atomic>
 #include <typeindex>
-#include <queue>
-#include <condition_variable>
 
 namespace v3d {
 namespace core {
 
+/// @brief 事件类型ID - 驻留类型名得到的整数句柄
+using TypeId = uint32_t;
+
+/**
+ * @class TypeRegistry
+ * @brief 事件类型注册表 - 类型名与整数ID互转
+ *
+ * 每个事件类型首次注册时驻留类型名并分配稠密ID，
+ * 之后按ID分发和查表，热路径上不再碰字符串。
+ */
+class TypeRegistry {
+public:
+    /**
+     * @brief 驻留类型名并返回类型ID
+     * @param name 类型名称
+     * @return 该类型的整数ID（同名恒返回同一ID）
+     */
+    static TypeId reg(std::string_view name);
+
+    /**
+     * @brief 按ID取回类型名（诊断/日志用的冷路径）
+     * @param id 类型ID
+     * @return 类型名称；未注册的ID返回"<unknown>"
+     */
+    static const char* name(TypeId id);
+};
+
 /**
  * @class Event
  * @brief 事件基类
- * 
- * 所有事件都应继承此类。
- * 提供事件类型和大小的基本信息。
+ *
+ * 所有事件都应继承此类。派生类用DEFINE_EVENT_TYPE(T)生成
+ * getTypeId()实现；类型名只在首次注册时驻留一次，
+ * 之后每次分发只付一次虚调用取整数ID，不再构造字符串。
  */
 class Event {
 public:
     virtual ~Event() = default;
-    
+
+    /**
+     * @brief 获取事件类型ID
+     * @return 驻留后的整数类型ID
+     */
+    virtual TypeId getTypeId() const noexcept = 0;
+
     /**
-     * @brief 获取事件类型名称
+     * @brief 获取事件类型名称（诊断/日志用）
      * @return 类型名称字符串
+     *
+     * 按getTypeId()查注册表的薄封装，仅供打印；
+     * 分发路径一律走整数ID。
      */
-    virtual std::string getType() const = 0;
-    
+    std::string getType() const;
+
     /**
      * @brief 获取事件大小
      * @return 事件数据大小（字节）
      */
     virtual size_t getSize() const = 0;
+
+    /**
+     * @brief 事件对象分配 - 小事件走线程本地slab
+     * @param size 对象大小
+     * @return 对象内存
+     *
+     * 高频publish每个事件都malloc/free一对，分配器全局锁
+     * 成为热点。不超过256字节的事件改走TlsSlab的线程本地
+     * 空闲链，分配/回收都不取锁；更大的事件回退普通堆。
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * @brief 事件对象回收（按大小路由回slab或普通堆）
+     * @param ptr 对象内存
+     * @param size 对象大小
+     */
+    static void operator delete(void* ptr, size_t size);
 };
 
 /// @brief 事件回调函数类型
 using EventCallback = std::function<void(const Event&)>;
 
+/// @brief 频道ID - 订阅/发布时驻留频道名得到的整数句柄
+using ChannelId = uint32_t;
+
 /**
  * @class EventBus
  * @brief 事件总线 - 实现发布/订阅模式
@@ -95,14 +157,14 @@ public:
      * @param callback 回调函数
      */
     template<typename T>
-    void subscribe(const std::string& channel, EventCallback callback);
+    void subscribe(std::string_view channel, EventCallback callback);
     
     /**
      * @brief 订阅频道
      * @param channel 频道名称
      * @param callback 回调函数
      */
-    void subscribe(const std::string& channel, EventCallback callback);
+    void subscribe(std::string_view channel, EventCallback callback);
     
     /**
      * @brief 取消订阅频道（模板版本）
@@ -110,7 +172,7 @@ public:
      * @param channel 频道名称
      */
     template<typename T>
-    void unsubscribe(const std::string& channel);
+    void unsubscribe(std::string_view channel);
     
     /**
      * @brief 取消订阅频道
@@ -118,7 +180,7 @@ public:
      * 
      * 移除该频道的所有订阅者。
      */
-    void unsubscribe(const std::string& channel);
+    void unsubscribe(std::string_view channel);
     
     /**
      * @brief 同步发布事件
@@ -127,17 +189,62 @@ public:
      * 
      * 立即调用所有订阅者的回调函数。
      */
-    void publish(const std::string& channel, const Event& event);
+    void publish(std::string_view channel, const Event& event);
+
+    /**
+     * @brief 同步发布事件（频道ID版本）
+     * @param channel 频道ID（由getChannelId获得）
+     * @param event 事件对象
+     *
+     * 热路径重载：跳过字符串哈希，订阅表按整数键查找。
+     * 高频发布方应缓存getChannelId的结果走这里。
+     */
+    void publish(ChannelId channel, const Event& event);
+
+    /**
+     * @brief 驻留频道名并返回频道ID
+     * @param channel 频道名称
+     * @return 该频道的整数ID（同名频道恒返回同一ID）
+     *
+     * 订阅时调用一次，之后发布用ID版本的publish，
+     * 每次发布省掉一遍字符串哈希和逐字符比较。
+     */
+    ChannelId getChannelId(std::string_view channel);
     
     /**
      * @brief 异步发布事件
      * @param channel 频道名称
      * @param event 事件对象（所有权转移）
      * 
-     * 将事件加入队列，稍后通过processEvents()处理。
+     * 将事件加入无锁环形队列，稍后通过processEvents()处理。
+     * 队列满时丢弃本次事件。
      */
-    void publishAsync(const std::string& channel, std::unique_ptr<Event> event);
-    
+    void publishAsync(std::string_view channel, std::unique_ptr<Event> event);
+
+    /**
+     * @brief 异步发布事件（值语义版本）
+     * @tparam T 事件类型（Event子类）
+     * @param channel 频道名称
+     * @param event 事件对象（移入队列）
+     *
+     * 不超过kInlineEventBytes的事件直接就地构造进队列槽位的
+     * 内联存储，整个异步路径零堆分配；更大的事件回退堆分配。
+     * 高频发布方应优先走这里而不是make_unique版本。
+     */
+    template<typename T>
+        requires std::is_base_of_v<Event, std::decay_t<T>>
+    void publishAsync(std::string_view channel, T&& event);
+
+    /**
+     * @brief 异步发布事件（频道ID加值语义版本）
+     * @tparam T 事件类型（Event子类）
+     * @param channel 频道ID（由getChannelId获得）
+     * @param event 事件对象（移入队列）
+     */
+    template<typename T>
+        requires std::is_base_of_v<Event, std::decay_t<T>>
+    void publishAsync(ChannelId channel, T&& event);
+
     /**
      * @brief 处理所有待处理事件
      * 
@@ -155,7 +262,7 @@ public:
      * @param channel 频道名称
      * @return 订阅者数量
      */
-    size_t getSubscriberCount(const std::string& channel) const;
+    size_t getSubscriberCount(std::string_view channel) const;
     
     /**
      * @brief 获取待处理事件数量
@@ -179,33 +286,100 @@ private:
     EventBus();
     ~EventBus();
     
+    /// @brief 分发thunk类型 - 状态指针加事件引用的纯函数指针
+    using HandlerThunk = void (*)(void*, const Event&);
+
+    /**
+     * @struct SubscriberList
+     * @brief 订阅者列表 - thunk与状态指针按SoA分列存放
+     *
+     * std::function数组逐元素又宽又冷：每次调用摸两条缓存行外加
+     * 一次间接跳转的查表。拆成连续的函数指针数组和并行的状态
+     * 指针数组后，分发循环顺序扫两条窄流，CPU看见的始终是同一条
+     * call [reg]模式；状态以shared_ptr存放，快照复制时直接共享。
+     */
+    struct SubscriberList {
+        std::vector<HandlerThunk> thunks;          ///< 分发thunk数组（连续）
+        std::vector<std::shared_ptr<void>> states; ///< 并行的回调状态指针
+    };
+
+    /**
+     * @struct TransparentStringHash
+     * @brief 透明字符串哈希 - string_view查找不构造std::string
+     */
+    struct TransparentStringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view sv) const {
+            return std::hash<std::string_view>{}(sv);
+        }
+    };
+
     /**
-     * @struct Subscription
-     * @brief 订阅信息结构
+     * @struct ChannelSlot
+     * @brief 频道槽位 - 订阅者列表的RCU快照
+     *
+     * 发布侧只做一次原子shared_ptr加载拿快照，全程不持锁；
+     * 订阅/退订在写锁内整表复制后原子替换。槽位指针一旦
+     * 创建就不再移动，发布方可以安心缓存频道ID。
      */
-    struct Subscription {
-        std::string channel;    ///< 频道名称
-        EventCallback callback; ///< 回调函数
-        size_t id;              ///< 订阅ID
+    struct ChannelSlot {
+        std::atomic<std::shared_ptr<const SubscriberList>> subscribers; ///< 订阅者快照
     };
 
-    std::unordered_map<std::string, std::vector<Subscription>> subscribers_; ///< 订阅者映射
-    mutable std::mutex subscribersMutex_;                                    ///< 订阅者互斥锁
+    /// @brief 频道名到ID的驻留表类型（透明哈希，查找零拷贝）
+    using ChannelNameMap = std::unordered_map<std::string, ChannelId,
+                                              TransparentStringHash, std::equal_to<>>;
+
+    /**
+     * @brief 驻留频道名（调用方需已持有subscribersMutex_）
+     * @param channel 频道名称
+     * @return 频道ID
+     */
+    ChannelId internChannelLocked(std::string_view channel);
+
+    /// @brief 频道名到ID驻留表的RCU快照（驻留是冷路径，整表复制替换）
+    std::atomic<std::shared_ptr<const ChannelNameMap>> channelIds_;
+    /// @brief 按频道ID索引的槽位数组RCU快照（新频道时复制增长）
+    std::atomic<std::shared_ptr<const std::vector<std::shared_ptr<ChannelSlot>>>> channelSlots_;
+    mutable std::mutex subscribersMutex_;  ///< 写侧互斥锁（仅订阅/退订/驻留持有）
     
+    /// @brief 内联事件存储上限（字节）- 超过的事件回退堆分配
+    static constexpr size_t kInlineEventBytes = 64;
+
     /**
-     * @struct QueuedEvent
-     * @brief 队列事件结构
+     * @struct AsyncSlot
+     * @brief 异步队列槽位 - 内联事件存储加认领序号
+     *
+     * publishAsync的队列是Vyukov式有界MPSC环：多个发布线程
+     * CAS认领槽位、写入后发布序号，全程无锁；
+     * processEvents按序号单消费者取走。小事件就地构造在
+     * storage里（destroy非空），大事件存堆指针（destroy为空）。
      */
-    struct QueuedEvent {
-        std::string channel;           ///< 频道名称
-        std::unique_ptr<Event> event;  ///< 事件对象
+    struct AsyncSlot {
+        std::atomic<uint64_t> seq;                    ///< 槽位序号
+        alignas(16) std::byte storage[kInlineEventBytes]; ///< 小事件内联存储
+        Event* event;                                 ///< 事件指针（指向storage或堆）
+        void (*destroy)(void*);                       ///< 内联事件析构thunk（堆路径为空）
+        ChannelId channel;                            ///< 频道ID
     };
 
-    std::queue<QueuedEvent> eventQueue_;          ///< 事件队列
-    mutable std::mutex queueMutex_;               ///< 队列互斥锁
-    std::condition_variable queueCondition_;      ///< 条件变量
-    std::atomic<size_t> maxQueueSize_;            ///< 最大队列大小
-    std::atomic<size_t> nextSubscriptionId_;      ///< 下一个订阅ID
+    /**
+     * @brief CAS认领一个异步队列槽位
+     * @param posOut 认领到的环位置（用于发布序号）
+     * @return 槽位指针；环满时返回nullptr（本次事件丢弃）
+     *
+     * 认领到的槽位由调用方填充后store(pos+1)发布序号。
+     */
+    AsyncSlot* claimAsyncSlot(uint64_t& posOut);
+
+    static constexpr size_t kAsyncQueueCapacity = 16384;  ///< 环容量（2的幂）
+    static constexpr size_t kAsyncQueueMask = kAsyncQueueCapacity - 1;  ///< 下标掩码
+
+    std::vector<AsyncSlot> asyncSlots_;           ///< 异步事件环形队列
+    std::atomic<uint64_t> enqPos_;                ///< 生产游标
+    std::atomic<uint64_t> deqPos_;                ///< 消费游标
+    mutable std::mutex consumeMutex_;             ///< 消费侧互斥锁（仅processEvents/clear持有）
+    std::atomic<size_t> maxQueueSize_;            ///< 最大队列大小（逻辑上限）
 };
 
 /**
@@ -235,11 +409,12 @@ public:
      * @param data 事件数据
      */
     explicit TypedEvent(const T& data) : data_(data) {}
-    
-    std::string getType() const override {
-        return typeid(T).name();
+
+    TypeId getTypeId() const noexcept override {
+        static const TypeId id = TypeRegistry::reg(typeid(T).name());
+        return id;
     }
-    
+
     size_t getSize() const override {
         return sizeof(T);
     }
@@ -264,64 +439,130 @@ private:
     T data_;  ///< 事件数据
 };
 
+/**
+ * @struct TypeIndex
+ * @brief 事件类型的编译期索引
+ *
+ * 通过DEFINE_EVENT(T, Id)特化，把具体事件类型映射为稠密的
+ * 整数下标。EventDispatcher在调用点类型已知时凭它直接做
+ * 数组下标寻址，省去getType()的字符串哈希和散列表查找。
+ */
+template<typename T>
+struct TypeIndex;
+
+namespace detail {
+
+/**
+ * @brief 检测T是否已通过DEFINE_EVENT注册编译期索引
+ */
+template<typename T, typename = void>
+struct HasTypeIndex : std::false_type {};
+
+template<typename T>
+struct HasTypeIndex<T, std::void_t<decltype(TypeIndex<T>::value)>> : std::true_type {};
+
+}
+
 /**
  * @class EventDispatcher
  * @brief 事件分发器 - 类型安全的事件分发
  * 
  * 单例模式，提供按事件类型分发的能力。
  * 与EventBus不同，EventDispatcher按类型而非频道分发事件。
- * 
+ *
+ * 用DEFINE_EVENT(T, Id)注册过编译期索引的事件类型走快路径：
+ * 监听器按下标存在固定数组里，分发是一次数组寻址；
+ * 字符串键的API保留为未注册类型的慢路径回退。
+ *
  * @example
  * @code
  * auto& dispatcher = EventDispatcher::getInstance();
- * 
- * // 添加监听器
- * dispatcher.addListener("MyEvent", [](const Event& e) {
+ *
+ * // 注册编译期索引（全局作用域，下标全局唯一）
+ * DEFINE_EVENT(MyEvent, 0);
+ *
+ * // 添加监听器（类型版本，免字符串哈希）
+ * dispatcher.addListener<MyEvent>([](const Event& e) {
  *     // 处理事件
  * });
- * 
- * // 分发事件
+ *
+ * // 分发事件（T在调用点推导，下标寻址直达监听器）
  * MyEvent event;
  * dispatcher.dispatch(event);
  * @endcode
  */
 class EventDispatcher {
 public:
+    /// @brief 编译期索引的类型上限（DEFINE_EVENT的Id须小于它）
+    static constexpr size_t kMaxEventTypes = 64;
+
     /**
      * @brief 获取单例实例
      * @return EventDispatcher的单例引用
      */
     static EventDispatcher& getInstance();
-    
+
     /**
-     * @brief 分发事件
+     * @brief 分发事件（散列表慢路径）
      * @param event 事件对象
+     *
+     * 按event.getTypeId()查散列表，整数哈希、不碰字符串。
+     * 已注册TypeIndex的类型应走模板版本（数组寻址）。
      */
     void dispatch(const Event& event);
-    
+
     /**
      * @brief 分发类型化事件
-     * @tparam T 数据类型
-     * @param data 事件数据
-     * 
-     * 自动包装为TypedEvent后分发。
+     * @tparam T 事件或数据类型
+     * @param data 事件对象或事件数据
+     *
+     * T已注册TypeIndex时按编译期下标寻址分发；
+     * 未注册的Event子类回退字符串键路径；
+     * 非Event类型自动包装为TypedEvent后分发。
      */
     template<typename T>
     void dispatch(const T& data);
-    
+
+    /**
+     * @brief 添加事件监听器（类型版本）
+     * @tparam T 事件类型（须已DEFINE_EVENT注册）
+     * @param callback 回调函数
+     */
+    template<typename T>
+    void addListener(EventCallback callback) {
+        static_assert(detail::HasTypeIndex<T>::value,
+                      "T must be registered with DEFINE_EVENT");
+        static_assert(TypeIndex<T>::value < kMaxEventTypes,
+                      "TypeIndex exceeds kMaxEventTypes");
+        std::lock_guard<std::mutex> lock(listenersMutex_);
+        listenersByIndex_[TypeIndex<T>::value].push_back(std::move(callback));
+    }
+
     /**
      * @brief 添加事件监听器
-     * @param eventType 事件类型名称
+     * @param eventType 事件类型名称（注册时驻留为TypeId）
      * @param callback 回调函数
      */
     void addListener(const std::string& eventType, EventCallback callback);
-    
+
+    /**
+     * @brief 移除指定类型的所有监听器（类型版本）
+     * @tparam T 事件类型（须已DEFINE_EVENT注册）
+     */
+    template<typename T>
+    void removeAllListeners() {
+        static_assert(detail::HasTypeIndex<T>::value,
+                      "T must be registered with DEFINE_EVENT");
+        std::lock_guard<std::mutex> lock(listenersMutex_);
+        listenersByIndex_[TypeIndex<T>::value].clear();
+    }
+
     /**
      * @brief 移除指定类型的所有监听器
      * @param eventType 事件类型名称
      */
     void removeAllListeners(const std::string& eventType);
-    
+
     /**
      * @brief 清除所有监听器
      */
@@ -331,25 +572,97 @@ private:
     EventDispatcher();
     ~EventDispatcher();
 
-    std::unordered_map<std::string, std::vector<EventCallback>> listeners_; ///< 监听器映射
-    mutable std::mutex listenersMutex_;                                     ///< 监听器互斥锁
+    /// @brief 单个类型的监听器列表
+    using HandlerVec = std::vector<EventCallback>;
+
+    std::array<HandlerVec, kMaxEventTypes> listenersByIndex_;  ///< 按编译期下标的监听器数组
+    std::unordered_map<TypeId, HandlerVec> listeners_;         ///< 按类型ID的监听器映射（慢路径）
+    mutable std::mutex listenersMutex_;                        ///< 监听器互斥锁
 };
 
 template<typename T>
-void EventBus::subscribe(const std::string& channel, EventCallback callback) {
+void EventBus::subscribe(std::string_view channel, EventCallback callback) {
     subscribe(channel, callback);
 }
 
 template<typename T>
-void EventBus::unsubscribe(const std::string& channel) {
+void EventBus::unsubscribe(std::string_view channel) {
     unsubscribe(channel);
 }
 
+template<typename T>
+    requires std::is_base_of_v<Event, std::decay_t<T>>
+void EventBus::publishAsync(std::string_view channel, T&& event) {
+    publishAsync(getChannelId(channel), std::forward<T>(event));
+}
+
+template<typename T>
+    requires std::is_base_of_v<Event, std::decay_t<T>>
+void EventBus::publishAsync(ChannelId channel, T&& event) {
+    using EventType = std::decay_t<T>;
+
+    uint64_t pos = 0;
+    AsyncSlot* slot = claimAsyncSlot(pos);
+    if (!slot) {
+        return;
+    }
+
+    if constexpr (sizeof(EventType) <= kInlineEventBytes &&
+                  alignof(EventType) <= alignof(std::max_align_t)) {
+        // 小事件就地构造进槽位内联存储，无堆分配
+        slot->event = ::new (static_cast<void*>(slot->storage)) EventType(std::forward<T>(event));
+        slot->destroy = [](void* ptr) {
+            static_cast<EventType*>(ptr)->~EventType();
+        };
+    } else {
+        slot->event = new EventType(std::forward<T>(event));
+        slot->destroy = nullptr;
+    }
+    slot->channel = channel;
+    slot->seq.store(pos + 1, std::memory_order_release);
+}
+
 template<typename T>
 void EventDispatcher::dispatch(const T& data) {
-    TypedEvent<T> event(data);
-    dispatch(event);
+    if constexpr (std::is_base_of_v<Event, T> && detail::HasTypeIndex<T>::value) {
+        // 快路径：类型在调用点已知，一次数组寻址直达监听器
+        std::lock_guard<std::mutex> lock(listenersMutex_);
+        for (const auto& callback : listenersByIndex_[TypeIndex<T>::value]) {
+            callback(data);
+        }
+    } else if constexpr (std::is_base_of_v<Event, T>) {
+        dispatch(static_cast<const Event&>(data));
+    } else {
+        TypedEvent<T> event(data);
+        dispatch(static_cast<const Event&>(event));
+    }
 }
 
 }
 }
+
+/**
+ * @brief 注册事件类型的编译期索引
+ * @param T 事件类型（完整限定名）
+ * @param Id 类型下标（须全局唯一且小于EventDispatcher::kMaxEventTypes）
+ *
+ * 在全局作用域使用。特化v3d::core::TypeIndex<T>，使
+ * EventDispatcher的模板addListener/dispatch对T走数组下标快路径。
+ */
+#define DEFINE_EVENT(T, Id) \
+    template<> struct v3d::core::TypeIndex<T> { \
+        static constexpr size_t value = (Id); \
+    }
+
+/**
+ * @brief 生成事件类型的getTypeId()实现
+ * @param T 事件类型（类名即驻留的类型名）
+ *
+ * 在Event子类的类体内使用。类型名只在首次调用时驻留一次，
+ * 之后每次取ID只是读一个函数局部静态量。
+ */
+#define DEFINE_EVENT_TYPE(T) \
+    v3d::core::TypeId getTypeId() const noexcept override { \
+        static const v3d::core::TypeId id = v3d::core::TypeRegistry::reg(#T); \
+        return id; \
+    }
@@ -1,8 +1,17 @@
 #include "logger.h"
 #include <iostream>
+#include <array>
 #include <filesystem>
 #include <iomanip>
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace v3d {
 namespace core {
 
@@ -72,24 +81,183 @@ void LogMessage::setMessage(const std::string& message) {
     message_ = message;
 }
 
+void LogAppender::appendBatch(const std::vector<LogMessage>& messages) {
+    for (const auto& message : messages) {
+        append(message);
+    }
+}
+
 ConsoleAppender::ConsoleAppender(bool useColor)
-    : useColor_(useColor) {
+    : useColor_(useColor)
+    , ring_(kRingCapacity) {
+    for (size_t i = 0; i < kRingCapacity; ++i) {
+        ring_[i].seq.store(i, std::memory_order_relaxed);
+    }
+    writer_ = std::thread(&ConsoleAppender::writerLoop, this);
+}
+
+ConsoleAppender::~ConsoleAppender() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        running_.store(false, std::memory_order_release);
+    }
+    wakeCv_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
 }
 
 void ConsoleAppender::append(const LogMessage& message) {
+    std::string line;
     if (useColor_) {
-        std::cout << getColorCode(message.getLevel());
+        line += getColorCode(message.getLevel());
+        line += message.toString();
+        line += "\033[0m";
+    } else {
+        line += message.toString();
     }
+    line.push_back('\n');
+    enqueue(std::move(line));
+}
 
-    std::cout << message.toString() << std::endl;
+void ConsoleAppender::appendBatch(const std::vector<LogMessage>& messages) {
+    // 整批拼成一条记录入环，环上只占一个槽位，
+    // 写线程端也只是iovec里的一项
+    std::string output;
+    for (const auto& message : messages) {
+        if (useColor_) {
+            output += getColorCode(message.getLevel());
+        }
 
-    if (useColor_) {
-        std::cout << "\033[0m";
+        output += message.toString();
+
+        if (useColor_) {
+            output += "\033[0m";
+        }
+
+        output += '\n';
     }
+
+    enqueue(std::move(output));
 }
 
 void ConsoleAppender::flush() {
-    std::cout.flush();
+    // 等写线程把当前已入环的记录全部落到stdout
+    uint64_t target = enqPos_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    wakeCv_.notify_one();
+    flushCv_.wait(lock, [&] {
+        return writtenCount_.load(std::memory_order_acquire) >= target;
+    });
+}
+
+void ConsoleAppender::enqueue(std::string&& text) {
+    // 生产侧CAS认领槽位后写入并发布序号，线程间不持锁；
+    // 环满说明写线程落后，让出CPU等它腾出槽位，不丢日志
+    uint64_t pos = enqPos_.load(std::memory_order_relaxed);
+    for (;;) {
+        RingSlot& slot = ring_[pos & kRingMask];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq == pos) {
+            if (enqPos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.text = std::move(text);
+                slot.seq.store(pos + 1, std::memory_order_release);
+                break;
+            }
+        } else if (seq < pos) {
+            std::this_thread::yield();
+            pos = enqPos_.load(std::memory_order_relaxed);
+        } else {
+            pos = enqPos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    // 只有写线程确实在休眠时才付一次锁和notify的代价
+    if (writerIdle_.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wakeCv_.notify_one();
+    }
+}
+
+void ConsoleAppender::writerLoop() {
+    std::vector<std::string> batch;
+    batch.reserve(kMaxBatch);
+
+    for (;;) {
+        // 单消费者按序号收集一批记录，取走即归还槽位
+        batch.clear();
+        while (batch.size() < kMaxBatch) {
+            uint64_t pos = deqPos_.load(std::memory_order_relaxed);
+            RingSlot& slot = ring_[pos & kRingMask];
+            if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            batch.push_back(std::move(slot.text));
+            slot.text = std::string();
+            slot.seq.store(pos + kRingCapacity, std::memory_order_release);
+            deqPos_.store(pos + 1, std::memory_order_release);
+        }
+
+        if (!batch.empty()) {
+#if defined(_WIN32)
+            for (const auto& text : batch) {
+                std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+            }
+            std::cout.flush();
+#else
+            // 一批记录合并成一次writev，20个线程的逐条write
+            // 坍缩为每批一次系统调用
+            std::array<struct iovec, kMaxBatch> iov;
+            size_t n = 0;
+            size_t total = 0;
+            for (const auto& text : batch) {
+                iov[n].iov_base = const_cast<char*>(text.data());
+                iov[n].iov_len = text.size();
+                total += text.size();
+                ++n;
+            }
+            size_t written = 0;
+            size_t skip = 0;
+            while (written < total) {
+                ssize_t ret = ::writev(STDOUT_FILENO, iov.data() + skip,
+                                       static_cast<int>(n - skip));
+                if (ret <= 0) {
+                    break;
+                }
+                written += static_cast<size_t>(ret);
+                // 部分写：跳过已写完的iovec项，修剪写了一半的那项
+                size_t done = static_cast<size_t>(ret);
+                while (skip < n && done >= iov[skip].iov_len) {
+                    done -= iov[skip].iov_len;
+                    ++skip;
+                }
+                if (skip < n && done > 0) {
+                    iov[skip].iov_base = static_cast<char*>(iov[skip].iov_base) + done;
+                    iov[skip].iov_len -= done;
+                }
+            }
+#endif
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex_);
+                writtenCount_.fetch_add(batch.size(), std::memory_order_release);
+            }
+            flushCv_.notify_all();
+            continue;
+        }
+
+        // 环空：退出或休眠等新记录
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        if (!running_.load(std::memory_order_acquire)) {
+            break;
+        }
+        writerIdle_.store(true, std::memory_order_release);
+        wakeCv_.wait(lock, [&] {
+            uint64_t pos = deqPos_.load(std::memory_order_relaxed);
+            return ring_[pos & kRingMask].seq.load(std::memory_order_acquire) == pos + 1
+                || !running_.load(std::memory_order_acquire);
+        });
+        writerIdle_.store(false, std::memory_order_release);
+    }
 }
 
 std::string ConsoleAppender::getColorCode(LogLevel level) const {
@@ -124,6 +292,23 @@ void FileAppender::append(const LogMessage& message) {
     file_ << message.toString() << std::endl;
 }
 
+void FileAppender::appendBatch(const std::vector<LogMessage>& messages) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!file_.is_open()) {
+        return;
+    }
+
+    // 整批拼接后一次写入，落盘交给flush()统一处理
+    std::string output;
+    for (const auto& message : messages) {
+        output += message.toString();
+        output += '\n';
+    }
+
+    file_.write(output.data(), static_cast<std::streamsize>(output.size()));
+}
+
 void FileAppender::flush() {
     std::lock_guard<std::mutex> lock(mutex_);
 
@@ -147,6 +332,121 @@ void FileAppender::setFilePath(const std::string& filePath) {
     file_.open(filePath_, std::ios::out | std::ios::app);
 }
 
+AsyncFileAppender::AsyncFileAppender(const std::string& filePath, bool append)
+    : filePath_(filePath)
+    , flushTicket_(0)
+    , flushDone_(0)
+    , running_(true) {
+
+    std::filesystem::path path(filePath);
+    std::filesystem::create_directories(path.parent_path());
+
+    auto mode = std::ios::out;
+    if (append) {
+        mode |= std::ios::app;
+    }
+    file_.open(filePath_, mode);
+
+    writer_ = std::thread(&AsyncFileAppender::writerLoop, this);
+}
+
+AsyncFileAppender::~AsyncFileAppender() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    wakeCv_.notify_one();
+
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+void AsyncFileAppender::append(const LogMessage& message) {
+    std::string chunk = message.toString();
+    chunk += '\n';
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(std::move(chunk));
+    }
+    wakeCv_.notify_one();
+}
+
+void AsyncFileAppender::appendBatch(const std::vector<LogMessage>& messages) {
+    // 整批合并成一个文本块，队列里只占一项
+    std::string chunk;
+    for (const auto& message : messages) {
+        chunk += message.toString();
+        chunk += '\n';
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(std::move(chunk));
+    }
+    wakeCv_.notify_one();
+}
+
+void AsyncFileAppender::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    uint64_t ticket = ++flushTicket_;
+    wakeCv_.notify_one();
+
+    doneCv_.wait(lock, [this, ticket]() {
+        return flushDone_ >= ticket;
+    });
+}
+
+void AsyncFileAppender::writerLoop() {
+    std::vector<std::string> batch;
+
+    for (;;) {
+        uint64_t flushTarget = 0;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeCv_.wait(lock, [this]() {
+                return !running_ || !pending_.empty() || flushDone_ < flushTicket_;
+            });
+
+            if (!running_ && pending_.empty() && flushDone_ >= flushTicket_) {
+                break;
+            }
+
+            batch.swap(pending_);
+            flushTarget = flushTicket_;
+        }
+
+        // 不持锁写文件：文件流只有本线程访问
+        if (file_.is_open()) {
+            for (const auto& chunk : batch) {
+                file_.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            }
+        }
+        batch.clear();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (flushDone_ < flushTarget && pending_.empty()) {
+            if (file_.is_open()) {
+                file_.flush();
+            }
+            flushDone_ = flushTarget;
+            doneCv_.notify_all();
+        }
+    }
+
+    // 停止前把剩余内容落盘
+    if (file_.is_open()) {
+        file_.flush();
+    }
+}
+
 RollingFileAppender::RollingFileAppender(const std::string& filePath, size_t maxFileSize, int maxFiles)
     : filePath_(filePath)
     , maxFileSize_(maxFileSize)
@@ -237,9 +537,201 @@ void RollingFileAppender::setMaxFiles(int maxFiles) {
     maxFiles_ = maxFiles;
 }
 
+MmapFileAppender::MmapFileAppender(const std::string& filePath, size_t maxFileSize, int maxFiles)
+    : filePath_(filePath)
+    , maxFileSize_(maxFileSize)
+    , maxFiles_(maxFiles) {
+
+    std::filesystem::path path(filePath);
+    std::filesystem::create_directories(path.parent_path());
+
+#if defined(_WIN32)
+    file_.open(filePath_, std::ios::out | std::ios::app);
+#else
+    openMapped();
+#endif
+}
+
+MmapFileAppender::~MmapFileAppender() {
+#if defined(_WIN32)
+    if (file_.is_open()) {
+        file_.close();
+    }
+#else
+    std::unique_lock<std::shared_mutex> lock(mapMutex_);
+    closeMapped();
+#endif
+}
+
+void MmapFileAppender::append(const LogMessage& message) {
+    std::string line = message.toString();
+    line.push_back('\n');
+    writeBytes(line.data(), line.size());
+}
+
+void MmapFileAppender::appendBatch(const std::vector<LogMessage>& messages) {
+    // 整批拼成一段，只预订一次偏移
+    std::string block;
+    for (const auto& message : messages) {
+        block += message.toString();
+        block.push_back('\n');
+    }
+    writeBytes(block.data(), block.size());
+}
+
+void MmapFileAppender::flush() {
+#if defined(_WIN32)
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_.is_open()) {
+        file_.flush();
+    }
+#else
+    // 数据已在页缓存里，这里只是发起异步回写；读取方不依赖它
+    std::shared_lock<std::shared_mutex> lock(mapMutex_);
+    if (base_) {
+        ::msync(base_, off_.load(std::memory_order_relaxed), MS_ASYNC);
+    }
+#endif
+}
+
+void MmapFileAppender::writeBytes(const char* data, size_t len) {
+    if (len == 0) {
+        return;
+    }
+
+#if defined(_WIN32)
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_.is_open()) {
+        file_.write(data, static_cast<std::streamsize>(len));
+    }
+#else
+    for (;;) {
+        {
+            std::shared_lock<std::shared_mutex> lock(mapMutex_);
+            if (!base_) {
+                return;
+            }
+            if (len > cap_) {
+                // 单条记录超过文件上限：截断尾部，保证能落盘
+                len = cap_;
+            }
+
+            // CAS预订保证偏移不越过容量，预订到的区间独占可写
+            size_t pos = off_.load(std::memory_order_relaxed);
+            while (pos + len <= cap_) {
+                if (off_.compare_exchange_weak(pos, pos + len,
+                        std::memory_order_relaxed)) {
+                    std::memcpy(base_ + pos, data, len);
+                    return;
+                }
+            }
+        }
+
+        // 容量不够：独占锁下滚动后重试。独占锁会等所有memcpy完成
+        std::unique_lock<std::shared_mutex> lock(mapMutex_);
+        if (!base_) {
+            return;
+        }
+        if (off_.load(std::memory_order_relaxed) + len > cap_) {
+            rollFile();
+            if (!base_) {
+                return;
+            }
+        }
+    }
+#endif
+}
+
+#if !defined(_WIN32)
+
+void MmapFileAppender::openMapped() {
+    fd_ = ::open(filePath_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        return;
+    }
+
+    struct stat st{};
+    size_t existing = (::fstat(fd_, &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+    off_.store(std::min(existing, maxFileSize_), std::memory_order_relaxed);
+
+    // 预扩到滚动上限并整段映射，写入期间不再增长
+    if (::ftruncate(fd_, static_cast<off_t>(maxFileSize_)) != 0) {
+        ::close(fd_);
+        fd_ = -1;
+        return;
+    }
+
+    void* mem = ::mmap(nullptr, maxFileSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mem == MAP_FAILED) {
+        ::close(fd_);
+        fd_ = -1;
+        return;
+    }
+
+    base_ = static_cast<char*>(mem);
+    cap_ = maxFileSize_;
+}
+
+void MmapFileAppender::closeMapped() {
+    if (base_) {
+        ::msync(base_, cap_, MS_ASYNC);
+        ::munmap(base_, cap_);
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        // 收回预扩的尾部，文件恢复为实际写入量
+        if (::ftruncate(fd_, static_cast<off_t>(off_.load(std::memory_order_relaxed))) != 0) {
+            // 收缩失败不影响已写内容，忽略
+        }
+        ::close(fd_);
+        fd_ = -1;
+    }
+    cap_ = 0;
+}
+
+void MmapFileAppender::rollFile() {
+    closeMapped();
+
+    for (int i = maxFiles_ - 1; i >= 1; --i) {
+        std::string oldFile = getRollFileName(i);
+        std::string newFile = getRollFileName(i + 1);
+
+        if (std::filesystem::exists(oldFile)) {
+            std::filesystem::rename(oldFile, newFile);
+        }
+    }
+
+    std::string backupFile = getRollFileName(1);
+    if (std::filesystem::exists(filePath_)) {
+        std::filesystem::rename(filePath_, backupFile);
+    }
+
+    off_.store(0, std::memory_order_relaxed);
+    openMapped();
+}
+
+std::string MmapFileAppender::getRollFileName(int index) const {
+    if (index == 0) {
+        return filePath_;
+    }
+
+    std::filesystem::path path(filePath_);
+    std::string stem = path.stem().string();
+    std::string extension = path.extension().string();
+
+    return path.parent_path().string() + "/" + stem + "." + std::to_string(index) + extension;
+}
+
+#endif
+
+std::atomic<uint64_t> Logger::nextId_(0);
+
+thread_local std::unordered_map<uint64_t, std::shared_ptr<Logger::ThreadBuffer>> Logger::tlsBuffers_;
+
 Logger::Logger(const std::string& name)
     : name_(name)
-    , level_(LogLevel::Info) {
+    , level_(LogLevel::Info)
+    , id_(nextId_.fetch_add(1, std::memory_order_relaxed)) {
 }
 
 Logger::~Logger() {
@@ -254,10 +746,64 @@ void Logger::log(LogLevel level, const std::string& message, const char* file, i
     LogMessage logMessage(level, name_, file ? file : "", line);
     logMessage.setMessage(message);
 
+    // 写入线程本地缓冲，攒满一批才走一次记录器互斥锁
+    ThreadBuffer& buffer = localBuffer();
+    bool full = false;
+
+    {
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.records.push_back(std::move(logMessage));
+        full = buffer.records.size() >= kBatchSize;
+    }
+
+    if (full) {
+        drainBuffer(buffer);
+    }
+}
+
+Logger::ThreadBuffer& Logger::localBuffer() {
+    auto it = tlsBuffers_.find(id_);
+    if (it == tlsBuffers_.end()) {
+        // 顺手清理已销毁记录器遗留的缓冲（仅本映射持有时引用计数为1）
+        for (auto cur = tlsBuffers_.begin(); cur != tlsBuffers_.end();) {
+            if (cur->second.use_count() == 1) {
+                cur = tlsBuffers_.erase(cur);
+            } else {
+                ++cur;
+            }
+        }
+
+        auto buffer = std::make_shared<ThreadBuffer>();
+        buffer->records.reserve(kBatchSize);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            threadBuffers_.push_back(buffer);
+        }
+
+        it = tlsBuffers_.emplace(id_, std::move(buffer)).first;
+    }
+
+    return *it->second;
+}
+
+void Logger::drainBuffer(ThreadBuffer& buffer) {
+    // 先把整批记录移出缓冲再取记录器锁，避免两把锁嵌套
+    std::vector<LogMessage> batch;
+
+    {
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        if (buffer.records.empty()) {
+            return;
+        }
+        batch.swap(buffer.records);
+        buffer.records.reserve(kBatchSize);
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
 
     for (auto& appender : appenders_) {
-        appender->append(logMessage);
+        appender->appendBatch(batch);
     }
 }
 
@@ -313,6 +859,18 @@ std::string Logger::getName() const {
 }
 
 void Logger::flush() {
+    // 先排空所有线程的本地缓冲，保证flush()后输出完整可见
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers = threadBuffers_;
+    }
+
+    for (auto& buffer : buffers) {
+        drainBuffer(*buffer);
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
 
     for (auto& appender : appenders_) {
@@ -333,6 +891,12 @@ LoggerManager::~LoggerManager() {
     shutdown();
 }
 
+std::atomic<uint64_t> LoggerManager::cacheGeneration_(0);
+
+thread_local uint64_t LoggerManager::tlsCacheGeneration_ = 0;
+
+thread_local std::unordered_map<const char*, std::shared_ptr<Logger>> LoggerManager::tlsCachedLoggers_;
+
 std::shared_ptr<Logger> LoggerManager::getLogger(const std::string& name) {
     std::lock_guard<std::mutex> lock(mutex_);
 
@@ -363,6 +927,24 @@ std::shared_ptr<Logger> LoggerManager::getOrCreateLogger(const std::string& name
     return logger;
 }
 
+std::shared_ptr<Logger> LoggerManager::getOrCreateLogger(const char* name) {
+    // shutdown()会递增代数，这里发现代数变化就整体丢弃本线程缓存
+    uint64_t generation = cacheGeneration_.load(std::memory_order_acquire);
+    if (tlsCacheGeneration_ != generation) {
+        tlsCachedLoggers_.clear();
+        tlsCacheGeneration_ = generation;
+    }
+
+    auto it = tlsCachedLoggers_.find(name);
+    if (it != tlsCachedLoggers_.end()) {
+        return it->second;
+    }
+
+    auto logger = getOrCreateLogger(std::string(name));
+    tlsCachedLoggers_.emplace(name, logger);
+    return logger;
+}
+
 void LoggerManager::setDefaultLevel(LogLevel level) {
     defaultLevel_ = level;
 }
@@ -418,6 +1000,9 @@ void LoggerManager::shutdown() {
     std::lock_guard<std::mutex> lock(mutex_);
     loggers_.clear();
     globalAppenders_.clear();
+
+    // 使所有线程的字面量快路径缓存失效
+    cacheGeneration_.fetch_add(1, std::memory_order_release);
 }
 
 }
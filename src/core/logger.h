@@ -25,6 +25,16 @@
 #include <chrono>
 #include <iomanip>
 #include <unordered_map>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <charconv>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include <thread>
+#include <condition_variable>
+#include <shared_mutex>
 
 namespace v3d {
 namespace core {
@@ -140,7 +150,18 @@ public:
      * @param message 日志消息
      */
     virtual void append(const LogMessage& message) = 0;
-    
+
+    /**
+     * @brief 批量输出日志消息
+     * @param messages 按记录顺序排列的一批日志消息
+     *
+     * 记录器按线程本地批次调用该接口，整批消息只走一次虚调用。
+     * 默认实现逐条转发给append，派生类可以覆盖为单次写入
+     * （如控制台/文件输出器把整批拼成一次write），
+     * 把每条日志一次系统调用合并为每批一次。
+     */
+    virtual void appendBatch(const std::vector<LogMessage>& messages);
+
     /**
      * @brief 刷新缓冲区
      */
@@ -150,9 +171,13 @@ public:
 /**
  * @class ConsoleAppender
  * @brief 控制台日志输出
- * 
+ *
  * 将日志输出到标准输出，支持彩色显示。
- * 
+ * 写入不直接落stdout：记录推入无锁MPSC环后由专属写线程
+ * 批量收集，一次writev落盘。多线程高频打日志时，原来
+ * 串行在stdio锁上的竞争变成各生产线程一次CAS认领槽位，
+ * 写线程把一批记录合并成一次系统调用。
+ *
  * @example
  * @code
  * auto appender = std::make_shared<ConsoleAppender>(true); // 启用颜色
@@ -162,15 +187,48 @@ public:
 class ConsoleAppender : public LogAppender {
 public:
     /**
-     * @brief 构造控制台输出器
+     * @brief 构造控制台输出器（启动后台写线程）
      * @param useColor 是否使用彩色输出（默认true）
      */
     explicit ConsoleAppender(bool useColor = true);
-    
+
+    /**
+     * @brief 析构 - 写完环中剩余记录后回收写线程
+     */
+    ~ConsoleAppender() override;
+
     void append(const LogMessage& message) override;
+    void appendBatch(const std::vector<LogMessage>& messages) override;
+
+    /**
+     * @brief 等待已入环的记录全部写到stdout
+     */
     void flush() override;
 
 private:
+    static constexpr size_t kRingCapacity = 4096;      ///< 环容量（2的幂）
+    static constexpr size_t kRingMask = kRingCapacity - 1;  ///< 下标掩码
+    static constexpr size_t kMaxBatch = 64;            ///< 写线程单次收集上限
+
+    /**
+     * @struct RingSlot
+     * @brief 环槽位 - 文本记录加认领序号（Vyukov式MPSC）
+     */
+    struct RingSlot {
+        std::atomic<uint64_t> seq;  ///< 槽位序号
+        std::string text;           ///< 待写文本（含颜色码与换行）
+    };
+
+    /**
+     * @brief 把一段文本推入环（环满时让出CPU重试，不丢日志）
+     */
+    void enqueue(std::string&& text);
+
+    /**
+     * @brief 写线程主循环 - 批量收集后一次writev写stdout
+     */
+    void writerLoop();
+
     /**
      * @brief 获取日志级别对应的颜色代码
      * @param level 日志级别
@@ -178,7 +236,17 @@ private:
      */
     std::string getColorCode(LogLevel level) const;
 
-    bool useColor_;  ///< 是否使用彩色输出
+    bool useColor_;                        ///< 是否使用彩色输出
+    std::vector<RingSlot> ring_;           ///< 记录环形队列
+    std::atomic<uint64_t> enqPos_{0};      ///< 生产游标
+    std::atomic<uint64_t> deqPos_{0};      ///< 消费游标
+    std::atomic<uint64_t> writtenCount_{0}; ///< 已写到stdout的记录数
+    std::atomic<bool> running_{true};      ///< 写线程运行标志
+    std::atomic<bool> writerIdle_{false};  ///< 写线程是否在休眠（入环时据此决定唤醒）
+    std::mutex wakeMutex_;                 ///< 唤醒/flush等待互斥锁
+    std::condition_variable wakeCv_;       ///< 写线程唤醒条件变量
+    std::condition_variable flushCv_;      ///< flush等待条件变量
+    std::thread writer_;                   ///< 后台写线程
 };
 
 /**
@@ -202,8 +270,9 @@ public:
      */
     explicit FileAppender(const std::string& filePath, bool append = false);
     ~FileAppender();
-    
+
     void append(const LogMessage& message) override;
+    void appendBatch(const std::vector<LogMessage>& messages) override;
     void flush() override;
     
     /**
@@ -218,6 +287,66 @@ private:
     std::mutex mutex_;      ///< 线程安全互斥锁
 };
 
+/**
+ * @class AsyncFileAppender
+ * @brief 异步文件日志输出 - 磁盘写入挪到专用写线程
+ *
+ * FileAppender在调用线程上同步写文件，高频日志时每批都要
+ * 跨一次内核。这里记录线程只把格式化好的文本块入队就返回，
+ * 专用写线程批量取走队列里攒下的所有块，合并成一次流写入，
+ * 把多次内核往返压缩成每批一次。flush()向写线程投递屏障并
+ * 等待其排空队列、落盘完成后才返回，保证flush()后内容可见。
+ *
+ * @example
+ * @code
+ * auto appender = std::make_shared<AsyncFileAppender>("app.log", true);
+ * logger->addAppender(appender);
+ * @endcode
+ */
+class AsyncFileAppender : public LogAppender {
+public:
+    /**
+     * @brief 构造异步文件输出器（启动写线程）
+     * @param filePath 日志文件路径
+     * @param append 是否追加模式（默认false，覆盖模式）
+     */
+    explicit AsyncFileAppender(const std::string& filePath, bool append = false);
+
+    /**
+     * @brief 析构（排空队列、落盘后停止写线程）
+     */
+    ~AsyncFileAppender();
+
+    void append(const LogMessage& message) override;
+    void appendBatch(const std::vector<LogMessage>& messages) override;
+
+    /**
+     * @brief 刷新缓冲区
+     *
+     * 阻塞等待写线程排空队列并把文件流落盘。
+     */
+    void flush() override;
+
+private:
+    /**
+     * @brief 写线程主循环 - 批量取走队列并合并写入
+     *
+     * 文件流只被写线程访问（构造时打开除外），无需额外加锁。
+     */
+    void writerLoop();
+
+    std::ofstream file_;                ///< 文件输出流（写线程独占）
+    std::string filePath_;              ///< 文件路径
+    std::vector<std::string> pending_;  ///< 待写文本块队列
+    uint64_t flushTicket_;              ///< 已请求的flush屏障序号
+    uint64_t flushDone_;                ///< 写线程已完成的flush序号
+    bool running_;                      ///< 写线程运行标志
+    std::mutex mutex_;                  ///< 队列互斥锁
+    std::condition_variable wakeCv_;    ///< 唤醒写线程
+    std::condition_variable doneCv_;    ///< flush等待屏障完成
+    std::thread writer_;                ///< 专用写线程
+};
+
 /**
  * @class RollingFileAppender
  * @brief 滚动文件日志输出
@@ -281,13 +410,148 @@ private:
     std::mutex mutex_;        ///< 线程安全互斥锁
 };
 
+/**
+ * @class MmapFileAppender
+ * @brief 内存映射文件日志输出
+ *
+ * 文件预扩到滚动上限后整段mmap，日志直接memcpy进页缓存映射区，
+ * 比stdio少一次用户态缓冲拷贝。写入位置用原子量预订，常规路径
+ * 各线程互不阻塞；达到上限时按编号滚动备份，规则与
+ * RollingFileAppender一致。flush()只发起异步回写（msync）。
+ * Windows下回退为普通文件流输出。
+ *
+ * @example
+ * @code
+ * // 最大10MB，保留5个备份文件
+ * auto appender = std::make_shared<MmapFileAppender>("app.log", 10*1024*1024, 5);
+ * logger->addAppender(appender);
+ * @endcode
+ */
+class MmapFileAppender : public LogAppender {
+public:
+    /**
+     * @brief 构造内存映射文件输出器
+     * @param filePath 日志文件路径
+     * @param maxFileSize 单个文件最大大小（默认10MB）
+     * @param maxFiles 最大备份文件数（默认5个）
+     */
+    MmapFileAppender(const std::string& filePath, size_t maxFileSize = 10 * 1024 * 1024, int maxFiles = 5);
+    ~MmapFileAppender();
+
+    void append(const LogMessage& message) override;
+    void appendBatch(const std::vector<LogMessage>& messages) override;
+    void flush() override;
+
+private:
+    /**
+     * @brief 把一段字节写入映射区
+     *
+     * 常规路径持共享锁、CAS预订偏移后memcpy；预订越界时
+     * 换独占锁滚动文件再重试。
+     */
+    void writeBytes(const char* data, size_t len);
+
+#if defined(_WIN32)
+    std::ofstream file_;                ///< 回退用文件输出流
+    std::mutex mutex_;                  ///< 回退路径互斥锁
+#else
+    /**
+     * @brief 打开文件并预扩、建立映射
+     */
+    void openMapped();
+
+    /**
+     * @brief 解除映射，文件收缩回实际写入量后关闭
+     */
+    void closeMapped();
+
+    /**
+     * @brief 滚动文件（须持独占锁）
+     */
+    void rollFile();
+
+    /**
+     * @brief 获取备份文件名
+     * @param index 备份索引
+     * @return 备份文件名
+     */
+    std::string getRollFileName(int index) const;
+
+    int fd_ = -1;                       ///< 文件描述符
+    char* base_ = nullptr;              ///< 映射区起始地址
+    size_t cap_ = 0;                    ///< 映射区容量
+    std::atomic<size_t> off_{0};        ///< 下一个写入偏移
+    std::shared_mutex mapMutex_;        ///< 写入共享、滚动独占
+#endif
+    std::string filePath_;              ///< 文件路径
+    size_t maxFileSize_;                ///< 最大文件大小
+    int maxFiles_;                      ///< 最大备份文件数
+};
+
+namespace detail {
+
+/**
+ * @brief 把一段文本追加到栈上的格式化缓冲
+ * @param buf 缓冲起始地址
+ * @param cap 缓冲容量
+ * @param pos 当前写入位置
+ * @return 追加后的写入位置（超出容量的部分被截断）
+ */
+inline size_t appendLogArg(char* buf, size_t cap, size_t pos, std::string_view value) {
+    size_t count = std::min(value.size(), cap - pos);
+    std::memcpy(buf + pos, value.data(), count);
+    return pos + count;
+}
+
+/// @brief 追加C字符串参数
+inline size_t appendLogArg(char* buf, size_t cap, size_t pos, const char* value) {
+    return appendLogArg(buf, cap, pos, std::string_view(value ? value : ""));
+}
+
+/// @brief 追加布尔参数
+inline size_t appendLogArg(char* buf, size_t cap, size_t pos, bool value) {
+    return appendLogArg(buf, cap, pos,
+                        value ? std::string_view("true") : std::string_view("false"));
+}
+
+/// @brief 追加单字符参数
+inline size_t appendLogArg(char* buf, size_t cap, size_t pos, char value) {
+    if (pos < cap) {
+        buf[pos++] = value;
+    }
+    return pos;
+}
+
+/// @brief 追加数值参数（std::to_chars直接写入缓冲，不经过堆）
+template<typename T>
+    requires std::is_arithmetic_v<T>
+size_t appendLogArg(char* buf, size_t cap, size_t pos, T value) {
+    auto result = std::to_chars(buf + pos, buf + cap, value);
+    return result.ec == std::errc() ? static_cast<size_t>(result.ptr - buf) : pos;
+}
+
+/// @brief 判断参数列表是否是LOG_*宏传入的（文件名, 行号）对
+template<typename... Args>
+inline constexpr bool isFileLineArgs = false;
+
+template<typename File>
+inline constexpr bool isFileLineArgs<File, int> = std::is_convertible_v<File, const char*>;
+
+}
+
 /**
  * @class Logger
  * @brief 日志记录器
  * 
  * 主要的日志记录类，支持多级别日志和多输出目标。
  * 线程安全。
- * 
+ *
+ * 高频并发记录时，每条日志都抢记录器互斥锁会在各线程间
+ * 来回拉扯同一缓存行。这里把日志先攒进线程本地缓冲，
+ * 攒满一批（kBatchSize条）或调用flush()时才持锁一次，
+ * 整批交给输出器的appendBatch，把锁竞争摊薄到每批一次。
+ * 注意：日志在攒批期间不落盘，读取输出前需先调用flush()。
+ *
  * @example
  * @code
  * auto logger = LoggerManager::getInstance().getOrCreateLogger("MyApp");
@@ -345,7 +609,63 @@ public:
      * @brief 记录Fatal级别日志
      */
     void fatal(const std::string& message, const char* file = nullptr, int line = 0);
-    
+
+    /**
+     * @brief 记录格式化日志（栈缓冲，无额外堆分配）
+     * @param fmt 格式字符串，"{}"按顺序替换为后续参数
+     * @param args 格式化参数（数值、布尔、字符、字符串）
+     *
+     * 拼接消息的惯用写法"text " + std::to_string(i)每条日志
+     * 至少两次堆分配。这里把参数直接格式化进512字节栈缓冲
+     * （数值走std::to_chars），整个格式化路径零堆分配，
+     * 只在消息进入攒批缓冲时复制一次。超长消息会被截断。
+     *
+     * @example
+     * @code
+     * logger->info("Loaded {} meshes in {} ms", meshCount, elapsed);
+     * @endcode
+     */
+    template<typename... Args>
+        requires (sizeof...(Args) > 0 && !detail::isFileLineArgs<std::decay_t<Args>...>)
+    void trace(std::string_view fmt, Args&&... args) {
+        logFmt(LogLevel::Trace, fmt, std::forward<Args>(args)...);
+    }
+
+    /// @brief 记录Debug级别格式化日志
+    template<typename... Args>
+        requires (sizeof...(Args) > 0 && !detail::isFileLineArgs<std::decay_t<Args>...>)
+    void debug(std::string_view fmt, Args&&... args) {
+        logFmt(LogLevel::Debug, fmt, std::forward<Args>(args)...);
+    }
+
+    /// @brief 记录Info级别格式化日志
+    template<typename... Args>
+        requires (sizeof...(Args) > 0 && !detail::isFileLineArgs<std::decay_t<Args>...>)
+    void info(std::string_view fmt, Args&&... args) {
+        logFmt(LogLevel::Info, fmt, std::forward<Args>(args)...);
+    }
+
+    /// @brief 记录Warning级别格式化日志
+    template<typename... Args>
+        requires (sizeof...(Args) > 0 && !detail::isFileLineArgs<std::decay_t<Args>...>)
+    void warning(std::string_view fmt, Args&&... args) {
+        logFmt(LogLevel::Warning, fmt, std::forward<Args>(args)...);
+    }
+
+    /// @brief 记录Error级别格式化日志
+    template<typename... Args>
+        requires (sizeof...(Args) > 0 && !detail::isFileLineArgs<std::decay_t<Args>...>)
+    void error(std::string_view fmt, Args&&... args) {
+        logFmt(LogLevel::Error, fmt, std::forward<Args>(args)...);
+    }
+
+    /// @brief 记录Fatal级别格式化日志
+    template<typename... Args>
+        requires (sizeof...(Args) > 0 && !detail::isFileLineArgs<std::decay_t<Args>...>)
+    void fatal(std::string_view fmt, Args&&... args) {
+        logFmt(LogLevel::Fatal, fmt, std::forward<Args>(args)...);
+    }
+
     /**
      * @brief 添加输出目标
      * @param appender 输出目标
@@ -385,14 +705,82 @@ public:
     
     /**
      * @brief 刷新所有输出目标
+     *
+     * 先排空所有线程的本地日志缓冲，再刷新输出目标。
      */
     void flush();
 
 private:
+    /**
+     * @struct ThreadBuffer
+     * @brief 线程本地日志缓冲 - 单线程独占写入的攒批槽
+     *
+     * 每个线程对每个记录器持有一个缓冲，日志先写入这里。
+     * 缓冲自带的互斥锁平时只被拥有线程获取（无竞争，纳秒级），
+     * 仅在flush()排空时才会被其他线程短暂持有。
+     */
+    struct ThreadBuffer {
+        std::mutex mutex;                 ///< 缓冲互斥锁（几乎无竞争）
+        std::vector<LogMessage> records;  ///< 攒批中的日志记录
+    };
+
+    /**
+     * @brief 获取当前线程对应的本地缓冲（首次使用时创建并注册）
+     * @return 线程本地缓冲引用
+     */
+    ThreadBuffer& localBuffer();
+
+    /**
+     * @brief 排空一个线程缓冲，整批交给输出目标
+     * @param buffer 要排空的缓冲
+     */
+    void drainBuffer(ThreadBuffer& buffer);
+
+    /**
+     * @brief 把格式字符串和参数格式化进栈缓冲后记录
+     * @param level 日志级别
+     * @param fmt 格式字符串
+     * @param args 格式化参数
+     */
+    template<typename... Args>
+    void logFmt(LogLevel level, std::string_view fmt, Args&&... args) {
+        if (level < level_) {
+            return;
+        }
+
+        char buf[kFormatBufferSize];
+        size_t pos = 0;
+        size_t offset = 0;
+
+        // 折叠表达式逐个参数消费一个"{}"占位符
+        ([&] {
+            size_t placeholder = fmt.find("{}", offset);
+            if (placeholder == std::string_view::npos) {
+                return;
+            }
+            pos = detail::appendLogArg(buf, sizeof(buf), pos,
+                                       fmt.substr(offset, placeholder - offset));
+            pos = detail::appendLogArg(buf, sizeof(buf), pos, args);
+            offset = placeholder + 2;
+        }(), ...);
+
+        pos = detail::appendLogArg(buf, sizeof(buf), pos, fmt.substr(offset));
+
+        log(level, std::string(buf, pos), nullptr, 0);
+    }
+
+    static constexpr size_t kBatchSize = 256;         ///< 触发自动排空的攒批条数
+    static constexpr size_t kFormatBufferSize = 512;  ///< 格式化栈缓冲大小（字节）
+
     std::string name_;                                  ///< 记录器名称
     LogLevel level_;                                    ///< 日志级别
+    uint64_t id_;                                       ///< 记录器唯一标识（线程本地缓冲按此索引）
     std::vector<std::shared_ptr<LogAppender>> appenders_; ///< 输出目标列表
+    std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers_; ///< 各线程缓冲的注册表
     std::mutex mutex_;                                  ///< 线程安全互斥锁
+
+    static std::atomic<uint64_t> nextId_;               ///< 记录器标识分配器
+    static thread_local std::unordered_map<uint64_t, std::shared_ptr<ThreadBuffer>> tlsBuffers_; ///< 本线程的缓冲映射
 };
 
 /**
@@ -436,6 +824,19 @@ public:
      * @return 记录器
      */
     std::shared_ptr<Logger> getOrCreateLogger(const std::string& name);
+
+    /**
+     * @brief 获取或创建日志记录器（字符串字面量快路径）
+     * @param name 记录器名称（通常是字符串字面量）
+     * @return 记录器
+     *
+     * 每次记录都走getOrCreateLogger时，字符串哈希加全局互斥锁
+     * 会成为热点。字面量的地址在整个进程内稳定，这里按指针
+     * 身份查线程本地缓存，命中时不取锁、不哈希字符串内容；
+     * 未命中（或shutdown()后缓存代数失效）才回退到全局映射。
+     * 不同地址的同名字符串只是各自缓存一份，结果仍然一致。
+     */
+    std::shared_ptr<Logger> getOrCreateLogger(const char* name);
     
     /**
      * @brief 设置默认日志级别
@@ -486,6 +887,10 @@ private:
     std::vector<std::shared_ptr<LogAppender>> globalAppenders_;        ///< 全局输出目标
     LogLevel defaultLevel_;                                            ///< 默认日志级别
     std::mutex mutex_;                                                 ///< 线程安全互斥锁
+
+    static std::atomic<uint64_t> cacheGeneration_;  ///< 缓存代数（shutdown时递增使所有线程缓存失效）
+    static thread_local uint64_t tlsCacheGeneration_;  ///< 本线程缓存对应的代数
+    static thread_local std::unordered_map<const char*, std::shared_ptr<Logger>> tlsCachedLoggers_; ///< 按指针身份缓存的记录器
 };
 
 /// @brief 便捷宏 - 记录Trace级别日志
@@ -1,4 +1,5 @@
 #include "memory_pool.h"
+#include <cstring>
 #include <stdexcept>
 
 namespace v3d {
@@ -6,9 +7,8 @@ namespace core {
 
 template<typename T, size_t BlockSize>
 MemoryPool<T, BlockSize>::MemoryPool()
-    : usedCount_(0)
+    : serial_(nextSerial_.fetch_add(1, std::memory_order_relaxed) + 1)
     , capacity_(0) {
-    allocateNewBlock();
 }
 
 template<typename T, size_t BlockSize>
@@ -16,29 +16,94 @@ MemoryPool<T, BlockSize>::~MemoryPool() {
 }
 
 template<typename T, size_t BlockSize>
-T* MemoryPool<T, BlockSize>::allocate() {
+typename MemoryPool<T, BlockSize>::ThreadCache* MemoryPool<T, BlockSize>::localCache() {
+    // 快路径：序列号匹配说明缓存仍属于本池，一次TLS读即命中
+    if (tlsEntry_.serial == serial_) {
+        return tlsEntry_.cache;
+    }
+
+    // 慢路径：本线程首次触到本池（或池被clear过），持锁查建缓存
     std::lock_guard<std::mutex> lock(mutex_);
+    auto threadId = std::this_thread::get_id();
 
-    if (freeList_.empty()) {
-        allocateNewBlock();
+    ThreadCache* cache = nullptr;
+    for (const auto& existing : caches_) {
+        if (existing->ownerThread == threadId) {
+            cache = existing.get();
+            break;
+        }
+    }
+    if (!cache) {
+        caches_.push_back(std::make_unique<ThreadCache>());
+        cache = caches_.back().get();
+        cache->ownerThread = threadId;
     }
 
-    T* ptr = freeList_.top();
-    freeList_.pop();
-    usedCount_++;
+    tlsEntry_.serial = serial_;
+    tlsEntry_.cache = cache;
+    return cache;
+}
 
-    return ptr;
+template<typename T, size_t BlockSize>
+void MemoryPool<T, BlockSize>::refillLocked(ThreadCache* cache) {
+    std::unique_ptr<Node[]> block(new Node[BlockSize]);
+
+    for (size_t i = 0; i < BlockSize; ++i) {
+        block[i].owner = cache;
+        block[i].next = cache->freeList;
+        cache->freeList = &block[i];
+    }
+
+    blocks_.push_back(std::move(block));
+    capacity_.fetch_add(BlockSize, std::memory_order_relaxed);
 }
 
 template<typename T, size_t BlockSize>
-void MemoryPool<T, BlockSize>::deallocate(T* ptr) {
-    if (!ptr) return;
+T* MemoryPool<T, BlockSize>::allocate() {
+    ThreadCache* cache = localCache();
 
-    std::lock_guard<std::mutex> lock(mutex_);
+    Node* node = cache->freeList;
+    if (!node) {
+        // 本地链空：先收割其他线程退还的节点，再考虑持锁开新块
+        cache->freeList = cache->remoteFree.exchange(nullptr, std::memory_order_acquire);
+        node = cache->freeList;
+    }
+    if (!node) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        refillLocked(cache);
+        node = cache->freeList;
+    }
+
+    cache->freeList = node->next;
+    cache->used.fetch_add(1, std::memory_order_relaxed);
+    return reinterpret_cast<T*>(node->payload);
+}
+
+template<typename T, size_t BlockSize>
+void MemoryPool<T, BlockSize>::deallocate(T* ptr) noexcept {
+    if (!ptr) return;
 
     ptr->~T();
-    freeList_.push(ptr);
-    usedCount_--;
+
+    Node* node = reinterpret_cast<Node*>(
+        reinterpret_cast<unsigned char*>(ptr) - offsetof(Node, payload));
+    ThreadCache* owner = node->owner;
+    ThreadCache* cache = localCache();
+
+    cache->used.fetch_sub(1, std::memory_order_relaxed);
+
+    if (owner == cache) {
+        // 同线程释放：推回本地链，无锁无原子
+        node->next = cache->freeList;
+        cache->freeList = node;
+    } else {
+        // 跨线程释放：压到所属缓存的remote链，所属线程收割
+        Node* head = owner->remoteFree.load(std::memory_order_relaxed);
+        do {
+            node->next = head;
+        } while (!owner->remoteFree.compare_exchange_weak(head, node,
+                     std::memory_order_release, std::memory_order_relaxed));
+    }
 }
 
 template<typename T, size_t BlockSize>
@@ -46,18 +111,22 @@ void MemoryPool<T, BlockSize>::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
 
     blocks_.clear();
-    while (!freeList_.empty()) {
-        freeList_.pop();
-    }
-    usedCount_ = 0;
-    capacity_ = 0;
+    caches_.clear();
+    capacity_.store(0, std::memory_order_relaxed);
 
-    allocateNewBlock();
+    // 换序列号使所有线程的TLS入口失效，旧缓存指针不会再被触到
+    serial_ = nextSerial_.fetch_add(1, std::memory_order_relaxed) + 1;
 }
 
 template<typename T, size_t BlockSize>
 size_t MemoryPool<T, BlockSize>::getUsedCount() const {
-    return usedCount_.load();
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    long long total = 0;
+    for (const auto& cache : caches_) {
+        total += cache->used.load(std::memory_order_relaxed);
+    }
+    return total > 0 ? static_cast<size_t>(total) : 0;
 }
 
 template<typename T, size_t BlockSize>
@@ -67,26 +136,16 @@ size_t MemoryPool<T, BlockSize>::getCapacity() const {
 
 template<typename T, size_t BlockSize>
 size_t MemoryPool<T, BlockSize>::getFreeCount() const {
-    return capacity_ - usedCount_;
-}
-
-template<typename T, size_t BlockSize>
-void MemoryPool<T, BlockSize>::allocateNewBlock() {
-    auto block = std::make_unique<Block>();
-    T* data = reinterpret_cast<T*>(block->data);
-
-    for (size_t i = 0; i < BlockSize; ++i) {
-        freeList_.push(&data[i]);
-    }
-
-    blocks_.push_back(std::move(block));
-    capacity_ += BlockSize;
+    return capacity_.load() - getUsedCount();
 }
 
 template<typename T>
 ObjectPool<T>::ObjectPool(size_t initialSize)
-    : usedCount_(0) {
-    expand(initialSize);
+    : freeHead_(0)
+    , usedCount_(0)
+    , capacity_(0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    expandLocked(initialSize);
 }
 
 template<typename T>
@@ -94,40 +153,33 @@ ObjectPool<T>::~ObjectPool() {
 }
 
 template<typename T>
-template<typename... Args>
-T* ObjectPool<T>::acquire(Args&&... args) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (freeList_.empty()) {
-        expand(pool_.size());
-    }
-
-    T* obj = freeList_.top();
-    freeList_.pop();
+void ObjectPool<T>::release(T* obj) noexcept {
+    if (!obj) return;
 
-    new (obj) T(std::forward<Args>(args)...);
-    usedCount_++;
+    obj->~T();
 
-    return obj;
+    Node* node = reinterpret_cast<Node*>(
+        reinterpret_cast<unsigned char*>(obj) - offsetof(Node, storage));
+    pushChain(node, node);
+    usedCount_.fetch_sub(1, std::memory_order_relaxed);
 }
 
 template<typename T>
-void ObjectPool<T>::release(T* obj) {
-    if (!obj) return;
-
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    obj->~T();
-    freeList_.push(obj);
-    usedCount_--;
+void ObjectPool<T>::pushChain(Node* first, Node* last) noexcept {
+    uint64_t head = freeHead_.load(std::memory_order_relaxed);
+    do {
+        last->next.store(nodeOf(head), std::memory_order_relaxed);
+    } while (!freeHead_.compare_exchange_weak(head, pack(first, tagOf(head) + 1),
+                 std::memory_order_release, std::memory_order_relaxed));
 }
 
 template<typename T>
 void ObjectPool<T>::reserve(size_t size) {
     std::lock_guard<std::mutex> lock(mutex_);
 
-    if (size > pool_.size()) {
-        expand(size - pool_.size());
+    size_t current = capacity_.load(std::memory_order_relaxed);
+    if (size > current) {
+        expandLocked(size - current);
     }
 }
 
@@ -135,11 +187,10 @@ template<typename T>
 void ObjectPool<T>::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
 
-    pool_.clear();
-    while (!freeList_.empty()) {
-        freeList_.pop();
-    }
-    usedCount_ = 0;
+    freeHead_.store(0, std::memory_order_release);
+    slabResource_.release();
+    capacity_.store(0, std::memory_order_relaxed);
+    usedCount_.store(0, std::memory_order_relaxed);
 }
 
 template<typename T>
@@ -149,67 +200,91 @@ size_t ObjectPool<T>::getUsedCount() const {
 
 template<typename T>
 size_t ObjectPool<T>::getCapacity() const {
-    return pool_.size();
+    return capacity_.load();
 }
 
 template<typename T>
-void ObjectPool<T>::expand(size_t size) {
+void ObjectPool<T>::expandLocked(size_t size) {
+    if (size == 0) return;
+
+    // 节点板从单调资源划拨，clear时一次release全收回
+    Node* slab = static_cast<Node*>(
+        slabResource_.allocate(size * sizeof(Node), alignof(Node)));
     for (size_t i = 0; i < size; ++i) {
-        pool_.push_back(std::make_unique<T>());
-        freeList_.push(pool_.back().get());
+        ::new (&slab[i]) Node();
     }
+    for (size_t i = 0; i + 1 < size; ++i) {
+        slab[i].next.store(&slab[i + 1], std::memory_order_relaxed);
+    }
+
+    // 整条链一次CAS挂上空闲栈
+    pushChain(&slab[0], &slab[size - 1]);
+    capacity_.fetch_add(size, std::memory_order_relaxed);
 }
 
 MemoryArena::MemoryArena(size_t initialSize)
-    : blockSize_(initialSize)
-    , currentBlock_(nullptr) {
+    : MemoryArena(ArenaOptions{initialSize, std::max(initialSize, ArenaOptions{}.maxBlockSize)}) {
+}
+
+MemoryArena::MemoryArena(const ArenaOptions& options)
+    : nextChunkSize_(options.startBlockSize)
+    , maxChunkSize_(options.maxBlockSize) {
     auto block = std::make_unique<Block>();
-    block->size = blockSize_;
-    block->used = 0;
-    block->data = std::make_unique<unsigned char[]>(blockSize_);
-    block->next = nullptr;
-    currentBlock_ = block.get();
+    block->size = nextChunkSize_;
+    block->data = std::make_unique<unsigned char[]>(block->size);
+    cur_ = block->data.get();
+    end_ = cur_ + block->size;
     blocks_.push_back(std::move(block));
+
+    // 首块之后即开始倍增
+    nextChunkSize_ = std::min(nextChunkSize_ * 2, maxChunkSize_);
 }
 
 MemoryArena::~MemoryArena() {
 }
 
-void* MemoryArena::allocate(size_t size, size_t alignment) {
-    size_t alignedSize = (size + alignment - 1) & ~(alignment - 1);
-
-    if (currentBlock_->used + alignedSize > currentBlock_->size) {
-        auto newBlock = std::make_unique<Block>();
-        newBlock->size = std::max(blockSize_, alignedSize * 2);
-        newBlock->used = 0;
-        newBlock->data = std::make_unique<unsigned char[]>(newBlock->size);
-        newBlock->next = currentBlock_;
-        
-        blocks_.push_back(std::move(newBlock));
-        currentBlock_ = blocks_.back().get();
+void* MemoryArena::slowGrow(size_t size, size_t alignment) noexcept {
+    // 新块按倍增序列取大小，至少容下本次请求连同最坏情况的对齐填充。
+    // 分配走nothrow：allocate是noexcept热路径，失败以nullptr上报
+    std::unique_ptr<Block> newBlock(new (std::nothrow) Block());
+    if (!newBlock) {
+        return nullptr;
+    }
+    newBlock->size = std::max(nextChunkSize_, (size + alignment) * 2);
+    newBlock->data.reset(new (std::nothrow) unsigned char[newBlock->size]);
+    if (!newBlock->data) {
+        return nullptr;
     }
+    nextChunkSize_ = std::min(nextChunkSize_ * 2, maxChunkSize_);
 
-    void* ptr = &currentBlock_->data[currentBlock_->used];
-    currentBlock_->used += alignedSize;
+    cur_ = newBlock->data.get();
+    end_ = cur_ + newBlock->size;
+    blocks_.push_back(std::move(newBlock));
 
-    return ptr;
+    // 新块保证容得下，重做一次碰撞分配即命中
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(cur_) + alignment - 1) &
+                        ~(static_cast<uintptr_t>(alignment) - 1);
+    cur_ = reinterpret_cast<unsigned char*>(aligned + size);
+    used_ += size;
+    return reinterpret_cast<void*>(aligned);
 }
 
 void MemoryArena::reset() {
+    // O(1)复位：只拨回游标，不触碰数据页
+    used_ = 0;
+    cur_ = blocks_[0]->data.get();
+    end_ = cur_ + blocks_[0]->size;
+}
+
+void MemoryArena::resetSecure() {
     for (auto& block : blocks_) {
-        block->used = 0;
-    }
-    if (!blocks_.empty()) {
-        currentBlock_ = blocks_[0].get();
+        std::memset(block->data.get(), 0, block->size);
     }
+    reset();
 }
 
 size_t MemoryArena::getUsedMemory() const {
-    size_t total = 0;
-    for (const auto& block : blocks_) {
-        total += block->used;
-    }
-    return total;
+    return used_;
 }
 
 size_t MemoryArena::getTotalMemory() const {
@@ -220,70 +295,12 @@ size_t MemoryArena::getTotalMemory() const {
     return total;
 }
 
-template<typename T>
-SmartPtr<T>::SmartPtr(T* ptr)
-    : ptr_(ptr) {
-}
-
-template<typename T>
-SmartPtr<T>::~SmartPtr() {
-    if (ptr_) {
-        delete ptr_;
-    }
-}
-
-template<typename T>
-SmartPtr<T>::SmartPtr(SmartPtr&& other) noexcept
-    : ptr_(other.ptr_) {
-    other.ptr_ = nullptr;
-}
-
-template<typename T>
-SmartPtr<T>& SmartPtr<T>::operator=(SmartPtr&& other) noexcept {
-    if (this != &other) {
-        if (ptr_) {
-            delete ptr_;
-        }
-        ptr_ = other.ptr_;
-        other.ptr_ = nullptr;
-    }
-    return *this;
-}
-
-template<typename T>
-T* SmartPtr<T>::get() const {
-    return ptr_;
-}
-
-template<typename T>
-T& SmartPtr<T>::operator*() const {
-    return *ptr_;
-}
-
-template<typename T>
-T* SmartPtr<T>::operator->() const {
-    return ptr_;
-}
-
-template<typename T>
-SmartPtr<T>::operator bool() const {
-    return ptr_ != nullptr;
-}
-
-template<typename T>
-void SmartPtr<T>::reset() {
-    if (ptr_) {
-        delete ptr_;
-        ptr_ = nullptr;
-    }
-}
-
-template<typename T>
-T* SmartPtr<T>::release() {
-    T* temp = ptr_;
-    ptr_ = nullptr;
-    return temp;
-}
+// 显式实例化：模板成员体只在本TU编译一次，测试各TU经
+// extern template声明链接过来，优化也集中在这一处
+template class MemoryPool<int, 1024>;
+template class ObjectPool<int>;
+template class ObjectPool<std::string>;
+template class ObjectPool<std::pmr::string>;
 
 }
 }
\ No newline at end of file
@@ -6,40 +6,169 @@
 #include <mutex>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <array>
+#include <bit>
+#include <memory_resource>
+#include <string>
 
 namespace v3d {
 namespace core {
 
+// 内存池：分配/回收走线程本地缓存，常规路径不取锁不做原子CAS。
+// 节点头部带所属缓存标签，跨线程释放压到所属缓存的原子remote链，
+// 所属线程本地链耗尽时收割。全局锁只保护开新块和建缓存的慢路径，
+// 每BlockSize次分配才摸一次。用量计数按缓存分片，查询时汇总。
 template<typename T, size_t BlockSize = 1024>
 class MemoryPool {
 public:
     MemoryPool();
     ~MemoryPool();
 
+    // 热路径标hot：编译器把它们聚在一起排布，冷分支移出指令流
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
     T* allocate();
-    void deallocate(T* ptr);
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
+    void deallocate(T* ptr) noexcept;
 
+#if defined(__GNUC__)
+    [[gnu::cold]] [[gnu::noinline]]
+#endif
     void clear();
     size_t getUsedCount() const;
     size_t getCapacity() const;
     size_t getFreeCount() const;
 
 private:
-    struct Block {
-        alignas(T) unsigned char data[sizeof(T) * BlockSize];
-        std::unique_ptr<Block> next;
+    struct ThreadCache;
+
+    // 节点 - 所属缓存标签、空闲链next加载荷。
+    // next不与载荷复用存储：回收不抹载荷，复用时旧值仍在
+    struct Node {
+        ThreadCache* owner;
+        Node* next;
+        alignas(T) unsigned char payload[sizeof(T)];
     };
 
-    std::unique_ptr<Block> firstBlock_;
-    std::stack<T*> freeList_;
-    std::vector<std::unique_ptr<Block>> blocks_;
-    mutable std::mutex mutex_;
-    std::atomic<size_t> usedCount_;
+    // 线程缓存 - 本地空闲链加跨线程退还链，用量计数分片就地存放
+    struct ThreadCache {
+        Node* freeList = nullptr;              // 本地空闲链（无锁无原子）
+        std::atomic<Node*> remoteFree{nullptr}; // 跨线程退还链（MPSC）
+        std::atomic<long long> used{0};        // 用量分片（远程释放会使单片为负，总和正确）
+        std::thread::id ownerThread;           // 所属线程
+    };
+
+    // 线程本地入口 - 按池序列号识别，换池/clear后自动失效
+    struct TlsEntry {
+        uint64_t serial = 0;
+        ThreadCache* cache = nullptr;
+    };
+
+    ThreadCache* localCache();
+#if defined(__GNUC__)
+    [[gnu::cold]] [[gnu::noinline]]
+#endif
+    void refillLocked(ThreadCache* cache);
+
+    uint64_t serial_;                                 // 本池实例序列号（全局单调，不复用）
+    std::vector<std::unique_ptr<Node[]>> blocks_;     // 节点块存储
+    std::vector<std::unique_ptr<ThreadCache>> caches_; // 各线程缓存
+    mutable std::mutex mutex_;                        // 慢路径锁（开新块/建缓存/汇总）
     std::atomic<size_t> capacity_;
 
-    void allocateNewBlock();
+    static std::atomic<uint64_t> nextSerial_;
+    static thread_local TlsEntry tlsEntry_;
+};
+
+template<typename T, size_t BlockSize>
+std::atomic<uint64_t> MemoryPool<T, BlockSize>::nextSerial_{0};
+
+template<typename T, size_t BlockSize>
+thread_local typename MemoryPool<T, BlockSize>::TlsEntry MemoryPool<T, BlockSize>::tlsEntry_;
+
+// 位图池：定容池，空闲集是每字64槽的位图（1=空闲）。分配即
+// countr_zero找最低位+清位+指针算术，无链表可追；回收置位即可。
+// searchHint_记住最近有动静的字，常规场景第一个字就命中。
+// 单线程定容场景用；跨线程/不定容需求走MemoryPool或ObjectPool。
+template<typename T, size_t Capacity = 1024>
+class BitmapPool {
+public:
+    static_assert(Capacity > 0, "BitmapPool requires a non-zero capacity");
+
+    BitmapPool() {
+        clear();
+    }
+
+    /// @brief 分配一个槽；池满返回nullptr
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
+    T* allocate() noexcept {
+        for (size_t n = 0; n < kWords; ++n) {
+            size_t w = searchHint_ + n;
+            if (w >= kWords) {
+                w -= kWords;
+            }
+            if (uint64_t bits = freeBits_[w]) {
+                unsigned bit = static_cast<unsigned>(std::countr_zero(bits));
+                freeBits_[w] = bits & (bits - 1);  // 清最低置位
+                searchHint_ = w;
+                ++usedCount_;
+                return slot(w * 64 + bit);
+            }
+        }
+        return nullptr;
+    }
+
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
+    void deallocate(T* ptr) noexcept {
+        if (!ptr) return;
+
+        size_t index = static_cast<size_t>(ptr - slot(0));
+        freeBits_[index / 64] |= uint64_t{1} << (index % 64);
+        searchHint_ = index / 64;
+        --usedCount_;
+    }
+
+    void clear() {
+        freeBits_.fill(~uint64_t{0});
+        if (Capacity % 64 != 0) {
+            // 末字只有前Capacity%64个槽有效
+            freeBits_[kWords - 1] = (uint64_t{1} << (Capacity % 64)) - 1;
+        }
+        searchHint_ = 0;
+        usedCount_ = 0;
+    }
+
+    size_t getUsedCount() const { return usedCount_; }
+    static constexpr size_t getCapacity() { return Capacity; }
+
+private:
+    static constexpr size_t kWords = (Capacity + 63) / 64;
+
+    T* slot(size_t index) {
+        return reinterpret_cast<T*>(storage_) + index;
+    }
+
+    std::array<uint64_t, kWords> freeBits_;
+    size_t searchHint_ = 0;
+    size_t usedCount_ = 0;
+    alignas(T) unsigned char storage_[sizeof(T) * Capacity];
 };
 
+// 对象池：空闲链是无锁Treiber栈。acquire/release热路径各是一个
+// CAS循环，不再进互斥字；指针高16位藏一个代计数防ABA（用户态
+// 地址只占低48位）。互斥字只剩扩容/clear这类冷路径在用。
+// 节点内存池生命期内稳定不释放，弹栈时读node->next是安全的。
+// 节点板从内部monotonic_buffer_resource划拨；存PMR元素类型时
+// 可经memoryResource()让元素内容与节点共用同一片竞技场。
 template<typename T>
 class ObjectPool {
 public:
@@ -47,49 +176,296 @@ public:
     ~ObjectPool();
 
     template<typename... Args>
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
     T* acquire(Args&&... args);
 
-    void release(T* obj);
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
+    void release(T* obj) noexcept;
 
     void reserve(size_t size);
+#if defined(__GNUC__)
+    [[gnu::cold]] [[gnu::noinline]]
+#endif
     void clear();
 
     size_t getUsedCount() const;
     size_t getCapacity() const;
 
+    /**
+     * @brief 池的后备内存资源
+     *
+     * 存std::pmr::string之类的PMR元素时把它作为元素分配器传入，
+     * 元素堆块与节点板聚进同一片单调竞技场。资源本身不带同步，
+     * 并发acquire构造PMR元素需调用方自行串行化。
+     */
+    std::pmr::memory_resource* memoryResource() { return &slabResource_; }
+
 private:
-    std::vector<std::unique_ptr<T>> pool_;
-    std::stack<T*> freeList_;
+    // next为原子：弹栈方读它时推栈方可能正在改写，代计数CAS
+    // 保证读到旧值的那次交换必然失败，relaxed访问即足够
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static constexpr uint64_t kPtrMask = (uint64_t{1} << 48) - 1;
+
+    static Node* nodeOf(uint64_t head) {
+        return reinterpret_cast<Node*>(head & kPtrMask);
+    }
+    static uint64_t tagOf(uint64_t head) { return head >> 48; }
+    static uint64_t pack(Node* node, uint64_t tag) {
+        return (tag << 48) | reinterpret_cast<uint64_t>(node);
+    }
+
+    void pushChain(Node* first, Node* last) noexcept;
+#if defined(__GNUC__)
+    [[gnu::cold]] [[gnu::noinline]]
+#endif
+    void expandLocked(size_t size);
+
+    std::pmr::monotonic_buffer_resource slabResource_;
+    std::atomic<uint64_t> freeHead_;
     mutable std::mutex mutex_;
     std::atomic<size_t> usedCount_;
+    std::atomic<size_t> capacity_;
+};
 
-    void expand(size_t size);
+template<typename T>
+template<typename... Args>
+T* ObjectPool<T>::acquire(Args&&... args) {
+    for (;;) {
+        uint64_t head = freeHead_.load(std::memory_order_acquire);
+        while (Node* node = nodeOf(head)) {
+            // 弹栈CAS：换头同时递增代计数，避免ABA把旧next装回去
+            uint64_t next = pack(node->next.load(std::memory_order_relaxed),
+                                 tagOf(head) + 1);
+            if (freeHead_.compare_exchange_weak(head, next,
+                    std::memory_order_acq_rel, std::memory_order_acquire)) {
+                usedCount_.fetch_add(1, std::memory_order_relaxed);
+                return ::new (node->storage) T(std::forward<Args>(args)...);
+            }
+        }
+
+        // 空闲链耗尽才进锁扩容，扩完回到无锁路径重试
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!nodeOf(freeHead_.load(std::memory_order_acquire))) {
+            size_t current = capacity_.load(std::memory_order_relaxed);
+            expandLocked(current > 0 ? current : 1);
+        }
+    }
+}
+
+/**
+ * @struct ArenaOptions
+ * @brief 竞技场配置 - 起始块大小与块大小上限
+ */
+struct ArenaOptions {
+    size_t startBlockSize = 1024 * 1024;      ///< 首块大小
+    size_t maxBlockSize = 64 * 1024 * 1024;   ///< 块大小倍增上限
 };
 
+// 内存竞技场：纯指针碰撞分配。热路径是一次add+and对齐上取整、
+// 一次越界比较、一次游标回写，整体内联后只剩几条指令；
+// 开新块的扩容路径隔离在不内联的冷函数里，不污染调用方的指令流。
+// 新块按指数倍增（封顶maxBlockSize），持续分配只触发O(log N)次扩容。
 class MemoryArena {
 public:
     explicit MemoryArena(size_t initialSize = 1024 * 1024);
+    explicit MemoryArena(const ArenaOptions& options);
     ~MemoryArena();
 
-    void* allocate(size_t size, size_t alignment = 16);
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
+    void* allocate(size_t size, size_t alignment = 16) noexcept {
+        // alignment须为2的幂：上取整即add+mask，无模无分支
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(cur_) + alignment - 1) &
+                            ~(static_cast<uintptr_t>(alignment) - 1);
+        if (aligned + size > reinterpret_cast<uintptr_t>(end_)) {
+            return slowGrow(size, alignment);
+        }
+        cur_ = reinterpret_cast<unsigned char*>(aligned + size);
+        used_ += size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
     void reset();
 
+    /**
+     * @brief 重置并抹零所有块
+     *
+     * 敏感数据场景用：把每个块整块memset为0后再复位游标。
+     * 代价与总容量成正比，常规复用一律走O(1)的reset()。
+     */
+    void resetSecure();
+
     size_t getUsedMemory() const;
     size_t getTotalMemory() const;
 
 private:
     struct Block {
         size_t size;
-        size_t used;
         std::unique_ptr<unsigned char[]> data;
-        Block* next = nullptr;
     };
 
-    Block* currentBlock_;
+    /**
+     * @brief 扩容慢路径 - 开新块后重做一次碰撞分配
+     *
+     * 标记为冷且不内联，保证热路径在调用方内联成一小段直线代码。
+     */
+#if defined(__GNUC__)
+    [[gnu::cold]] [[gnu::noinline]]
+#endif
+    void* slowGrow(size_t size, size_t alignment) noexcept;
+
+    unsigned char* cur_ = nullptr;   ///< 碰撞游标
+    unsigned char* end_ = nullptr;   ///< 当前块末尾
+    size_t used_ = 0;                ///< 已分配字节数（按请求量计）
     std::vector<std::unique_ptr<Block>> blocks_;
-    size_t blockSize_;
+    size_t nextChunkSize_;           ///< 下一个新块的大小（每次扩容翻倍）
+    size_t maxChunkSize_;            ///< 块大小上限
 };
 
+// 线程本地slab分配器：分配/回收走本线程空闲链，不碰全局锁。
+// 跨线程释放压到所属slab的原子remote链，所属线程下次分配时收割。
+// 线程退出后slab进孤儿链等新线程复用，永不销毁，跨线程释放无悬垂。
+template<size_t BlockBytes>
+class TlsSlab {
+public:
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
+    static void* allocate() {
+        ThreadSlab* slab = localSlab();
+        Node* node = slab->pop();
+        return node->payload;
+    }
+
+#if defined(__GNUC__)
+    [[gnu::hot]]
+#endif
+    static void deallocate(void* ptr) noexcept {
+        if (!ptr) return;
+
+        Node* node = reinterpret_cast<Node*>(
+            static_cast<unsigned char*>(ptr) - offsetof(Node, payload));
+        ThreadSlab* owner = node->owner;
+
+        if (owner == tlsSlab_) {
+            owner->pushLocal(node);
+        } else {
+            owner->pushRemote(node);
+        }
+    }
+
+private:
+    static constexpr size_t kPageBytes = 64 * 1024;
+
+    struct ThreadSlab;
+
+    struct Node {
+        ThreadSlab* owner;
+        union {
+            Node* next;
+            alignas(std::max_align_t) unsigned char payload[BlockBytes];
+        };
+    };
+
+    struct ThreadSlab {
+        Node* freeList = nullptr;
+        std::atomic<Node*> remoteFree{nullptr};
+        std::vector<std::unique_ptr<Node[]>> pages;
+
+        Node* pop() {
+            if (!freeList) {
+                // 先收割其他线程退还的节点，再考虑开新页
+                freeList = remoteFree.exchange(nullptr, std::memory_order_acquire);
+            }
+            if (!freeList) {
+                addPage();
+            }
+
+            Node* node = freeList;
+            freeList = node->next;
+            return node;
+        }
+
+        void pushLocal(Node* node) {
+            node->next = freeList;
+            freeList = node;
+        }
+
+        void pushRemote(Node* node) {
+            Node* head = remoteFree.load(std::memory_order_relaxed);
+            do {
+                node->next = head;
+            } while (!remoteFree.compare_exchange_weak(head, node,
+                         std::memory_order_release, std::memory_order_relaxed));
+        }
+
+#if defined(__GNUC__)
+        [[gnu::cold]] [[gnu::noinline]]
+#endif
+        void addPage() {
+            size_t count = kPageBytes / sizeof(Node);
+            std::unique_ptr<Node[]> page(new Node[count]);
+
+            for (size_t i = 0; i < count; ++i) {
+                page[i].owner = this;
+                page[i].next = freeList;
+                freeList = &page[i];
+            }
+
+            pages.push_back(std::move(page));
+        }
+    };
+
+    struct SlabHolder {
+        ~SlabHolder() {
+            if (!tlsSlab_) return;
+
+            std::lock_guard<std::mutex> lock(orphanMutex_);
+            orphans_.push_back(tlsSlab_);
+            tlsSlab_ = nullptr;
+        }
+    };
+
+    static ThreadSlab* localSlab() {
+        if (!tlsSlab_) {
+            {
+                std::lock_guard<std::mutex> lock(orphanMutex_);
+                if (!orphans_.empty()) {
+                    tlsSlab_ = orphans_.back();
+                    orphans_.pop_back();
+                }
+            }
+            if (!tlsSlab_) {
+                tlsSlab_ = new ThreadSlab();
+            }
+        }
+        static thread_local SlabHolder holder;
+        return tlsSlab_;
+    }
+
+    static thread_local ThreadSlab* tlsSlab_;
+    static std::mutex orphanMutex_;
+    static std::vector<ThreadSlab*> orphans_;
+};
+
+template<size_t BlockBytes>
+thread_local typename TlsSlab<BlockBytes>::ThreadSlab* TlsSlab<BlockBytes>::tlsSlab_ = nullptr;
+
+template<size_t BlockBytes>
+std::mutex TlsSlab<BlockBytes>::orphanMutex_;
+
+template<size_t BlockBytes>
+std::vector<typename TlsSlab<BlockBytes>::ThreadSlab*> TlsSlab<BlockBytes>::orphans_;
+
 template<typename T>
 class SmartPtr {
 public:
@@ -115,5 +491,87 @@ private:
     T* ptr_;
 };
 
+template<typename T>
+SmartPtr<T>::SmartPtr(T* ptr)
+    : ptr_(ptr) {
+}
+
+template<typename T>
+SmartPtr<T>::~SmartPtr() {
+    if (ptr_) {
+        delete ptr_;
+    }
+}
+
+template<typename T>
+SmartPtr<T>::SmartPtr(SmartPtr&& other) noexcept
+    : ptr_(other.ptr_) {
+    other.ptr_ = nullptr;
+}
+
+template<typename T>
+SmartPtr<T>& SmartPtr<T>::operator=(SmartPtr&& other) noexcept {
+    if (this != &other) {
+        if (ptr_) {
+            delete ptr_;
+        }
+        ptr_ = other.ptr_;
+        other.ptr_ = nullptr;
+    }
+    return *this;
+}
+
+template<typename T>
+T* SmartPtr<T>::get() const {
+    return ptr_;
+}
+
+template<typename T>
+T& SmartPtr<T>::operator*() const {
+    return *ptr_;
+}
+
+template<typename T>
+T* SmartPtr<T>::operator->() const {
+    return ptr_;
+}
+
+template<typename T>
+SmartPtr<T>::operator bool() const {
+    return ptr_ != nullptr;
+}
+
+template<typename T>
+void SmartPtr<T>::reset() {
+    if (ptr_) {
+        delete ptr_;
+        ptr_ = nullptr;
+    }
+}
+
+template<typename T>
+T* SmartPtr<T>::release() {
+    T* temp = ptr_;
+    ptr_ = nullptr;
+    return temp;
+}
+
+/**
+ * @brief 单次分配构造SmartPtr管理的对象
+ *
+ * SmartPtr是独占指针，本身不带控制块，对象那一次new已经是
+ * 全部堆流量；工厂把构造收进单个表达式，省去裸new的中间态。
+ */
+template<typename T, typename... Args>
+SmartPtr<T> makeSmart(Args&&... args) {
+    return SmartPtr<T>(new T(std::forward<Args>(args)...));
+}
+
+// 常用特化在memory_pool.cpp集中实例化，这里只声明不重复展开
+extern template class MemoryPool<int, 1024>;
+extern template class ObjectPool<int>;
+extern template class ObjectPool<std::string>;
+extern template class ObjectPool<std::pmr::string>;
+
 }
 }
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "object_manager.h"
+#include <charconv>
+#include <cstdio>
 #include <random>
 #include <sstream>
 #include <iomanip>
@@ -6,6 +8,48 @@
 namespace v3d {
 namespace core {
 
+namespace {
+
+/// @brief splitmix64 - 每线程一个状态，生成128位随机ID的两半
+uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e9b5ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+uint64_t& tlsIdState() {
+    static thread_local uint64_t state = [] {
+        std::random_device rd;
+        return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    }();
+    return state;
+}
+
+}
+
+std::string ObjectId::toString() const {
+    char buf[33];
+    std::snprintf(buf, sizeof(buf), "%016llx%016llx",
+                  static_cast<unsigned long long>(hi),
+                  static_cast<unsigned long long>(lo));
+    return std::string(buf, 32);
+}
+
+ObjectId ObjectId::fromString(std::string_view text) {
+    ObjectId id;
+    if (text.size() != 32) {
+        return ObjectId{};
+    }
+    auto r1 = std::from_chars(text.data(), text.data() + 16, id.hi, 16);
+    auto r2 = std::from_chars(text.data() + 16, text.data() + 32, id.lo, 16);
+    if (r1.ec != std::errc{} || r2.ec != std::errc{} ||
+        r1.ptr != text.data() + 16 || r2.ptr != text.data() + 32) {
+        return ObjectId{};
+    }
+    return id;
+}
+
 Object::Object()
     : active_(true) {
     generateId();
@@ -15,7 +59,7 @@ Object::Object()
 Object::~Object() {
 }
 
-std::string Object::getId() const {
+ObjectId Object::getId() const {
     return id_;
 }
 
@@ -27,12 +71,12 @@ void Object::setName(const std::string& name) {
     name_ = name;
 }
 
-std::string Object::getType() const {
-    return type_;
+std::string_view Object::getType() const {
+    return type_.view();
 }
 
-std::string Object::getCategory() const {
-    return category_;
+std::string_view Object::getCategory() const {
+    return category_.view();
 }
 
 bool Object::isActive() const {
@@ -51,40 +95,8 @@ void Object::destroy() {
 }
 
 void Object::generateId() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(0, 15);
-
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-
-    for (int i = 0; i < 8; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-";
-
-    for (int i = 0; i < 4; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-4";
-
-    for (int i = 0; i < 3; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-";
-
-    ss << std::setw(1) << (8 + dis(gen) % 4);
-
-    for (int i = 0; i < 3; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-";
-
-    for (int i = 0; i < 12; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-
-    id_ = ss.str();
+    id_.hi = splitmix64(tlsIdState());
+    id_.lo = splitmix64(tlsIdState());
 }
 
 std::vector<std::string> Object::getComponentNames() const {
@@ -98,13 +110,9 @@ std::vector<std::string> Object::getComponentNames() const {
     return names;
 }
 
-ObjectManager& ObjectManager::getInstance() {
-    static ObjectManager instance;
-    return instance;
-}
-
 ObjectManager::ObjectManager()
-    : maxObjects_(10000) {
+    : objectCount_(0)
+    , maxObjects_(10000) {
 }
 
 ObjectManager::~ObjectManager() {
@@ -112,34 +120,59 @@ ObjectManager::~ObjectManager() {
 }
 
 void ObjectManager::destroyObject(const std::string& id) {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
+    destroyObject(ObjectId::fromString(id));
+}
+
+void ObjectManager::destroyObject(const ObjectId& id) {
+    std::string name;
+    {
+        ObjectShard& shard = objectShard(id);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
 
-    auto it = objects_.find(id);
-    if (it != objects_.end()) {
-        nameToIdMap_.erase(it->second->getName());
+        auto it = shard.objects.find(id);
+        if (it == shard.objects.end()) {
+            return;
+        }
+        name = it->second->getName();
         it->second->destroy();
-        objects_.erase(it);
+        shard.objects.erase(it);
     }
+
+    {
+        NameShard& shard = nameShard(name);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.nameToId.erase(name);
+    }
+    objectCount_.fetch_sub(1, std::memory_order_relaxed);
 }
 
 void ObjectManager::destroyAllObjects() {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
-
-    for (auto& pair : objects_) {
-        pair.second->destroy();
+    // 逐桶清空，任何时刻只持一把桶锁
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(objectShards_[i].mutex);
+        for (auto& pair : objectShards_[i].objects) {
+            pair.second->destroy();
+        }
+        objectShards_[i].objects.clear();
     }
-
-    objects_.clear();
-    nameToIdMap_.clear();
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(nameShards_[i].mutex);
+        nameShards_[i].nameToId.clear();
+    }
+    objectCount_.store(0, std::memory_order_relaxed);
 }
 
 std::vector<Object*> ObjectManager::getObjectsByCategory(const std::string& category) const {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
+    // 查询串只驻留一次，之后逐对象只做整数ID比较
+    const TypeId categoryId = TypeRegistry::reg(category);
     std::vector<Object*> result;
 
-    for (const auto& pair : objects_) {
-        if (pair.second->getCategory() == category) {
-            result.push_back(pair.second.get());
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::shared_lock<std::shared_mutex> lock(objectShards_[i].mutex);
+        for (const auto& pair : objectShards_[i].objects) {
+            if (pair.second->category_.id() == categoryId) {
+                result.push_back(pair.second.get());
+            }
         }
     }
 
@@ -147,34 +180,46 @@ std::vector<Object*> ObjectManager::getObjectsByCategory(const std::string& cate
 }
 
 std::vector<Object*> ObjectManager::getActiveObjects() const {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
     std::vector<Object*> result;
 
-    for (const auto& pair : objects_) {
-        if (pair.second->isActive()) {
-            result.push_back(pair.second.get());
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::shared_lock<std::shared_mutex> lock(objectShards_[i].mutex);
+        for (const auto& pair : objectShards_[i].objects) {
+            if (pair.second->isActive()) {
+                result.push_back(pair.second.get());
+            }
         }
     }
 
     return result;
 }
 
-Object* ObjectManager::findObject(const std::string& name) const {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
+Object* ObjectManager::findObject(std::string_view name) const {
+    ObjectId id;
+    {
+        NameShard& shard = nameShard(name);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
 
-    auto it = nameToIdMap_.find(name);
-    if (it != nameToIdMap_.end()) {
-        return objects_.at(it->second).get();
+        auto it = shard.nameToId.find(name);
+        if (it == shard.nameToId.end()) {
+            return nullptr;
+        }
+        id = it->second;
     }
 
-    return nullptr;
+    return findObjectById(id);
 }
 
 Object* ObjectManager::findObjectById(const std::string& id) const {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
+    return findObjectById(ObjectId::fromString(id));
+}
+
+Object* ObjectManager::findObjectById(const ObjectId& id) const {
+    ObjectShard& shard = objectShard(id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
 
-    auto it = objects_.find(id);
-    if (it != objects_.end()) {
+    auto it = shard.objects.find(id);
+    if (it != shard.objects.end()) {
         return it->second.get();
     }
 
@@ -182,26 +227,28 @@ Object* ObjectManager::findObjectById(const std::string& id) const {
 }
 
 void ObjectManager::updateAllObjects(float deltaTime) {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
-
-    for (auto& pair : objects_) {
-        if (pair.second->isActive()) {
-            pair.second->update(deltaTime);
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::shared_lock<std::shared_mutex> lock(objectShards_[i].mutex);
+        for (auto& pair : objectShards_[i].objects) {
+            if (pair.second->isActive()) {
+                pair.second->update(deltaTime);
+            }
         }
     }
 }
 
 size_t ObjectManager::getObjectCount() const {
-    return objects_.size();
+    return objectCount_.load(std::memory_order_relaxed);
 }
 
 size_t ObjectManager::getActiveObjectCount() const {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
-
     size_t count = 0;
-    for (const auto& pair : objects_) {
-        if (pair.second->isActive()) {
-            count++;
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::shared_lock<std::shared_mutex> lock(objectShards_[i].mutex);
+        for (const auto& pair : objectShards_[i].objects) {
+            if (pair.second->isActive()) {
+                count++;
+            }
         }
     }
 
@@ -216,41 +263,12 @@ size_t ObjectManager::getMaxObjects() const {
     return maxObjects_;
 }
 
-std::string ObjectManager::generateId() const {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(0, 15);
-
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-
-    for (int i = 0; i < 8; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-";
-
-    for (int i = 0; i < 4; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-4";
-
-    for (int i = 0; i < 3; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-";
-
-    ss << std::setw(1) << (8 + dis(gen) % 4);
-
-    for (int i = 0; i < 3; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-    ss << "-";
-
-    for (int i = 0; i < 12; ++i) {
-        ss << std::setw(1) << dis(gen);
-    }
-
-    return ss.str();
+ObjectId ObjectManager::generateId() const {
+    // 每线程一个splitmix状态，生成不取锁不摸堆
+    ObjectId id;
+    id.hi = splitmix64(tlsIdState());
+    id.lo = splitmix64(tlsIdState());
+    return id;
 }
 
 }
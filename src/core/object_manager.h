@@ -1,5 +1,7 @@
 #pragma once
 
+#include "event_system.h"
+
 #include <string>
 #include <unordered_map>
 #include <memory>
@@ -7,12 +9,88 @@
 #include <typeindex>
 #include <vector>
 #include <mutex>
+#include <shared_mutex>
 #include <atomic>
 #include <random>
 
 namespace v3d {
 namespace core {
 
+/**
+ * @class InternedString
+ * @brief 驻留字符串 - 只存注册表整数ID的轻量句柄
+ *
+ * 赋值时把内容驻留进TypeRegistry，之后比较走整数，
+ * 读取返回注册表内的稳定string_view，自身不持有堆内存。
+ */
+class InternedString {
+public:
+    static constexpr TypeId kUnset = ~TypeId{0};
+
+    InternedString() = default;
+    InternedString(std::string_view text) : id_(TypeRegistry::reg(text)) {}
+
+    InternedString& operator=(std::string_view text) {
+        id_ = TypeRegistry::reg(text);
+        return *this;
+    }
+
+    std::string_view view() const {
+        return id_ == kUnset ? std::string_view() : std::string_view(TypeRegistry::name(id_));
+    }
+
+    TypeId id() const { return id_; }
+    bool empty() const { return id_ == kUnset; }
+
+    bool operator==(const InternedString& other) const { return id_ == other.id_; }
+
+private:
+    TypeId id_ = kUnset;
+};
+
+/**
+ * @struct ObjectId
+ * @brief 对象ID - 128位随机整数，替代UUID字符串
+ *
+ * 生成不摸堆，比较是两次整数比较；低64位本身已随机，
+ * 直接充当哈希值。字符串形式只在需要展示/互操作时转换。
+ */
+struct ObjectId {
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+
+    bool empty() const { return (hi | lo) == 0; }
+
+    /// @brief 转成32个十六进制字符的字符串（冷路径）
+    std::string toString() const;
+
+    /// @brief 从字符串形式解析；非法输入返回空ID
+    static ObjectId fromString(std::string_view text);
+
+    operator std::string() const { return toString(); }
+
+    bool operator==(const ObjectId& other) const {
+        return hi == other.hi && lo == other.lo;
+    }
+
+    /// @brief 与字符串形式直接比较（测试/日志里的便捷用法）
+    bool operator==(std::string_view text) const { return toString() == text; }
+};
+
+/// @brief 对象ID哈希 - 低64位已随机，原样即是哈希值
+struct ObjectIdHash {
+    size_t operator()(const ObjectId& id) const { return static_cast<size_t>(id.lo); }
+};
+
+/// @brief 透明字符串哈希 - 按view散列，异构查找不再构造临时string
+/// （标准保证同内容的string与string_view哈希值一致）
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view text) const {
+        return std::hash<std::string_view>{}(text);
+    }
+};
+
 class Object {
 public:
     friend class ObjectManager;
@@ -20,12 +98,12 @@ public:
     Object();
     virtual ~Object();
 
-    std::string getId() const;
+    ObjectId getId() const;
     std::string getName() const;
     void setName(const std::string& name);
 
-    std::string getType() const;
-    std::string getCategory() const;
+    std::string_view getType() const;
+    std::string_view getCategory() const;
 
     bool isActive() const;
     void setActive(bool active);
@@ -45,10 +123,11 @@ public:
     std::vector<std::string> getComponentNames() const;
 
 protected:
-    std::string id_;
+    ObjectId id_;
     std::string name_;
-    std::string type_;
-    std::string category_;
+    InternedString type_;      ///< 类型名驻留句柄（整数比较）
+    InternedString category_;  ///< 分类名驻留句柄（整数比较）
+    uint32_t createTypeId_ = ~uint32_t{0};  ///< 创建时的静态类型ID（见StaticTypeId）
     bool active_;
 
     struct ComponentWrapper {
@@ -69,18 +148,38 @@ protected:
     void generateId();
 };
 
+// 对象管理器：id/名字注册表按hash(id)分成16个桶，各桶独立
+// shared_mutex。多线程建/查/删只碰各自桶的锁，全局不再有单一
+// 互斥字的缓存行乒乓；总量计数走原子变量，上限检查无锁。
 class ObjectManager {
 public:
-    static ObjectManager& getInstance();
+    /// @brief 发放稠密类型ID - 每个静态类型进程内只领一次
+    static uint32_t allocateTypeId() {
+        static std::atomic<uint32_t> next{0};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief 取单例 - C++11静态局部保证线程安全初始化；
+    /// 定义放头文件里，调用方可内联掉跨编译单元的函数调用
+    static ObjectManager& getInstance() {
+        static ObjectManager instance;
+        return instance;
+    }
 
     template<typename T, typename... Args>
     T* createObject(Args&&... args);
 
+    void destroyObject(const ObjectId& id);
     void destroyObject(const std::string& id);
     void destroyAllObjects();
 
     template<typename T>
-    T* getObject(const std::string& id) const;
+    T* getObject(const ObjectId& id) const;
+
+    template<typename T>
+    T* getObject(const std::string& id) const {
+        return getObject<T>(ObjectId::fromString(id));
+    }
 
     template<typename T>
     std::vector<T*> getObjectsByType() const;
@@ -88,7 +187,8 @@ public:
     std::vector<Object*> getObjectsByCategory(const std::string& category) const;
     std::vector<Object*> getActiveObjects() const;
 
-    Object* findObject(const std::string& name) const;
+    Object* findObject(std::string_view name) const;
+    Object* findObjectById(const ObjectId& id) const;
     Object* findObjectById(const std::string& id) const;
 
     void updateAllObjects(float deltaTime);
@@ -103,14 +203,48 @@ private:
     ObjectManager();
     ~ObjectManager();
 
-    std::string generateId() const;
+    ObjectId generateId() const;
+
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kShardMask = kShardCount - 1;
+
+    // 分片 - id主表与对应的读写锁；名字索引按hash(名字)另行分片
+    struct ObjectShard {
+        std::unordered_map<ObjectId, std::unique_ptr<Object>, ObjectIdHash> objects;
+        mutable std::shared_mutex mutex;
+    };
+
+    struct NameShard {
+        std::unordered_map<std::string, ObjectId,
+                           TransparentStringHash, std::equal_to<>> nameToId;
+        mutable std::shared_mutex mutex;
+    };
+
+    ObjectShard& objectShard(const ObjectId& id) const {
+        return objectShards_[id.lo & kShardMask];
+    }
+
+    NameShard& nameShard(std::string_view name) const {
+        return nameShards_[std::hash<std::string_view>{}(name) & kShardMask];
+    }
 
-    std::unordered_map<std::string, std::unique_ptr<Object>> objects_;
-    std::unordered_map<std::string, std::string> nameToIdMap_;
-    mutable std::mutex objectsMutex_;
+    mutable ObjectShard objectShards_[kShardCount];
+    mutable NameShard nameShards_[kShardCount];
+    std::atomic<size_t> objectCount_;
     std::atomic<size_t> maxObjects_;
 };
 
+/**
+ * @struct StaticTypeId
+ * @brief 编译期挂钩的稠密类型ID - 每个T首次触到时领号，之后是常量
+ *
+ * 类型查询用它做整数比较，不走typeid/dynamic_cast的RTTI机制。
+ */
+template<typename T>
+struct StaticTypeId {
+    static inline const uint32_t value = ObjectManager::allocateTypeId();
+};
+
 template<typename T>
 class ObjectFactory {
 public:
@@ -161,30 +295,40 @@ T* ObjectManager::createObject(Args&&... args) {
     auto obj = std::make_unique<T>(std::forward<Args>(args)...);
     T* rawPtr = obj.get();
 
-    std::lock_guard<std::mutex> lock(objectsMutex_);
-
-    if (objects_.size() >= maxObjects_) {
+    // 上限检查走原子计数：先占名额，超限回退，不取任何锁
+    if (objectCount_.fetch_add(1, std::memory_order_relaxed) >= maxObjects_) {
+        objectCount_.fetch_sub(1, std::memory_order_relaxed);
         return nullptr;
     }
 
-    std::string id = generateId();
+    ObjectId id = generateId();
     obj->id_ = id;
+    obj->createTypeId_ = StaticTypeId<T>::value;
 
     if (obj->name_.empty()) {
-        obj->name_ = obj->type_ + "_" + id.substr(0, 8);
+        obj->name_ = std::string(obj->type_.view()) + "_" + id.toString().substr(0, 8);
     }
 
-    nameToIdMap_[obj->name_] = id;
-    objects_[id] = std::move(obj);
+    {
+        NameShard& shard = nameShard(obj->name_);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.nameToId[obj->name_] = id;
+    }
+    {
+        ObjectShard& shard = objectShard(id);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.objects[id] = std::move(obj);
+    }
 
     return rawPtr;
 }
 
 template<typename T>
-T* ObjectManager::getObject(const std::string& id) const {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
-    auto it = objects_.find(id);
-    if (it != objects_.end()) {
+T* ObjectManager::getObject(const ObjectId& id) const {
+    ObjectShard& shard = objectShard(id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.objects.find(id);
+    if (it != shard.objects.end()) {
         return dynamic_cast<T*>(it->second.get());
     }
     return nullptr;
@@ -192,12 +336,16 @@ T* ObjectManager::getObject(const std::string& id) const {
 
 template<typename T>
 std::vector<T*> ObjectManager::getObjectsByType() const {
-    std::lock_guard<std::mutex> lock(objectsMutex_);
+    // 创建类型比较是纯整数：命中即可static_cast，无RTTI查询
+    const uint32_t typeId = StaticTypeId<T>::value;
     std::vector<T*> result;
 
-    for (const auto& pair : objects_) {
-        if (auto obj = dynamic_cast<T*>(pair.second.get())) {
-            result.push_back(obj);
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::shared_lock<std::shared_mutex> lock(objectShards_[i].mutex);
+        for (const auto& pair : objectShards_[i].objects) {
+            if (pair.second->createTypeId_ == typeId) {
+                result.push_back(static_cast<T*>(pair.second.get()));
+            }
         }
     }
 
@@ -25,60 +25,85 @@ CommandManager::~CommandManager() {
 }
 
 void CommandManager::executeCommand(std::unique_ptr<Command> command) {
-    command->execute();
+    pushExecuted(CommandSlot{command.release(), false});
+}
 
-    if (!redoStack_.empty()) {
-        while (!redoStack_.empty()) {
-            currentMemoryUsage_ -= redoStack_.top()->getMemorySize();
-            redoStack_.pop();
-        }
-    }
+void CommandManager::destroySlot(CommandSlot& slot) {
+    if (!slot.command) return;
 
-    if (!undoStack_.empty() && command->isMergeableWith(undoStack_.top().get())) {
-        undoStack_.top()->mergeWith(command.get());
+    if (slot.arenaOwned) {
+        // Arena memory is reclaimed wholesale on the next full clear()
+        slot.command->~Command();
     } else {
-        currentMemoryUsage_ += command->getMemorySize();
-        undoStack_.push(std::move(command));
+        delete slot.command;
+    }
+    slot.command = nullptr;
+}
+
+bool CommandManager::pushExecuted(CommandSlot slot) {
+    slot.command->execute();
+
+    while (!redoStack_.empty()) {
+        currentMemoryUsage_ -= redoStack_.top().command->getMemorySize();
+        destroySlot(redoStack_.top());
+        redoStack_.pop();
+    }
+
+    if (!undoStack_.empty() && slot.command->isMergeableWith(undoStack_.top().command)) {
+        undoStack_.top().command->mergeWith(slot.command);
+        destroySlot(slot);
+        trimMemory();
+        trimSteps();
+        return false;
     }
 
+    currentMemoryUsage_ += slot.command->getMemorySize();
+    undoStack_.push(slot);
+
     trimMemory();
     trimSteps();
+    return true;
 }
 
 void CommandManager::undo() {
     if (undoStack_.empty()) return;
 
-    auto command = std::move(undoStack_.top());
+    CommandSlot slot = undoStack_.top();
     undoStack_.pop();
-    currentMemoryUsage_ -= command->getMemorySize();
+    currentMemoryUsage_ -= slot.command->getMemorySize();
 
-    command->undo();
-    currentMemoryUsage_ += command->getMemorySize();
-    redoStack_.push(std::move(command));
+    slot.command->undo();
+    currentMemoryUsage_ += slot.command->getMemorySize();
+    redoStack_.push(slot);
 }
 
 void CommandManager::redo() {
     if (redoStack_.empty()) return;
 
-    auto command = std::move(redoStack_.top());
+    CommandSlot slot = redoStack_.top();
     redoStack_.pop();
-    currentMemoryUsage_ -= command->getMemorySize();
+    currentMemoryUsage_ -= slot.command->getMemorySize();
 
-    command->redo();
-    currentMemoryUsage_ += command->getMemorySize();
-    undoStack_.push(std::move(command));
+    slot.command->redo();
+    currentMemoryUsage_ += slot.command->getMemorySize();
+    undoStack_.push(slot);
 }
 
 void CommandManager::clear() {
     while (!undoStack_.empty()) {
-        currentMemoryUsage_ -= undoStack_.top()->getMemorySize();
+        currentMemoryUsage_ -= undoStack_.top().command->getMemorySize();
+        destroySlot(undoStack_.top());
         undoStack_.pop();
     }
     while (!redoStack_.empty()) {
-        currentMemoryUsage_ -= redoStack_.top()->getMemorySize();
+        currentMemoryUsage_ -= redoStack_.top().command->getMemorySize();
+        destroySlot(redoStack_.top());
         redoStack_.pop();
     }
-    checkpoints_.clear();
+    clearCheckpoints();
+
+    // Nothing references the arena anymore: reclaim every command in O(1)
+    arena_.reset();
 }
 
 bool CommandManager::canUndo() const {
@@ -90,11 +115,11 @@ bool CommandManager::canRedo() const {
 }
 
 std::string CommandManager::getUndoDescription() const {
-    return undoStack_.empty() ? "" : undoStack_.top()->getDescription();
+    return undoStack_.empty() ? "" : undoStack_.top().command->getDescription();
 }
 
 std::string CommandManager::getRedoDescription() const {
-    return redoStack_.empty() ? "" : redoStack_.top()->getDescription();
+    return redoStack_.empty() ? "" : redoStack_.top().command->getDescription();
 }
 
 size_t CommandManager::getUndoStackSize() const {
@@ -120,10 +145,10 @@ void CommandManager::setMaxUndoSteps(size_t maxSteps) {
 }
 
 void CommandManager::saveCheckpoint(const std::string& name) {
-    std::vector<std::unique_ptr<Command>> checkpointCommands;
+    std::vector<CommandSlot> checkpointCommands;
 
     while (!undoStack_.empty()) {
-        checkpointCommands.push_back(std::move(undoStack_.top()));
+        checkpointCommands.push_back(undoStack_.top());
         undoStack_.pop();
     }
 
@@ -134,16 +159,38 @@ void CommandManager::saveCheckpoint(const std::string& name) {
 void CommandManager::loadCheckpoint(const std::string& name) {
     auto it = std::find_if(checkpoints_.begin(), checkpoints_.end(),
         [&name](const auto& pair) { return pair.first == name; });
+    if (it == checkpoints_.end()) {
+        return;
+    }
 
-    if (it != checkpoints_.end()) {
-        clear();
-        for (const auto& command : it->second) {
-            executeCommand(std::unique_ptr<Command>(command->clone()));
-        }
+    // Clone before clear(): clear() destroys the checkpoints (and may
+    // reset the arena the originals live in). Handles keep small clones
+    // in their inline buffers instead of one heap allocation each.
+    std::vector<CommandHandle> clones;
+    clones.reserve(it->second.size());
+    for (const auto& slot : it->second) {
+        clones.emplace_back(*slot.command);
+    }
+
+    clear();
+    for (const auto& handle : clones) {
+        // Re-clone into the arena; a command without a cloneInto override
+        // heap-clones instead and the slot is tagged accordingly
+        const Command& source = *handle.get();
+        void* mem = arena_.allocate(source.getMemorySize(),
+                                    alignof(std::max_align_t));
+        Command* command = source.cloneInto(mem);
+        pushExecuted(CommandSlot{command, command == mem});
     }
 }
 
 void CommandManager::clearCheckpoints() {
+    for (auto& checkpoint : checkpoints_) {
+        for (auto& slot : checkpoint.second) {
+            currentMemoryUsage_ -= slot.command->getMemorySize();
+            destroySlot(slot);
+        }
+    }
     checkpoints_.clear();
 }
 
@@ -157,14 +204,16 @@ std::vector<std::string> CommandManager::getCheckpointNames() const {
 
 void CommandManager::trimMemory() {
     while (currentMemoryUsage_ > maxMemorySize_ && !undoStack_.empty()) {
-        currentMemoryUsage_ -= undoStack_.top()->getMemorySize();
+        currentMemoryUsage_ -= undoStack_.top().command->getMemorySize();
+        destroySlot(undoStack_.top());
         undoStack_.pop();
     }
 }
 
 void CommandManager::trimSteps() {
     while (undoStack_.size() > maxUndoSteps_ && !undoStack_.empty()) {
-        currentMemoryUsage_ -= undoStack_.top()->getMemorySize();
+        currentMemoryUsage_ -= undoStack_.top().command->getMemorySize();
+        destroySlot(undoStack_.top());
         undoStack_.pop();
     }
 }
@@ -181,20 +230,48 @@ ChangeTracker::~ChangeTracker() {
 }
 
 void ChangeTracker::recordChange(const ChangeRecord& record) {
-    changeHistory_.push_back(record);
+    ChangeRecordCompact compact;
+    compact.objectId = strings_.intern(record.objectId);
+    compact.propertyName = strings_.intern(record.propertyName);
+    compact.oldValue = strings_.intern(record.oldValue);
+    compact.newValue = strings_.intern(record.newValue);
+    compact.userId = strings_.intern(record.userId);
+    compact.sessionId = strings_.intern(record.sessionId);
+    compact.timestampNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            record.timestamp.time_since_epoch()).count());
+    changeHistory_.push_back(compact);
+}
+
+ChangeTracker::ChangeRecord ChangeTracker::expand(const ChangeRecordCompact& compact) const {
+    ChangeRecord record;
+    record.objectId = strings_.text(compact.objectId);
+    record.propertyName = strings_.text(compact.propertyName);
+    record.oldValue = strings_.text(compact.oldValue);
+    record.newValue = strings_.text(compact.newValue);
+    record.userId = strings_.text(compact.userId);
+    record.sessionId = strings_.text(compact.sessionId);
+    record.timestamp = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(compact.timestampNs)));
+    return record;
 }
 
 std::vector<ChangeTracker::ChangeRecord> ChangeTracker::getChangeHistory(
     const std::string& objectId) const {
 
-    if (objectId.empty()) {
-        return changeHistory_;
+    // The filter string is looked up once; the scan itself compares ids
+    const uint32_t wantedId = objectId.empty() ? StringTable::kNotFound
+                                               : strings_.find(objectId);
+    if (!objectId.empty() && wantedId == StringTable::kNotFound) {
+        return {};
     }
 
     std::vector<ChangeRecord> filtered;
-    for (const auto& record : changeHistory_) {
-        if (record.objectId == objectId) {
-            filtered.push_back(record);
+    for (size_t i = 0; i < changeHistory_.size(); ++i) {
+        const ChangeRecordCompact& record = changeHistory_[i];
+        if (objectId.empty() || record.objectId == wantedId) {
+            filtered.push_back(expand(record));
         }
     }
     return filtered;
@@ -203,10 +280,15 @@ std::vector<ChangeTracker::ChangeRecord> ChangeTracker::getChangeHistory(
 std::vector<ChangeTracker::ChangeRecord> ChangeTracker::getChangesSince(
     const std::chrono::system_clock::time_point& time) const {
 
+    const uint64_t sinceNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            time.time_since_epoch()).count());
+
     std::vector<ChangeRecord> filtered;
-    for (const auto& record : changeHistory_) {
-        if (record.timestamp >= time) {
-            filtered.push_back(record);
+    for (size_t i = 0; i < changeHistory_.size(); ++i) {
+        const ChangeRecordCompact& record = changeHistory_[i];
+        if (record.timestampNs >= sinceNs) {
+            filtered.push_back(expand(record));
         }
     }
     return filtered;
@@ -214,7 +296,8 @@ std::vector<ChangeTracker::ChangeRecord> ChangeTracker::getChangesSince(
 
 void ChangeTracker::exportChanges(const std::string& filePath) const {
     nlohmann::json j;
-    for (const auto& record : changeHistory_) {
+    for (size_t i = 0; i < changeHistory_.size(); ++i) {
+        const ChangeRecord record = expand(changeHistory_[i]);
         j.push_back({
             {"objectId", record.objectId},
             {"propertyName", record.propertyName},
@@ -244,12 +327,13 @@ void ChangeTracker::importChanges(const std::string& filePath) {
         record.timestamp = std::chrono::system_clock::from_time_t(item["timestamp"]);
         record.userId = item["userId"];
         record.sessionId = item["sessionId"];
-        changeHistory_.push_back(record);
+        recordChange(record);
     }
 }
 
 void ChangeTracker::clear() {
     changeHistory_.clear();
+    strings_.clear();
 }
 
 VersionManager& VersionManager::getInstance() {
@@ -286,8 +370,8 @@ std::string VersionManager::createVersion(const std::string& description, const
     versions_.push_back(info);
     currentVersion_ = info.versionId;
 
-    if (versions_.size() > maxVersions_) {
-        versions_.erase(versions_.begin());
+    while (versions_.size() > maxVersions_) {
+        versions_.pop_front();
     }
 
     return info.versionId;
@@ -326,7 +410,7 @@ VersionManager::VersionInfo VersionManager::getVersionInfo(const std::string& ve
 }
 
 std::vector<VersionManager::VersionInfo> VersionManager::getVersionHistory() const {
-    return versions_;
+    return {versions_.begin(), versions_.end()};
 }
 
 std::vector<VersionManager::VersionInfo> VersionManager::getVersionBranch(const std::string& versionId) const {
@@ -14,12 +14,20 @@
 
 #pragma once
 
+#include "memory_pool.h"
+
+#include <array>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <vector>
 #include <functional>
 #include <stack>
 #include <string>
 #include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <deque>
 
 namespace v3d {
 namespace core {
@@ -43,17 +51,109 @@ public:
     virtual bool isMergeableWith(const Command* other) const { return false; }
     virtual void mergeWith(Command* other) {}
     virtual Command* clone() const = 0;
+
+    /**
+     * @brief Placement-clone into caller-provided storage
+     *
+     * dst must hold at least getMemorySize() bytes, max_align_t aligned.
+     * Subclasses override with a placement-new of themselves; the default
+     * falls back to the heap clone() and ignores dst, which callers detect
+     * by the returned pointer not being dst.
+     */
+    virtual Command* cloneInto(void* dst) const {
+        (void)dst;
+        return clone();
+    }
+};
+
+/**
+ * @class CommandHandle
+ * @brief Owning clone of a command with a small-buffer optimization
+ *
+ * Commands whose getMemorySize() fits the inline buffer are cloned in
+ * place via cloneInto(); larger ones (or ones without a cloneInto
+ * override) fall back to a heap clone. Used by checkpoint restore to
+ * hold clones without one heap allocation per command.
+ */
+class CommandHandle {
+public:
+    static constexpr size_t kInlineBytes = 128;
+
+    explicit CommandHandle(const Command& source) {
+        adopt(source);
+    }
+
+    CommandHandle(const CommandHandle& other) {
+        adopt(*other.command_);
+    }
+
+    CommandHandle& operator=(const CommandHandle& other) {
+        if (this != &other) {
+            destroy();
+            adopt(*other.command_);
+        }
+        return *this;
+    }
+
+    ~CommandHandle() {
+        destroy();
+    }
+
+    Command* get() const { return command_; }
+
+private:
+    void adopt(const Command& source) {
+        if (source.getMemorySize() <= kInlineBytes) {
+            command_ = source.cloneInto(buffer_);
+        } else {
+            command_ = source.clone();
+        }
+    }
+
+    void destroy() {
+        if (isInline()) {
+            command_->~Command();
+        } else {
+            delete command_;
+        }
+        command_ = nullptr;
+    }
+
+    bool isInline() const {
+        return reinterpret_cast<const unsigned char*>(command_) == buffer_;
+    }
+
+    alignas(std::max_align_t) unsigned char buffer_[kInlineBytes];
+    Command* command_ = nullptr;
 };
 
 /**
  * @class CommandManager
  * @brief Command Manager - Manages command execution, undo and redo
+ *
+ * Commands created through execute<C>() are placement-constructed in the
+ * manager's bump-pointer arena instead of individually heap-allocated;
+ * their bytes are reclaimed in one O(1) arena reset when clear() drains
+ * everything. Heap-owned commands via executeCommand() keep working.
  */
 class CommandManager {
 public:
     static CommandManager& getInstance();
     
     void executeCommand(std::unique_ptr<Command> command);
+
+    /**
+     * @brief Construct a command in the arena, execute it and push it on the undo stack
+     * @return The command, or nullptr if it was merged into the previous one
+     */
+    template<typename C, typename... Args>
+    C* execute(Args&&... args) {
+        static_assert(std::is_base_of_v<Command, C>,
+                      "execute<C> requires a Command subclass");
+        void* mem = arena_.allocate(sizeof(C), alignof(C));
+        C* command = ::new (mem) C(std::forward<Args>(args)...);
+        return pushExecuted(CommandSlot{command, true}) ? command : nullptr;
+    }
     void undo();
     void redo();
     void clear();
@@ -72,19 +172,72 @@ public:
     std::vector<std::string> getCheckpointNames() const;
 
 private:
+    // Command plus its ownership: arena-resident commands only run their
+    // destructor when dropped, heap commands are deleted outright
+    struct CommandSlot {
+        Command* command = nullptr;
+        bool arenaOwned = false;
+    };
+
     CommandManager();
     ~CommandManager();
+    bool pushExecuted(CommandSlot slot);
+    void destroySlot(CommandSlot& slot);
     void trimMemory();
     void trimSteps();
 
-    std::stack<std::unique_ptr<Command>> undoStack_;
-    std::stack<std::unique_ptr<Command>> redoStack_;
-    std::vector<std::pair<std::string, std::vector<std::unique_ptr<Command>>>> checkpoints_;
+    std::stack<CommandSlot> undoStack_;
+    std::stack<CommandSlot> redoStack_;
+    std::vector<std::pair<std::string, std::vector<CommandSlot>>> checkpoints_;
+    MemoryArena arena_{64 * 1024};
     size_t maxMemorySize_;
     size_t maxUndoSteps_;
     size_t currentMemoryUsage_;
 };
 
+/**
+ * @class SegmentedVector
+ * @brief Append-only log of fixed-size segments - pushes never relocate
+ *
+ * Growth allocates a new segment instead of reallocating and copying the
+ * whole backing store, so appended elements stay put and a push is a
+ * division/modulo pair plus an occasional segment allocation.
+ */
+template<typename T, size_t SegmentSize = 256>
+class SegmentedVector {
+public:
+    void push_back(const T& value) { appendSlot() = value; }
+    void push_back(T&& value) { appendSlot() = std::move(value); }
+
+    T& operator[](size_t index) {
+        return (*segments_[index / SegmentSize])[index % SegmentSize];
+    }
+    const T& operator[](size_t index) const {
+        return (*segments_[index / SegmentSize])[index % SegmentSize];
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear() {
+        segments_.clear();
+        size_ = 0;
+    }
+
+private:
+    T& appendSlot() {
+        if (size_ == segments_.size() * SegmentSize) {
+            segments_.push_back(std::make_unique<std::array<T, SegmentSize>>());
+        }
+        T& slot = (*segments_[size_ / SegmentSize])[size_ % SegmentSize];
+        ++size_;
+        return slot;
+    }
+
+    std::vector<std::unique_ptr<std::array<T, SegmentSize>>> segments_;
+    size_t size_ = 0;
+};
+
 /**
  * @class ChangeTracker
  * @brief Change Tracker - Records all property change history
@@ -110,9 +263,67 @@ public:
     void clear();
 
 private:
+    /**
+     * @class StringTable
+     * @brief Deduplicating store - maps repeated field text to dense 32-bit ids
+     */
+    class StringTable {
+    public:
+        static constexpr uint32_t kNotFound = ~uint32_t{0};
+
+        uint32_t intern(const std::string& text) {
+            auto it = lookup_.find(text);
+            if (it != lookup_.end()) {
+                return it->second;
+            }
+            uint32_t id = static_cast<uint32_t>(strings_.size());
+            strings_.push_back(text);
+            lookup_.emplace(text, id);
+            return id;
+        }
+
+        uint32_t find(const std::string& text) const {
+            auto it = lookup_.find(text);
+            return it != lookup_.end() ? it->second : kNotFound;
+        }
+
+        const std::string& text(uint32_t id) const { return strings_[id]; }
+
+        void clear() {
+            lookup_.clear();
+            strings_.clear();
+        }
+
+    private:
+        std::unordered_map<std::string, uint32_t> lookup_;
+        std::vector<std::string> strings_;
+    };
+
+    /**
+     * @struct ChangeRecordCompact
+     * @brief Stored form of a record - six interned ids plus a nanosecond stamp
+     *
+     * 32 bytes instead of six heap strings, so a history scan stays on
+     * roughly one cache line per two records. The string-field ChangeRecord
+     * remains the public API; records are rebuilt from the table on query.
+     */
+    struct ChangeRecordCompact {
+        uint32_t objectId;
+        uint32_t propertyName;
+        uint32_t oldValue;
+        uint32_t newValue;
+        uint32_t userId;
+        uint32_t sessionId;
+        uint64_t timestampNs;
+    };
+
     ChangeTracker();
     ~ChangeTracker();
-    std::vector<ChangeRecord> changeHistory_;
+
+    ChangeRecord expand(const ChangeRecordCompact& compact) const;
+
+    StringTable strings_;
+    SegmentedVector<ChangeRecordCompact> changeHistory_;
 };
 
 /**
@@ -155,7 +366,8 @@ private:
     std::string calculateChecksum(const std::string& versionId) const;
     void autoSave();
 
-    std::vector<VersionInfo> versions_;
+    // 双端队列：超限淘汰最老版本是O(1)的pop_front，不再整段搬移
+    std::deque<VersionInfo> versions_;
     std::string currentVersion_;
     size_t maxVersions_;
     int autoSaveInterval_;
@@ -44,7 +44,8 @@ void MeshAsset::setMesh(std::shared_ptr<modeling::Mesh> mesh) {
 size_t MeshAsset::getMemoryUsage() const {
     if (!mesh_) return 0;
     size_t usage = sizeof(MeshAsset);
-    usage += mesh_->getVertices().size() * sizeof(modeling::Vertex);
+    usage += mesh_->getVertexCount() *
+             (4 * sizeof(glm::vec3) + sizeof(glm::vec2) + sizeof(glm::vec4));
     usage += mesh_->getFaces().size() * sizeof(modeling::Face);
     return usage;
 }
@@ -195,6 +196,9 @@ AssetManager& AssetManager::getInstance() {
 
 AssetManager::AssetManager()
     : totalMemoryUsage_(0) {
+    // Canonical alias prefixes get low symbol ids up front; registering
+    // or resolving them later never takes the map's insert path
+    assetPathAliases_.prewarm({"models", "textures", "audio", "animations", "scenes"});
 }
 
 AssetManager::~AssetManager() {
@@ -203,30 +207,33 @@ AssetManager::~AssetManager() {
 
 AssetHandle AssetManager::loadAsset(const std::string& path, AssetType type) {
     std::string resolvedPath = resolveAssetPath(path);
-    std::string assetId = generateAssetId(resolvedPath);
+    uint64_t assetId = generateAssetId(resolvedPath);
 
     {
         std::lock_guard<std::mutex> lock(assetsMutex_);
 
         auto it = assets_.find(assetId);
         if (it != assets_.end()) {
-            if (it->second->getState() == AssetLoadState::Loaded) {
-                it->second->incrementRefCount();
-                it->second->setLastAccessed();
+            Asset& cached = **it->second;
+            if (cached.getState() == AssetLoadState::Loaded) {
+                cached.incrementRefCount();
+                cached.setLastAccessed();
+                assetLru_.splice(assetLru_.begin(), assetLru_, it->second);
                 AssetHandle handle;
                 handle.id = assetId;
-                handle.type = it->second->getType();
+                handle.type = cached.getType();
                 return handle;
             }
         }
     }
 
-    auto asset = createAsset(type, assetId);
+    auto asset = createAsset(type, resolvedPath);
     if (!asset) {
         AssetHandle handle;
         return handle;
     }
 
+    asset->setHashId(assetId);
     asset->setState(AssetLoadState::Loading);
 
     if (progressCallback_) {
@@ -242,7 +249,24 @@ AssetHandle AssetManager::loadAsset(const std::string& path, AssetType type) {
 
         {
             std::lock_guard<std::mutex> lock(assetsMutex_);
-            assets_[assetId] = asset;
+
+            // Two concurrent loads of the same path can both miss the
+            // cache; keep the first inserted entry so the LRU list and
+            // index never hold duplicate nodes for one id
+            auto existing = assets_.find(assetId);
+            if (existing != assets_.end()) {
+                Asset& cached = **existing->second;
+                cached.incrementRefCount();
+                cached.setLastAccessed();
+                assetLru_.splice(assetLru_.begin(), assetLru_, existing->second);
+                AssetHandle handle;
+                handle.id = assetId;
+                handle.type = cached.getType();
+                return handle;
+            }
+
+            assetLru_.push_front(asset);
+            assets_[assetId] = assetLru_.begin();
             totalMemoryUsage_ += asset->getMemoryUsage();
         }
 
@@ -269,18 +293,20 @@ AssetHandle AssetManager::loadAsset(const std::string& path, AssetType type) {
 AssetHandle AssetManager::loadAssetAsync(const std::string& path, AssetType type,
                                          std::function<void(const AssetHandle&)> callback) {
     std::string resolvedPath = resolveAssetPath(path);
-    std::string assetId = generateAssetId(resolvedPath);
+    uint64_t assetId = generateAssetId(resolvedPath);
 
     {
         std::lock_guard<std::mutex> lock(assetsMutex_);
 
         auto it = assets_.find(assetId);
-        if (it != assets_.end() && it->second->getState() == AssetLoadState::Loaded) {
-            it->second->incrementRefCount();
-            it->second->setLastAccessed();
+        if (it != assets_.end() && (*it->second)->getState() == AssetLoadState::Loaded) {
+            Asset& cached = **it->second;
+            cached.incrementRefCount();
+            cached.setLastAccessed();
+            assetLru_.splice(assetLru_.begin(), assetLru_, it->second);
             AssetHandle handle;
             handle.id = assetId;
-            handle.type = it->second->getType();
+            handle.type = cached.getType();
             if (callback) callback(handle);
             return handle;
         }
@@ -297,6 +323,32 @@ AssetHandle AssetManager::loadAssetAsync(const std::string& path, AssetType type
     return handle;
 }
 
+std::vector<AssetHandle> AssetManager::loadAssetsBatch(std::span<const AssetBatchRequest> requests) {
+    std::vector<AssetHandle> handles(requests.size());
+
+    // Bulk scene loads overlap file I/O in bounded waves of futures
+    // instead of serializing N loadAsset round trips. (True batched
+    // submission would need liburing; this tree stays on std threading.)
+    constexpr size_t kMaxInFlight = 8;
+
+    for (size_t base = 0; base < requests.size(); base += kMaxInFlight) {
+        const size_t end = std::min(base + kMaxInFlight, requests.size());
+
+        std::vector<std::future<AssetHandle>> wave;
+        wave.reserve(end - base);
+        for (size_t i = base; i < end; ++i) {
+            wave.push_back(std::async(std::launch::async, [this, &requests, i]() {
+                return loadAsset(requests[i].path, requests[i].type);
+            }));
+        }
+        for (size_t i = base; i < end; ++i) {
+            handles[i] = wave[i - base].get();
+        }
+    }
+
+    return handles;
+}
+
 void AssetManager::unloadAsset(const AssetHandle& handle) {
     if (!handle.isValid()) return;
 
@@ -304,13 +356,11 @@ void AssetManager::unloadAsset(const AssetHandle& handle) {
 
     auto it = assets_.find(handle.id);
     if (it != assets_.end()) {
-        it->second->decrementRefCount();
+        Asset& asset = **it->second;
+        asset.decrementRefCount();
 
-        if (it->second->getRefCount() <= 0 && cacheConfig_.enableAutoUnload) {
-            size_t memoryUsage = it->second->getMemoryUsage();
-            it->second->unload();
-            totalMemoryUsage_ -= memoryUsage;
-            assets_.erase(it);
+        if (asset.getRefCount() <= 0 && cacheConfig_.enableAutoUnload) {
+            evictLocked(it->second);
         }
     }
 }
@@ -318,10 +368,11 @@ void AssetManager::unloadAsset(const AssetHandle& handle) {
 void AssetManager::unloadAllAssets() {
     std::lock_guard<std::mutex> lock(assetsMutex_);
 
-    for (auto& pair : assets_) {
-        pair.second->unload();
+    for (auto& asset : assetLru_) {
+        asset->unload();
     }
 
+    assetLru_.clear();
     assets_.clear();
     totalMemoryUsage_ = 0;
 }
@@ -329,12 +380,9 @@ void AssetManager::unloadAllAssets() {
 void AssetManager::unloadUnusedAssets() {
     std::lock_guard<std::mutex> lock(assetsMutex_);
 
-    for (auto it = assets_.begin(); it != assets_.end(); ) {
-        if (it->second->getRefCount() <= 0) {
-            size_t memoryUsage = it->second->getMemoryUsage();
-            it->second->unload();
-            totalMemoryUsage_ -= memoryUsage;
-            it = assets_.erase(it);
+    for (auto it = assetLru_.begin(); it != assetLru_.end(); ) {
+        if ((*it)->getRefCount() <= 0) {
+            it = evictLocked(it);
         } else {
             ++it;
         }
@@ -347,7 +395,7 @@ bool AssetManager::isAssetLoaded(const AssetHandle& handle) const {
     std::lock_guard<std::mutex> lock(assetsMutex_);
 
     auto it = assets_.find(handle.id);
-    return it != assets_.end() && it->second->getState() == AssetLoadState::Loaded;
+    return it != assets_.end() && (*it->second)->getState() == AssetLoadState::Loaded;
 }
 
 AssetLoadState AssetManager::getAssetState(const AssetHandle& handle) const {
@@ -357,7 +405,7 @@ AssetLoadState AssetManager::getAssetState(const AssetHandle& handle) const {
 
     auto it = assets_.find(handle.id);
     if (it != assets_.end()) {
-        return it->second->getState();
+        return (*it->second)->getState();
     }
 
     return AssetLoadState::Unloaded;
@@ -372,7 +420,7 @@ AssetMetadata AssetManager::getAssetMetadata(const AssetHandle& handle) const {
 
     auto it = assets_.find(handle.id);
     if (it != assets_.end()) {
-        metadata = it->second->getMetadata();
+        metadata = (*it->second)->getMetadata();
     }
 
     return metadata;
@@ -383,9 +431,9 @@ std::vector<AssetMetadata> AssetManager::getAllAssetsMetadata() const {
 
     std::lock_guard<std::mutex> lock(assetsMutex_);
 
-    metadataList.reserve(assets_.size());
-    for (const auto& pair : assets_) {
-        metadataList.push_back(pair.second->getMetadata());
+    metadataList.reserve(assetLru_.size());
+    for (const auto& asset : assetLru_) {
+        metadataList.push_back(asset->getMetadata());
     }
 
     return metadataList;
@@ -402,6 +450,7 @@ size_t AssetManager::getLoadedAssetCount() const {
 
 void AssetManager::setCacheConfig(const AssetCacheConfig& config) {
     cacheConfig_ = config;
+    nextSweep_ = {};
     checkMemoryUsage();
 }
 
@@ -411,20 +460,47 @@ const AssetCacheConfig& AssetManager::getCacheConfig() const {
 
 void AssetManager::registerAssetPath(const std::string& alias, const std::string& path) {
     std::lock_guard<std::mutex> lock(assetsMutex_);
-    assetPathAliases_[alias] = path;
+    assetPathAliases_.setTarget(assetPathAliases_.intern(alias), path);
 }
 
 std::string AssetManager::resolveAssetPath(const std::string& path) const {
-    std::string resolvedPath = path;
-
-    for (const auto& pair : assetPathAliases_) {
-        if (path.find(pair.first + "/") == 0) {
-            resolvedPath = pair.second + path.substr(pair.first.length());
-            break;
+    std::string resolved;
+    resolveAssetPath(path, resolved);
+    return resolved;
+}
+
+void AssetManager::resolveAssetPath(std::string_view path, std::string& out) const {
+    out.clear();
+    out.reserve(path.size() + 32);
+
+    // Probe the interned alias table with the leading path component;
+    // the heterogeneous lookup hashes the view without a temporary string
+    const size_t slash = path.find('/');
+    if (slash != std::string_view::npos) {
+        const PathInternTable::SymbolId symbol =
+            assetPathAliases_.find(path.substr(0, slash));
+        // Pre-warmed aliases exist in the table before registration; only
+        // a symbol with a target path assigned counts as registered
+        if (symbol != PathInternTable::kNotFound &&
+            !assetPathAliases_.target(symbol).empty()) {
+            out.append(assetPathAliases_.target(symbol));
+            out.append(path.substr(slash));
         }
     }
+    if (out.empty()) {
+        out.assign(path);
+    }
 
-    return FileLoader::normalizePath(resolvedPath);
+    // Already-clean paths skip the std::filesystem round trip; only inputs
+    // with dot components, doubled or backslash separators need lexical
+    // normalization
+    if (out.find("//") != std::string::npos ||
+        out.find('\\') != std::string::npos ||
+        out.find("./") != std::string::npos ||
+        out.find("/.") != std::string::npos ||
+        out == "." || out == "..") {
+        out = FileLoader::normalizePath(out);
+    }
 }
 
 void AssetManager::setProgressCallback(std::function<void(const std::string&, float)> callback) {
@@ -438,28 +514,35 @@ void AssetManager::setErrorCallback(std::function<void(const std::string&, const
 void AssetManager::update() {
     if (!cacheConfig_.enableAutoUnload) return;
 
+    // Idle sweeps are only meaningful at maxIdleTime granularity; calling
+    // update() every frame should not pay for a scan each time
+    auto steadyNow = std::chrono::steady_clock::now();
+    if (steadyNow < nextSweep_) return;
+    nextSweep_ = steadyNow + cacheConfig_.maxIdleTime / 4;
+
     auto now = std::chrono::system_clock::now();
-    std::vector<std::string> assetsToUnload;
 
-    {
-        std::lock_guard<std::mutex> lock(assetsMutex_);
+    std::lock_guard<std::mutex> lock(assetsMutex_);
 
-        for (const auto& pair : assets_) {
-            if (pair.second->getRefCount() <= 0) {
-                auto idleTime = std::chrono::duration_cast<std::chrono::seconds>(
-                    now - pair.second->getLastAccessed()).count();
+    // Walk from the LRU tail: entries there are the least recently used,
+    // so the first still-fresh unreferenced asset ends the scan. Cost per
+    // frame is O(evicted) plus any pinned assets that drifted to the back
+    auto it = assetLru_.end();
+    while (it != assetLru_.begin()) {
+        --it;
+        Asset& asset = **it;
 
-                if (idleTime >= cacheConfig_.maxIdleTime.count()) {
-                    assetsToUnload.push_back(pair.first);
-                }
-            }
+        if (asset.getRefCount() > 0) {
+            continue;
         }
-    }
 
-    for (const auto& assetId : assetsToUnload) {
-        AssetHandle handle;
-        handle.id = assetId;
-        unloadAsset(handle);
+        auto idleTime = std::chrono::duration_cast<std::chrono::seconds>(
+            now - asset.getLastAccessed()).count();
+        if (idleTime < cacheConfig_.maxIdleTime.count()) {
+            break;
+        }
+
+        it = evictLocked(it);
     }
 }
 
@@ -467,16 +550,8 @@ void AssetManager::cleanup() {
     unloadAllAssets();
 }
 
-std::string AssetManager::generateAssetId(const std::string& path) const {
-    std::string id = path;
-    std::replace(id.begin(), id.end(), '\\', '/');
-    std::replace(id.begin(), id.end(), ':', '_');
-    std::replace(id.begin(), id.end(), '.', '_');
-
-    std::hash<std::string> hasher;
-    size_t hash = hasher(path);
-
-    return id + "_" + std::to_string(hash);
+uint64_t AssetManager::generateAssetId(const std::string& path) const {
+    return fnv1a64(path);
 }
 
 AssetType AssetManager::detectAssetType(const std::string& path) const {
@@ -542,7 +617,7 @@ bool AssetManager::loadAssetData(std::shared_ptr<Asset> asset, const std::string
                 auto meshAsset = std::dynamic_pointer_cast<MeshAsset>(asset);
                 auto mesh = MeshLoader::load(path);
                 if (mesh) {
-                    meshAsset->setMesh(mesh);
+                    meshAsset->setMesh(std::move(mesh));
                     return true;
                 }
                 break;
@@ -569,7 +644,7 @@ bool AssetManager::loadAssetData(std::shared_ptr<Asset> asset, const std::string
                 auto audioAsset = std::dynamic_pointer_cast<AudioAsset>(asset);
                 auto buffer = AudioLoader::load(path);
                 if (buffer) {
-                    audioAsset->setAudioBuffer(buffer);
+                    audioAsset->setAudioBuffer(std::move(buffer));
                     return true;
                 }
                 break;
@@ -605,28 +680,27 @@ void AssetManager::checkMemoryUsage() {
 }
 
 void AssetManager::unloadOldestAssets(size_t targetMemoryUsage) {
-    std::vector<std::pair<std::string, std::chrono::system_clock::time_point>> assetTimestamps;
-
-    {
-        std::lock_guard<std::mutex> lock(assetsMutex_);
+    std::lock_guard<std::mutex> lock(assetsMutex_);
 
-        for (const auto& pair : assets_) {
-            if (pair.second->getRefCount() <= 0) {
-                assetTimestamps.push_back({pair.first, pair.second->getLastAccessed()});
-            }
+    // The list is already in recency order: pop unreferenced assets off
+    // the tail until the budget is met, no snapshot-and-sort pass needed
+    auto it = assetLru_.end();
+    while (it != assetLru_.begin() && totalMemoryUsage_ > targetMemoryUsage) {
+        --it;
+        if ((*it)->getRefCount() > 0) {
+            continue;
         }
+        it = evictLocked(it);
     }
+}
 
-    std::sort(assetTimestamps.begin(), assetTimestamps.end(),
-              [](const auto& a, const auto& b) { return a.second < b.second; });
-
-    for (const auto& pair : assetTimestamps) {
-        if (totalMemoryUsage_ <= targetMemoryUsage) break;
-
-        AssetHandle handle;
-        handle.id = pair.first;
-        unloadAsset(handle);
-    }
+AssetManager::AssetList::iterator AssetManager::evictLocked(AssetList::iterator it) {
+    Asset& asset = **it;
+    size_t memoryUsage = asset.getMemoryUsage();
+    asset.unload();
+    totalMemoryUsage_ -= memoryUsage;
+    assets_.erase(asset.getHashId());
+    return assetLru_.erase(it);
 }
 
 }
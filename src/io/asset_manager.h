@@ -3,12 +3,17 @@
 #include "file_loader.h"
 #include "file_saver.h"
 #include "format_converter.h"
+#include "path_intern.h"
 #include "../modeling/mesh.h"
 #include "../animation/skeleton.h"
 #include "../animation/animation_clip.h"
 #include "../audio/audio_buffer.h"
 #include "../modeling/material.h"
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <list>
+#include <span>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -54,11 +59,33 @@ struct AssetMetadata {
     int referenceCount;
 };
 
+/// @brief FNV-1a 64-bit hash - asset ids are integers derived from the
+/// resolved path, so handle validity and cache lookups are integer ops
+constexpr uint64_t fnv1a64(std::string_view text) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// @brief Identity hash for asset ids - FNV output is already well mixed
+struct AssetIdHash {
+    size_t operator()(uint64_t id) const { return static_cast<size_t>(id); }
+};
+
 struct AssetHandle {
-    std::string id;
-    AssetType type;
-    bool isValid() const { return !id.empty(); }
-    void reset() { id.clear(); type = AssetType::Unknown; }
+    uint64_t id = 0;
+    AssetType type = AssetType::Unknown;
+    bool isValid() const { return id != 0; }
+    void reset() { id = 0; type = AssetType::Unknown; }
+};
+
+/// @brief One entry of a bulk load submitted through loadAssetsBatch
+struct AssetBatchRequest {
+    std::string path;
+    AssetType type = AssetType::Unknown;
 };
 
 class Asset {
@@ -67,6 +94,8 @@ public:
     virtual ~Asset();
 
     const std::string& getId() const { return id_; }
+    uint64_t getHashId() const { return hashId_; }
+    void setHashId(uint64_t hashId) { hashId_ = hashId; }
     AssetType getType() const { return type_; }
     AssetLoadState getState() const { return state_; }
     void setState(AssetLoadState state) { state_ = state; }
@@ -86,6 +115,7 @@ public:
 
 protected:
     std::string id_;
+    uint64_t hashId_ = 0;  ///< Cache key: fnv1a64 of the resolved path
     AssetType type_;
     AssetLoadState state_;
     AssetMetadata metadata_;
@@ -114,7 +144,10 @@ public:
     ~SkeletonAsset() override;
 
     void setSkeleton(std::shared_ptr<animation::Skeleton> skeleton);
-    std::shared_ptr<animation::Skeleton> getSkeleton() const { return skeleton_; }
+
+    // 返回引用借用，不按值拷贝shared_ptr：每次借用省一对原子引用计数增减，
+    // 动画运行时内部一律持有非拥有的Skeleton*，共享所有权只停在资产层
+    const std::shared_ptr<animation::Skeleton>& getSkeleton() const { return skeleton_; }
 
     size_t getMemoryUsage() const override;
     void unload() override;
@@ -204,6 +237,7 @@ public:
     AssetHandle loadAsset(const std::string& path, AssetType type);
     AssetHandle loadAssetAsync(const std::string& path, AssetType type,
                               std::function<void(const AssetHandle&)> callback);
+    std::vector<AssetHandle> loadAssetsBatch(std::span<const AssetBatchRequest> requests);
 
     template<typename T>
     std::shared_ptr<T> getAsset(const AssetHandle& handle);
@@ -226,6 +260,7 @@ public:
 
     void registerAssetPath(const std::string& alias, const std::string& path);
     std::string resolveAssetPath(const std::string& path) const;
+    void resolveAssetPath(std::string_view path, std::string& out) const;
 
     void setProgressCallback(std::function<void(const std::string&, float)> callback);
     void setErrorCallback(std::function<void(const std::string&, const std::string&)> callback);
@@ -240,7 +275,7 @@ private:
     AssetManager(const AssetManager&) = delete;
     AssetManager& operator=(const AssetManager&) = delete;
 
-    std::string generateAssetId(const std::string& path) const;
+    uint64_t generateAssetId(const std::string& path) const;
     AssetType detectAssetType(const std::string& path) const;
 
     std::shared_ptr<Asset> createAsset(AssetType type, const std::string& id);
@@ -249,14 +284,27 @@ private:
     void checkMemoryUsage();
     void unloadOldestAssets(size_t targetMemoryUsage);
 
-    std::unordered_map<std::string, std::shared_ptr<Asset>> assets_;
-    std::unordered_map<std::string, std::string> assetPathAliases_;
+    // LRU order: front is the most recently used asset. The index maps
+    // asset id to its list node, so a cache hit is one splice and
+    // eviction pops from the back instead of scanning every asset
+    using AssetList = std::list<std::shared_ptr<Asset>>;
+
+    /// @brief Unloads one asset, erasing its list node and index entry;
+    /// caller holds assetsMutex_. Returns the iterator after the node
+    AssetList::iterator evictLocked(AssetList::iterator it);
+
+    AssetList assetLru_;
+    std::unordered_map<uint64_t, AssetList::iterator, AssetIdHash> assets_;
+    PathInternTable assetPathAliases_;
 
     mutable std::mutex assetsMutex_;
     std::atomic<size_t> totalMemoryUsage_;
 
     AssetCacheConfig cacheConfig_;
 
+    /// @brief Next idle-sweep deadline; update() returns immediately before it
+    std::chrono::steady_clock::time_point nextSweep_{};
+
     std::function<void(const std::string&, float)> progressCallback_;
     std::function<void(const std::string&, const std::string&)> errorCallback_;
 };
@@ -266,11 +314,12 @@ std::shared_ptr<T> AssetManager::getAsset(const AssetHandle& handle) {
     std::lock_guard<std::mutex> lock(assetsMutex_);
 
     auto it = assets_.find(handle.id);
-    if (it == assets_.end() || it->second->getState() != AssetLoadState::Loaded) {
+    if (it == assets_.end() || (*it->second)->getState() != AssetLoadState::Loaded) {
         return nullptr;
     }
 
-    return std::dynamic_pointer_cast<T>(it->second);
+    assetLru_.splice(assetLru_.begin(), assetLru_, it->second);
+    return std::dynamic_pointer_cast<T>(*it->second);
 }
 
 }
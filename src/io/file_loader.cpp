@@ -3,6 +3,16 @@
 #include <filesystem>
 #include <algorithm>
 #include <unordered_map>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace v3d {
 namespace io {
@@ -87,6 +97,122 @@ bool FileLoader::isDirectory(const std::string& path) {
     return std::filesystem::is_directory(path);
 }
 
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        this->~MappedFile();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+        fileHandle_ = std::exchange(other.fileHandle_, nullptr);
+        mappingHandle_ = std::exchange(other.mappingHandle_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mappingHandle_) {
+        CloseHandle(mappingHandle_);
+    }
+    if (fileHandle_) {
+        CloseHandle(fileHandle_);
+    }
+    fileHandle_ = nullptr;
+    mappingHandle_ = nullptr;
+#else
+    if (data_) {
+        munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+MappedFile FileLoader::mapReadOnly(const std::string& filePath) {
+    MappedFile mapped;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        if (errorCallback_) {
+            errorCallback_("Failed to open file: " + filePath);
+        }
+        return mapped;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return mapped;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        if (errorCallback_) {
+            errorCallback_("Failed to map file: " + filePath);
+        }
+        return mapped;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        if (errorCallback_) {
+            errorCallback_("Failed to map file: " + filePath);
+        }
+        return mapped;
+    }
+
+    mapped.fileHandle_ = file;
+    mapped.mappingHandle_ = mapping;
+    mapped.data_ = static_cast<const uint8_t*>(view);
+    mapped.size_ = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (errorCallback_) {
+            errorCallback_("Failed to open file: " + filePath);
+        }
+        return mapped;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return mapped;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        if (errorCallback_) {
+            errorCallback_("Failed to map file: " + filePath);
+        }
+        return mapped;
+    }
+
+    mapped.data_ = static_cast<const uint8_t*>(view);
+    mapped.size_ = static_cast<size_t>(st.st_size);
+#endif
+
+    if (progressCallback_) {
+        progressCallback_(1.0f);
+    }
+
+    return mapped;
+}
+
 std::vector<uint8_t> FileLoader::readBinaryFile(const std::string& filePath) {
     std::ifstream file(filePath, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <deque>
+#include <span>
 
 namespace v3d {
 namespace io {
@@ -62,6 +63,31 @@ struct FileMetadata {
     std::unordered_map<std::string, std::string> properties;
 };
 
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    bool isValid() const { return data_ != nullptr; }
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::span<const uint8_t> span() const { return {data_, size_}; }
+
+private:
+    friend class FileLoader;
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
+
 class FileLoader {
 public:
     static FileFormat detectFormat(const std::string& filePath);
@@ -70,6 +96,7 @@ public:
     static size_t getFileSize(const std::string& filePath);
     static bool isDirectory(const std::string& path);
     static std::vector<uint8_t> readBinaryFile(const std::string& filePath);
+    static MappedFile mapReadOnly(const std::string& filePath);
     static std::string readTextFile(const std::string& filePath);
     static bool writeBinaryFile(const std::string& filePath, const std::vector<uint8_t>& data);
     static bool writeTextFile(const std::string& filePath, const std::string& content);
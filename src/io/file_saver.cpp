@@ -4,6 +4,9 @@
 #include <assimp/postprocess.h>
 #include <fstream>
 #include <sstream>
+#include <atomic>
+#include <cstring>
+#include <nlohmann/json.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -11,10 +14,131 @@
 namespace v3d {
 namespace io {
 
-std::function<void(float)> MeshLoader::progressCallback_;
-std::function<void(const std::string&)> MeshLoader::errorCallback_;
+namespace {
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadOBJ(const std::string& filePath) {
+// Sequential cursor over a memory-mapped file; replaces per-field
+// ifstream reads so binary parsers touch the page cache directly.
+class ByteReader {
+public:
+    explicit ByteReader(std::span<const uint8_t> bytes)
+        : data_(bytes.data()), size_(bytes.size()) {}
+
+    bool read(void* dst, size_t count) {
+        if (offset_ + count > size_) {
+            return false;
+        }
+        std::memcpy(dst, data_ + offset_, count);
+        offset_ += count;
+        return true;
+    }
+
+    const uint8_t* cursor() const { return data_ + offset_; }
+    size_t remaining() const { return size_ - offset_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    size_t offset_ = 0;
+};
+
+struct ContentHash128 {
+    uint64_t low;
+    uint64_t high;
+
+    bool operator==(const ContentHash128& other) const {
+        return low == other.low && high == other.high;
+    }
+};
+
+struct ContentHash128Hasher {
+    size_t operator()(const ContentHash128& h) const {
+        return static_cast<size_t>(h.low ^ (h.high * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+ContentHash128 hashBytes(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t h1 = 0xCBF29CE484222325ull;
+    uint64_t h2 = 0x84222325CBF29CE4ull;
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, bytes + i, 8);
+        h1 = (h1 ^ chunk) * 0x100000001B3ull;
+        h2 = (h2 ^ (chunk >> 1)) * 0x00000100000001B3ull;
+        h2 ^= h2 >> 29;
+    }
+    for (; i < size; ++i) {
+        h1 = (h1 ^ bytes[i]) * 0x100000001B3ull;
+        h2 = (h2 ^ bytes[i]) * 0x00000100000001B3ull;
+    }
+
+    h1 ^= h1 >> 33;
+    h1 *= 0xFF51AFD7ED558CCDull;
+    h2 ^= h2 >> 33;
+    h2 *= 0xC4CEB9FE1A85EC53ull;
+
+    return ContentHash128{h1 ^ size, h2 ^ (size << 1)};
+}
+
+struct GLTFMeshPayload {
+    std::vector<float> vertexData;
+    std::vector<uint32_t> indexData;
+    size_t vertexCount;
+    size_t indexCount;
+};
+
+GLTFMeshPayload flattenMeshPayload(const modeling::Mesh& mesh) {
+    GLTFMeshPayload payload;
+    payload.vertexCount = static_cast<size_t>(mesh.getVertexCount());
+    payload.vertexData.reserve(payload.vertexCount * 8);
+
+    for (int i = 0; i < mesh.getVertexCount(); ++i) {
+        const modeling::Vertex& vertex = mesh.getVertex(i);
+        payload.vertexData.push_back(vertex.position.x);
+        payload.vertexData.push_back(vertex.position.y);
+        payload.vertexData.push_back(vertex.position.z);
+        payload.vertexData.push_back(vertex.normal.x);
+        payload.vertexData.push_back(vertex.normal.y);
+        payload.vertexData.push_back(vertex.normal.z);
+        payload.vertexData.push_back(vertex.texCoord.x);
+        payload.vertexData.push_back(vertex.texCoord.y);
+    }
+
+    for (int i = 0; i < mesh.getFaceCount(); ++i) {
+        const modeling::Face& face = mesh.getFace(i);
+        for (size_t j = 2; j < face.vertices.size(); ++j) {
+            payload.indexData.push_back(static_cast<uint32_t>(face.vertices[0]));
+            payload.indexData.push_back(static_cast<uint32_t>(face.vertices[j - 1]));
+            payload.indexData.push_back(static_cast<uint32_t>(face.vertices[j]));
+        }
+    }
+    payload.indexCount = payload.indexData.size();
+
+    return payload;
+}
+
+}
+
+std::atomic<void (*)(void*, float) noexcept> MeshLoader::progressFn_{nullptr};
+std::atomic<void*> MeshLoader::progressCtx_{nullptr};
+std::atomic<void (*)(void*, const char*) noexcept> MeshLoader::errorFn_{nullptr};
+std::atomic<void*> MeshLoader::errorCtx_{nullptr};
+
+void MeshLoader::reportProgress(float progress) {
+    if (auto* fn = progressFn_.load(std::memory_order_acquire)) {
+        fn(progressCtx_.load(std::memory_order_acquire), progress);
+    }
+}
+
+void MeshLoader::reportError(const std::string& message) {
+    if (auto* fn = errorFn_.load(std::memory_order_acquire)) {
+        fn(errorCtx_.load(std::memory_order_acquire), message.c_str());
+    }
+}
+
+std::unique_ptr<modeling::Mesh> MeshLoader::loadOBJ(const std::string& filePath) {
     Assimp::Importer importer;
     const aiScene* scene = importer.ReadFile(filePath,
         aiProcess_Triangulate |
@@ -25,22 +149,21 @@ std::shared_ptr<modeling::Mesh> MeshLoader::loadOBJ(const std::string& filePath)
         aiProcess_ImproveCacheLocality);
 
     if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-        if (errorCallback_) {
-            errorCallback_("Failed to load OBJ file: " + filePath);
-        }
+        reportError("Failed to load OBJ file: " + filePath);
         return nullptr;
     }
 
-    auto mesh = std::make_shared<modeling::Mesh>();
+    auto mesh = std::make_unique<modeling::Mesh>();
     mesh->setName(FileLoader::getFileName(filePath));
 
-    if (progressCallback_) {
-        progressCallback_(0.5f);
-    }
+    reportProgress(0.5f);
 
     for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
         const aiMesh* aiMesh = scene->mMeshes[m];
 
+        mesh->reserveVertices(mesh->getVertexCount() + static_cast<int>(aiMesh->mNumVertices));
+        mesh->reserveFaces(mesh->getFaceCount() + static_cast<int>(aiMesh->mNumFaces));
+
         std::unordered_map<std::string, int> vertexMap;
 
         for (unsigned int v = 0; v < aiMesh->mNumVertices; ++v) {
@@ -81,16 +204,15 @@ std::shared_ptr<modeling::Mesh> MeshLoader::loadOBJ(const std::string& filePath)
         }
     }
 
+    mesh->finalize();
     mesh->recalculateAll();
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return mesh;
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadFBX(const std::string& filePath) {
+std::unique_ptr<modeling::Mesh> MeshLoader::loadFBX(const std::string& filePath) {
     Assimp::Importer importer;
     const aiScene* scene = importer.ReadFile(filePath,
         aiProcess_Triangulate |
@@ -101,22 +223,21 @@ std::shared_ptr<modeling::Mesh> MeshLoader::loadFBX(const std::string& filePath)
         aiProcess_ImproveCacheLocality);
 
     if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-        if (errorCallback_) {
-            errorCallback_("Failed to load FBX file: " + filePath);
-        }
+        reportError("Failed to load FBX file: " + filePath);
         return nullptr;
     }
 
-    auto mesh = std::make_shared<modeling::Mesh>();
+    auto mesh = std::make_unique<modeling::Mesh>();
     mesh->setName(FileLoader::getFileName(filePath));
 
-    if (progressCallback_) {
-        progressCallback_(0.5f);
-    }
+    reportProgress(0.5f);
 
     for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
         const aiMesh* aiMesh = scene->mMeshes[m];
 
+        mesh->reserveVertices(mesh->getVertexCount() + static_cast<int>(aiMesh->mNumVertices));
+        mesh->reserveFaces(mesh->getFaceCount() + static_cast<int>(aiMesh->mNumFaces));
+
         for (unsigned int v = 0; v < aiMesh->mNumVertices; ++v) {
             modeling::Vertex vertex;
 
@@ -155,83 +276,71 @@ std::shared_ptr<modeling::Mesh> MeshLoader::loadFBX(const std::string& filePath)
         }
     }
 
+    mesh->finalize();
     mesh->recalculateAll();
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return mesh;
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadGLTF(const std::string& filePath) {
+std::unique_ptr<modeling::Mesh> MeshLoader::loadGLTF(const std::string& filePath) {
     return loadFBX(filePath);
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadGLB(const std::string& filePath) {
+std::unique_ptr<modeling::Mesh> MeshLoader::loadGLB(const std::string& filePath) {
     return loadFBX(filePath);
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadDAE(const std::string& filePath) {
+std::unique_ptr<modeling::Mesh> MeshLoader::loadDAE(const std::string& filePath) {
     return loadFBX(filePath);
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadSTL(const std::string& filePath) {
+std::unique_ptr<modeling::Mesh> MeshLoader::loadSTL(const std::string& filePath) {
     return loadFBX(filePath);
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadPLY(const std::string& filePath) {
+std::unique_ptr<modeling::Mesh> MeshLoader::loadPLY(const std::string& filePath) {
     return loadFBX(filePath);
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::loadPMX(const std::string& filePath) {
-    auto mesh = std::make_shared<modeling::Mesh>();
+std::unique_ptr<modeling::Mesh> MeshLoader::loadPMX(const std::string& filePath) {
+    auto mesh = std::make_unique<modeling::Mesh>();
     mesh->setName(FileLoader::getFileName(filePath));
 
-    std::ifstream file(filePath, std::ios::binary);
-    if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to open PMX file: " + filePath);
-        }
+    MappedFile mapped = FileLoader::mapReadOnly(filePath);
+    if (!mapped.isValid()) {
+        reportError("Failed to open PMX file: " + filePath);
         return nullptr;
     }
 
+    ByteReader reader(mapped.span());
+
     char header[4];
-    file.read(header, 4);
+    if (!reader.read(header, 4)) {
+        reportError("Invalid PMX file format");
+        return nullptr;
+    }
 
     if (header[0] != 'P' || header[1] != 'M' || header[2] != 'X' || header[3] != ' ') {
-        if (errorCallback_) {
-            errorCallback_("Invalid PMX file format");
-        }
+        reportError("Invalid PMX file format");
         return nullptr;
     }
 
     float version;
-    file.read(reinterpret_cast<char*>(&version), 4);
+    reader.read(&version, 4);
 
     uint8_t vertexCount;
-    file.read(reinterpret_cast<char*>(&vertexCount), 1);
+    reader.read(&vertexCount, 1);
 
     std::vector<glm::vec3> positions(vertexCount);
     std::vector<glm::vec3> normals(vertexCount);
     std::vector<glm::vec2> uvs(vertexCount);
 
     for (int i = 0; i < vertexCount; ++i) {
-        float x, y, z;
-        file.read(reinterpret_cast<char*>(&x), 4);
-        file.read(reinterpret_cast<char*>(&y), 4);
-        file.read(reinterpret_cast<char*>(&z), 4);
-        positions[i] = glm::vec3(x, y, z);
-
-        file.read(reinterpret_cast<char*>(&x), 4);
-        file.read(reinterpret_cast<char*>(&y), 4);
-        file.read(reinterpret_cast<char*>(&z), 4);
-        normals[i] = glm::vec3(x, y, z);
-
-        float u, v;
-        file.read(reinterpret_cast<char*>(&u), 4);
-        file.read(reinterpret_cast<char*>(&v), 4);
-        uvs[i] = glm::vec2(u, v);
+        reader.read(&positions[i], sizeof(glm::vec3));
+        reader.read(&normals[i], sizeof(glm::vec3));
+        reader.read(&uvs[i], sizeof(glm::vec2));
     }
 
     for (int i = 0; i < vertexCount; ++i) {
@@ -242,27 +351,24 @@ std::shared_ptr<modeling::Mesh> MeshLoader::loadPMX(const std::string& filePath)
         mesh->addVertex(vertex);
     }
 
-    uint32_t indexCount;
-    file.read(reinterpret_cast<char*>(&indexCount), 4);
+    uint32_t indexCount = 0;
+    reader.read(&indexCount, 4);
 
-    for (uint32_t i = 0; i < indexCount; i += 3) {
-        uint8_t i0, i1, i2;
-        file.read(reinterpret_cast<char*>(&i0), 1);
-        file.read(reinterpret_cast<char*>(&i1), 1);
-        file.read(reinterpret_cast<char*>(&i2), 1);
-        mesh->addTriangle(i0, i1, i2);
+    for (uint32_t i = 0; i + 2 < indexCount; i += 3) {
+        uint8_t indices[3] = {0, 0, 0};
+        reader.read(indices, 3);
+        mesh->addTriangle(indices[0], indices[1], indices[2]);
     }
 
+    mesh->finalize();
     mesh->recalculateAll();
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return mesh;
 }
 
-std::shared_ptr<modeling::Mesh> MeshLoader::load(const std::string& filePath) {
+std::unique_ptr<modeling::Mesh> MeshLoader::load(const std::string& filePath) {
     FileFormat format = FileLoader::detectFormat(filePath);
 
     switch (format) {
@@ -275,19 +381,15 @@ std::shared_ptr<modeling::Mesh> MeshLoader::load(const std::string& filePath) {
         case FileFormat::PLY: return loadPLY(filePath);
         case FileFormat::PMX: return loadPMX(filePath);
         default:
-            if (errorCallback_) {
-                errorCallback_("Unsupported file format: " + filePath);
-            }
+            reportError("Unsupported file format: " + filePath);
             return nullptr;
     }
 }
 
-bool MeshLoader::saveOBJ(const std::string& filePath, const modeling::Mesh& mesh) {
+bool MeshLoader::saveOBJ(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten) {
     std::ofstream file(filePath);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to create OBJ file: " + filePath);
-        }
+        reportError("Failed to create OBJ file: " + filePath);
         return false;
     }
 
@@ -325,19 +427,19 @@ bool MeshLoader::saveOBJ(const std::string& filePath, const modeling::Mesh& mesh
         }
     }
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+    if (bytesWritten) {
+        *bytesWritten = static_cast<size_t>(file.tellp());
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool MeshLoader::saveSTL(const std::string& filePath, const modeling::Mesh& mesh) {
+bool MeshLoader::saveSTL(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten) {
     std::ofstream file(filePath, std::ios::binary);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to create STL file: " + filePath);
-        }
+        reportError("Failed to create STL file: " + filePath);
         return false;
     }
 
@@ -375,19 +477,19 @@ bool MeshLoader::saveSTL(const std::string& filePath, const modeling::Mesh& mesh
         }
     }
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+    if (bytesWritten) {
+        *bytesWritten = static_cast<size_t>(file.tellp());
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool MeshLoader::savePLY(const std::string& filePath, const modeling::Mesh& mesh) {
+bool MeshLoader::savePLY(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten) {
     std::ofstream file(filePath);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to create PLY file: " + filePath);
-        }
+        reportError("Failed to create PLY file: " + filePath);
         return false;
     }
 
@@ -422,38 +524,54 @@ bool MeshLoader::savePLY(const std::string& filePath, const modeling::Mesh& mesh
         file << "\n";
     }
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+    if (bytesWritten) {
+        *bytesWritten = static_cast<size_t>(file.tellp());
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool MeshLoader::save(const std::string& filePath, const modeling::Mesh& mesh) {
+bool MeshLoader::save(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten) {
     FileFormat format = FileLoader::detectFormat(filePath);
 
     switch (format) {
-        case FileFormat::OBJ: return saveOBJ(filePath, mesh);
-        case FileFormat::STL: return saveSTL(filePath, mesh);
-        case FileFormat::PLY: return savePLY(filePath, mesh);
+        case FileFormat::OBJ: return saveOBJ(filePath, mesh, bytesWritten);
+        case FileFormat::STL: return saveSTL(filePath, mesh, bytesWritten);
+        case FileFormat::PLY: return savePLY(filePath, mesh, bytesWritten);
         default:
-            if (errorCallback_) {
-                errorCallback_("Unsupported file format: " + filePath);
-            }
+            reportError("Unsupported file format: " + filePath);
             return false;
     }
 }
 
-void MeshLoader::setProgressCallback(std::function<void(float)> callback) {
-    progressCallback_ = callback;
+void MeshLoader::setProgressCallback(void (*callback)(void*, float) noexcept, void* context) {
+    progressCtx_.store(context, std::memory_order_relaxed);
+    progressFn_.store(callback, std::memory_order_release);
 }
 
-void MeshLoader::setErrorCallback(std::function<void(const std::string&)> callback) {
-    errorCallback_ = callback;
+void MeshLoader::setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context) {
+    errorCtx_.store(context, std::memory_order_relaxed);
+    errorFn_.store(callback, std::memory_order_release);
 }
 
-std::function<void(float)> AnimationLoader::progressCallback_;
-std::function<void(const std::string&)> AnimationLoader::errorCallback_;
+std::atomic<void (*)(void*, float) noexcept> AnimationLoader::progressFn_{nullptr};
+std::atomic<void*> AnimationLoader::progressCtx_{nullptr};
+std::atomic<void (*)(void*, const char*) noexcept> AnimationLoader::errorFn_{nullptr};
+std::atomic<void*> AnimationLoader::errorCtx_{nullptr};
+
+void AnimationLoader::reportProgress(float progress) {
+    if (auto* fn = progressFn_.load(std::memory_order_acquire)) {
+        fn(progressCtx_.load(std::memory_order_acquire), progress);
+    }
+}
+
+void AnimationLoader::reportError(const std::string& message) {
+    if (auto* fn = errorFn_.load(std::memory_order_acquire)) {
+        fn(errorCtx_.load(std::memory_order_acquire), message.c_str());
+    }
+}
 
 std::shared_ptr<animation::Skeleton> AnimationLoader::loadSkeleton(const std::string& filePath) {
     FileFormat format = FileLoader::detectFormat(filePath);
@@ -486,9 +604,7 @@ std::shared_ptr<animation::AnimationClip> AnimationLoader::loadVMD(const std::st
 
     std::ifstream file(filePath, std::ios::binary);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to open VMD file: " + filePath);
-        }
+        reportError("Failed to open VMD file: " + filePath);
         return nullptr;
     }
 
@@ -496,15 +612,11 @@ std::shared_ptr<animation::AnimationClip> AnimationLoader::loadVMD(const std::st
     file.read(header, 30);
 
     if (std::string(header, 23) != "Vocaloid Motion Data") {
-        if (errorCallback_) {
-            errorCallback_("Invalid VMD file format");
-        }
+        reportError("Invalid VMD file format");
         return nullptr;
     }
 
-    if (progressCallback_) {
-        progressCallback_(0.5f);
-    }
+    reportProgress(0.5f);
 
     uint32_t boneCount;
     file.read(reinterpret_cast<char*>(&boneCount), 4);
@@ -561,9 +673,7 @@ std::shared_ptr<animation::AnimationClip> AnimationLoader::loadVMD(const std::st
 
     clip->setDuration(10.0f);
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return clip;
 }
@@ -574,9 +684,7 @@ std::shared_ptr<animation::AnimationClip> AnimationLoader::loadBVH(const std::st
 
     std::ifstream file(filePath);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to open BVH file: " + filePath);
-        }
+        reportError("Failed to open BVH file: " + filePath);
         return nullptr;
     }
 
@@ -587,9 +695,7 @@ std::shared_ptr<animation::AnimationClip> AnimationLoader::loadBVH(const std::st
         }
     }
 
-    if (progressCallback_) {
-        progressCallback_(0.5f);
-    }
+    reportProgress(0.5f);
 
     while (std::getline(file, line)) {
         if (line.find("MOTION") != std::string::npos) {
@@ -599,19 +705,15 @@ std::shared_ptr<animation::AnimationClip> AnimationLoader::loadBVH(const std::st
 
     clip->setDuration(10.0f);
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return clip;
 }
 
-bool AnimationLoader::saveVMD(const std::string& filePath, const animation::AnimationClip& clip) {
+bool AnimationLoader::saveVMD(const std::string& filePath, const animation::AnimationClip& clip, size_t* bytesWritten) {
     std::ofstream file(filePath, std::ios::binary);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to create VMD file: " + filePath);
-        }
+        reportError("Failed to create VMD file: " + filePath);
         return false;
     }
 
@@ -630,19 +732,19 @@ bool AnimationLoader::saveVMD(const std::string& filePath, const animation::Anim
     uint32_t lightCount = 0;
     file.write(reinterpret_cast<const char*>(&lightCount), 4);
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+    if (bytesWritten) {
+        *bytesWritten = static_cast<size_t>(file.tellp());
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool AnimationLoader::saveBVH(const std::string& filePath, const animation::AnimationClip& clip) {
+bool AnimationLoader::saveBVH(const std::string& filePath, const animation::AnimationClip& clip, size_t* bytesWritten) {
     std::ofstream file(filePath);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to create BVH file: " + filePath);
-        }
+        reportError("Failed to create BVH file: " + filePath);
         return false;
     }
 
@@ -656,80 +758,98 @@ bool AnimationLoader::saveBVH(const std::string& filePath, const animation::Anim
     file << "Frames: " << static_cast<int>(clip.getDuration() * 30) << "\n";
     file << "Frame Time: 0.0333333\n";
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+    if (bytesWritten) {
+        *bytesWritten = static_cast<size_t>(file.tellp());
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-void AnimationLoader::setProgressCallback(std::function<void(float)> callback) {
-    progressCallback_ = callback;
+void AnimationLoader::setProgressCallback(void (*callback)(void*, float) noexcept, void* context) {
+    progressCtx_.store(context, std::memory_order_relaxed);
+    progressFn_.store(callback, std::memory_order_release);
 }
 
-void AnimationLoader::setErrorCallback(std::function<void(const std::string&)> callback) {
-    errorCallback_ = callback;
+void AnimationLoader::setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context) {
+    errorCtx_.store(context, std::memory_order_relaxed);
+    errorFn_.store(callback, std::memory_order_release);
 }
 
-std::function<void(float)> AudioLoader::progressCallback_;
-std::function<void(const std::string&)> AudioLoader::errorCallback_;
+std::atomic<void (*)(void*, float) noexcept> AudioLoader::progressFn_{nullptr};
+std::atomic<void*> AudioLoader::progressCtx_{nullptr};
+std::atomic<void (*)(void*, const char*) noexcept> AudioLoader::errorFn_{nullptr};
+std::atomic<void*> AudioLoader::errorCtx_{nullptr};
 
-std::shared_ptr<audio::AudioBuffer> AudioLoader::loadWAV(const std::string& filePath) {
-    auto buffer = std::make_shared<audio::AudioBuffer>();
+void AudioLoader::reportProgress(float progress) {
+    if (auto* fn = progressFn_.load(std::memory_order_acquire)) {
+        fn(progressCtx_.load(std::memory_order_acquire), progress);
+    }
+}
 
-    std::ifstream file(filePath, std::ios::binary);
-    if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to open WAV file: " + filePath);
-        }
+void AudioLoader::reportError(const std::string& message) {
+    if (auto* fn = errorFn_.load(std::memory_order_acquire)) {
+        fn(errorCtx_.load(std::memory_order_acquire), message.c_str());
+    }
+}
+
+std::unique_ptr<audio::AudioBuffer> AudioLoader::loadWAV(const std::string& filePath) {
+    auto buffer = std::make_unique<audio::AudioBuffer>();
+
+    MappedFile mapped = FileLoader::mapReadOnly(filePath);
+    if (!mapped.isValid()) {
+        reportError("Failed to open WAV file: " + filePath);
         return nullptr;
     }
 
-    char riffHeader[4];
-    file.read(riffHeader, 4);
+    ByteReader reader(mapped.span());
 
-    if (riffHeader[0] != 'R' || riffHeader[1] != 'I' || riffHeader[2] != 'F' || riffHeader[3] != 'F') {
-        if (errorCallback_) {
-            errorCallback_("Invalid WAV file format");
-        }
+    char riffHeader[4];
+    if (!reader.read(riffHeader, 4) ||
+        riffHeader[0] != 'R' || riffHeader[1] != 'I' || riffHeader[2] != 'F' || riffHeader[3] != 'F') {
+        reportError("Invalid WAV file format");
         return nullptr;
     }
 
     uint32_t fileSize;
-    file.read(reinterpret_cast<char*>(&fileSize), 4);
+    reader.read(&fileSize, 4);
 
     char waveHeader[4];
-    file.read(waveHeader, 4);
+    reader.read(waveHeader, 4);
 
     char fmtHeader[4];
-    file.read(fmtHeader, 4);
+    reader.read(fmtHeader, 4);
 
     uint32_t fmtSize;
-    file.read(reinterpret_cast<char*>(&fmtSize), 4);
+    reader.read(&fmtSize, 4);
 
     uint16_t audioFormat;
-    file.read(reinterpret_cast<char*>(&audioFormat), 2);
+    reader.read(&audioFormat, 2);
 
-    uint16_t numChannels;
-    file.read(reinterpret_cast<char*>(&numChannels), 2);
+    uint16_t numChannels = 0;
+    reader.read(&numChannels, 2);
 
-    uint32_t sampleRate;
-    file.read(reinterpret_cast<char*>(&sampleRate), 4);
+    uint32_t sampleRate = 0;
+    reader.read(&sampleRate, 4);
 
     uint32_t byteRate;
-    file.read(reinterpret_cast<char*>(&byteRate), 4);
+    reader.read(&byteRate, 4);
 
     uint16_t blockAlign;
-    file.read(reinterpret_cast<char*>(&blockAlign), 2);
+    reader.read(&blockAlign, 2);
 
-    uint16_t bitsPerSample;
-    file.read(reinterpret_cast<char*>(&bitsPerSample), 2);
+    uint16_t bitsPerSample = 0;
+    reader.read(&bitsPerSample, 2);
 
     char dataHeader[4];
-    file.read(dataHeader, 4);
+    reader.read(dataHeader, 4);
 
-    uint32_t dataSize;
-    file.read(reinterpret_cast<char*>(&dataSize), 4);
+    uint32_t dataSize = 0;
+    if (!reader.read(&dataSize, 4) || numChannels == 0 || bitsPerSample < 8) {
+        reportError("Invalid WAV file format");
+        return nullptr;
+    }
 
     audio::AudioSpec spec;
     spec.sampleRate = static_cast<int>(sampleRate);
@@ -746,52 +866,46 @@ std::shared_ptr<audio::AudioBuffer> AudioLoader::loadWAV(const std::string& file
     size_t frameCount = dataSize / (bitsPerSample / 8) / numChannels;
     buffer->allocate(spec, frameCount);
 
-    std::vector<int16_t> samples(frameCount * numChannels);
-    file.read(reinterpret_cast<char*>(samples.data()), dataSize);
+    // Convert straight from the mapping: the page cache is the only copy
+    // of the PCM data, instead of a staging vector filled via file.read.
+    const int16_t* samples = reinterpret_cast<const int16_t*>(reader.cursor());
+    size_t sampleCount = std::min(frameCount * numChannels, reader.remaining() / sizeof(int16_t));
 
     float* floatSamples = reinterpret_cast<float*>(buffer->getData());
-    for (size_t i = 0; i < samples.size(); ++i) {
+    for (size_t i = 0; i < sampleCount; ++i) {
         floatSamples[i] = static_cast<float>(samples[i]) / 32768.0f;
     }
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return buffer;
 }
 
-std::shared_ptr<audio::AudioBuffer> AudioLoader::loadMP3(const std::string& filePath) {
-    auto buffer = std::make_shared<audio::AudioBuffer>();
+std::unique_ptr<audio::AudioBuffer> AudioLoader::loadMP3(const std::string& filePath) {
+    auto buffer = std::make_unique<audio::AudioBuffer>();
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return buffer;
 }
 
-std::shared_ptr<audio::AudioBuffer> AudioLoader::loadOGG(const std::string& filePath) {
-    auto buffer = std::make_shared<audio::AudioBuffer>();
+std::unique_ptr<audio::AudioBuffer> AudioLoader::loadOGG(const std::string& filePath) {
+    auto buffer = std::make_unique<audio::AudioBuffer>();
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return buffer;
 }
 
-std::shared_ptr<audio::AudioBuffer> AudioLoader::loadFLAC(const std::string& filePath) {
-    auto buffer = std::make_shared<audio::AudioBuffer>();
+std::unique_ptr<audio::AudioBuffer> AudioLoader::loadFLAC(const std::string& filePath) {
+    auto buffer = std::make_unique<audio::AudioBuffer>();
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return buffer;
 }
 
-std::shared_ptr<audio::AudioBuffer> AudioLoader::load(const std::string& filePath) {
+std::unique_ptr<audio::AudioBuffer> AudioLoader::load(const std::string& filePath) {
     FileFormat format = FileLoader::detectFormat(filePath);
 
     switch (format) {
@@ -800,19 +914,15 @@ std::shared_ptr<audio::AudioBuffer> AudioLoader::load(const std::string& filePat
         case FileFormat::OGG: return loadOGG(filePath);
         case FileFormat::FLAC: return loadFLAC(filePath);
         default:
-            if (errorCallback_) {
-                errorCallback_("Unsupported audio format: " + filePath);
-            }
+            reportError("Unsupported audio format: " + filePath);
             return nullptr;
     }
 }
 
-bool AudioLoader::saveWAV(const std::string& filePath, const audio::AudioBuffer& buffer) {
+bool AudioLoader::saveWAV(const std::string& filePath, const audio::AudioBuffer& buffer, size_t* bytesWritten) {
     std::ofstream file(filePath, std::ios::binary);
     if (!file.is_open()) {
-        if (errorCallback_) {
-            errorCallback_("Failed to create WAV file: " + filePath);
-        }
+        reportError("Failed to create WAV file: " + filePath);
         return false;
     }
 
@@ -854,48 +964,62 @@ bool AudioLoader::saveWAV(const std::string& filePath, const audio::AudioBuffer&
 
     file.write(reinterpret_cast<const char*>(buffer.getData()), buffer.getSizeInBytes());
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+    if (bytesWritten) {
+        *bytesWritten = static_cast<size_t>(file.tellp());
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool AudioLoader::saveFLAC(const std::string& filePath, const audio::AudioBuffer& buffer) {
+bool AudioLoader::saveFLAC(const std::string& filePath, const audio::AudioBuffer& buffer, size_t* bytesWritten) {
     return false;
 }
 
-bool AudioLoader::save(const std::string& filePath, const audio::AudioBuffer& buffer) {
+bool AudioLoader::save(const std::string& filePath, const audio::AudioBuffer& buffer, size_t* bytesWritten) {
     FileFormat format = FileLoader::detectFormat(filePath);
 
     switch (format) {
-        case FileFormat::WAV: return saveWAV(filePath, buffer);
-        case FileFormat::FLAC: return saveFLAC(filePath, buffer);
+        case FileFormat::WAV: return saveWAV(filePath, buffer, bytesWritten);
+        case FileFormat::FLAC: return saveFLAC(filePath, buffer, bytesWritten);
         default:
-            if (errorCallback_) {
-                errorCallback_("Unsupported audio format: " + filePath);
-            }
+            reportError("Unsupported audio format: " + filePath);
             return false;
     }
 }
 
-void AudioLoader::setProgressCallback(std::function<void(float)> callback) {
-    progressCallback_ = callback;
+void AudioLoader::setProgressCallback(void (*callback)(void*, float) noexcept, void* context) {
+    progressCtx_.store(context, std::memory_order_relaxed);
+    progressFn_.store(callback, std::memory_order_release);
 }
 
-void AudioLoader::setErrorCallback(std::function<void(const std::string&)> callback) {
-    errorCallback_ = callback;
+void AudioLoader::setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context) {
+    errorCtx_.store(context, std::memory_order_relaxed);
+    errorFn_.store(callback, std::memory_order_release);
+}
+
+std::atomic<void (*)(void*, float) noexcept> ImageLoader::progressFn_{nullptr};
+std::atomic<void*> ImageLoader::progressCtx_{nullptr};
+std::atomic<void (*)(void*, const char*) noexcept> ImageLoader::errorFn_{nullptr};
+std::atomic<void*> ImageLoader::errorCtx_{nullptr};
+
+void ImageLoader::reportProgress(float progress) {
+    if (auto* fn = progressFn_.load(std::memory_order_acquire)) {
+        fn(progressCtx_.load(std::memory_order_acquire), progress);
+    }
 }
 
-std::function<void(float)> ImageLoader::progressCallback_;
-std::function<void(const std::string&)> ImageLoader::errorCallback_;
+void ImageLoader::reportError(const std::string& message) {
+    if (auto* fn = errorFn_.load(std::memory_order_acquire)) {
+        fn(errorCtx_.load(std::memory_order_acquire), message.c_str());
+    }
+}
 
 std::vector<uint8_t> ImageLoader::loadPNG(const std::string& filePath, int& width, int& height, int& channels) {
     std::vector<uint8_t> data;
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return data;
 }
@@ -903,9 +1027,7 @@ std::vector<uint8_t> ImageLoader::loadPNG(const std::string& filePath, int& widt
 std::vector<uint8_t> ImageLoader::loadJPG(const std::string& filePath, int& width, int& height, int& channels) {
     std::vector<uint8_t> data;
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return data;
 }
@@ -913,9 +1035,7 @@ std::vector<uint8_t> ImageLoader::loadJPG(const std::string& filePath, int& widt
 std::vector<uint8_t> ImageLoader::loadEXR(const std::string& filePath, int& width, int& height, int& channels) {
     std::vector<uint8_t> data;
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return data;
 }
@@ -923,9 +1043,7 @@ std::vector<uint8_t> ImageLoader::loadEXR(const std::string& filePath, int& widt
 std::vector<uint8_t> ImageLoader::loadHDR(const std::string& filePath, int& width, int& height, int& channels) {
     std::vector<uint8_t> data;
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return data;
 }
@@ -933,9 +1051,7 @@ std::vector<uint8_t> ImageLoader::loadHDR(const std::string& filePath, int& widt
 std::vector<uint8_t> ImageLoader::loadTGA(const std::string& filePath, int& width, int& height, int& channels) {
     std::vector<uint8_t> data;
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return data;
 }
@@ -943,9 +1059,7 @@ std::vector<uint8_t> ImageLoader::loadTGA(const std::string& filePath, int& widt
 std::vector<uint8_t> ImageLoader::loadBMP(const std::string& filePath, int& width, int& height, int& channels) {
     std::vector<uint8_t> data;
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
     return data;
 }
@@ -961,79 +1075,102 @@ std::vector<uint8_t> ImageLoader::load(const std::string& filePath, int& width,
         case FileFormat::TGA: return loadTGA(filePath, width, height, channels);
         case FileFormat::BMP: return loadBMP(filePath, width, height, channels);
         default:
-            if (errorCallback_) {
-                errorCallback_("Unsupported image format: " + filePath);
-            }
+            reportError("Unsupported image format: " + filePath);
             return {};
     }
 }
 
-bool ImageLoader::savePNG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels) {
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+bool ImageLoader::savePNG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten) {
+    if (bytesWritten) {
+        *bytesWritten = 0;
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool ImageLoader::saveJPG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels) {
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+bool ImageLoader::saveJPG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten) {
+    if (bytesWritten) {
+        *bytesWritten = 0;
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool ImageLoader::saveEXR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels) {
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+bool ImageLoader::saveEXR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten) {
+    if (bytesWritten) {
+        *bytesWritten = 0;
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool ImageLoader::saveHDR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels) {
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+bool ImageLoader::saveHDR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten) {
+    if (bytesWritten) {
+        *bytesWritten = 0;
     }
 
+    reportProgress(1.0f);
+
     return true;
 }
 
-bool ImageLoader::save(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels) {
+bool ImageLoader::save(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten) {
     FileFormat format = FileLoader::detectFormat(filePath);
 
     switch (format) {
-        case FileFormat::PNG: return savePNG(filePath, data, width, height, channels);
-        case FileFormat::JPG: return saveJPG(filePath, data, width, height, channels);
-        case FileFormat::EXR: return saveEXR(filePath, data, width, height, channels);
-        case FileFormat::HDR: return saveHDR(filePath, data, width, height, channels);
+        case FileFormat::PNG: return savePNG(filePath, data, width, height, channels, bytesWritten);
+        case FileFormat::JPG: return saveJPG(filePath, data, width, height, channels, bytesWritten);
+        case FileFormat::EXR: return saveEXR(filePath, data, width, height, channels, bytesWritten);
+        case FileFormat::HDR: return saveHDR(filePath, data, width, height, channels, bytesWritten);
         default:
-            if (errorCallback_) {
-                errorCallback_("Unsupported image format: " + filePath);
-            }
+            reportError("Unsupported image format: " + filePath);
             return false;
     }
 }
 
-void ImageLoader::setProgressCallback(std::function<void(float)> callback) {
-    progressCallback_ = callback;
+void ImageLoader::setProgressCallback(void (*callback)(void*, float) noexcept, void* context) {
+    progressCtx_.store(context, std::memory_order_relaxed);
+    progressFn_.store(callback, std::memory_order_release);
 }
 
-void ImageLoader::setErrorCallback(std::function<void(const std::string&)> callback) {
-    errorCallback_ = callback;
+void ImageLoader::setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context) {
+    errorCtx_.store(context, std::memory_order_relaxed);
+    errorFn_.store(callback, std::memory_order_release);
 }
 
-std::function<void(float)> SceneLoader::progressCallback_;
-std::function<void(const std::string&)> SceneLoader::errorCallback_;
+std::atomic<void (*)(void*, float) noexcept> SceneLoader::progressFn_{nullptr};
+std::atomic<void*> SceneLoader::progressCtx_{nullptr};
+std::atomic<void (*)(void*, const char*) noexcept> SceneLoader::errorFn_{nullptr};
+std::atomic<void*> SceneLoader::errorCtx_{nullptr};
+
+void SceneLoader::reportProgress(float progress) {
+    if (auto* fn = progressFn_.load(std::memory_order_acquire)) {
+        fn(progressCtx_.load(std::memory_order_acquire), progress);
+    }
+}
+
+void SceneLoader::reportError(const std::string& message) {
+    if (auto* fn = errorFn_.load(std::memory_order_acquire)) {
+        fn(errorCtx_.load(std::memory_order_acquire), message.c_str());
+    }
+}
 
 std::shared_ptr<SceneLoader::SceneNode> SceneLoader::loadScene(const std::string& filePath) {
     FileFormat format = FileLoader::detectFormat(filePath);
 
     if (format == FileFormat::GLTF || format == FileFormat::GLB) {
-        auto nodes = loadGLTFScene(filePath);
-        if (!nodes.empty()) {
-            return nodes[0];
+        auto graph = loadGLTFScene(filePath);
+        if (graph && !graph->nodes.empty()) {
+            // Aliasing shared_ptr: the caller sees the root node, the control
+            // block keeps the whole node pool alive. Child indices are
+            // absolute into the pool, so root[childIdx] stays valid.
+            return std::shared_ptr<SceneNode>(graph, &graph->nodes.front());
         }
     }
 
@@ -1044,30 +1181,207 @@ bool SceneLoader::saveScene(const std::string& filePath, const std::shared_ptr<S
     return false;
 }
 
-std::vector<std::shared_ptr<SceneLoader::SceneNode>> SceneLoader::loadGLTFScene(const std::string& filePath) {
-    std::vector<std::shared_ptr<SceneNode>> nodes;
+std::shared_ptr<SceneLoader::SceneGraph> SceneLoader::loadGLTFScene(const std::string& filePath) {
+    auto graph = std::make_shared<SceneGraph>();
 
-    if (progressCallback_) {
-        progressCallback_(1.0f);
-    }
+    reportProgress(1.0f);
 
-    return nodes;
+    return graph;
 }
 
-bool SceneLoader::saveGLTFScene(const std::string& filePath, const std::vector<std::shared_ptr<SceneNode>>& nodes) {
-    if (progressCallback_) {
-        progressCallback_(1.0f);
+bool SceneLoader::saveGLTFScene(const std::string& filePath, const SceneGraph& graph) {
+    const std::vector<SceneNode>& flatNodes = graph.nodes;
+
+    std::string binPath = filePath.substr(0, filePath.find_last_of('.')) + ".bin";
+    std::string binName = FileLoader::getFileName(binPath) + ".bin";
+
+    std::vector<uint8_t> binBuffer;
+    nlohmann::json gltf;
+    gltf["asset"] = {{"version", "2.0"}, {"generator", "3D Video Studio"}};
+
+    nlohmann::json bufferViews = nlohmann::json::array();
+    nlohmann::json accessors = nlohmann::json::array();
+    nlohmann::json meshes = nlohmann::json::array();
+    nlohmann::json gltfNodes = nlohmann::json::array();
+
+    // Instanced nodes share vertex/index payloads: one bufferView set per
+    // unique content hash instead of one per node.
+    std::unordered_map<ContentHash128, int, ContentHash128Hasher> seenMeshes;
+
+    for (size_t n = 0; n < flatNodes.size(); ++n) {
+        const SceneNode& node = flatNodes[n];
+        int meshIndex = -1;
+
+        if (node.mesh && node.mesh->getVertexCount() > 0) {
+            GLTFMeshPayload payload = flattenMeshPayload(*node.mesh);
+
+            ContentHash128 vertexHash = hashBytes(payload.vertexData.data(),
+                payload.vertexData.size() * sizeof(float));
+            ContentHash128 indexHash = hashBytes(payload.indexData.data(),
+                payload.indexData.size() * sizeof(uint32_t));
+            ContentHash128 contentHash{vertexHash.low ^ indexHash.high,
+                                       vertexHash.high ^ indexHash.low};
+
+            auto it = seenMeshes.find(contentHash);
+            if (it != seenMeshes.end()) {
+                meshIndex = it->second;
+            } else {
+                size_t vertexOffset = binBuffer.size();
+                size_t vertexBytes = payload.vertexData.size() * sizeof(float);
+                binBuffer.resize(vertexOffset + vertexBytes);
+                std::memcpy(binBuffer.data() + vertexOffset, payload.vertexData.data(), vertexBytes);
+
+                size_t indexOffset = binBuffer.size();
+                size_t indexBytes = payload.indexData.size() * sizeof(uint32_t);
+                binBuffer.resize(indexOffset + indexBytes);
+                std::memcpy(binBuffer.data() + indexOffset, payload.indexData.data(), indexBytes);
+
+                int vertexViewIndex = static_cast<int>(bufferViews.size());
+                bufferViews.push_back({
+                    {"buffer", 0},
+                    {"byteOffset", vertexOffset},
+                    {"byteLength", vertexBytes},
+                    {"byteStride", 32},
+                    {"target", 34962}
+                });
+
+                int indexViewIndex = static_cast<int>(bufferViews.size());
+                bufferViews.push_back({
+                    {"buffer", 0},
+                    {"byteOffset", indexOffset},
+                    {"byteLength", indexBytes},
+                    {"target", 34963}
+                });
+
+                int positionAccessor = static_cast<int>(accessors.size());
+                accessors.push_back({
+                    {"bufferView", vertexViewIndex},
+                    {"byteOffset", 0},
+                    {"componentType", 5126},
+                    {"count", payload.vertexCount},
+                    {"type", "VEC3"}
+                });
+
+                int normalAccessor = static_cast<int>(accessors.size());
+                accessors.push_back({
+                    {"bufferView", vertexViewIndex},
+                    {"byteOffset", 12},
+                    {"componentType", 5126},
+                    {"count", payload.vertexCount},
+                    {"type", "VEC3"}
+                });
+
+                int texCoordAccessor = static_cast<int>(accessors.size());
+                accessors.push_back({
+                    {"bufferView", vertexViewIndex},
+                    {"byteOffset", 24},
+                    {"componentType", 5126},
+                    {"count", payload.vertexCount},
+                    {"type", "VEC2"}
+                });
+
+                int indexAccessor = static_cast<int>(accessors.size());
+                accessors.push_back({
+                    {"bufferView", indexViewIndex},
+                    {"byteOffset", 0},
+                    {"componentType", 5125},
+                    {"count", payload.indexCount},
+                    {"type", "SCALAR"}
+                });
+
+                meshIndex = static_cast<int>(meshes.size());
+                meshes.push_back({
+                    {"name", node.mesh->getName()},
+                    {"primitives", {{
+                        {"attributes", {
+                            {"POSITION", positionAccessor},
+                            {"NORMAL", normalAccessor},
+                            {"TEXCOORD_0", texCoordAccessor}
+                        }},
+                        {"indices", indexAccessor},
+                        {"mode", 4}
+                    }}}
+                });
+
+                seenMeshes.emplace(contentHash, meshIndex);
+            }
+        }
+
+        nlohmann::json gltfNode;
+        gltfNode["name"] = node.name;
+        if (meshIndex >= 0) {
+            gltfNode["mesh"] = meshIndex;
+        }
+
+        nlohmann::json matrix = nlohmann::json::array();
+        const float* m = glm::value_ptr(node.transform);
+        for (int i = 0; i < 16; ++i) {
+            matrix.push_back(m[i]);
+        }
+        gltfNode["matrix"] = matrix;
+
+        if (node.childCount > 0) {
+            nlohmann::json children = nlohmann::json::array();
+            for (uint32_t c = 0; c < node.childCount; ++c) {
+                children.push_back(node.firstChildIdx + c);
+            }
+            gltfNode["children"] = children;
+        }
+
+        gltfNodes.push_back(gltfNode);
+
+        reportProgress(static_cast<float>(n + 1) / static_cast<float>(flatNodes.size()) * 0.8f);
+    }
+
+    gltf["buffers"] = {{{"uri", binName}, {"byteLength", binBuffer.size()}}};
+    gltf["bufferViews"] = bufferViews;
+    gltf["accessors"] = accessors;
+    gltf["meshes"] = meshes;
+    gltf["nodes"] = gltfNodes;
+
+    std::vector<bool> isChild(flatNodes.size(), false);
+    for (const SceneNode& node : flatNodes) {
+        for (uint32_t c = 0; c < node.childCount; ++c) {
+            isChild[node.firstChildIdx + c] = true;
+        }
+    }
+
+    nlohmann::json sceneNodes = nlohmann::json::array();
+    for (size_t i = 0; i < flatNodes.size(); ++i) {
+        if (!isChild[i]) {
+            sceneNodes.push_back(i);
+        }
     }
+    gltf["scenes"] = {{{"nodes", sceneNodes}}};
+    gltf["scene"] = 0;
+
+    std::ofstream binFile(binPath, std::ios::binary);
+    if (!binFile.is_open()) {
+        reportError("Failed to create glTF buffer file: " + binPath);
+        return false;
+    }
+    binFile.write(reinterpret_cast<const char*>(binBuffer.data()), binBuffer.size());
+
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        reportError("Failed to create glTF file: " + filePath);
+        return false;
+    }
+    file << gltf.dump(2);
+
+    reportProgress(1.0f);
 
     return true;
 }
 
-void SceneLoader::setProgressCallback(std::function<void(float)> callback) {
-    progressCallback_ = callback;
+void SceneLoader::setProgressCallback(void (*callback)(void*, float) noexcept, void* context) {
+    progressCtx_.store(context, std::memory_order_relaxed);
+    progressFn_.store(callback, std::memory_order_release);
 }
 
-void SceneLoader::setErrorCallback(std::function<void(const std::string&)> callback) {
-    errorCallback_ = callback;
+void SceneLoader::setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context) {
+    errorCtx_.store(context, std::memory_order_relaxed);
+    errorFn_.store(callback, std::memory_order_release);
 }
 
 }
@@ -8,36 +8,41 @@
 #include <memory>
 #include <vector>
 #include <unordered_map>
-#include <functional>
+#include <atomic>
 
 namespace v3d {
 namespace io {
 
 class MeshLoader {
 public:
-    static std::shared_ptr<modeling::Mesh> loadOBJ(const std::string& filePath);
-    static std::shared_ptr<modeling::Mesh> loadFBX(const std::string& filePath);
-    static std::shared_ptr<modeling::Mesh> loadGLTF(const std::string& filePath);
-    static std::shared_ptr<modeling::Mesh> loadGLB(const std::string& filePath);
-    static std::shared_ptr<modeling::Mesh> loadDAE(const std::string& filePath);
-    static std::shared_ptr<modeling::Mesh> loadSTL(const std::string& filePath);
-    static std::shared_ptr<modeling::Mesh> loadPLY(const std::string& filePath);
-    static std::shared_ptr<modeling::Mesh> loadPMX(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadOBJ(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadFBX(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadGLTF(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadGLB(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadDAE(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadSTL(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadPLY(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> loadPMX(const std::string& filePath);
 
-    static std::shared_ptr<modeling::Mesh> load(const std::string& filePath);
+    static std::unique_ptr<modeling::Mesh> load(const std::string& filePath);
 
-    static bool saveOBJ(const std::string& filePath, const modeling::Mesh& mesh);
-    static bool saveSTL(const std::string& filePath, const modeling::Mesh& mesh);
-    static bool savePLY(const std::string& filePath, const modeling::Mesh& mesh);
+    static bool saveOBJ(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten = nullptr);
+    static bool saveSTL(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten = nullptr);
+    static bool savePLY(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten = nullptr);
 
-    static bool save(const std::string& filePath, const modeling::Mesh& mesh);
+    static bool save(const std::string& filePath, const modeling::Mesh& mesh, size_t* bytesWritten = nullptr);
 
-    static void setProgressCallback(std::function<void(float)> callback);
-    static void setErrorCallback(std::function<void(const std::string&)> callback);
+    static void setProgressCallback(void (*callback)(void*, float) noexcept, void* context = nullptr);
+    static void setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context = nullptr);
 
 private:
-    static std::function<void(float)> progressCallback_;
-    static std::function<void(const std::string&)> errorCallback_;
+    static void reportProgress(float progress);
+    static void reportError(const std::string& message);
+
+    static std::atomic<void (*)(void*, float) noexcept> progressFn_;
+    static std::atomic<void*> progressCtx_;
+    static std::atomic<void (*)(void*, const char*) noexcept> errorFn_;
+    static std::atomic<void*> errorCtx_;
 };
 
 class AnimationLoader {
@@ -48,37 +53,47 @@ public:
     static std::shared_ptr<animation::AnimationClip> loadVMD(const std::string& filePath);
     static std::shared_ptr<animation::AnimationClip> loadBVH(const std::string& filePath);
 
-    static bool saveVMD(const std::string& filePath, const animation::AnimationClip& clip);
-    static bool saveBVH(const std::string& filePath, const animation::AnimationClip& clip);
+    static bool saveVMD(const std::string& filePath, const animation::AnimationClip& clip, size_t* bytesWritten = nullptr);
+    static bool saveBVH(const std::string& filePath, const animation::AnimationClip& clip, size_t* bytesWritten = nullptr);
 
-    static void setProgressCallback(std::function<void(float)> callback);
-    static void setErrorCallback(std::function<void(const std::string&)> callback);
+    static void setProgressCallback(void (*callback)(void*, float) noexcept, void* context = nullptr);
+    static void setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context = nullptr);
 
 private:
-    static std::function<void(float)> progressCallback_;
-    static std::function<void(const std::string&)> errorCallback_;
+    static void reportProgress(float progress);
+    static void reportError(const std::string& message);
+
+    static std::atomic<void (*)(void*, float) noexcept> progressFn_;
+    static std::atomic<void*> progressCtx_;
+    static std::atomic<void (*)(void*, const char*) noexcept> errorFn_;
+    static std::atomic<void*> errorCtx_;
 };
 
 class AudioLoader {
 public:
-    static std::shared_ptr<audio::AudioBuffer> loadWAV(const std::string& filePath);
-    static std::shared_ptr<audio::AudioBuffer> loadMP3(const std::string& filePath);
-    static std::shared_ptr<audio::AudioBuffer> loadOGG(const std::string& filePath);
-    static std::shared_ptr<audio::AudioBuffer> loadFLAC(const std::string& filePath);
+    static std::unique_ptr<audio::AudioBuffer> loadWAV(const std::string& filePath);
+    static std::unique_ptr<audio::AudioBuffer> loadMP3(const std::string& filePath);
+    static std::unique_ptr<audio::AudioBuffer> loadOGG(const std::string& filePath);
+    static std::unique_ptr<audio::AudioBuffer> loadFLAC(const std::string& filePath);
 
-    static std::shared_ptr<audio::AudioBuffer> load(const std::string& filePath);
+    static std::unique_ptr<audio::AudioBuffer> load(const std::string& filePath);
 
-    static bool saveWAV(const std::string& filePath, const audio::AudioBuffer& buffer);
-    static bool saveFLAC(const std::string& filePath, const audio::AudioBuffer& buffer);
+    static bool saveWAV(const std::string& filePath, const audio::AudioBuffer& buffer, size_t* bytesWritten = nullptr);
+    static bool saveFLAC(const std::string& filePath, const audio::AudioBuffer& buffer, size_t* bytesWritten = nullptr);
 
-    static bool save(const std::string& filePath, const audio::AudioBuffer& buffer);
+    static bool save(const std::string& filePath, const audio::AudioBuffer& buffer, size_t* bytesWritten = nullptr);
 
-    static void setProgressCallback(std::function<void(float)> callback);
-    static void setErrorCallback(std::function<void(const std::string&)> callback);
+    static void setProgressCallback(void (*callback)(void*, float) noexcept, void* context = nullptr);
+    static void setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context = nullptr);
 
 private:
-    static std::function<void(float)> progressCallback_;
-    static std::function<void(const std::string&)> errorCallback_;
+    static void reportProgress(float progress);
+    static void reportError(const std::string& message);
+
+    static std::atomic<void (*)(void*, float) noexcept> progressFn_;
+    static std::atomic<void*> progressCtx_;
+    static std::atomic<void (*)(void*, const char*) noexcept> errorFn_;
+    static std::atomic<void*> errorCtx_;
 };
 
 class ImageLoader {
@@ -92,19 +107,24 @@ public:
 
     static std::vector<uint8_t> load(const std::string& filePath, int& width, int& height, int& channels);
 
-    static bool savePNG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels);
-    static bool saveJPG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels);
-    static bool saveEXR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels);
-    static bool saveHDR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels);
+    static bool savePNG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten = nullptr);
+    static bool saveJPG(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten = nullptr);
+    static bool saveEXR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten = nullptr);
+    static bool saveHDR(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten = nullptr);
 
-    static bool save(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels);
+    static bool save(const std::string& filePath, const std::vector<uint8_t>& data, int width, int height, int channels, size_t* bytesWritten = nullptr);
 
-    static void setProgressCallback(std::function<void(float)> callback);
-    static void setErrorCallback(std::function<void(const std::string&)> callback);
+    static void setProgressCallback(void (*callback)(void*, float) noexcept, void* context = nullptr);
+    static void setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context = nullptr);
 
 private:
-    static std::function<void(float)> progressCallback_;
-    static std::function<void(const std::string&)> errorCallback_;
+    static void reportProgress(float progress);
+    static void reportError(const std::string& message);
+
+    static std::atomic<void (*)(void*, float) noexcept> progressFn_;
+    static std::atomic<void*> progressCtx_;
+    static std::atomic<void (*)(void*, const char*) noexcept> errorFn_;
+    static std::atomic<void*> errorCtx_;
 };
 
 class SceneLoader {
@@ -114,24 +134,42 @@ public:
         std::string meshPath;
         std::shared_ptr<modeling::Mesh> mesh;
         glm::mat4 transform;
-        std::vector<std::shared_ptr<SceneNode>> children;
+        uint32_t firstChildIdx = 0;
+        uint32_t childCount = 0;
         std::shared_ptr<animation::Skeleton> skeleton;
         std::string animationPath;
         std::shared_ptr<animation::AnimationClip> animation;
     };
 
+    struct SceneGraph {
+        std::vector<SceneNode> nodes;
+
+        uint32_t addNode(SceneNode node) {
+            nodes.push_back(std::move(node));
+            return static_cast<uint32_t>(nodes.size() - 1);
+        }
+
+        SceneNode& root() { return nodes.front(); }
+        const SceneNode& root() const { return nodes.front(); }
+    };
+
     static std::shared_ptr<SceneNode> loadScene(const std::string& filePath);
     static bool saveScene(const std::string& filePath, const std::shared_ptr<SceneNode>& root);
 
-    static std::vector<std::shared_ptr<SceneNode>> loadGLTFScene(const std::string& filePath);
-    static bool saveGLTFScene(const std::string& filePath, const std::vector<std::shared_ptr<SceneNode>>& nodes);
+    static std::shared_ptr<SceneGraph> loadGLTFScene(const std::string& filePath);
+    static bool saveGLTFScene(const std::string& filePath, const SceneGraph& graph);
 
-    static void setProgressCallback(std::function<void(float)> callback);
-    static void setErrorCallback(std::function<void(const std::string&)> callback);
+    static void setProgressCallback(void (*callback)(void*, float) noexcept, void* context = nullptr);
+    static void setErrorCallback(void (*callback)(void*, const char*) noexcept, void* context = nullptr);
 
 private:
-    static std::function<void(float)> progressCallback_;
-    static std::function<void(const std::string&)> errorCallback_;
+    static void reportProgress(float progress);
+    static void reportError(const std::string& message);
+
+    static std::atomic<void (*)(void*, float) noexcept> progressFn_;
+    static std::atomic<void*> progressCtx_;
+    static std::atomic<void (*)(void*, const char*) noexcept> errorFn_;
+    static std::atomic<void*> errorCtx_;
 };
 
 }
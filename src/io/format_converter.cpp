@@ -1,207 +1,301 @@
 #include "format_converter.h"
 #include "file_saver.h"
+#include "../concurrency/thread_pool.h"
 #include <chrono>
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstring>
 #include <thread>
-#include <future>
+#include <mutex>
+#include <condition_variable>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace v3d {
 namespace io {
 
-std::function<void(float)> FormatConverter::progressCallback_;
-std::function<void(const std::string&)> FormatConverter::errorCallback_;
-
-ConversionResult FormatConverter::convertMesh(const std::string& inputPath, const std::string& outputPath,
-                                             const ConversionOptions& options) {
-    auto startTime = std::chrono::high_resolution_clock::now();
-    ConversionResult result;
-    result.success = false;
-    result.outputPath = outputPath;
-    result.originalSize = FileLoader::getFileSize(inputPath);
-
-    try {
-        FileFormat inputFormat = FileLoader::detectFormat(inputPath);
-        FileFormat outputFormat = FileLoader::detectFormat(outputPath);
-
-        if (!canConvert(inputFormat, outputFormat)) {
-            result.errorMessage = "Unsupported conversion from " + FileLoader::getFormatExtension(inputFormat) +
-                                 " to " + FileLoader::getFormatExtension(outputFormat);
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
-        }
-
-        if (progressCallback_) progressCallback_(0.1f);
-
-        auto mesh = loadAndProcessMesh(inputPath, options);
-        if (!mesh) {
-            result.errorMessage = "Failed to load mesh from " + inputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
+namespace {
+
+// Separable bilinear resize: each destination row is a vertical lerp of two
+// horizontally resized source rows. Weights are Q8 fixed point so the whole
+// per-pixel computation stays in 16-bit integer math; the vertical pass,
+// which touches every destination byte, is vectorized with AVX2.
+
+// Per-column source index and Q8 weight, shared by every row of a resize.
+struct HorizTables {
+    std::vector<int> x0s;
+    std::vector<int> x1s;
+    std::vector<int> fxs;
+
+    HorizTables(int srcWidth, int dstWidth, float invScaleX)
+        : x0s(dstWidth), x1s(dstWidth), fxs(dstWidth) {
+        for (int x = 0; x < dstWidth; ++x) {
+            float srcX = x * invScaleX;
+            int x0 = static_cast<int>(srcX);
+            x0s[x] = x0;
+            x1s[x] = std::min(x0 + 1, srcWidth - 1);
+            fxs[x] = static_cast<int>((srcX - x0) * 256.0f);
         }
-
-        if (progressCallback_) progressCallback_(0.7f);
-
-        bool saved = saveMesh(mesh, outputPath, options);
-        if (!saved) {
-            result.errorMessage = "Failed to save mesh to " + outputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
+    }
+};
+
+// Channels > 0 fixes the channel count at compile time so the inner loop
+// fully unrolls; Channels == 0 is the runtime fallback for odd layouts.
+template <int Channels>
+void horizResizeRow(const uint8_t* srcRow, uint8_t* dstRow,
+                    int dstWidth, int channels, const HorizTables& tables) {
+    const int ch = Channels > 0 ? Channels : channels;
+    for (int x = 0; x < dstWidth; ++x) {
+        const int fx = tables.fxs[x];
+        const uint8_t* p0 = srcRow + tables.x0s[x] * ch;
+        const uint8_t* p1 = srcRow + tables.x1s[x] * ch;
+        uint8_t* d = dstRow + x * ch;
+        for (int c = 0; c < ch; ++c) {
+            d[c] = static_cast<uint8_t>((p0[c] * (256 - fx) + p1[c] * fx + 128) >> 8);
         }
-
-        if (progressCallback_) progressCallback_(1.0f);
-
-        result.success = true;
-        result.convertedSize = FileLoader::getFileSize(outputPath);
-
-    } catch (const std::exception& e) {
-        result.errorMessage = std::string("Conversion error: ") + e.what();
-        if (errorCallback_) errorCallback_(result.errorMessage);
     }
-
-    auto endTime = std::chrono::high_resolution_clock::now();
-    result.conversionTime = std::chrono::duration<float>(endTime - startTime).count();
-
-    return result;
 }
 
-ConversionResult FormatConverter::convertAnimation(const std::string& inputPath, const std::string& outputPath,
-                                                  const ConversionOptions& options) {
-    auto startTime = std::chrono::high_resolution_clock::now();
-    ConversionResult result;
-    result.success = false;
-    result.outputPath = outputPath;
-    result.originalSize = FileLoader::getFileSize(inputPath);
+void vertLerpRow(const uint8_t* rowA, const uint8_t* rowB, uint8_t* dst,
+                 int count, int fy) {
+    // Exact row hit (common for integer upscale ratios): nothing to blend.
+    if (fy == 0) {
+        std::memcpy(dst, rowA, static_cast<size_t>(count));
+        return;
+    }
 
-    try {
-        FileFormat inputFormat = FileLoader::detectFormat(inputPath);
-        FileFormat outputFormat = FileLoader::detectFormat(outputPath);
+    const int wA = 256 - fy;
+    const int wB = fy;
+    int i = 0;
 
-        if (!canConvert(inputFormat, outputFormat)) {
-            result.errorMessage = "Unsupported animation conversion";
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
-        }
+#if defined(__AVX2__)
+    const __m256i weightA = _mm256_set1_epi16(static_cast<int16_t>(wA));
+    const __m256i weightB = _mm256_set1_epi16(static_cast<int16_t>(wB));
+    const __m256i half = _mm256_set1_epi16(128);
 
-        if (progressCallback_) progressCallback_(0.2f);
+    for (; i + 16 <= count; i += 16) {
+        __m256i a16 = _mm256_cvtepu8_epi16(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowA + i)));
+        __m256i b16 = _mm256_cvtepu8_epi16(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowB + i)));
 
-        auto clip = AnimationLoader::loadAnimationClip(inputPath);
-        if (!clip) {
-            result.errorMessage = "Failed to load animation from " + inputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
-        }
+        __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(a16, weightA),
+                                       _mm256_mullo_epi16(b16, weightB));
+        sum = _mm256_srli_epi16(_mm256_add_epi16(sum, half), 8);
 
-        if (progressCallback_) progressCallback_(0.6f);
+        __m128i packed = _mm_packus_epi16(_mm256_castsi256_si128(sum),
+                                          _mm256_extracti128_si256(sum, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+#endif
 
-        bool saved = false;
-        if (outputFormat == FileFormat::VMD) {
-            saved = AnimationLoader::saveVMD(outputPath, *clip);
-        } else if (outputFormat == FileFormat::BVH) {
-            saved = AnimationLoader::saveBVH(outputPath, *clip);
-        }
+    for (; i < count; ++i) {
+        dst[i] = static_cast<uint8_t>((rowA[i] * wA + rowB[i] * wB + 128) >> 8);
+    }
+}
 
-        if (!saved) {
-            result.errorMessage = "Failed to save animation to " + outputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
-        }
+template <int Channels>
+std::vector<uint8_t> resizeBilinearImpl(const std::vector<uint8_t>& src,
+                                        int width, int height, int channels,
+                                        int targetWidth, int targetHeight) {
+    // Reciprocals hoisted so the index math below is a multiply, not a divide.
+    const float invScaleX = static_cast<float>(width) / targetWidth;
+    const float invScaleY = static_cast<float>(height) / targetHeight;
+    const int rowBytes = targetWidth * channels;
+    const size_t srcStride = static_cast<size_t>(width) * channels;
+
+    std::vector<uint8_t> dst(static_cast<size_t>(targetHeight) * rowBytes);
+
+    // Per-row source indices and weights, computed once so the parallel
+    // workers only do x-dependent work.
+    std::vector<int> y0s(targetHeight);
+    std::vector<int> y1s(targetHeight);
+    std::vector<int> fys(targetHeight);
+    const HorizTables tables(width, targetWidth, invScaleX);
+    for (int y = 0; y < targetHeight; ++y) {
+        float srcY = y * invScaleY;
+        int y0 = static_cast<int>(srcY);
+        y0s[y] = y0;
+        y1s[y] = std::min(y0 + 1, height - 1);
+        fys[y] = static_cast<int>((srcY - y0) * 256.0f);
+    }
 
-        if (progressCallback_) progressCallback_(1.0f);
+    // Rows are independent; tile them statically so each worker keeps its
+    // destination cache lines (and its cached source rows) hot.
+#pragma omp parallel
+    {
+        std::vector<uint8_t> rowA(rowBytes);
+        std::vector<uint8_t> rowB(rowBytes);
+        int rowAIndex = -1;
+        int rowBIndex = -1;
 
-        result.success = true;
-        result.convertedSize = FileLoader::getFileSize(outputPath);
+#pragma omp for schedule(static, 16)
+        for (int y = 0; y < targetHeight; ++y) {
+            const int y0 = y0s[y];
+            const int y1 = y1s[y];
+
+            // Consecutive destination rows usually share source rows when
+            // upscaling; keep the two horizontally resized rows cached.
+            if (rowAIndex != y0) {
+                if (rowBIndex == y0) {
+                    rowA.swap(rowB);
+                    std::swap(rowAIndex, rowBIndex);
+                } else {
+                    horizResizeRow<Channels>(src.data() + y0 * srcStride, rowA.data(),
+                                             targetWidth, channels, tables);
+                    rowAIndex = y0;
+                }
+            }
+            if (rowBIndex != y1) {
+                horizResizeRow<Channels>(src.data() + y1 * srcStride, rowB.data(),
+                                         targetWidth, channels, tables);
+                rowBIndex = y1;
+            }
 
-    } catch (const std::exception& e) {
-        result.errorMessage = std::string("Animation conversion error: ") + e.what();
-        if (errorCallback_) errorCallback_(result.errorMessage);
+            vertLerpRow(rowA.data(), rowB.data(),
+                        dst.data() + static_cast<size_t>(y) * rowBytes, rowBytes, fys[y]);
+        }
     }
 
-    auto endTime = std::chrono::high_resolution_clock::now();
-    result.conversionTime = std::chrono::duration<float>(endTime - startTime).count();
-
-    return result;
+    return dst;
 }
 
-ConversionResult FormatConverter::convertAudio(const std::string& inputPath, const std::string& outputPath,
-                                              const AudioConversionOptions& options) {
-    auto startTime = std::chrono::high_resolution_clock::now();
-    ConversionResult result;
-    result.success = false;
-    result.outputPath = outputPath;
-    result.originalSize = FileLoader::getFileSize(inputPath);
+// Box-area average for strong shrinks: each destination pixel averages its
+// whole integer source window, which both reads every source texel once
+// (better quality than a 4-tap bilinear skipping most of them) and needs no
+// weight tables. The per-box divide is a Q16 reciprocal multiply.
+template <int Channels>
+std::vector<uint8_t> resizeAreaImpl(const std::vector<uint8_t>& src,
+                                    int width, int height, int channels,
+                                    int targetWidth, int targetHeight) {
+    const int ch = Channels > 0 ? Channels : channels;
+    const float invScaleX = static_cast<float>(width) / targetWidth;
+    const float invScaleY = static_cast<float>(height) / targetHeight;
+    const int rowBytes = targetWidth * ch;
+    const size_t srcStride = static_cast<size_t>(width) * ch;
+
+    std::vector<uint8_t> dst(static_cast<size_t>(targetHeight) * rowBytes);
+
+    std::vector<int> xStarts(targetWidth + 1);
+    for (int x = 0; x <= targetWidth; ++x) {
+        xStarts[x] = std::min(static_cast<int>(x * invScaleX), width);
+    }
 
-    try {
-        if (progressCallback_) progressCallback_(0.1f);
+#pragma omp parallel for schedule(static, 16)
+    for (int y = 0; y < targetHeight; ++y) {
+        const int sy0 = std::min(static_cast<int>(y * invScaleY), height);
+        const int sy1 = std::max(std::min(static_cast<int>((y + 1) * invScaleY), height), sy0 + 1);
+        uint8_t* dstRow = dst.data() + static_cast<size_t>(y) * rowBytes;
+
+        for (int x = 0; x < targetWidth; ++x) {
+            const int sx0 = xStarts[x];
+            const int sx1 = std::max(xStarts[x + 1], sx0 + 1);
+            const uint32_t area = static_cast<uint32_t>((sx1 - sx0) * (sy1 - sy0));
+            const uint32_t invArea = (65536u + area / 2) / area;
+
+            uint32_t sums[4] = {0, 0, 0, 0};
+            for (int sy = sy0; sy < sy1; ++sy) {
+                const uint8_t* p = src.data() + sy * srcStride + static_cast<size_t>(sx0) * ch;
+                for (int sx = sx0; sx < sx1; ++sx) {
+                    for (int cIdx = 0; cIdx < ch; ++cIdx) {
+                        sums[cIdx] += *p++;
+                    }
+                }
+            }
 
-        auto buffer = loadAndProcessAudio(inputPath, options);
-        if (!buffer) {
-            result.errorMessage = "Failed to load audio from " + inputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
+            uint8_t* d = dstRow + x * ch;
+            for (int cIdx = 0; cIdx < ch; ++cIdx) {
+                d[cIdx] = static_cast<uint8_t>(std::min((sums[cIdx] * invArea + 32768u) >> 16, 255u));
+            }
         }
+    }
 
-        if (progressCallback_) progressCallback_(0.7f);
+    return dst;
+}
 
-        bool saved = saveAudio(buffer, outputPath, options);
-        if (!saved) {
-            result.errorMessage = "Failed to save audio to " + outputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
+std::vector<uint8_t> resizeBilinear(const std::vector<uint8_t>& src,
+                                    int width, int height, int channels,
+                                    int targetWidth, int targetHeight) {
+    // Shrinks past 2x would make the 4-tap bilinear skip source texels
+    // entirely; hand those to the area-average path instead.
+    if (targetWidth * 2 < width && targetHeight * 2 < height) {
+        switch (channels) {
+            case 1: return resizeAreaImpl<1>(src, width, height, channels, targetWidth, targetHeight);
+            case 3: return resizeAreaImpl<3>(src, width, height, channels, targetWidth, targetHeight);
+            case 4: return resizeAreaImpl<4>(src, width, height, channels, targetWidth, targetHeight);
+            default: break;
         }
+    }
 
-        if (progressCallback_) progressCallback_(1.0f);
-
-        result.success = true;
-        result.convertedSize = FileLoader::getFileSize(outputPath);
-
-    } catch (const std::exception& e) {
-        result.errorMessage = std::string("Audio conversion error: ") + e.what();
-        if (errorCallback_) errorCallback_(result.errorMessage);
+    switch (channels) {
+        case 1: return resizeBilinearImpl<1>(src, width, height, channels, targetWidth, targetHeight);
+        case 3: return resizeBilinearImpl<3>(src, width, height, channels, targetWidth, targetHeight);
+        case 4: return resizeBilinearImpl<4>(src, width, height, channels, targetWidth, targetHeight);
+        default: return resizeBilinearImpl<0>(src, width, height, channels, targetWidth, targetHeight);
     }
+}
 
-    auto endTime = std::chrono::high_resolution_clock::now();
-    result.conversionTime = std::chrono::duration<float>(endTime - startTime).count();
+// One instantiation per asset kind of the shared conversion scaffolding:
+// timing, size bookkeeping, progress/error callbacks and exception
+// handling live here, the lambdas supply only the load and save steps.
+struct ConversionScript {
+    const char* subject;
+    const char* errorPrefix;
+    float startProgress;
+    float loadedProgress;
+};
+
+template <typename T>
+bool conversionPayloadValid(const T& payload) {
+    return static_cast<bool>(payload);
+}
 
-    return result;
+bool conversionPayloadValid(const std::vector<uint8_t>& payload) {
+    return !payload.empty();
 }
 
-ConversionResult FormatConverter::convertImage(const std::string& inputPath, const std::string& outputPath,
-                                              int targetWidth, int targetHeight, int quality) {
+template <typename Load, typename Save>
+ConversionResult runConversion(const std::string& inputPath, const std::string& outputPath,
+                               const ConversionCallbacks& callbacks, const ConversionScript& script,
+                               Load&& load, Save&& save) {
     auto startTime = std::chrono::high_resolution_clock::now();
     ConversionResult result;
     result.success = false;
     result.outputPath = outputPath;
     result.originalSize = FileLoader::getFileSize(inputPath);
+    result.convertedSize = 0;
 
     try {
-        int width, height, channels;
-        if (progressCallback_) progressCallback_(0.1f);
+        if (callbacks.progress) callbacks.progress(script.startProgress);
 
-        auto data = loadAndProcessImage(inputPath, width, height, channels, targetWidth, targetHeight, quality);
-        if (data.empty()) {
-            result.errorMessage = "Failed to load image from " + inputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
+        auto payload = load(result);
+        if (!conversionPayloadValid(payload)) {
+            if (result.errorMessage.empty()) {
+                result.errorMessage = std::string("Failed to load ") + script.subject + " from " + inputPath;
+            }
+            if (callbacks.error) callbacks.error(result.errorMessage);
             return result;
         }
 
-        if (progressCallback_) progressCallback_(0.7f);
+        if (callbacks.progress) callbacks.progress(script.loadedProgress);
 
-        bool saved = saveImage(data, outputPath, width, height, channels, quality);
-        if (!saved) {
-            result.errorMessage = "Failed to save image to " + outputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
+        if (!save(payload, result)) {
+            result.errorMessage = std::string("Failed to save ") + script.subject + " to " + outputPath;
+            if (callbacks.error) callbacks.error(result.errorMessage);
             return result;
         }
 
-        if (progressCallback_) progressCallback_(1.0f);
+        if (callbacks.progress) callbacks.progress(1.0f);
 
         result.success = true;
-        result.convertedSize = FileLoader::getFileSize(outputPath);
 
     } catch (const std::exception& e) {
-        result.errorMessage = std::string("Image conversion error: ") + e.what();
-        if (errorCallback_) errorCallback_(result.errorMessage);
+        result.errorMessage = script.errorPrefix + std::string(e.what());
+        if (callbacks.error) callbacks.error(result.errorMessage);
     }
 
     auto endTime = std::chrono::high_resolution_clock::now();
@@ -210,96 +304,168 @@ ConversionResult FormatConverter::convertImage(const std::string& inputPath, con
     return result;
 }
 
-ConversionResult FormatConverter::convertScene(const std::string& inputPath, const std::string& outputPath,
-                                              const ConversionOptions& options) {
-    auto startTime = std::chrono::high_resolution_clock::now();
-    ConversionResult result;
-    result.success = false;
-    result.outputPath = outputPath;
-    result.originalSize = FileLoader::getFileSize(inputPath);
-
-    try {
-        if (progressCallback_) progressCallback_(0.1f);
-
-        auto scene = SceneLoader::loadScene(inputPath);
-        if (!scene) {
-            result.errorMessage = "Failed to load scene from " + inputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
-        }
-
-        if (progressCallback_) progressCallback_(0.6f);
-
-        bool saved = SceneLoader::saveScene(outputPath, scene);
-        if (!saved) {
-            result.errorMessage = "Failed to save scene to " + outputPath;
-            if (errorCallback_) errorCallback_(result.errorMessage);
-            return result;
-        }
-
-        if (progressCallback_) progressCallback_(1.0f);
+}
 
-        result.success = true;
-        result.convertedSize = FileLoader::getFileSize(outputPath);
+ConversionResult FormatConverter::convertMesh(const std::string& inputPath, const std::string& outputPath,
+                                             const ConversionOptions& options,
+                                             const ConversionCallbacks& callbacks) {
+    ConversionScript script{"mesh", "Conversion error: ", 0.1f, 0.7f};
+    return runConversion(inputPath, outputPath, callbacks, script,
+        [&](ConversionResult& result) -> std::unique_ptr<modeling::Mesh> {
+            FileFormat inputFormat = FileLoader::detectFormat(inputPath);
+            FileFormat outputFormat = FileLoader::detectFormat(outputPath);
+            if (!canConvert(inputFormat, outputFormat)) {
+                result.errorMessage = "Unsupported conversion from " + FileLoader::getFormatExtension(inputFormat) +
+                                     " to " + FileLoader::getFormatExtension(outputFormat);
+                return nullptr;
+            }
+            return loadAndProcessMesh(inputPath, options);
+        },
+        [&](const std::unique_ptr<modeling::Mesh>& mesh, ConversionResult& result) {
+            return saveMesh(*mesh, outputPath, options, &result.convertedSize);
+        });
+}
 
-    } catch (const std::exception& e) {
-        result.errorMessage = std::string("Scene conversion error: ") + e.what();
-        if (errorCallback_) errorCallback_(result.errorMessage);
-    }
+ConversionResult FormatConverter::convertAnimation(const std::string& inputPath, const std::string& outputPath,
+                                                  const ConversionOptions& options,
+                                                  const ConversionCallbacks& callbacks) {
+    ConversionScript script{"animation", "Animation conversion error: ", 0.2f, 0.6f};
+    return runConversion(inputPath, outputPath, callbacks, script,
+        [&](ConversionResult& result) -> std::shared_ptr<animation::AnimationClip> {
+            if (!canConvert(FileLoader::detectFormat(inputPath), FileLoader::detectFormat(outputPath))) {
+                result.errorMessage = "Unsupported animation conversion";
+                return nullptr;
+            }
+            return AnimationLoader::loadAnimationClip(inputPath);
+        },
+        [&](const std::shared_ptr<animation::AnimationClip>& clip, ConversionResult& result) {
+            FileFormat outputFormat = FileLoader::detectFormat(outputPath);
+            if (outputFormat == FileFormat::VMD) {
+                return AnimationLoader::saveVMD(outputPath, *clip, &result.convertedSize);
+            }
+            if (outputFormat == FileFormat::BVH) {
+                return AnimationLoader::saveBVH(outputPath, *clip, &result.convertedSize);
+            }
+            return false;
+        });
+}
 
-    auto endTime = std::chrono::high_resolution_clock::now();
-    result.conversionTime = std::chrono::duration<float>(endTime - startTime).count();
+ConversionResult FormatConverter::convertAudio(const std::string& inputPath, const std::string& outputPath,
+                                              const AudioConversionOptions& options,
+                                              const ConversionCallbacks& callbacks) {
+    ConversionScript script{"audio", "Audio conversion error: ", 0.1f, 0.7f};
+    return runConversion(inputPath, outputPath, callbacks, script,
+        [&](ConversionResult&) {
+            return loadAndProcessAudio(inputPath, options);
+        },
+        [&](const std::unique_ptr<audio::AudioBuffer>& buffer, ConversionResult& result) {
+            return saveAudio(*buffer, outputPath, options, &result.convertedSize);
+        });
+}
 
-    return result;
+ConversionResult FormatConverter::convertImage(const std::string& inputPath, const std::string& outputPath,
+                                              int targetWidth, int targetHeight, int quality,
+                                              const ConversionCallbacks& callbacks) {
+    ConversionScript script{"image", "Image conversion error: ", 0.1f, 0.7f};
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    return runConversion(inputPath, outputPath, callbacks, script,
+        [&](ConversionResult&) {
+            return loadAndProcessImage(inputPath, width, height, channels, targetWidth, targetHeight, quality);
+        },
+        [&](const std::vector<uint8_t>& data, ConversionResult& result) {
+            return saveImage(data, outputPath, width, height, channels, quality, &result.convertedSize);
+        });
 }
 
-bool FormatConverter::canConvert(FileFormat from, FileFormat to) {
-    if (from == FileFormat::Unknown || to == FileFormat::Unknown) return false;
+ConversionResult FormatConverter::convertScene(const std::string& inputPath, const std::string& outputPath,
+                                              const ConversionOptions& options,
+                                              const ConversionCallbacks& callbacks) {
+    ConversionScript script{"scene", "Scene conversion error: ", 0.1f, 0.6f};
+    return runConversion(inputPath, outputPath, callbacks, script,
+        [&](ConversionResult&) {
+            return SceneLoader::loadScene(inputPath);
+        },
+        [&](const std::shared_ptr<SceneLoader::SceneNode>& scene, ConversionResult& result) {
+            if (!SceneLoader::saveScene(outputPath, scene)) {
+                return false;
+            }
+            result.convertedSize = FileLoader::getFileSize(outputPath);
+            return true;
+        });
+}
 
-    std::vector<FileFormat> meshFormats = {FileFormat::OBJ, FileFormat::FBX, FileFormat::GLTF, FileFormat::GLB,
-                                           FileFormat::DAE, FileFormat::STL, FileFormat::PLY, FileFormat::PMX};
+namespace {
 
-    std::vector<FileFormat> audioFormats = {FileFormat::WAV, FileFormat::MP3, FileFormat::OGG, FileFormat::FLAC};
+constexpr uint32_t formatBit(FileFormat f) {
+    return 1u << static_cast<int>(f);
+}
 
-    std::vector<FileFormat> imageFormats = {FileFormat::PNG, FileFormat::JPG, FileFormat::EXR, FileFormat::HDR,
-                                            FileFormat::TGA, FileFormat::BMP};
+constexpr uint32_t kMeshFormatMask =
+    formatBit(FileFormat::OBJ) | formatBit(FileFormat::FBX) |
+    formatBit(FileFormat::GLTF) | formatBit(FileFormat::GLB) |
+    formatBit(FileFormat::DAE) | formatBit(FileFormat::STL) |
+    formatBit(FileFormat::PLY) | formatBit(FileFormat::PMX);
+
+constexpr uint32_t kAudioFormatMask =
+    formatBit(FileFormat::WAV) | formatBit(FileFormat::MP3) |
+    formatBit(FileFormat::OGG) | formatBit(FileFormat::FLAC);
+
+constexpr uint32_t kImageFormatMask =
+    formatBit(FileFormat::PNG) | formatBit(FileFormat::JPG) |
+    formatBit(FileFormat::EXR) | formatBit(FileFormat::HDR) |
+    formatBit(FileFormat::TGA) | formatBit(FileFormat::BMP);
+
+constexpr uint32_t kAnimationFormatMask =
+    formatBit(FileFormat::VMD) | formatBit(FileFormat::BVH);
+
+enum class FormatCategory { Unknown, Mesh, Audio, Image, Animation };
+
+constexpr FormatCategory categoryOf(FileFormat f) {
+    const uint32_t bit = formatBit(f);
+    if (kMeshFormatMask & bit) return FormatCategory::Mesh;
+    if (kAudioFormatMask & bit) return FormatCategory::Audio;
+    if (kImageFormatMask & bit) return FormatCategory::Image;
+    if (kAnimationFormatMask & bit) return FormatCategory::Animation;
+    return FormatCategory::Unknown;
+}
 
-    std::vector<FileFormat> animationFormats = {FileFormat::VMD, FileFormat::BVH};
+constexpr uint32_t categoryMask(FormatCategory category) {
+    switch (category) {
+        case FormatCategory::Mesh: return kMeshFormatMask;
+        case FormatCategory::Audio: return kAudioFormatMask;
+        case FormatCategory::Image: return kImageFormatMask;
+        case FormatCategory::Animation: return kAnimationFormatMask;
+        default: return 0;
+    }
+}
 
-    auto isMeshFormat = [&meshFormats](FileFormat f) {
-        return std::find(meshFormats.begin(), meshFormats.end(), f) != meshFormats.end();
-    };
-    auto isAudioFormat = [&audioFormats](FileFormat f) {
-        return std::find(audioFormats.begin(), audioFormats.end(), f) != audioFormats.end();
-    };
-    auto isImageFormat = [&imageFormats](FileFormat f) {
-        return std::find(imageFormats.begin(), imageFormats.end(), f) != imageFormats.end();
-    };
-    auto isAnimationFormat = [&animationFormats](FileFormat f) {
-        return std::find(animationFormats.begin(), animationFormats.end(), f) != animationFormats.end();
-    };
+constexpr std::array<FileFormat, 20> kSupportedFormats = {
+    FileFormat::OBJ, FileFormat::FBX, FileFormat::GLTF, FileFormat::GLB, FileFormat::DAE,
+    FileFormat::STL, FileFormat::PLY, FileFormat::PMX, FileFormat::VMD, FileFormat::BVH,
+    FileFormat::WAV, FileFormat::MP3, FileFormat::OGG, FileFormat::FLAC,
+    FileFormat::PNG, FileFormat::JPG, FileFormat::EXR, FileFormat::HDR, FileFormat::TGA, FileFormat::BMP};
 
-    if (isMeshFormat(from) && isMeshFormat(to)) return true;
-    if (isAudioFormat(from) && isAudioFormat(to)) return true;
-    if (isImageFormat(from) && isImageFormat(to)) return true;
-    if (isAnimationFormat(from) && isAnimationFormat(to)) return true;
+}
 
-    return false;
+bool FormatConverter::canConvert(FileFormat from, FileFormat to) {
+    const FormatCategory category = categoryOf(from);
+    return category != FormatCategory::Unknown && category == categoryOf(to);
 }
 
-std::vector<FileFormat> FormatConverter::getSupportedFormats() {
-    return {FileFormat::OBJ, FileFormat::FBX, FileFormat::GLTF, FileFormat::GLB, FileFormat::DAE,
-            FileFormat::STL, FileFormat::PLY, FileFormat::PMX, FileFormat::VMD, FileFormat::BVH,
-            FileFormat::WAV, FileFormat::MP3, FileFormat::OGG, FileFormat::FLAC,
-            FileFormat::PNG, FileFormat::JPG, FileFormat::EXR, FileFormat::HDR, FileFormat::TGA, FileFormat::BMP};
+std::span<const FileFormat> FormatConverter::getSupportedFormats() {
+    return std::span{kSupportedFormats};
 }
 
 std::vector<FileFormat> FormatConverter::getTargetFormats(FileFormat sourceFormat) {
-    std::vector<FileFormat> allFormats = getSupportedFormats();
+    const uint32_t targetMask = categoryMask(categoryOf(sourceFormat));
+
     std::vector<FileFormat> targets;
+    targets.reserve(std::popcount(targetMask));
 
-    for (auto format : allFormats) {
-        if (canConvert(sourceFormat, format)) {
+    for (auto format : kSupportedFormats) {
+        if (targetMask & formatBit(format)) {
             targets.push_back(format);
         }
     }
@@ -307,15 +473,7 @@ std::vector<FileFormat> FormatConverter::getTargetFormats(FileFormat sourceForma
     return targets;
 }
 
-void FormatConverter::setProgressCallback(std::function<void(float)> callback) {
-    progressCallback_ = callback;
-}
-
-void FormatConverter::setErrorCallback(std::function<void(const std::string&)> callback) {
-    errorCallback_ = callback;
-}
-
-std::shared_ptr<modeling::Mesh> FormatConverter::loadAndProcessMesh(const std::string& inputPath,
+std::unique_ptr<modeling::Mesh> FormatConverter::loadAndProcessMesh(const std::string& inputPath,
                                                                    const ConversionOptions& options) {
     auto mesh = MeshLoader::load(inputPath);
     if (!mesh) return nullptr;
@@ -347,12 +505,12 @@ std::shared_ptr<modeling::Mesh> FormatConverter::loadAndProcessMesh(const std::s
     return mesh;
 }
 
-bool FormatConverter::saveMesh(const std::shared_ptr<modeling::Mesh>& mesh, const std::string& outputPath,
-                               const ConversionOptions& options) {
-    return MeshLoader::save(outputPath, *mesh);
+bool FormatConverter::saveMesh(const modeling::Mesh& mesh, const std::string& outputPath,
+                               const ConversionOptions& options, size_t* bytesWritten) {
+    return MeshLoader::save(outputPath, mesh, bytesWritten);
 }
 
-std::shared_ptr<audio::AudioBuffer> FormatConverter::loadAndProcessAudio(const std::string& inputPath,
+std::unique_ptr<audio::AudioBuffer> FormatConverter::loadAndProcessAudio(const std::string& inputPath,
                                                                           const AudioConversionOptions& options) {
     auto buffer = AudioLoader::load(inputPath);
     if (!buffer) return nullptr;
@@ -395,9 +553,9 @@ std::shared_ptr<audio::AudioBuffer> FormatConverter::loadAndProcessAudio(const s
     return buffer;
 }
 
-bool FormatConverter::saveAudio(const std::shared_ptr<audio::AudioBuffer>& buffer, const std::string& outputPath,
-                                const AudioConversionOptions& options) {
-    return AudioLoader::save(outputPath, *buffer);
+bool FormatConverter::saveAudio(const audio::AudioBuffer& buffer, const std::string& outputPath,
+                                const AudioConversionOptions& options, size_t* bytesWritten) {
+    return AudioLoader::save(outputPath, buffer, bytesWritten);
 }
 
 std::vector<uint8_t> FormatConverter::loadAndProcessImage(const std::string& inputPath,
@@ -407,39 +565,8 @@ std::vector<uint8_t> FormatConverter::loadAndProcessImage(const std::string& inp
     if (data.empty()) return data;
 
     if (targetWidth > 0 && targetHeight > 0 && (width != targetWidth || height != targetHeight)) {
-        float scaleX = static_cast<float>(targetWidth) / width;
-        float scaleY = static_cast<float>(targetHeight) / height;
-
-        std::vector<uint8_t> resizedData(targetWidth * targetHeight * channels);
-
-        for (int y = 0; y < targetHeight; ++y) {
-            for (int x = 0; x < targetWidth; ++x) {
-                float srcX = x / scaleX;
-                float srcY = y / scaleY;
-
-                int x0 = static_cast<int>(srcX);
-                int y0 = static_cast<int>(srcY);
-                int x1 = std::min(x0 + 1, width - 1);
-                int y1 = std::min(y0 + 1, height - 1);
-
-                float fx = srcX - x0;
-                float fy = srcY - y0;
-
-                for (int c = 0; c < channels; ++c) {
-                    float v00 = data[(y0 * width + x0) * channels + c];
-                    float v10 = data[(y0 * width + x1) * channels + c];
-                    float v01 = data[(y1 * width + x0) * channels + c];
-                    float v11 = data[(y1 * width + x1) * channels + c];
-
-                    float v0 = v00 * (1.0f - fx) + v10 * fx;
-                    float v1 = v01 * (1.0f - fx) + v11 * fx;
-                    float v = v0 * (1.0f - fy) + v1 * fy;
-
-                    resizedData[(y * targetWidth + x) * channels + c] = static_cast<uint8_t>(std::round(v));
-                }
-            }
-        }
-
+        std::vector<uint8_t> resizedData = resizeBilinear(data, width, height, channels,
+                                                          targetWidth, targetHeight);
         width = targetWidth;
         height = targetHeight;
         return resizedData;
@@ -449,8 +576,8 @@ std::vector<uint8_t> FormatConverter::loadAndProcessImage(const std::string& inp
 }
 
 bool FormatConverter::saveImage(const std::vector<uint8_t>& data, const std::string& outputPath,
-                               int width, int height, int channels, int quality) {
-    return ImageLoader::save(outputPath, data, width, height, channels);
+                               int width, int height, int channels, int quality, size_t* bytesWritten) {
+    return ImageLoader::save(outputPath, data, width, height, channels, bytesWritten);
 }
 
 BatchConverter::BatchConverter()
@@ -458,6 +585,46 @@ BatchConverter::BatchConverter()
     , progress_(0.0f)
     , completedCount_(0)
     , maxConcurrentConversions_(4) {
+    pool_ = std::make_unique<concurrency::ThreadPool>(maxConcurrentConversions_);
+    pool_->start();
+}
+
+BatchConverter::~BatchConverter() {
+    if (pool_) {
+        pool_->stop();
+    }
+}
+
+ConversionResult BatchConverter::runTask(const ConversionTask& task) {
+    ConversionCallbacks callbacks;
+    callbacks.progress = [this, &task](float progress) {
+        // Monitoring-only values: relaxed ordering keeps the callback path
+        // free of fences; cancelled_ stays seq_cst since it gates work.
+        float totalProgress =
+            (completedCount_.load(std::memory_order_relaxed) + progress) / tasks_.size();
+        progress_.store(totalProgress, std::memory_order_relaxed);
+        if (progressCallback_) progressCallback_(totalProgress, task.inputPath);
+    };
+    callbacks.error = [this, &task](const std::string& error) {
+        if (errorCallback_) errorCallback_(task.inputPath, error);
+    };
+
+    switch (task.type) {
+        case ConversionTask::Type::Mesh:
+            return FormatConverter::convertMesh(task.inputPath, task.outputPath, task.meshOptions, callbacks);
+        case ConversionTask::Type::Audio:
+            return FormatConverter::convertAudio(task.inputPath, task.outputPath, task.audioOptions, callbacks);
+        case ConversionTask::Type::Image:
+            return FormatConverter::convertImage(task.inputPath, task.outputPath,
+                                                task.imageTargetWidth, task.imageTargetHeight,
+                                                task.imageQuality, callbacks);
+        default: {
+            ConversionResult result;
+            result.success = false;
+            result.errorMessage = "Unknown conversion type";
+            return result;
+        }
+    }
 }
 
 void BatchConverter::addConversion(const std::string& inputPath, const std::string& outputPath,
@@ -494,72 +661,53 @@ void BatchConverter::addImageConversion(const std::string& inputPath, const std:
 
 std::vector<ConversionResult> BatchConverter::execute() {
     results_.clear();
-    results_.reserve(tasks_.size());
+    results_.resize(tasks_.size());
     cancelled_ = false;
-    completedCount_ = 0;
-    progress_ = 0.0f;
-
-    std::vector<std::future<ConversionResult>> futures;
-    int activeConversions = 0;
-    size_t taskIndex = 0;
-
-    while (taskIndex < tasks_.size() || activeConversions > 0) {
-        if (cancelled_) break;
-
-        while (activeConversions < maxConcurrentConversions_ && taskIndex < tasks_.size()) {
-            const auto& task = tasks_[taskIndex];
-
-            futures.push_back(std::async(std::launch::async, [task, this]() -> ConversionResult {
-                FormatConverter::setProgressCallback([this, task](float progress) {
-                    float totalProgress = (completedCount_ + progress) / tasks_.size();
-                    progress_ = totalProgress;
-                    if (progressCallback_) progressCallback_(totalProgress, task.inputPath);
-                });
-
-                FormatConverter::setErrorCallback([this, task](const std::string& error) {
-                    if (errorCallback_) errorCallback_(task.inputPath, error);
-                });
-
-                switch (task.type) {
-                    case ConversionTask::Type::Mesh:
-                        return FormatConverter::convertMesh(task.inputPath, task.outputPath, task.meshOptions);
-                    case ConversionTask::Type::Audio:
-                        return FormatConverter::convertAudio(task.inputPath, task.outputPath, task.audioOptions);
-                    case ConversionTask::Type::Image:
-                        return FormatConverter::convertImage(task.inputPath, task.outputPath,
-                                                            task.imageTargetWidth, task.imageTargetHeight,
-                                                            task.imageQuality);
-                    default:
-                        ConversionResult result;
-                        result.success = false;
-                        result.errorMessage = "Unknown conversion type";
-                        return result;
+    completedCount_.store(0, std::memory_order_relaxed);
+    progress_.store(0.0f, std::memory_order_relaxed);
+
+    // Stream input bytes ahead of the converters: prefetch tasks outrank
+    // conversion tasks in the pool's priority queue, so disk reads for
+    // later files overlap the compute of earlier conversions instead of
+    // serializing load -> process -> save per task.
+    for (const auto& task : tasks_) {
+        pool_->submitTask(std::unique_ptr<concurrency::Task>(
+            new concurrency::FunctionTask([this, path = task.inputPath]() {
+                if (!cancelled_) {
+                    FileLoader::readBinaryFile(path);
                 }
-            }));
-
-            activeConversions++;
-            taskIndex++;
-        }
-
-        for (auto it = futures.begin(); it != futures.end(); ) {
-            if (it->wait_for(std::chrono::milliseconds(10)) == std::future_status::ready) {
-                results_.push_back(it->get());
-                completedCount_++;
-                activeConversions--;
-                it = futures.erase(it);
-            } else {
-                ++it;
-            }
-        }
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }, 1)));
     }
 
-    for (auto& future : futures) {
-        future.wait();
-        results_.push_back(future.get());
+    // Each task writes its own preallocated slot, so no futures and no
+    // per-task shared state are needed; a counter plus condition variable
+    // is enough for the join.
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+    std::atomic<size_t> remaining(tasks_.size());
+
+    for (size_t i = 0; i < tasks_.size(); ++i) {
+        pool_->submitTask(std::unique_ptr<concurrency::Task>(
+            new concurrency::FunctionTask([this, i, &doneMutex, &doneCondition, &remaining]() {
+                const ConversionTask& task = tasks_[i];
+                if (cancelled_) {
+                    results_[i].success = false;
+                    results_[i].outputPath = task.outputPath;
+                    results_[i].errorMessage = "Cancelled";
+                } else {
+                    results_[i] = runTask(task);
+                    completedCount_.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (remaining.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(doneMutex);
+                    doneCondition.notify_one();
+                }
+            }, 0)));
     }
 
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCondition.wait(lock, [&remaining] { return remaining.load() == 0; });
+
     return results_;
 }
 
@@ -568,11 +716,11 @@ void BatchConverter::cancel() {
 }
 
 float BatchConverter::getProgress() const {
-    return progress_;
+    return progress_.load(std::memory_order_relaxed);
 }
 
 int BatchConverter::getCompletedCount() const {
-    return completedCount_;
+    return completedCount_.load(std::memory_order_relaxed);
 }
 
 int BatchConverter::getTotalCount() const {
@@ -580,7 +728,15 @@ int BatchConverter::getTotalCount() const {
 }
 
 void BatchConverter::setMaxConcurrentConversions(int maxConversions) {
-    maxConcurrentConversions_ = std::max(1, maxConversions);
+    maxConversions = std::max(1, maxConversions);
+    if (maxConversions == maxConcurrentConversions_) {
+        return;
+    }
+    maxConcurrentConversions_ = maxConversions;
+
+    pool_->stop();
+    pool_ = std::make_unique<concurrency::ThreadPool>(maxConversions);
+    pool_->start();
 }
 
 int BatchConverter::getMaxConcurrentConversions() const {
@@ -7,8 +7,13 @@
 #include <string>
 #include <memory>
 #include <functional>
+#include <span>
 
 namespace v3d {
+namespace concurrency {
+class ThreadPool;
+}
+
 namespace io {
 
 struct ConversionOptions {
@@ -38,6 +43,11 @@ struct AudioConversionOptions {
     float fadeOutDuration = 0.0f;
 };
 
+struct ConversionCallbacks {
+    std::function<void(float)> progress;
+    std::function<void(const std::string&)> error;
+};
+
 struct ConversionResult {
     bool success;
     std::string outputPath;
@@ -50,51 +60,51 @@ struct ConversionResult {
 class FormatConverter {
 public:
     static ConversionResult convertMesh(const std::string& inputPath, const std::string& outputPath,
-                                       const ConversionOptions& options = ConversionOptions());
+                                       const ConversionOptions& options = ConversionOptions(),
+                                       const ConversionCallbacks& callbacks = ConversionCallbacks());
 
     static ConversionResult convertAnimation(const std::string& inputPath, const std::string& outputPath,
-                                            const ConversionOptions& options = ConversionOptions());
+                                            const ConversionOptions& options = ConversionOptions(),
+                                            const ConversionCallbacks& callbacks = ConversionCallbacks());
 
     static ConversionResult convertAudio(const std::string& inputPath, const std::string& outputPath,
-                                       const AudioConversionOptions& options = AudioConversionOptions());
+                                       const AudioConversionOptions& options = AudioConversionOptions(),
+                                       const ConversionCallbacks& callbacks = ConversionCallbacks());
 
     static ConversionResult convertImage(const std::string& inputPath, const std::string& outputPath,
-                                        int targetWidth = 0, int targetHeight = 0, int quality = 85);
+                                        int targetWidth = 0, int targetHeight = 0, int quality = 85,
+                                        const ConversionCallbacks& callbacks = ConversionCallbacks());
 
     static ConversionResult convertScene(const std::string& inputPath, const std::string& outputPath,
-                                        const ConversionOptions& options = ConversionOptions());
+                                        const ConversionOptions& options = ConversionOptions(),
+                                        const ConversionCallbacks& callbacks = ConversionCallbacks());
 
     static bool canConvert(FileFormat from, FileFormat to);
-    static std::vector<FileFormat> getSupportedFormats();
+    static std::span<const FileFormat> getSupportedFormats();
     static std::vector<FileFormat> getTargetFormats(FileFormat sourceFormat);
 
-    static void setProgressCallback(std::function<void(float)> callback);
-    static void setErrorCallback(std::function<void(const std::string&)> callback);
-
 private:
-    static std::shared_ptr<modeling::Mesh> loadAndProcessMesh(const std::string& inputPath,
+    static std::unique_ptr<modeling::Mesh> loadAndProcessMesh(const std::string& inputPath,
                                                                const ConversionOptions& options);
-    static bool saveMesh(const std::shared_ptr<modeling::Mesh>& mesh, const std::string& outputPath,
-                        const ConversionOptions& options);
+    static bool saveMesh(const modeling::Mesh& mesh, const std::string& outputPath,
+                        const ConversionOptions& options, size_t* bytesWritten);
 
-    static std::shared_ptr<audio::AudioBuffer> loadAndProcessAudio(const std::string& inputPath,
+    static std::unique_ptr<audio::AudioBuffer> loadAndProcessAudio(const std::string& inputPath,
                                                                    const AudioConversionOptions& options);
-    static bool saveAudio(const std::shared_ptr<audio::AudioBuffer>& buffer, const std::string& outputPath,
-                         const AudioConversionOptions& options);
+    static bool saveAudio(const audio::AudioBuffer& buffer, const std::string& outputPath,
+                         const AudioConversionOptions& options, size_t* bytesWritten);
 
     static std::vector<uint8_t> loadAndProcessImage(const std::string& inputPath,
                                                     int& width, int& height, int& channels,
                                                     int targetWidth, int targetHeight, int quality);
     static bool saveImage(const std::vector<uint8_t>& data, const std::string& outputPath,
-                         int width, int height, int channels, int quality);
-
-    static std::function<void(float)> progressCallback_;
-    static std::function<void(const std::string&)> errorCallback_;
+                         int width, int height, int channels, int quality, size_t* bytesWritten);
 };
 
 class BatchConverter {
 public:
     BatchConverter();
+    ~BatchConverter();
 
     void addConversion(const std::string& inputPath, const std::string& outputPath,
                       const ConversionOptions& options = ConversionOptions());
@@ -130,8 +140,11 @@ private:
         int imageQuality;
     };
 
+    ConversionResult runTask(const ConversionTask& task);
+
     std::vector<ConversionTask> tasks_;
     std::vector<ConversionResult> results_;
+    std::unique_ptr<concurrency::ThreadPool> pool_;
     std::atomic<bool> cancelled_;
     std::atomic<float> progress_;
     std::atomic<int> completedCount_;
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace v3d {
+namespace io {
+
+/**
+ * @class PathInternTable
+ * @brief Path alias symbol table - interns alias strings into dense uint32 IDs
+ *
+ * Registration interns the alias once; resolution splits the leading path
+ * component and probes the table heterogeneously (no temporary std::string),
+ * and the returned symbol indexes straight into a flat target table. A
+ * resolution therefore costs one short-string hash plus a vector index
+ * instead of a linear scan with per-alias concatenation.
+ */
+class PathInternTable {
+public:
+    using SymbolId = uint32_t;
+    static constexpr SymbolId kNotFound = ~SymbolId{0};
+
+    /// @brief Interns an alias, assigning a fresh symbol on first sight
+    SymbolId intern(std::string_view alias) {
+        auto it = aliasToSymbol_.find(alias);
+        if (it != aliasToSymbol_.end()) {
+            return it->second;
+        }
+        SymbolId symbol = static_cast<SymbolId>(targets_.size());
+        targets_.emplace_back();
+        aliasToSymbol_.emplace(std::string(alias), symbol);
+        return symbol;
+    }
+
+    /// @brief Interns a batch of known-hot aliases ahead of first use,
+    /// giving them low, stable symbol ids and keeping later lookups on
+    /// the find-only path
+    void prewarm(std::initializer_list<std::string_view> aliases) {
+        for (std::string_view alias : aliases) {
+            intern(alias);
+        }
+    }
+
+    /// @brief Looks up an alias without interning; returns kNotFound on miss
+    SymbolId find(std::string_view alias) const {
+        auto it = aliasToSymbol_.find(alias);
+        return it != aliasToSymbol_.end() ? it->second : kNotFound;
+    }
+
+    /// @brief Sets the target path an interned symbol resolves to
+    void setTarget(SymbolId symbol, std::string path) {
+        targets_[symbol] = std::move(path);
+    }
+
+    /// @brief Returns the target path for a symbol obtained from find()
+    const std::string& target(SymbolId symbol) const {
+        return targets_[symbol];
+    }
+
+    bool empty() const { return targets_.empty(); }
+
+    void clear() {
+        aliasToSymbol_.clear();
+        targets_.clear();
+    }
+
+private:
+    /// @brief Transparent hash so lookups accept string_view directly
+    struct Hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const {
+            return std::hash<std::string_view>{}(text);
+        }
+    };
+
+    std::unordered_map<std::string, SymbolId, Hash, std::equal_to<>> aliasToSymbol_;
+    std::vector<std::string> targets_;  ///< Indexed by SymbolId
+};
+
+}
+}
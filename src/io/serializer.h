@@ -1,10 +1,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <nlohmann/json.hpp>
 
 namespace v3d {
@@ -13,7 +16,7 @@ namespace io {
 class Serializer {
 public:
     static std::string serializeToJson(const nlohmann::json& data);
-    static nlohmann::json deserializeFromJson(const std::string& json);
+    static nlohmann::json deserializeFromJson(std::string_view json);
 
     static std::vector<uint8_t> serializeToBinary(const nlohmann::json& data);
     static nlohmann::json deserializeFromBinary(const std::vector<uint8_t>& data);
@@ -21,21 +24,39 @@ public:
     static std::string compress(const std::string& data);
     static std::string decompress(const std::string& compressed);
 
+    // Raw-range primitives; the string and vector overloads below are thin
+    // wrappers so payloads never round-trip through an extra container copy.
+    static std::vector<uint8_t> compressBinary(const uint8_t* data, size_t size);
+    static std::vector<uint8_t> compressBinaryChunked(const uint8_t* data, size_t size);
+
     static std::vector<uint8_t> compressBinary(const std::vector<uint8_t>& data);
     static std::vector<uint8_t> decompressBinary(const std::vector<uint8_t>& compressed);
 
+    // Chunked container: payloads above 4 MiB are split and deflated in
+    // parallel, with per-chunk sizes stored in a small header so decompression
+    // parallelizes too. Smaller payloads and legacy single-stream data pass
+    // through compressBinary/decompressBinary unchanged.
+    static std::vector<uint8_t> compressBinaryChunked(const std::vector<uint8_t>& data);
+    static std::vector<uint8_t> decompressBinaryChunked(const std::vector<uint8_t>& compressed);
+
     static std::string encodeBase64(const std::vector<uint8_t>& data);
     static std::vector<uint8_t> decodeBase64(const std::string& encoded);
 
     static std::string calculateChecksum(const std::string& data);
     static std::string calculateChecksum(const std::vector<uint8_t>& data);
 
+    static void setCompressionLevel(int level);
+    static int getCompressionLevel();
+
     static void setProgressCallback(std::function<void(float)> callback);
     static void setErrorCallback(std::function<void(const std::string&)> callback);
 
 private:
+    friend class VersionedSerializer;
+
     static std::function<void(float)> progressCallback_;
     static std::function<void(const std::string&)> errorCallback_;
+    static int compressionLevel_;
 };
 
 class VersionedSerializer {
@@ -64,7 +85,7 @@ public:
     std::string serialize(const T& object);
 
     template<typename T>
-    bool deserialize(const std::string& data, T& object);
+    bool deserialize(std::string_view data, T& object);
 
     template<typename T>
     std::vector<uint8_t> serializeBinary(const T& object);
@@ -82,17 +103,33 @@ private:
     std::function<bool(const Version&, const Version&, nlohmann::json&)> migrationCallback_;
 };
 
+class StringArena {
+public:
+    std::string_view alloc(std::string_view text);
+    void reset();
+
+private:
+    static constexpr size_t kBlockSize = 32 * 1024;
+
+    char* cursor_ = nullptr;
+    char* limit_ = nullptr;
+    std::vector<std::unique_ptr<char[]>> blocks_;
+};
+
 class ProjectSerializer {
 public:
+    // Metadata strings are views into the serializer's arena: loadProject
+    // fills them with one bump allocation each, and they stay valid until
+    // the next loadProject call or the serializer is destroyed.
     struct ProjectMetadata {
-        std::string name;
-        std::string description;
-        std::string author;
+        std::string_view name;
+        std::string_view description;
+        std::string_view author;
         VersionedSerializer::Version version;
-        std::string createdDate;
-        std::string modifiedDate;
-        std::string thumbnail;
-        std::unordered_map<std::string, std::string> customProperties;
+        std::string_view createdDate;
+        std::string_view modifiedDate;
+        std::string_view thumbnail;
+        std::unordered_map<std::string_view, std::string_view> customProperties;
     };
 
     ProjectSerializer();
@@ -120,8 +157,17 @@ public:
 
 private:
     std::string getRecentProjectsPath() const;
-    void saveRecentProjects() const;
-
+    void saveRecentProjects();
+
+    StringArena metadataArena_;
+    // Recent-projects list lives here after the first read; only writes go
+    // back to disk, and they run off-thread so saveProject returns without
+    // waiting on the file.
+    mutable std::vector<std::string> recentCache_;
+    mutable bool recentLoaded_ = false;
+    mutable std::string recentProjectsPath_;
+    mutable std::once_flag recentPathOnce_;
+    std::future<void> recentWriteTask_;
     std::function<void(float)> progressCallback_;
     std::function<void(const std::string&)> errorCallback_;
 };
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "serializer.h"
+
+// Template bodies for VersionedSerializer. serializer.cpp includes this and
+// explicitly instantiates the types the engine actually serializes; a TU that
+// needs another type includes this header instead of re-declaring the bodies.
+
+namespace v3d {
+namespace io {
+
+template<typename T>
+std::string VersionedSerializer::serialize(const T& object) {
+    nlohmann::json data;
+
+    data["version"] = {
+        {"major", currentVersion_.major},
+        {"minor", currentVersion_.minor},
+        {"patch", currentVersion_.patch}
+    };
+
+    data["data"] = object;
+
+    if (Serializer::progressCallback_) {
+        Serializer::progressCallback_(0.5f);
+    }
+
+    std::string json = Serializer::serializeToJson(data);
+
+    if (Serializer::progressCallback_) {
+        Serializer::progressCallback_(1.0f);
+    }
+
+    return json;
+}
+
+template<typename T>
+bool VersionedSerializer::deserialize(std::string_view data, T& object) {
+    nlohmann::json json = Serializer::deserializeFromJson(data);
+
+    if (!json.contains("version")) {
+        if (Serializer::errorCallback_) {
+            Serializer::errorCallback_("Missing version information");
+        }
+        return false;
+    }
+
+    const auto& versionJson = json["version"];
+    Version version;
+    version.major = versionJson.value("major", 1);
+    version.minor = versionJson.value("minor", 0);
+    version.patch = versionJson.value("patch", 0);
+
+    if (!isCompatible(version)) {
+        if (migrationCallback_) {
+            nlohmann::json migratedData;
+            if (migrationCallback_(version, currentVersion_, json["data"])) {
+                object = json["data"].get<T>();
+            } else {
+                if (Serializer::errorCallback_) {
+                    Serializer::errorCallback_("Failed to migrate data from version " + version.toString());
+                }
+                return false;
+            }
+        } else {
+            if (Serializer::errorCallback_) {
+                Serializer::errorCallback_("Incompatible version: " + version.toString());
+            }
+            return false;
+        }
+    } else {
+        object = json["data"].get<T>();
+    }
+
+    if (Serializer::progressCallback_) {
+        Serializer::progressCallback_(1.0f);
+    }
+
+    return true;
+}
+
+template<typename T>
+std::vector<uint8_t> VersionedSerializer::serializeBinary(const T& object) {
+    std::string json = serialize(object);
+    return Serializer::compressBinaryChunked(
+        reinterpret_cast<const uint8_t*>(json.data()), json.size());
+}
+
+template<typename T>
+bool VersionedSerializer::deserializeBinary(const std::vector<uint8_t>& data, T& object) {
+    std::vector<uint8_t> decompressed = Serializer::decompressBinaryChunked(data);
+    return deserialize(std::string_view(reinterpret_cast<const char*>(decompressed.data()),
+                                        decompressed.size()), object);
+}
+
+}
+}
@@ -5,6 +5,43 @@
 namespace v3d {
 namespace modeling {
 
+namespace {
+
+// Maps a slot name to its TextureSlotId without walking every candidate:
+// the first character is unique for all slots except "albedo"/"ao", which
+// the length disambiguates. Returns Count for unknown names.
+TextureSlotId resolveSlotName(const std::string& slot) {
+    if (slot.empty()) {
+        return TextureSlotId::Count;
+    }
+    switch (slot[0]) {
+        case 'a':
+            if (slot == "albedo") return TextureSlotId::Albedo;
+            if (slot == "ao") return TextureSlotId::Ao;
+            break;
+        case 'n':
+            if (slot == "normal") return TextureSlotId::Normal;
+            break;
+        case 'm':
+            if (slot == "metallic") return TextureSlotId::Metallic;
+            break;
+        case 'r':
+            if (slot == "roughness") return TextureSlotId::Roughness;
+            break;
+        case 'e':
+            if (slot == "emissive") return TextureSlotId::Emissive;
+            break;
+        case 'o':
+            if (slot == "opacity") return TextureSlotId::Opacity;
+            break;
+        default:
+            break;
+    }
+    return TextureSlotId::Count;
+}
+
+}
+
 Material::Material()
     : type_(MaterialType::Standard)
     , albedo_(1.0f)
@@ -18,7 +55,8 @@ Material::Material()
     , ior_(1.5f)
     , transmission_(0.0f)
     , thickness_(0.5f)
-    , doubleSided_(false) {
+    , doubleSided_(false)
+    , cachedTransparent_(false) {
 }
 
 Material::Material(const std::string& name)
@@ -35,13 +73,14 @@ Material::Material(const std::string& name)
     , ior_(1.5f)
     , transmission_(0.0f)
     , thickness_(0.5f)
-    , doubleSided_(false) {
+    , doubleSided_(false)
+    , cachedTransparent_(false) {
 }
 
 Material::~Material() {
 }
 
-std::string Material::getName() const {
+const std::string& Material::getName() const {
     return name_;
 }
 
@@ -119,6 +158,7 @@ float Material::getOpacity() const {
 
 void Material::setOpacity(float opacity) {
     opacity_ = glm::clamp(opacity, 0.0f, 1.0f);
+    updateTransparency();
 }
 
 float Material::getIOR() const {
@@ -154,142 +194,126 @@ void Material::setDoubleSided(bool doubleSided) {
 }
 
 const TextureSlot& Material::getAlbedoTexture() const {
-    return albedoTexture_;
+    return textures_[static_cast<size_t>(TextureSlotId::Albedo)];
 }
 
 void Material::setAlbedoTexture(const std::string& path) {
-    albedoTexture_.path = path;
-    albedoTexture_.enabled = !path.empty();
+    setTexture(TextureSlotId::Albedo, path);
 }
 
 const TextureSlot& Material::getNormalTexture() const {
-    return normalTexture_;
+    return textures_[static_cast<size_t>(TextureSlotId::Normal)];
 }
 
 void Material::setNormalTexture(const std::string& path) {
-    normalTexture_.path = path;
-    normalTexture_.enabled = !path.empty();
+    setTexture(TextureSlotId::Normal, path);
 }
 
 const TextureSlot& Material::getMetallicTexture() const {
-    return metallicTexture_;
+    return textures_[static_cast<size_t>(TextureSlotId::Metallic)];
 }
 
 void Material::setMetallicTexture(const std::string& path) {
-    metallicTexture_.path = path;
-    metallicTexture_.enabled = !path.empty();
+    setTexture(TextureSlotId::Metallic, path);
 }
 
 const TextureSlot& Material::getRoughnessTexture() const {
-    return roughnessTexture_;
+    return textures_[static_cast<size_t>(TextureSlotId::Roughness)];
 }
 
 void Material::setRoughnessTexture(const std::string& path) {
-    roughnessTexture_.path = path;
-    roughnessTexture_.enabled = !path.empty();
+    setTexture(TextureSlotId::Roughness, path);
 }
 
 const TextureSlot& Material::getAoTexture() const {
-    return aoTexture_;
+    return textures_[static_cast<size_t>(TextureSlotId::Ao)];
 }
 
 void Material::setAoTexture(const std::string& path) {
-    aoTexture_.path = path;
-    aoTexture_.enabled = !path.empty();
+    setTexture(TextureSlotId::Ao, path);
 }
 
 const TextureSlot& Material::getEmissiveTexture() const {
-    return emissiveTexture_;
+    return textures_[static_cast<size_t>(TextureSlotId::Emissive)];
 }
 
 void Material::setEmissiveTexture(const std::string& path) {
-    emissiveTexture_.path = path;
-    emissiveTexture_.enabled = !path.empty();
+    setTexture(TextureSlotId::Emissive, path);
 }
 
 const TextureSlot& Material::getOpacityTexture() const {
-    return opacityTexture_;
+    return textures_[static_cast<size_t>(TextureSlotId::Opacity)];
 }
 
 void Material::setOpacityTexture(const std::string& path) {
-    opacityTexture_.path = path;
-    opacityTexture_.enabled = !path.empty();
+    setTexture(TextureSlotId::Opacity, path);
+}
+
+const TextureSlot& Material::getTexture(TextureSlotId slot) const {
+    return textures_[static_cast<size_t>(slot)];
+}
+
+void Material::setTexture(TextureSlotId slot, const std::string& path) {
+    TextureSlot& texture = textures_[static_cast<size_t>(slot)];
+    texture.path = path;
+    texture.enabled = !path.empty();
+    if (slot == TextureSlotId::Opacity) {
+        updateTransparency();
+    }
+}
+
+void Material::setTextureTiling(TextureSlotId slot, const glm::vec2& tiling) {
+    textures_[static_cast<size_t>(slot)].tiling = tiling;
+}
+
+void Material::setTextureOffset(TextureSlotId slot, const glm::vec2& offset) {
+    textures_[static_cast<size_t>(slot)].offset = offset;
+}
+
+void Material::enableTexture(TextureSlotId slot) {
+    textures_[static_cast<size_t>(slot)].enabled = true;
+    if (slot == TextureSlotId::Opacity) {
+        updateTransparency();
+    }
+}
+
+void Material::disableTexture(TextureSlotId slot) {
+    textures_[static_cast<size_t>(slot)].enabled = false;
+    if (slot == TextureSlotId::Opacity) {
+        updateTransparency();
+    }
 }
 
 void Material::setTextureTiling(const std::string& slot, const glm::vec2& tiling) {
-    if (slot == "albedo") {
-        albedoTexture_.tiling = tiling;
-    } else if (slot == "normal") {
-        normalTexture_.tiling = tiling;
-    } else if (slot == "metallic") {
-        metallicTexture_.tiling = tiling;
-    } else if (slot == "roughness") {
-        roughnessTexture_.tiling = tiling;
-    } else if (slot == "ao") {
-        aoTexture_.tiling = tiling;
-    } else if (slot == "emissive") {
-        emissiveTexture_.tiling = tiling;
-    } else if (slot == "opacity") {
-        opacityTexture_.tiling = tiling;
+    TextureSlotId id = resolveSlotName(slot);
+    if (id != TextureSlotId::Count) {
+        setTextureTiling(id, tiling);
     }
 }
 
 void Material::setTextureOffset(const std::string& slot, const glm::vec2& offset) {
-    if (slot == "albedo") {
-        albedoTexture_.offset = offset;
-    } else if (slot == "normal") {
-        normalTexture_.offset = offset;
-    } else if (slot == "metallic") {
-        metallicTexture_.offset = offset;
-    } else if (slot == "roughness") {
-        roughnessTexture_.offset = offset;
-    } else if (slot == "ao") {
-        aoTexture_.offset = offset;
-    } else if (slot == "emissive") {
-        emissiveTexture_.offset = offset;
-    } else if (slot == "opacity") {
-        opacityTexture_.offset = offset;
+    TextureSlotId id = resolveSlotName(slot);
+    if (id != TextureSlotId::Count) {
+        setTextureOffset(id, offset);
     }
 }
 
 void Material::enableTexture(const std::string& slot) {
-    if (slot == "albedo") {
-        albedoTexture_.enabled = true;
-    } else if (slot == "normal") {
-        normalTexture_.enabled = true;
-    } else if (slot == "metallic") {
-        metallicTexture_.enabled = true;
-    } else if (slot == "roughness") {
-        roughnessTexture_.enabled = true;
-    } else if (slot == "ao") {
-        aoTexture_.enabled = true;
-    } else if (slot == "emissive") {
-        emissiveTexture_.enabled = true;
-    } else if (slot == "opacity") {
-        opacityTexture_.enabled = true;
+    TextureSlotId id = resolveSlotName(slot);
+    if (id != TextureSlotId::Count) {
+        enableTexture(id);
     }
 }
 
 void Material::disableTexture(const std::string& slot) {
-    if (slot == "albedo") {
-        albedoTexture_.enabled = false;
-    } else if (slot == "normal") {
-        normalTexture_.enabled = false;
-    } else if (slot == "metallic") {
-        metallicTexture_.enabled = false;
-    } else if (slot == "roughness") {
-        roughnessTexture_.enabled = false;
-    } else if (slot == "ao") {
-        aoTexture_.enabled = false;
-    } else if (slot == "emissive") {
-        emissiveTexture_.enabled = false;
-    } else if (slot == "opacity") {
-        opacityTexture_.enabled = false;
+    TextureSlotId id = resolveSlotName(slot);
+    if (id != TextureSlotId::Count) {
+        disableTexture(id);
     }
 }
 
-bool Material::isTransparent() const {
-    return opacity_ < 1.0f || opacityTexture_.enabled;
+void Material::updateTransparency() {
+    cachedTransparent_ = (opacity_ < 1.0f) | getOpacityTexture().enabled;
 }
 
 void Material::clear() {
@@ -308,43 +332,43 @@ void Material::clear() {
     thickness_ = 0.5f;
     doubleSided_ = false;
 
-    albedoTexture_ = TextureSlot();
-    normalTexture_ = TextureSlot();
-    metallicTexture_ = TextureSlot();
-    roughnessTexture_ = TextureSlot();
-    aoTexture_ = TextureSlot();
-    emissiveTexture_ = TextureSlot();
-    opacityTexture_ = TextureSlot();
+    std::fill(textures_.begin(), textures_.end(), TextureSlot());
+    cachedTransparent_ = false;
 }
 
+MaterialLibrary* const MaterialLibrary::instance_ = new MaterialLibrary();
+
 MaterialLibrary& MaterialLibrary::getInstance() {
-    static MaterialLibrary instance;
-    return instance;
+    return *instance_;
 }
 
-MaterialLibrary::MaterialLibrary() {
+MaterialLibrary::MaterialLibrary()
+    : materials_(&pool_) {
     defaultMaterial_ = std::make_shared<Material>("Default");
 }
 
 std::shared_ptr<Material> MaterialLibrary::createMaterial(const std::string& name) {
     auto material = std::make_shared<Material>(name);
-    materials_[name] = material;
+    materials_[std::pmr::string(name, &pool_)] = material;
     return material;
 }
 
-std::shared_ptr<Material> MaterialLibrary::getMaterial(const std::string& name) const {
+std::shared_ptr<Material> MaterialLibrary::getMaterial(std::string_view name) const {
     auto it = materials_.find(name);
     return it != materials_.end() ? it->second : defaultMaterial_;
 }
 
 void MaterialLibrary::addMaterial(std::shared_ptr<Material> material) {
     if (material) {
-        materials_[material->getName()] = material;
+        materials_[std::pmr::string(material->getName(), &pool_)] = material;
     }
 }
 
-void MaterialLibrary::removeMaterial(const std::string& name) {
-    materials_.erase(name);
+void MaterialLibrary::removeMaterial(std::string_view name) {
+    auto it = materials_.find(name);
+    if (it != materials_.end()) {
+        materials_.erase(it);
+    }
 }
 
 void MaterialLibrary::clear() {
@@ -353,8 +377,9 @@ void MaterialLibrary::clear() {
 
 std::vector<std::string> MaterialLibrary::getMaterialNames() const {
     std::vector<std::string> names;
+    names.reserve(materials_.size());
     for (const auto& pair : materials_) {
-        names.push_back(pair.first);
+        names.emplace_back(std::string_view(pair.first));
     }
     return names;
 }
@@ -363,6 +388,31 @@ size_t MaterialLibrary::getMaterialCount() const {
     return materials_.size();
 }
 
+MaterialTable MaterialLibrary::buildTable() const {
+    MaterialTable table;
+    table.names.reserve(materials_.size());
+    table.albedo.reserve(materials_.size());
+    table.metallic.reserve(materials_.size());
+    table.roughness.reserve(materials_.size());
+    table.ao.reserve(materials_.size());
+    table.emissive.reserve(materials_.size());
+    table.emissiveIntensity.reserve(materials_.size());
+    table.opacity.reserve(materials_.size());
+
+    for (const auto& pair : materials_) {
+        const Material& material = *pair.second;
+        table.names.emplace_back(std::string_view(pair.first));
+        table.albedo.push_back(material.getAlbedo());
+        table.metallic.push_back(material.getMetallic());
+        table.roughness.push_back(material.getRoughness());
+        table.ao.push_back(material.getAo());
+        table.emissive.push_back(material.getEmissive());
+        table.emissiveIntensity.push_back(material.getEmissiveIntensity());
+        table.opacity.push_back(material.getOpacity());
+    }
+    return table;
+}
+
 bool MaterialLibrary::loadFromFile(const std::string& filePath) {
     return false;
 }
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include <memory_resource>
+#include <array>
+#include <cstdint>
 #include <unordered_map>
 #include <glm/glm.hpp>
 
@@ -20,6 +24,17 @@ enum class MaterialType {
     Skybox
 };
 
+enum class TextureSlotId : uint8_t {
+    Albedo = 0,
+    Normal,
+    Metallic,
+    Roughness,
+    Ao,
+    Emissive,
+    Opacity,
+    Count
+};
+
 struct TextureSlot {
     std::string path;
     int textureId;
@@ -36,7 +51,7 @@ public:
     explicit Material(const std::string& name);
     ~Material();
 
-    std::string getName() const;
+    const std::string& getName() const;
     void setName(const std::string& name);
 
     MaterialType getType() const;
@@ -99,17 +114,28 @@ public:
     const TextureSlot& getOpacityTexture() const;
     void setOpacityTexture(const std::string& path);
 
+    const TextureSlot& getTexture(TextureSlotId slot) const;
+    void setTexture(TextureSlotId slot, const std::string& path);
+
+    void setTextureTiling(TextureSlotId slot, const glm::vec2& tiling);
+    void setTextureOffset(TextureSlotId slot, const glm::vec2& offset);
+
+    void enableTexture(TextureSlotId slot);
+    void disableTexture(TextureSlotId slot);
+
     void setTextureTiling(const std::string& slot, const glm::vec2& tiling);
     void setTextureOffset(const std::string& slot, const glm::vec2& offset);
 
     void enableTexture(const std::string& slot);
     void disableTexture(const std::string& slot);
 
-    bool isTransparent() const;
+    bool isTransparent() const { return cachedTransparent_; }
 
     void clear();
 
 private:
+    void updateTransparency();
+
     std::string name_;
     MaterialType type_;
 
@@ -126,13 +152,36 @@ private:
     float thickness_;
     bool doubleSided_;
 
-    TextureSlot albedoTexture_;
-    TextureSlot normalTexture_;
-    TextureSlot metallicTexture_;
-    TextureSlot roughnessTexture_;
-    TextureSlot aoTexture_;
-    TextureSlot emissiveTexture_;
-    TextureSlot opacityTexture_;
+    std::array<TextureSlot, static_cast<size_t>(TextureSlotId::Count)> textures_;
+    // Kept in sync by the opacity mutators; render sort/binning reads this
+    // once per draw call, so the query is a single byte load.
+    bool cachedTransparent_;
+};
+
+// Structure-of-arrays snapshot of every material's PBR parameters. Each
+// attribute is one contiguous vector, so batch upload to a GPU constant
+// buffer is a single transfer per field instead of a gather per material.
+struct MaterialTable {
+    std::vector<std::string> names;
+    std::vector<glm::vec3> albedo;
+    std::vector<float> metallic;
+    std::vector<float> roughness;
+    std::vector<float> ao;
+    std::vector<glm::vec3> emissive;
+    std::vector<float> emissiveIntensity;
+    std::vector<float> opacity;
+
+    size_t size() const { return names.size(); }
+};
+
+// Transparent hash so the material map can be probed with a string_view or
+// literal without materializing a std::string per lookup.
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view text) const {
+        return std::hash<std::string_view>{}(text);
+    }
 };
 
 class MaterialLibrary {
@@ -140,15 +189,17 @@ public:
     static MaterialLibrary& getInstance();
 
     std::shared_ptr<Material> createMaterial(const std::string& name);
-    std::shared_ptr<Material> getMaterial(const std::string& name) const;
+    std::shared_ptr<Material> getMaterial(std::string_view name) const;
 
     void addMaterial(std::shared_ptr<Material> material);
-    void removeMaterial(const std::string& name);
+    void removeMaterial(std::string_view name);
     void clear();
 
     std::vector<std::string> getMaterialNames() const;
     size_t getMaterialCount() const;
 
+    MaterialTable buildTable() const;
+
     bool loadFromFile(const std::string& filePath);
     bool saveToFile(const std::string& filePath) const;
 
@@ -158,8 +209,20 @@ public:
 private:
     MaterialLibrary();
 
-    std::unordered_map<std::string, std::shared_ptr<Material>> materials_;
+    // Map nodes and name strings are many small allocations; a per-library
+    // pool keeps them together instead of scattered across the heap, and
+    // freed nodes are recycled on the next insert. Declared before the map
+    // so the pool outlives the containers that allocate from it.
+    std::pmr::unsynchronized_pool_resource pool_;
+    std::pmr::unordered_map<std::pmr::string, std::shared_ptr<Material>,
+                            StringHash, std::equal_to<>> materials_;
     std::shared_ptr<Material> defaultMaterial_;
+
+    // Eagerly constructed at load time and intentionally never destroyed:
+    // getInstance() is then a plain load with no thread-safe-static guard
+    // branch, and no static destructor can race shutdown code that still
+    // holds materials.
+    static MaterialLibrary* const instance_;
 };
 
 }
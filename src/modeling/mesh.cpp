@@ -1,11 +1,303 @@
 #include "mesh.h"
 #include <algorithm>
-#include <unordered_set>
+#include <bit>
 #include <cmath>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace v3d {
 namespace modeling {
 
+namespace {
+
+// splitmix64的终混合：每步一次乘法即可充分雪崩。std::hash<float>
+// 在常见实现里只是位转换，直接组合时不同浮点值的哈希大量碰撞。
+uint64_t mix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// -0.0f与0.0f相等但位型不同，先归一再取位型保证哈希与相等一致。
+uint32_t floatBits(float value) {
+    return std::bit_cast<uint32_t>(value == 0.0f ? 0.0f : value);
+}
+
+// [-1,1]的分量量化为10位有符号整数（存入32位字的低10位）。
+uint32_t packSnorm10(float value) {
+    float clamped = glm::clamp(value, -1.0f, 1.0f);
+    int quantized = static_cast<int>(std::round(clamped * 511.0f));
+    return static_cast<uint32_t>(quantized) & 0x3FFu;
+}
+
+// 单位向量按GPU的10_10_10_2布局打包，最高2位保留。
+uint32_t packSnorm_10_10_10_2(const glm::vec3& v) {
+    return packSnorm10(v.x) | (packSnorm10(v.y) << 10) | (packSnorm10(v.z) << 20);
+}
+
+uint32_t packSnorm16x2(const glm::vec2& v) {
+    auto pack = [](float value) {
+        float clamped = glm::clamp(value, -1.0f, 1.0f);
+        int quantized = static_cast<int>(std::round(clamped * 32767.0f));
+        return static_cast<uint32_t>(quantized) & 0xFFFFu;
+    };
+    return pack(v.x) | (pack(v.y) << 16);
+}
+
+uint32_t packUnorm8x4(const glm::vec4& v) {
+    auto pack = [](float value) {
+        float clamped = glm::clamp(value, 0.0f, 1.0f);
+        return static_cast<uint32_t>(std::round(clamped * 255.0f));
+    };
+    return pack(v.x) | (pack(v.y) << 8) | (pack(v.z) << 16) | (pack(v.w) << 24);
+}
+
+// 无向边的查找键：低顶点索引在高32位，高顶点索引在低32位。
+uint64_t edgeKey(int v1, int v2) {
+    uint32_t minV = static_cast<uint32_t>(std::min(v1, v2));
+    uint32_t maxV = static_cast<uint32_t>(std::max(v1, v2));
+    return (static_cast<uint64_t>(minV) << 32) | maxV;
+}
+
+#if defined(__AVX2__)
+// positions_ 是连续的xyz浮点流；每24个float（8个顶点）分量模式重复
+// 一次，因此用三个8宽累加器循环处理，最后按 通道索引 % 3 归并到
+// 对应分量。相比逐顶点的标量 glm::min/glm::max，每次迭代处理8个顶点。
+void minMaxPositions(const glm::vec3* positions, size_t count,
+                     glm::vec3& minOut, glm::vec3& maxOut) {
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+
+    const float* data = &positions[0].x;
+    size_t total = count * 3;
+
+    glm::vec3 minV = positions[0];
+    glm::vec3 maxV = positions[0];
+
+    size_t i = 0;
+    if (total >= 24) {
+        // 两组累加器交替使用（每次迭代48个float，两个完整xyz周期），
+        // min/max的延迟链拆成两条独立的，相邻迭代可以重叠执行。
+        __m256 minAcc[6];
+        __m256 maxAcc[6];
+        for (int k = 0; k < 6; ++k) {
+            minAcc[k] = _mm256_set1_ps(std::numeric_limits<float>::max());
+            maxAcc[k] = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+        }
+
+        for (; i + 48 <= total; i += 48) {
+            for (int k = 0; k < 6; ++k) {
+                __m256 values = _mm256_loadu_ps(data + i + k * 8);
+                minAcc[k] = _mm256_min_ps(minAcc[k], values);
+                maxAcc[k] = _mm256_max_ps(maxAcc[k], values);
+            }
+        }
+        for (; i + 24 <= total; i += 24) {
+            for (int k = 0; k < 3; ++k) {
+                __m256 values = _mm256_loadu_ps(data + i + k * 8);
+                minAcc[k] = _mm256_min_ps(minAcc[k], values);
+                maxAcc[k] = _mm256_max_ps(maxAcc[k], values);
+            }
+        }
+
+        // 48 = 16个xyz周期，lane % 3 仍然是正确的分量映射
+        float minLanes[48];
+        float maxLanes[48];
+        for (int k = 0; k < 6; ++k) {
+            _mm256_storeu_ps(minLanes + k * 8, minAcc[k]);
+            _mm256_storeu_ps(maxLanes + k * 8, maxAcc[k]);
+        }
+        for (int lane = 0; lane < 48; ++lane) {
+            int component = lane % 3;
+            minV[component] = glm::min(minV[component], minLanes[lane]);
+            maxV[component] = glm::max(maxV[component], maxLanes[lane]);
+        }
+    }
+
+    for (; i < total; ++i) {
+        int component = static_cast<int>(i % 3);
+        minV[component] = glm::min(minV[component], data[i]);
+        maxV[component] = glm::max(maxV[component], data[i]);
+    }
+
+    minOut = minV;
+    maxOut = maxV;
+}
+
+// 把逐分量的向量展开成三个按通道错位的寄存器：24个float（8个顶点）
+// 是xyz模式的一个完整周期，之后整个周期用三条指令处理。
+void broadcastComponents(const glm::vec3& v, __m256 out[3]) {
+    float pattern[24];
+    for (int i = 0; i < 24; ++i) {
+        pattern[i] = v[i % 3];
+    }
+    for (int k = 0; k < 3; ++k) {
+        out[k] = _mm256_loadu_ps(pattern + k * 8);
+    }
+}
+
+// 平移/缩放是纯带宽受限的流式内核，按minMaxPositions的布局方案
+// 每次迭代处理8个顶点。
+void addPositions(glm::vec3* positions, size_t count, const glm::vec3& offset) {
+    float* data = &positions[0].x;
+    size_t total = count * 3;
+
+    __m256 pattern[3];
+    broadcastComponents(offset, pattern);
+
+    size_t i = 0;
+    for (; i + 24 <= total; i += 24) {
+        for (int k = 0; k < 3; ++k) {
+            float* block = data + i + k * 8;
+            _mm256_storeu_ps(block, _mm256_add_ps(_mm256_loadu_ps(block), pattern[k]));
+        }
+    }
+    for (; i < total; ++i) {
+        data[i] += offset[static_cast<int>(i % 3)];
+    }
+}
+
+void mulPositions(glm::vec3* positions, size_t count, const glm::vec3& factor) {
+    float* data = &positions[0].x;
+    size_t total = count * 3;
+
+    __m256 pattern[3];
+    broadcastComponents(factor, pattern);
+
+    size_t i = 0;
+    for (; i + 24 <= total; i += 24) {
+        for (int k = 0; k < 3; ++k) {
+            float* block = data + i + k * 8;
+            _mm256_storeu_ps(block, _mm256_mul_ps(_mm256_loadu_ps(block), pattern[k]));
+        }
+    }
+    for (; i < total; ++i) {
+        data[i] *= factor[static_cast<int>(i % 3)];
+    }
+}
+
+// 有FMA指令时一条乘加，否则退化为mul+add
+inline __m128 madd(__m128 a, __m128 b, __m128 c) {
+#if defined(__FMA__)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+// 紧凑xyz流上的仿射变换：矩阵四列各载入一次，每个顶点三条乘加
+// 得到变换结果。整拍写回16字节会把结果w压到下一顶点的x上，因此
+// 下一顶点的x先暂存在寄存器里随写随补；最后一个顶点走标量写。
+void transformPositions(glm::vec3* positions, size_t count, const glm::mat4& matrix) {
+    if (count == 0) {
+        return;
+    }
+
+    const __m128 c0 = _mm_loadu_ps(&matrix[0][0]);
+    const __m128 c1 = _mm_loadu_ps(&matrix[1][0]);
+    const __m128 c2 = _mm_loadu_ps(&matrix[2][0]);
+    const __m128 c3 = _mm_loadu_ps(&matrix[3][0]);
+
+    float* data = &positions[0].x;
+    const size_t last = count - 1;
+    float nextX = data[0];
+    for (size_t i = 0; i < last; ++i) {
+        float* p = data + i * 3;
+        const float x = nextX;
+        const float y = p[1];
+        const float z = p[2];
+        nextX = p[3];
+        __m128 result = madd(_mm_set1_ps(x), c0,
+                        madd(_mm_set1_ps(y), c1,
+                        madd(_mm_set1_ps(z), c2, c3)));
+        _mm_storeu_ps(p, result);
+    }
+
+    glm::vec4 tail = matrix * glm::vec4(nextX, positions[last].y, positions[last].z, 1.0f);
+    positions[last] = glm::vec3(tail);
+}
+
+// 批量归一化交错 xyz 流。每块 8 个向量（24 个浮点），先按通道解交错
+// 凑出 8 个长度平方，用 rsqrt 加一次牛顿迭代得到倒数长度（约 23 位
+// 精度，法线切线足够），再扩展回交错布局相乘。相比逐向量 sqrt 加
+// 除法，8 个向量只付一次近似开方的代价。
+void normalizeVec3Stream(glm::vec3* vectors, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    float* data = &vectors[0].x;
+    size_t total = count * 3;
+
+    // 24 个浮点里第 k 个通道分布在三个寄存器的固定车道上，
+    // 用 permutevar8x32 加 blend 收集。
+    const __m256i gatherXA = _mm256_setr_epi32(0, 3, 6, 0, 0, 0, 0, 0);
+    const __m256i gatherXB = _mm256_setr_epi32(0, 0, 0, 1, 4, 7, 0, 0);
+    const __m256i gatherXC = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 2, 5);
+    const __m256i gatherYA = _mm256_setr_epi32(1, 4, 7, 0, 0, 0, 0, 0);
+    const __m256i gatherYB = _mm256_setr_epi32(0, 0, 0, 2, 5, 0, 0, 0);
+    const __m256i gatherYC = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 3, 6);
+    const __m256i gatherZA = _mm256_setr_epi32(2, 5, 0, 0, 0, 0, 0, 0);
+    const __m256i gatherZB = _mm256_setr_epi32(0, 0, 0, 3, 6, 0, 0, 0);
+    const __m256i gatherZC = _mm256_setr_epi32(0, 0, 0, 0, 0, 1, 4, 7);
+
+    // 倒数长度按每个向量占三个车道的布局扩展回去。
+    const __m256i spreadA = _mm256_setr_epi32(0, 0, 0, 1, 1, 1, 2, 2);
+    const __m256i spreadB = _mm256_setr_epi32(2, 3, 3, 3, 4, 4, 4, 5);
+    const __m256i spreadC = _mm256_setr_epi32(5, 5, 6, 6, 6, 7, 7, 7);
+
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+
+    size_t i = 0;
+    for (; i + 24 <= total; i += 24) {
+        __m256 a = _mm256_loadu_ps(data + i);
+        __m256 b = _mm256_loadu_ps(data + i + 8);
+        __m256 c = _mm256_loadu_ps(data + i + 16);
+
+        __m256 x = _mm256_blend_ps(
+            _mm256_blend_ps(_mm256_permutevar8x32_ps(a, gatherXA),
+                            _mm256_permutevar8x32_ps(b, gatherXB), 0x38),
+            _mm256_permutevar8x32_ps(c, gatherXC), 0xC0);
+        __m256 y = _mm256_blend_ps(
+            _mm256_blend_ps(_mm256_permutevar8x32_ps(a, gatherYA),
+                            _mm256_permutevar8x32_ps(b, gatherYB), 0x18),
+            _mm256_permutevar8x32_ps(c, gatherYC), 0xE0);
+        __m256 z = _mm256_blend_ps(
+            _mm256_blend_ps(_mm256_permutevar8x32_ps(a, gatherZA),
+                            _mm256_permutevar8x32_ps(b, gatherZB), 0x1C),
+            _mm256_permutevar8x32_ps(c, gatherZC), 0xE0);
+
+        __m256 lenSq = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+            _mm256_mul_ps(z, z));
+
+        // 一次牛顿迭代：inv *= 1.5 - 0.5 * lenSq * inv * inv
+        __m256 inv = _mm256_rsqrt_ps(lenSq);
+        inv = _mm256_mul_ps(inv,
+            _mm256_sub_ps(threeHalves,
+                _mm256_mul_ps(_mm256_mul_ps(half, lenSq),
+                              _mm256_mul_ps(inv, inv))));
+
+        _mm256_storeu_ps(data + i,
+            _mm256_mul_ps(a, _mm256_permutevar8x32_ps(inv, spreadA)));
+        _mm256_storeu_ps(data + i + 8,
+            _mm256_mul_ps(b, _mm256_permutevar8x32_ps(inv, spreadB)));
+        _mm256_storeu_ps(data + i + 16,
+            _mm256_mul_ps(c, _mm256_permutevar8x32_ps(inv, spreadC)));
+    }
+    for (; i + 3 <= total; i += 3) {
+        vectors[i / 3] = glm::normalize(vectors[i / 3]);
+    }
+}
+#endif
+
+}
+
 bool Vertex::operator==(const Vertex& other) const {
     return position == other.position &&
            normal == other.normal &&
@@ -16,11 +308,14 @@ bool Vertex::operator==(const Vertex& other) const {
 }
 
 size_t Vertex::hash() const {
-    size_t h = 0;
-    h ^= std::hash<float>()(position.x) + 0x9e3779b9 + (h << 6) + (h >> 2);
-    h ^= std::hash<float>()(position.y) + 0x9e3779b9 + (h << 6) + (h >> 2);
-    h ^= std::hash<float>()(position.z) + 0x9e3779b9 + (h << 6) + (h >> 2);
-    return h;
+    const float fields[] = {position.x, position.y, position.z,
+                            normal.x, normal.y, normal.z,
+                            texCoord.x, texCoord.y};
+    uint64_t h = 0;
+    for (float field : fields) {
+        h = mix64(h ^ floatBits(field));
+    }
+    return static_cast<size_t>(h);
 }
 
 bool Edge::operator==(const Edge& other) const {
@@ -36,23 +331,23 @@ size_t Edge::hash() const {
     return h;
 }
 
-void Face::calculateNormal(const std::vector<Vertex>& vertexData) {
+void Face::calculateNormal(const std::vector<glm::vec3>& positions) {
     if (vertices.size() < 3) {
         normal = glm::vec3(0.0f);
         return;
     }
 
-    const Vertex& v0 = vertexData[vertices[0]];
-    const Vertex& v1 = vertexData[vertices[1]];
-    const Vertex& v2 = vertexData[vertices[2]];
+    const glm::vec3& p0 = positions[vertices[0]];
+    const glm::vec3& p1 = positions[vertices[1]];
+    const glm::vec3& p2 = positions[vertices[2]];
 
-    glm::vec3 edge1 = v1.position - v0.position;
-    glm::vec3 edge2 = v2.position - v0.position;
+    glm::vec3 edge1 = p1 - p0;
+    glm::vec3 edge2 = p2 - p0;
 
     normal = glm::normalize(glm::cross(edge1, edge2));
 }
 
-void Face::calculateCentroid(const std::vector<Vertex>& vertexData) {
+void Face::calculateCentroid(const std::vector<glm::vec3>& positions) {
     if (vertices.empty()) {
         centroid = glm::vec3(0.0f);
         return;
@@ -60,27 +355,51 @@ void Face::calculateCentroid(const std::vector<Vertex>& vertexData) {
 
     glm::vec3 sum(0.0f);
     for (int vi : vertices) {
-        sum += vertexData[vi].position;
+        sum += positions[vi];
     }
     centroid = sum / static_cast<float>(vertices.size());
 }
 
-void Face::calculateArea(const std::vector<Vertex>& vertexData) {
+void Face::calculateArea(const std::vector<glm::vec3>& positions) {
     if (vertices.size() < 3) {
         area = 0.0f;
         return;
     }
 
-    const Vertex& v0 = vertexData[vertices[0]];
-    const Vertex& v1 = vertexData[vertices[1]];
-    const Vertex& v2 = vertexData[vertices[2]];
+    const glm::vec3& p0 = positions[vertices[0]];
+    const glm::vec3& p1 = positions[vertices[1]];
+    const glm::vec3& p2 = positions[vertices[2]];
 
-    glm::vec3 edge1 = v1.position - v0.position;
-    glm::vec3 edge2 = v2.position - v0.position;
+    glm::vec3 edge1 = p1 - p0;
+    glm::vec3 edge2 = p2 - p0;
 
     area = glm::length(glm::cross(edge1, edge2)) * 0.5f;
 }
 
+void Face::calculateGeometry(const std::vector<glm::vec3>& positions) {
+    calculateCentroid(positions);
+
+    if (vertices.size() < 3) {
+        normal = glm::vec3(0.0f);
+        area = 0.0f;
+        return;
+    }
+
+    const glm::vec3& p0 = positions[vertices[0]];
+    const glm::vec3& p1 = positions[vertices[1]];
+    const glm::vec3& p2 = positions[vertices[2]];
+
+    // 叉积的长度同时给出面积和归一化分母，只算一次叉积一次开方。
+    glm::vec3 cross = glm::cross(p1 - p0, p2 - p0);
+    float length = glm::length(cross);
+    if (length > 0.0f) {
+        normal = cross / length;
+    } else {
+        normal = glm::vec3(0.0f);
+    }
+    area = length * 0.5f;
+}
+
 bool Face::containsVertex(int vertexIndex) const {
     return std::find(vertices.begin(), vertices.end(), vertexIndex) != vertices.end();
 }
@@ -90,9 +409,14 @@ bool Face::containsEdge(int edgeIndex) const {
 }
 
 Mesh::Mesh()
-    : materialId_(-1)
+    : bonePool_(std::make_unique<std::pmr::unsynchronized_pool_resource>())
+    , vertexBones_(bonePool_.get())
+    , materialId_(-1)
     , smoothShading_(true)
-    , needsUpdate_(true) {
+    , boundsDirty_(true)
+    , normalsDirty_(true)
+    , tangentsDirty_(true)
+    , allTriangles_(true) {
     minBounds_ = glm::vec3(std::numeric_limits<float>::max());
     maxBounds_ = glm::vec3(std::numeric_limits<float>::lowest());
 }
@@ -100,68 +424,415 @@ Mesh::Mesh()
 Mesh::~Mesh() {
 }
 
+Mesh::Mesh(const Mesh& other)
+    : name_(other.name_)
+    , positions_(other.positions_)
+    , normals_(other.normals_)
+    , texCoords_(other.texCoords_)
+    , tangents_(other.tangents_)
+    , bitangents_(other.bitangents_)
+    , colors_(other.colors_)
+    , bonePool_(std::make_unique<std::pmr::unsynchronized_pool_resource>())
+    , vertexBones_(bonePool_.get())
+    , faces_(other.faces_)
+    , edges_(other.edges_)
+    , vertexToEdges_(other.vertexToEdges_)
+    , vertexToFaces_(other.vertexToFaces_)
+    , edgeIndex_(other.edgeIndex_)
+    , minBounds_(other.minBounds_)
+    , maxBounds_(other.maxBounds_)
+    , center_(other.center_)
+    , size_(other.size_)
+    , materialId_(other.materialId_)
+    , smoothShading_(other.smoothShading_)
+    , boundsDirty_(other.boundsDirty_)
+    , normalsDirty_(other.normalsDirty_)
+    , tangentsDirty_(other.tangentsDirty_)
+    , allTriangles_(other.allTriangles_) {
+    for (const auto& pair : other.vertexBones_) {
+        vertexBones_.emplace(pair.first, pair.second);
+    }
+}
+
+Mesh& Mesh::operator=(const Mesh& other) {
+    if (this != &other) {
+        name_ = other.name_;
+        positions_ = other.positions_;
+        normals_ = other.normals_;
+        texCoords_ = other.texCoords_;
+        tangents_ = other.tangents_;
+        bitangents_ = other.bitangents_;
+        colors_ = other.colors_;
+        vertexBones_.clear();
+        for (const auto& pair : other.vertexBones_) {
+            vertexBones_.emplace(pair.first, pair.second);
+        }
+        faces_ = other.faces_;
+        edges_ = other.edges_;
+        vertexToEdges_ = other.vertexToEdges_;
+        vertexToFaces_ = other.vertexToFaces_;
+        edgeIndex_ = other.edgeIndex_;
+        minBounds_ = other.minBounds_;
+        maxBounds_ = other.maxBounds_;
+        center_ = other.center_;
+        size_ = other.size_;
+        materialId_ = other.materialId_;
+        smoothShading_ = other.smoothShading_;
+        boundsDirty_ = other.boundsDirty_;
+        normalsDirty_ = other.normalsDirty_;
+        tangentsDirty_ = other.tangentsDirty_;
+        allTriangles_ = other.allTriangles_;
+    }
+    return *this;
+}
+
+Mesh& Mesh::operator=(Mesh&& other) {
+    if (this != &other) {
+        name_ = std::move(other.name_);
+        positions_ = std::move(other.positions_);
+        normals_ = std::move(other.normals_);
+        texCoords_ = std::move(other.texCoords_);
+        tangents_ = std::move(other.tangents_);
+        bitangents_ = std::move(other.bitangents_);
+        colors_ = std::move(other.colors_);
+        // 保留自有内存池：pmr map在分配器不同时逐元素搬移，
+        // 蒙皮数据落入本网格的池而不是悬挂在对方的池上。
+        vertexBones_ = std::move(other.vertexBones_);
+        faces_ = std::move(other.faces_);
+        edges_ = std::move(other.edges_);
+        vertexToEdges_ = std::move(other.vertexToEdges_);
+        vertexToFaces_ = std::move(other.vertexToFaces_);
+        edgeIndex_ = std::move(other.edgeIndex_);
+        minBounds_ = other.minBounds_;
+        maxBounds_ = other.maxBounds_;
+        center_ = other.center_;
+        size_ = other.size_;
+        materialId_ = other.materialId_;
+        smoothShading_ = other.smoothShading_;
+        boundsDirty_ = other.boundsDirty_;
+        normalsDirty_ = other.normalsDirty_;
+        tangentsDirty_ = other.tangentsDirty_;
+        allTriangles_ = other.allTriangles_;
+    }
+    return *this;
+}
+
 void Mesh::clear() {
-    vertices_.clear();
+    positions_.clear();
+    normals_.clear();
+    texCoords_.clear();
+    tangents_.clear();
+    bitangents_.clear();
+    colors_.clear();
+    vertexBones_.clear();
     faces_.clear();
     edges_.clear();
+    edgeIndex_.clear();
     vertexToEdges_.clear();
     vertexToFaces_.clear();
-    needsUpdate_ = true;
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+    allTriangles_ = true;
 }
 
 int Mesh::addVertex(const Vertex& vertex) {
-    vertices_.push_back(vertex);
-    needsUpdate_ = true;
-    return static_cast<int>(vertices_.size()) - 1;
+    int index = static_cast<int>(positions_.size());
+    positions_.push_back(vertex.position);
+    normals_.push_back(vertex.normal);
+    texCoords_.push_back(vertex.texCoord);
+    tangents_.push_back(vertex.tangent);
+    bitangents_.push_back(vertex.bitangent);
+    colors_.push_back(vertex.color);
+    if (!vertex.boneIndices.empty()) {
+        BoneData& bones = vertexBones_[index];
+        bones.indices.assign(vertex.boneIndices.begin(), vertex.boneIndices.end());
+        bones.weights.assign(vertex.boneWeights.begin(), vertex.boneWeights.end());
+    }
+    vertexToEdges_.emplace_back();
+    vertexToFaces_.emplace_back();
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+    return index;
 }
 
 int Mesh::addVertex(const glm::vec3& position) {
     return addVertex(Vertex(position));
 }
 
-Vertex& Mesh::getVertex(int index) {
-    return vertices_[index];
+int Mesh::addVertices(std::span<const glm::vec3> positions) {
+    int firstIndex = static_cast<int>(positions_.size());
+    positions_.insert(positions_.end(), positions.begin(), positions.end());
+
+    size_t total = positions_.size();
+    normals_.resize(total, glm::vec3(0.0f, 0.0f, 1.0f));
+    texCoords_.resize(total);
+    tangents_.resize(total, glm::vec3(0.0f));
+    bitangents_.resize(total, glm::vec3(0.0f));
+    colors_.resize(total, glm::vec4(1.0f));
+    vertexToEdges_.resize(total);
+    vertexToFaces_.resize(total);
+
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+    return firstIndex;
+}
+
+int Mesh::addVertex(const glm::vec3& position, const glm::vec3& normal,
+                    const glm::vec2& texCoord) {
+    int index = static_cast<int>(positions_.size());
+    positions_.push_back(position);
+    normals_.push_back(normal);
+    texCoords_.push_back(texCoord);
+    tangents_.emplace_back(0.0f);
+    bitangents_.emplace_back(0.0f);
+    colors_.emplace_back(1.0f);
+    vertexToEdges_.emplace_back();
+    vertexToFaces_.emplace_back();
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+    return index;
+}
+
+Vertex Mesh::getVertex(int index) const {
+    Vertex vertex;
+    vertex.position = positions_[index];
+    vertex.normal = normals_[index];
+    vertex.texCoord = texCoords_[index];
+    vertex.tangent = tangents_[index];
+    vertex.bitangent = bitangents_[index];
+    vertex.color = colors_[index];
+
+    auto it = vertexBones_.find(index);
+    if (it != vertexBones_.end()) {
+        vertex.boneIndices.assign(it->second.indices.begin(), it->second.indices.end());
+        vertex.boneWeights.assign(it->second.weights.begin(), it->second.weights.end());
+    }
+    return vertex;
 }
 
-const Vertex& Mesh::getVertex(int index) const {
-    return vertices_[index];
+void Mesh::setVertex(int index, const Vertex& vertex) {
+    positions_[index] = vertex.position;
+    normals_[index] = vertex.normal;
+    texCoords_[index] = vertex.texCoord;
+    tangents_[index] = vertex.tangent;
+    bitangents_[index] = vertex.bitangent;
+    colors_[index] = vertex.color;
+    if (!vertex.boneIndices.empty()) {
+        BoneData& bones = vertexBones_[index];
+        bones.indices.assign(vertex.boneIndices.begin(), vertex.boneIndices.end());
+        bones.weights.assign(vertex.boneWeights.begin(), vertex.boneWeights.end());
+    } else {
+        vertexBones_.erase(index);
+    }
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
 }
 
-void Mesh::setVertex(int index, const Vertex& vertex) {
-    vertices_[index] = vertex;
-    needsUpdate_ = true;
+glm::vec3 Mesh::getPosition(int index) const {
+    return positions_[index];
+}
+
+void Mesh::setPosition(int index, const glm::vec3& position) {
+    positions_[index] = position;
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+glm::vec3 Mesh::getNormal(int index) const {
+    return normals_[index];
+}
+
+void Mesh::setNormal(int index, const glm::vec3& normal) {
+    normals_[index] = normal;
+}
+
+glm::vec2 Mesh::getTexCoord(int index) const {
+    return texCoords_[index];
+}
+
+void Mesh::setTexCoord(int index, const glm::vec2& texCoord) {
+    texCoords_[index] = texCoord;
+}
+
+void Mesh::setTexCoords(std::span<const glm::vec2> texCoords) {
+    size_t count = std::min(texCoords.size(), texCoords_.size());
+    std::copy_n(texCoords.begin(), count, texCoords_.begin());
 }
 
 void Mesh::removeVertex(int index) {
-    if (index < 0 || index >= static_cast<int>(vertices_.size())) {
+    if (index < 0 || index >= static_cast<int>(positions_.size())) {
         return;
     }
 
-    vertices_.erase(vertices_.begin() + index);
+    // 从引用该顶点的面中移除它
+    for (int fi : vertexToFaces_[index]) {
+        auto& faceVerts = faces_[fi].vertices;
+        faceVerts.erase(std::remove(faceVerts.begin(), faceVerts.end(), index),
+                        faceVerts.end());
+    }
 
-    for (auto& face : faces_) {
-        auto it = std::find(face.vertices.begin(), face.vertices.end(), index);
-        if (it != face.vertices.end()) {
-            face.vertices.erase(it);
+    vertexToEdges_[index].clear();
+    vertexToFaces_[index].clear();
+    vertexBones_.erase(index);
+
+    // 交换删除：把最后一个顶点搬到空出的槽位，只需修补对原末尾
+    // 索引的引用，而不是移动并重编号其后的所有顶点。
+    int last = static_cast<int>(positions_.size()) - 1;
+    if (index != last) {
+        positions_[index] = positions_[last];
+        normals_[index] = normals_[last];
+        texCoords_[index] = texCoords_[last];
+        tangents_[index] = tangents_[last];
+        bitangents_[index] = bitangents_[last];
+        colors_[index] = colors_[last];
+
+        auto boneIt = vertexBones_.find(last);
+        if (boneIt != vertexBones_.end()) {
+            vertexBones_[index] = std::move(boneIt->second);
+            vertexBones_.erase(last);
         }
-        for (int& vi : face.vertices) {
-            if (vi > index) {
-                vi--;
-            }
+
+        for (int fi : vertexToFaces_[last]) {
+            std::replace(faces_[fi].vertices.begin(), faces_[fi].vertices.end(),
+                         last, index);
+        }
+        vertexToFaces_[index] = std::move(vertexToFaces_[last]);
+
+        for (int ei : vertexToEdges_[last]) {
+            Edge& edge = edges_[ei];
+            edgeIndex_.erase(edgeKey(edge.vertex1, edge.vertex2));
+            if (edge.vertex1 == last) edge.vertex1 = index;
+            if (edge.vertex2 == last) edge.vertex2 = index;
+            edgeIndex_[edgeKey(edge.vertex1, edge.vertex2)] = ei;
+        }
+        vertexToEdges_[index] = std::move(vertexToEdges_[last]);
+    }
+
+    positions_.pop_back();
+    normals_.pop_back();
+    texCoords_.pop_back();
+    tangents_.pop_back();
+    bitangents_.pop_back();
+    colors_.pop_back();
+    vertexToEdges_.pop_back();
+    vertexToFaces_.pop_back();
+
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+void Mesh::removeVertices(std::span<const int> indices) {
+    const int vertexCount = static_cast<int>(positions_.size());
+
+    std::vector<uint8_t> dead(vertexCount, 0);
+    int deadCount = 0;
+    for (int vi : indices) {
+        if (vi >= 0 && vi < vertexCount && !dead[vi]) {
+            dead[vi] = 1;
+            ++deadCount;
+        }
+    }
+    if (deadCount == 0) {
+        return;
+    }
+
+    // 触到死顶点的边整批先删，复用 removeEdges 的压实
+    std::vector<int> edgesToRemove;
+    for (int ei = 0; ei < static_cast<int>(edges_.size()); ++ei) {
+        if (dead[edges_[ei].vertex1] || dead[edges_[ei].vertex2]) {
+            edgesToRemove.push_back(ei);
+        }
+    }
+    removeEdges(std::span<const int>(edgesToRemove));
+
+    // 面里对死顶点的引用摘掉，骨骼数据一并清除
+    for (int vi = 0; vi < vertexCount; ++vi) {
+        if (!dead[vi]) {
+            continue;
+        }
+        for (int fi : vertexToFaces_[vi]) {
+            auto& faceVerts = faces_[fi].vertices;
+            faceVerts.erase(std::remove(faceVerts.begin(), faceVerts.end(), vi),
+                            faceVerts.end());
         }
+        vertexBones_.erase(vi);
     }
 
-    vertexToEdges_.erase(index);
-    vertexToFaces_.erase(index);
+    // 保序压实：存活顶点前移并记下旧索引到新索引的重映射表
+    std::vector<int> vertexRemap(vertexCount, -1);
+    int newCount = 0;
+    for (int vi = 0; vi < vertexCount; ++vi) {
+        if (dead[vi]) {
+            continue;
+        }
+        vertexRemap[vi] = newCount;
+        if (newCount != vi) {
+            positions_[newCount] = positions_[vi];
+            normals_[newCount] = normals_[vi];
+            texCoords_[newCount] = texCoords_[vi];
+            tangents_[newCount] = tangents_[vi];
+            bitangents_[newCount] = bitangents_[vi];
+            colors_[newCount] = colors_[vi];
+            vertexToEdges_[newCount] = std::move(vertexToEdges_[vi]);
+            vertexToFaces_[newCount] = std::move(vertexToFaces_[vi]);
+        }
+        ++newCount;
+    }
+    positions_.resize(newCount);
+    normals_.resize(newCount);
+    texCoords_.resize(newCount);
+    tangents_.resize(newCount);
+    bitangents_.resize(newCount);
+    colors_.resize(newCount);
+    vertexToEdges_.resize(newCount);
+    vertexToFaces_.resize(newCount);
+
+    for (auto& face : faces_) {
+        for (int& fv : face.vertices) {
+            fv = vertexRemap[fv];
+        }
+    }
+
+    // 边端点重编号会改键，哈希表整个重建
+    edgeIndex_.clear();
+    for (int ei = 0; ei < static_cast<int>(edges_.size()); ++ei) {
+        Edge& edge = edges_[ei];
+        edge.vertex1 = vertexRemap[edge.vertex1];
+        edge.vertex2 = vertexRemap[edge.vertex2];
+        edgeIndex_[edgeKey(edge.vertex1, edge.vertex2)] = ei;
+    }
+
+    if (!vertexBones_.empty()) {
+        std::pmr::unordered_map<int, BoneData> remappedBones(vertexBones_.get_allocator());
+        for (auto& pair : vertexBones_) {
+            remappedBones[vertexRemap[pair.first]] = std::move(pair.second);
+        }
+        vertexBones_ = std::move(remappedBones);
+    }
 
-    needsUpdate_ = true;
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
 }
 
 int Mesh::addFace(const std::vector<int>& vertexIndices) {
+    return addFace(std::span<const int>(vertexIndices));
+}
+
+int Mesh::addFace(std::span<const int> vertexIndices) {
+    if (vertexIndices.size() != 3) {
+        allTriangles_ = false;
+    }
+
     Face face(vertexIndices);
-    face.calculateNormal(vertices_);
-    face.calculateCentroid(vertices_);
-    face.calculateArea(vertices_);
+    face.calculateGeometry(positions_);
 
     int faceIndex = static_cast<int>(faces_.size());
     faces_.push_back(face);
@@ -183,16 +854,33 @@ int Mesh::addFace(const std::vector<int>& vertexIndices) {
         vertexToFaces_[v1].push_back(faceIndex);
     }
 
-    needsUpdate_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
     return faceIndex;
 }
 
+int Mesh::addFaces(std::span<const int> indices, int stride) {
+    if (stride <= 0 || indices.empty()) {
+        return -1;
+    }
+    int firstFace = static_cast<int>(faces_.size());
+    size_t faceCount = indices.size() / static_cast<size_t>(stride);
+    faces_.reserve(faces_.size() + faceCount);
+    for (size_t i = 0; i < faceCount; ++i) {
+        addFace(indices.subspan(i * static_cast<size_t>(stride),
+                                static_cast<size_t>(stride)));
+    }
+    return firstFace;
+}
+
 int Mesh::addTriangle(int v0, int v1, int v2) {
-    return addFace({v0, v1, v2});
+    const int indices[] = {v0, v1, v2};
+    return addFace(std::span<const int>(indices));
 }
 
 int Mesh::addQuad(int v0, int v1, int v2, int v3) {
-    return addFace({v0, v1, v2, v3});
+    const int indices[] = {v0, v1, v2, v3};
+    return addFace(std::span<const int>(indices));
 }
 
 Face& Mesh::getFace(int index) {
@@ -225,23 +913,90 @@ void Mesh::removeFace(int index) {
         faces.erase(std::remove(faces.begin(), faces.end(), index), faces.end());
     }
 
-    faces_.erase(faces_.begin() + index);
-    needsUpdate_ = true;
+    // 交换删除：末尾的面搬进空槽，修补指向原末尾索引的引用
+    int last = static_cast<int>(faces_.size()) - 1;
+    if (index != last) {
+        faces_[index] = std::move(faces_[last]);
+
+        for (int edgeIndex : faces_[index].edges) {
+            Edge& edge = edges_[edgeIndex];
+            if (edge.face1 == last) edge.face1 = index;
+            if (edge.face2 == last) edge.face2 = index;
+        }
+
+        for (int vertexIndex : faces_[index].vertices) {
+            auto& faces = vertexToFaces_[vertexIndex];
+            std::replace(faces.begin(), faces.end(), last, index);
+        }
+    }
+
+    faces_.pop_back();
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
 }
 
-int Mesh::addEdge(int v1, int v2) {
-    Edge newEdge(v1, v2);
+void Mesh::removeFaces(std::span<const int> indices) {
+    const int faceCount = static_cast<int>(faces_.size());
+
+    std::vector<uint8_t> dead(faceCount, 0);
+    int deadCount = 0;
+    for (int fi : indices) {
+        if (fi >= 0 && fi < faceCount && !dead[fi]) {
+            dead[fi] = 1;
+            ++deadCount;
+        }
+    }
+    if (deadCount == 0) {
+        return;
+    }
+
+    // 保序压实：存活的面前移，得到旧索引到新索引的重映射表，
+    // 邻接表和边的面引用各修补一遍即可。
+    std::vector<int> faceRemap(faceCount, -1);
+    int newCount = 0;
+    for (int fi = 0; fi < faceCount; ++fi) {
+        if (dead[fi]) {
+            continue;
+        }
+        faceRemap[fi] = newCount;
+        if (newCount != fi) {
+            faces_[newCount] = std::move(faces_[fi]);
+        }
+        ++newCount;
+    }
+    faces_.resize(newCount);
+
+    for (auto& edge : edges_) {
+        if (edge.face1 != -1) edge.face1 = faceRemap[edge.face1];
+        if (edge.face2 != -1) edge.face2 = faceRemap[edge.face2];
+        if (edge.face1 == -1 && edge.face2 != -1) {
+            std::swap(edge.face1, edge.face2);
+        }
+    }
 
-    for (size_t i = 0; i < edges_.size(); ++i) {
-        if (edges_[i] == newEdge) {
-            vertexToEdges_[v1].push_back(static_cast<int>(i));
-            vertexToEdges_[v2].push_back(static_cast<int>(i));
-            return static_cast<int>(i);
+    for (auto& faceList : vertexToFaces_) {
+        size_t write = 0;
+        for (int fi : faceList) {
+            int newIndex = faceRemap[fi];
+            if (newIndex != -1) {
+                faceList[write++] = newIndex;
+            }
         }
+        faceList.resize(write);
+    }
+
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+int Mesh::addEdge(int v1, int v2) {
+    auto [it, inserted] = edgeIndex_.emplace(edgeKey(v1, v2),
+                                             static_cast<int>(edges_.size()));
+    int edgeIndex = it->second;
+    if (inserted) {
+        edges_.push_back(Edge(v1, v2));
     }
 
-    int edgeIndex = static_cast<int>(edges_.size());
-    edges_.push_back(newEdge);
     vertexToEdges_[v1].push_back(edgeIndex);
     vertexToEdges_[v2].push_back(edgeIndex);
 
@@ -268,12 +1023,102 @@ void Mesh::removeEdge(int index) {
         edges.erase(std::remove(edges.begin(), edges.end(), index), edges.end());
     }
 
-    edges_.erase(edges_.begin() + index);
-    needsUpdate_ = true;
+    edgeIndex_.erase(edgeKey(edge.vertex1, edge.vertex2));
+
+    // 交换删除：末尾的边搬进空槽，修补指向原末尾索引的引用
+    int last = static_cast<int>(edges_.size()) - 1;
+    if (index != last) {
+        edges_[index] = edges_[last];
+
+        const Edge& moved = edges_[index];
+        for (int vi : {moved.vertex1, moved.vertex2}) {
+            auto& edges = vertexToEdges_[vi];
+            std::replace(edges.begin(), edges.end(), last, index);
+        }
+        edgeIndex_[edgeKey(moved.vertex1, moved.vertex2)] = index;
+
+        for (int fi : {moved.face1, moved.face2}) {
+            if (fi != -1) {
+                auto& faceEdges = faces_[fi].edges;
+                std::replace(faceEdges.begin(), faceEdges.end(), last, index);
+            }
+        }
+    }
+
+    edges_.pop_back();
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+void Mesh::removeEdges(std::span<const int> indices) {
+    const int edgeCount = static_cast<int>(edges_.size());
+
+    std::vector<uint8_t> dead(edgeCount, 0);
+    int deadCount = 0;
+    for (int ei : indices) {
+        if (ei >= 0 && ei < edgeCount && !dead[ei]) {
+            dead[ei] = 1;
+            ++deadCount;
+        }
+    }
+    if (deadCount == 0) {
+        return;
+    }
+
+    // 先按旧端点删掉哈希表里的死边键，再压实重映射
+    for (int ei = 0; ei < edgeCount; ++ei) {
+        if (dead[ei]) {
+            edgeIndex_.erase(edgeKey(edges_[ei].vertex1, edges_[ei].vertex2));
+        }
+    }
+
+    std::vector<int> edgeRemap(edgeCount, -1);
+    int newCount = 0;
+    for (int ei = 0; ei < edgeCount; ++ei) {
+        if (dead[ei]) {
+            continue;
+        }
+        edgeRemap[ei] = newCount;
+        if (newCount != ei) {
+            edges_[newCount] = edges_[ei];
+        }
+        ++newCount;
+    }
+    edges_.resize(newCount);
+
+    for (auto& pair : edgeIndex_) {
+        pair.second = edgeRemap[pair.second];
+    }
+
+    for (auto& edgeList : vertexToEdges_) {
+        size_t write = 0;
+        for (int ei : edgeList) {
+            int newIndex = edgeRemap[ei];
+            if (newIndex != -1) {
+                edgeList[write++] = newIndex;
+            }
+        }
+        edgeList.resize(write);
+    }
+
+    for (auto& face : faces_) {
+        auto& faceEdges = face.edges;
+        int* write = faceEdges.begin();
+        for (int ei : faceEdges) {
+            int newIndex = (ei >= 0 && ei < edgeCount) ? edgeRemap[ei] : -1;
+            if (newIndex != -1) {
+                *write++ = newIndex;
+            }
+        }
+        faceEdges.erase(write, faceEdges.end());
+    }
+
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
 }
 
 int Mesh::getVertexCount() const {
-    return static_cast<int>(vertices_.size());
+    return static_cast<int>(positions_.size());
 }
 
 int Mesh::getFaceCount() const {
@@ -284,8 +1129,46 @@ int Mesh::getEdgeCount() const {
     return static_cast<int>(edges_.size());
 }
 
-const std::vector<Vertex>& Mesh::getVertices() const {
-    return vertices_;
+glm::vec3* Mesh::positionsData() {
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+    return positions_.data();
+}
+
+glm::vec3* Mesh::normalsData() {
+    return normals_.data();
+}
+
+void Mesh::swapPositions(std::vector<glm::vec3>& other) {
+    positions_.swap(other);
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+const std::vector<glm::vec3>& Mesh::getPositions() const {
+    return positions_;
+}
+
+const std::vector<glm::vec3>& Mesh::getNormals() const {
+    return normals_;
+}
+
+const std::vector<glm::vec2>& Mesh::getTexCoords() const {
+    return texCoords_;
+}
+
+const std::vector<glm::vec3>& Mesh::getTangents() const {
+    return tangents_;
+}
+
+const std::vector<glm::vec3>& Mesh::getBitangents() const {
+    return bitangents_;
+}
+
+const std::vector<glm::vec4>& Mesh::getColors() const {
+    return colors_;
 }
 
 const std::vector<Face>& Mesh::getFaces() const {
@@ -297,69 +1180,138 @@ const std::vector<Edge>& Mesh::getEdges() const {
 }
 
 void Mesh::calculateNormals() {
-    for (auto& vertex : vertices_) {
-        vertex.normal = glm::vec3(0.0f);
+    // 法线仍然有效（例如平移后）就不重算整遍累加
+    if (!normalsDirty_) {
+        return;
     }
 
-    for (const auto& face : faces_) {
-        glm::vec3 faceNormal = face.normal;
-        float faceArea = face.area;
+    const int faceCount = static_cast<int>(faces_.size());
+
+    // 相邻面共享顶点，直接并行累加会产生写冲突；每个线程先累加到
+    // 私有缓冲。合并不再走critical串行：按顶点区间并行归约，
+    // 每个顶点由唯一线程把各私有缓冲的分量加进normals_，无冲突。
+    const int vertexCount = static_cast<int>(normals_.size());
+    std::vector<std::vector<glm::vec3>> threadNormals;
+
+#pragma omp parallel
+    {
+#if defined(_OPENMP)
+        const int threadId = omp_get_thread_num();
+#pragma omp single
+        {
+            threadNormals.resize(static_cast<size_t>(omp_get_num_threads()));
+        }
+#else
+        const int threadId = 0;
+        threadNormals.resize(1);
+#endif
+        std::vector<glm::vec3>& localNormals = threadNormals[threadId];
+        localNormals.assign(normals_.size(), glm::vec3(0.0f));
+
+#pragma omp for schedule(dynamic, 1024)
+        for (int i = 0; i < faceCount; ++i) {
+            const Face& face = faces_[i];
+            glm::vec3 weightedNormal = face.normal * face.area;
+
+            for (int vertexIndex : face.vertices) {
+                localNormals[vertexIndex] += weightedNormal;
+            }
+        }
 
-        for (int vertexIndex : face.vertices) {
-            vertices_[vertexIndex].normal += faceNormal * faceArea;
+#pragma omp for schedule(static)
+        for (int v = 0; v < vertexCount; ++v) {
+            glm::vec3 sum(0.0f);
+            for (const auto& local : threadNormals) {
+                sum += local[v];
+            }
+            normals_[v] = sum;
         }
     }
 
-    for (auto& vertex : vertices_) {
-        vertex.normal = glm::normalize(vertex.normal);
+#if defined(__AVX2__)
+    normalizeVec3Stream(normals_.data(), normals_.size());
+#else
+    for (auto& normal : normals_) {
+        normal = glm::normalize(normal);
     }
+#endif
+
+    normalsDirty_ = false;
 }
 
 void Mesh::calculateTangents() {
-    for (auto& vertex : vertices_) {
-        vertex.tangent = glm::vec3(0.0f);
-        vertex.bitangent = glm::vec3(0.0f);
-    }
+    std::fill(tangents_.begin(), tangents_.end(), glm::vec3(0.0f));
+    std::fill(bitangents_.begin(), bitangents_.end(), glm::vec3(0.0f));
 
-    for (const auto& face : faces_) {
-        if (face.vertices.size() < 3) continue;
+    const int faceCount = static_cast<int>(faces_.size());
 
-        const Vertex& v0 = vertices_[face.vertices[0]];
-        const Vertex& v1 = vertices_[face.vertices[1]];
-        const Vertex& v2 = vertices_[face.vertices[2]];
+    // 与 calculateNormals 相同的归约方案：线程私有缓冲加串行合并。
+#pragma omp parallel
+    {
+        std::vector<glm::vec3> localTangents(tangents_.size(), glm::vec3(0.0f));
+        std::vector<glm::vec3> localBitangents(bitangents_.size(), glm::vec3(0.0f));
 
-        glm::vec3 edge1 = v1.position - v0.position;
-        glm::vec3 edge2 = v2.position - v0.position;
+#pragma omp for schedule(dynamic, 1024)
+        for (int i = 0; i < faceCount; ++i) {
+            const Face& face = faces_[i];
+            if (face.vertices.size() < 3) continue;
 
-        glm::vec2 deltaUV1 = v1.texCoord - v0.texCoord;
-        glm::vec2 deltaUV2 = v2.texCoord - v0.texCoord;
+            const glm::vec3& p0 = positions_[face.vertices[0]];
+            const glm::vec3& p1 = positions_[face.vertices[1]];
+            const glm::vec3& p2 = positions_[face.vertices[2]];
 
-        float f = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
+            glm::vec3 edge1 = p1 - p0;
+            glm::vec3 edge2 = p2 - p0;
 
-        glm::vec3 tangent;
-        tangent.x = f * (deltaUV2.y * edge1.x - deltaUV1.y * edge2.x);
-        tangent.y = f * (deltaUV2.y * edge1.y - deltaUV1.y * edge2.y);
-        tangent.z = f * (deltaUV2.y * edge1.z - deltaUV1.y * edge2.z);
+            glm::vec2 deltaUV1 = texCoords_[face.vertices[1]] - texCoords_[face.vertices[0]];
+            glm::vec2 deltaUV2 = texCoords_[face.vertices[2]] - texCoords_[face.vertices[0]];
 
-        glm::vec3 bitangent;
-        bitangent.x = f * (-deltaUV2.x * edge1.x + deltaUV1.x * edge2.x);
-        bitangent.y = f * (-deltaUV2.x * edge1.y + deltaUV1.x * edge2.y);
-        bitangent.z = f * (-deltaUV2.x * edge1.z + deltaUV1.x * edge2.z);
+            float f = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
 
-        for (int vertexIndex : face.vertices) {
-            vertices_[vertexIndex].tangent += tangent;
-            vertices_[vertexIndex].bitangent += bitangent;
+            glm::vec3 tangent;
+            tangent.x = f * (deltaUV2.y * edge1.x - deltaUV1.y * edge2.x);
+            tangent.y = f * (deltaUV2.y * edge1.y - deltaUV1.y * edge2.y);
+            tangent.z = f * (deltaUV2.y * edge1.z - deltaUV1.y * edge2.z);
+
+            glm::vec3 bitangent;
+            bitangent.x = f * (-deltaUV2.x * edge1.x + deltaUV1.x * edge2.x);
+            bitangent.y = f * (-deltaUV2.x * edge1.y + deltaUV1.x * edge2.y);
+            bitangent.z = f * (-deltaUV2.x * edge1.z + deltaUV1.x * edge2.z);
+
+            for (int vertexIndex : face.vertices) {
+                localTangents[vertexIndex] += tangent;
+                localBitangents[vertexIndex] += bitangent;
+            }
+        }
+
+#pragma omp critical
+        {
+            for (size_t v = 0; v < tangents_.size(); ++v) {
+                tangents_[v] += localTangents[v];
+                bitangents_[v] += localBitangents[v];
+            }
         }
     }
 
-    for (auto& vertex : vertices_) {
-        vertex.tangent = glm::normalize(vertex.tangent);
-        vertex.bitangent = glm::normalize(vertex.bitangent);
+#if defined(__AVX2__)
+    normalizeVec3Stream(tangents_.data(), tangents_.size());
+    normalizeVec3Stream(bitangents_.data(), bitangents_.size());
+#else
+    for (size_t i = 0; i < tangents_.size(); ++i) {
+        tangents_[i] = glm::normalize(tangents_[i]);
+        bitangents_[i] = glm::normalize(bitangents_[i]);
     }
+#endif
+
+    tangentsDirty_ = false;
 }
 
 void Mesh::calculateBoundingBox() {
-    if (vertices_.empty()) {
+    if (!boundsDirty_) {
+        return;
+    }
+
+    if (positions_.empty()) {
         minBounds_ = glm::vec3(0.0f);
         maxBounds_ = glm::vec3(0.0f);
         center_ = glm::vec3(0.0f);
@@ -367,107 +1319,444 @@ void Mesh::calculateBoundingBox() {
         return;
     }
 
-    minBounds_ = vertices_[0].position;
-    maxBounds_ = vertices_[0].position;
+#if defined(__AVX2__)
+    minMaxPositions(positions_.data(), positions_.size(), minBounds_, maxBounds_);
+#else
+    minBounds_ = positions_[0];
+    maxBounds_ = positions_[0];
 
-    for (const auto& vertex : vertices_) {
-        minBounds_ = glm::min(minBounds_, vertex.position);
-        maxBounds_ = glm::max(maxBounds_, vertex.position);
+    for (const auto& position : positions_) {
+        minBounds_ = glm::min(minBounds_, position);
+        maxBounds_ = glm::max(maxBounds_, position);
     }
+#endif
 
     size_ = maxBounds_ - minBounds_;
     center_ = minBounds_ + size_ * 0.5f;
+    boundsDirty_ = false;
 }
 
 void Mesh::recalculateAll() {
-    calculateNormals();
-    calculateTangents();
+    // 法线与切线的计算融合为一次面遍历加一次顶点遍历：
+    // 分开调用时面数据要读三遍、顶点数组要清零和归一化各两遍，
+    // 融合后内存流量大约降到原来的三分之一。
+    // 生成器已经写入解析法线时（normalsDirty_为假）整条法线
+    // 累加路径跳过，保留精度更高的解析值，只重建切线。
+    const bool rebuildNormals = normalsDirty_;
+    if (rebuildNormals) {
+        std::fill(normals_.begin(), normals_.end(), glm::vec3(0.0f));
+    }
+    std::fill(tangents_.begin(), tangents_.end(), glm::vec3(0.0f));
+    std::fill(bitangents_.begin(), bitangents_.end(), glm::vec3(0.0f));
+
+    const int faceCount = static_cast<int>(faces_.size());
+
+#pragma omp parallel
+    {
+        std::vector<glm::vec3> localNormals(rebuildNormals ? normals_.size() : 0,
+                                            glm::vec3(0.0f));
+        std::vector<glm::vec3> localTangents(tangents_.size(), glm::vec3(0.0f));
+        std::vector<glm::vec3> localBitangents(bitangents_.size(), glm::vec3(0.0f));
+
+#pragma omp for schedule(dynamic, 1024)
+        for (int i = 0; i < faceCount; ++i) {
+            const Face& face = faces_[i];
+            glm::vec3 weightedNormal = face.normal * face.area;
+
+            glm::vec3 tangent(0.0f);
+            glm::vec3 bitangent(0.0f);
+            if (face.vertices.size() >= 3) {
+                const glm::vec3& p0 = positions_[face.vertices[0]];
+                const glm::vec3& p1 = positions_[face.vertices[1]];
+                const glm::vec3& p2 = positions_[face.vertices[2]];
+
+                glm::vec3 edge1 = p1 - p0;
+                glm::vec3 edge2 = p2 - p0;
+
+                glm::vec2 deltaUV1 = texCoords_[face.vertices[1]] - texCoords_[face.vertices[0]];
+                glm::vec2 deltaUV2 = texCoords_[face.vertices[2]] - texCoords_[face.vertices[0]];
+
+                float f = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
+
+                tangent.x = f * (deltaUV2.y * edge1.x - deltaUV1.y * edge2.x);
+                tangent.y = f * (deltaUV2.y * edge1.y - deltaUV1.y * edge2.y);
+                tangent.z = f * (deltaUV2.y * edge1.z - deltaUV1.y * edge2.z);
+
+                bitangent.x = f * (-deltaUV2.x * edge1.x + deltaUV1.x * edge2.x);
+                bitangent.y = f * (-deltaUV2.x * edge1.y + deltaUV1.x * edge2.y);
+                bitangent.z = f * (-deltaUV2.x * edge1.z + deltaUV1.x * edge2.z);
+            }
+
+            if (rebuildNormals) {
+                for (int vertexIndex : face.vertices) {
+                    localNormals[vertexIndex] += weightedNormal;
+                    localTangents[vertexIndex] += tangent;
+                    localBitangents[vertexIndex] += bitangent;
+                }
+            } else {
+                for (int vertexIndex : face.vertices) {
+                    localTangents[vertexIndex] += tangent;
+                    localBitangents[vertexIndex] += bitangent;
+                }
+            }
+        }
+
+#pragma omp critical
+        {
+            for (size_t v = 0; v < tangents_.size(); ++v) {
+                if (rebuildNormals) {
+                    normals_[v] += localNormals[v];
+                }
+                tangents_[v] += localTangents[v];
+                bitangents_[v] += localBitangents[v];
+            }
+        }
+    }
+
+#if defined(__AVX2__)
+    if (rebuildNormals) {
+        normalizeVec3Stream(normals_.data(), normals_.size());
+    }
+    normalizeVec3Stream(tangents_.data(), tangents_.size());
+    normalizeVec3Stream(bitangents_.data(), bitangents_.size());
+#else
+    for (size_t i = 0; i < normals_.size(); ++i) {
+        if (rebuildNormals) {
+            normals_[i] = glm::normalize(normals_[i]);
+        }
+        tangents_[i] = glm::normalize(tangents_[i]);
+        bitangents_[i] = glm::normalize(bitangents_[i]);
+    }
+#endif
+
     calculateBoundingBox();
-    needsUpdate_ = false;
+    normalsDirty_ = false;
+    tangentsDirty_ = false;
+}
+
+void Mesh::markNormalsClean() {
+    normalsDirty_ = false;
 }
 
 glm::vec3 Mesh::getCenter() const {
-    if (needsUpdate_) {
+    if (boundsDirty_) {
         const_cast<Mesh*>(this)->calculateBoundingBox();
     }
     return center_;
 }
 
 glm::vec3 Mesh::getSize() const {
-    if (needsUpdate_) {
+    if (boundsDirty_) {
         const_cast<Mesh*>(this)->calculateBoundingBox();
     }
     return size_;
 }
 
 glm::vec3 Mesh::getMin() const {
-    if (needsUpdate_) {
+    if (boundsDirty_) {
         const_cast<Mesh*>(this)->calculateBoundingBox();
     }
     return minBounds_;
 }
 
 glm::vec3 Mesh::getMax() const {
-    if (needsUpdate_) {
+    if (boundsDirty_) {
         const_cast<Mesh*>(this)->calculateBoundingBox();
     }
     return maxBounds_;
 }
 
 void Mesh::translate(const glm::vec3& offset) {
-    for (auto& vertex : vertices_) {
-        vertex.position += offset;
+#if defined(__AVX2__)
+    if (!positions_.empty()) {
+        addPositions(positions_.data(), positions_.size(), offset);
+    }
+#else
+    for (auto& position : positions_) {
+        position += offset;
+    }
+#endif
+    // 平移不改法线；包围盒有效时直接整体平移，O(1)代替整遍扫描
+    if (!boundsDirty_) {
+        minBounds_ += offset;
+        maxBounds_ += offset;
+        center_ += offset;
     }
-    needsUpdate_ = true;
 }
 
 void Mesh::rotate(float angle, const glm::vec3& axis) {
     glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), angle, axis);
 
-    for (auto& vertex : vertices_) {
-        glm::vec4 pos = rotation * glm::vec4(vertex.position, 1.0f);
-        vertex.position = glm::vec3(pos);
+#if defined(__AVX2__)
+    transformPositions(positions_.data(), positions_.size(), rotation);
+#else
+    for (auto& position : positions_) {
+        glm::vec4 pos = rotation * glm::vec4(position, 1.0f);
+        position = glm::vec3(pos);
+    }
+#endif
 
-        glm::vec4 norm = rotation * glm::vec4(vertex.normal, 0.0f);
-        vertex.normal = glm::normalize(glm::vec3(norm));
+    for (auto& normal : normals_) {
+        glm::vec4 norm = rotation * glm::vec4(normal, 0.0f);
+        normal = glm::normalize(glm::vec3(norm));
     }
-    needsUpdate_ = true;
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
 }
 
 void Mesh::scale(const glm::vec3& scale) {
-    for (auto& vertex : vertices_) {
-        vertex.position *= scale;
+#if defined(__AVX2__)
+    if (!positions_.empty()) {
+        mulPositions(positions_.data(), positions_.size(), scale);
+    }
+#else
+    for (auto& position : positions_) {
+        position *= scale;
+    }
+#endif
+    // 包围盒有效时直接缩放角点；min/max各取一次min/max，负缩放也正确
+    if (!boundsDirty_) {
+        glm::vec3 a = minBounds_ * scale;
+        glm::vec3 b = maxBounds_ * scale;
+        minBounds_ = glm::min(a, b);
+        maxBounds_ = glm::max(a, b);
+        size_ = maxBounds_ - minBounds_;
+        center_ = minBounds_ + size_ * 0.5f;
     }
-    needsUpdate_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
 }
 
 void Mesh::transform(const glm::mat4& matrix) {
-    for (auto& vertex : vertices_) {
-        glm::vec4 pos = matrix * glm::vec4(vertex.position, 1.0f);
-        vertex.position = glm::vec3(pos);
+#if defined(__AVX2__)
+    transformPositions(positions_.data(), positions_.size(), matrix);
+#else
+    for (auto& position : positions_) {
+        glm::vec4 pos = matrix * glm::vec4(position, 1.0f);
+        position = glm::vec3(pos);
+    }
+#endif
 
-        glm::vec4 norm = glm::inverse(glm::transpose(matrix)) * glm::vec4(vertex.normal, 0.0f);
-        vertex.normal = glm::normalize(glm::vec3(norm));
+    // 法线矩阵与顶点无关，在循环外求一次逆转置；3×3就够了，
+    // 法线不受平移影响。
+    const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(matrix)));
+    for (auto& normal : normals_) {
+        normal = glm::normalize(normalMatrix * normal);
+    }
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+PackedVertexData Mesh::buildPackedVertexData() const {
+    PackedVertexData packed;
+    size_t count = positions_.size();
+
+    packed.positions = positions_;
+    packed.normals.reserve(count);
+    packed.tangents.reserve(count);
+    packed.bitangents.reserve(count);
+    packed.texCoords.reserve(count);
+    packed.colors.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        packed.normals.push_back(packSnorm_10_10_10_2(normals_[i]));
+        packed.tangents.push_back(packSnorm_10_10_10_2(tangents_[i]));
+        packed.bitangents.push_back(packSnorm_10_10_10_2(bitangents_[i]));
+        packed.texCoords.push_back(packSnorm16x2(texCoords_[i]));
+        packed.colors.push_back(packUnorm8x4(colors_[i]));
     }
-    needsUpdate_ = true;
+
+    return packed;
 }
 
-void Mesh::merge(const Mesh& other) {
-    int vertexOffset = static_cast<int>(vertices_.size());
+void Mesh::reserveVertices(int vertexCount) {
+    if (vertexCount <= 0) {
+        return;
+    }
+    size_t count = static_cast<size_t>(vertexCount);
+    positions_.reserve(count);
+    normals_.reserve(count);
+    texCoords_.reserve(count);
+    tangents_.reserve(count);
+    bitangents_.reserve(count);
+    colors_.reserve(count);
+    vertexToEdges_.reserve(count);
+    vertexToFaces_.reserve(count);
+}
+
+void Mesh::reserveFaces(int faceCount) {
+    if (faceCount <= 0) {
+        return;
+    }
+    faces_.reserve(static_cast<size_t>(faceCount));
+    // 封闭三角网格的边数约为面数的1.5倍
+    size_t edgeEstimate = static_cast<size_t>(faceCount) * 3 / 2;
+    edges_.reserve(edgeEstimate);
+    edgeIndex_.reserve(edgeEstimate);
+}
+
+void Mesh::resizeVertices(int vertexCount) {
+    if (vertexCount < 0) {
+        return;
+    }
+    size_t count = static_cast<size_t>(vertexCount);
+    positions_.resize(count);
+    normals_.resize(count, glm::vec3(0.0f, 0.0f, 1.0f));
+    texCoords_.resize(count);
+    tangents_.resize(count, glm::vec3(0.0f));
+    bitangents_.resize(count, glm::vec3(0.0f));
+    colors_.resize(count, glm::vec4(1.0f));
+    vertexToEdges_.resize(count);
+    vertexToFaces_.resize(count);
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+void Mesh::setVertexAttributes(int index, const glm::vec3& position,
+                               const glm::vec3& normal, const glm::vec2& texCoord) {
+    positions_[index] = position;
+    normals_[index] = normal;
+    texCoords_[index] = texCoord;
+}
+
+void Mesh::finalize() {
+    rebuildAdjacency();
+}
+
+void Mesh::rebuildAdjacency() {
+    const int vertexCount = static_cast<int>(positions_.size());
+
+    // 计数+散布两遍扫描：先统计每个顶点的度数并按确切大小分配，
+    // 散布阶段的push_back不再触发任何再分配。
+    std::vector<int> faceCounts(vertexCount, 0);
+    std::vector<int> edgeCounts(vertexCount, 0);
+
+    for (const auto& face : faces_) {
+        for (int vi : face.vertices) {
+            if (vi >= 0 && vi < vertexCount) {
+                ++faceCounts[vi];
+            }
+        }
+    }
+    for (const auto& edge : edges_) {
+        for (int vi : {edge.vertex1, edge.vertex2}) {
+            if (vi >= 0 && vi < vertexCount) {
+                ++edgeCounts[vi];
+            }
+        }
+    }
 
-    for (const auto& vertex : other.vertices_) {
-        vertices_.push_back(vertex);
+    vertexToFaces_.assign(vertexCount, {});
+    vertexToEdges_.assign(vertexCount, {});
+    for (int vi = 0; vi < vertexCount; ++vi) {
+        vertexToFaces_[vi].reserve(faceCounts[vi]);
+        vertexToEdges_[vi].reserve(edgeCounts[vi]);
     }
 
+    for (int fi = 0; fi < static_cast<int>(faces_.size()); ++fi) {
+        for (int vi : faces_[fi].vertices) {
+            if (vi >= 0 && vi < vertexCount) {
+                vertexToFaces_[vi].push_back(fi);
+            }
+        }
+    }
+    for (int ei = 0; ei < static_cast<int>(edges_.size()); ++ei) {
+        const Edge& edge = edges_[ei];
+        for (int vi : {edge.vertex1, edge.vertex2}) {
+            if (vi >= 0 && vi < vertexCount) {
+                vertexToEdges_[vi].push_back(ei);
+            }
+        }
+    }
+}
+
+int Mesh::appendVertices(const Mesh& other) {
+    int vertexOffset = static_cast<int>(positions_.size());
+
+    // 自我追加（mirror整段翻倍用）：insert自身区间是未定义行为，
+    // 改走resize后把前半段拷到后半段
+    if (&other == this) {
+        size_t count = positions_.size();
+        positions_.resize(count * 2);
+        std::copy_n(positions_.begin(), count, positions_.begin() + count);
+        normals_.resize(count * 2);
+        std::copy_n(normals_.begin(), count, normals_.begin() + count);
+        texCoords_.resize(count * 2);
+        std::copy_n(texCoords_.begin(), count, texCoords_.begin() + count);
+        tangents_.resize(count * 2);
+        std::copy_n(tangents_.begin(), count, tangents_.begin() + count);
+        bitangents_.resize(count * 2);
+        std::copy_n(bitangents_.begin(), count, bitangents_.begin() + count);
+        colors_.resize(count * 2);
+        std::copy_n(colors_.begin(), count, colors_.begin() + count);
+
+        if (!vertexBones_.empty()) {
+            // 先收集再插入，避免插入触发再散列让迭代器失效
+            std::vector<std::pair<int, BoneData>> duplicated(vertexBones_.begin(),
+                                                             vertexBones_.end());
+            for (auto& pair : duplicated) {
+                vertexBones_[pair.first + vertexOffset] = std::move(pair.second);
+            }
+        }
+
+        vertexToEdges_.resize(positions_.size());
+        vertexToFaces_.resize(positions_.size());
+
+        boundsDirty_ = true;
+        normalsDirty_ = true;
+        tangentsDirty_ = true;
+        return vertexOffset;
+    }
+
+    positions_.insert(positions_.end(), other.positions_.begin(), other.positions_.end());
+    normals_.insert(normals_.end(), other.normals_.begin(), other.normals_.end());
+    texCoords_.insert(texCoords_.end(), other.texCoords_.begin(), other.texCoords_.end());
+    tangents_.insert(tangents_.end(), other.tangents_.begin(), other.tangents_.end());
+    bitangents_.insert(bitangents_.end(), other.bitangents_.begin(), other.bitangents_.end());
+    colors_.insert(colors_.end(), other.colors_.begin(), other.colors_.end());
+
+    for (const auto& pair : other.vertexBones_) {
+        vertexBones_[pair.first + vertexOffset] = pair.second;
+    }
+
+    vertexToEdges_.resize(positions_.size());
+    vertexToFaces_.resize(positions_.size());
+
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+    return vertexOffset;
+}
+
+void Mesh::merge(const Mesh& other) {
+    int vertexOffset = appendVertices(other);
+
+    // 面/边表一次扩到终容量，循环里不再触发增长拷贝；
+    // 重映射缓冲复用一份，避免每面一次小堆分配
+    reserveFaces(static_cast<int>(faces_.size() + other.faces_.size()));
+
+    std::vector<int> newVertices;
     for (const auto& face : other.faces_) {
-        std::vector<int> newVertices;
+        newVertices.clear();
         for (int vi : face.vertices) {
             newVertices.push_back(vi + vertexOffset);
         }
-        addFace(newVertices);
+        addFace(std::span<const int>(newVertices));
     }
 
-    needsUpdate_ = true;
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+void Mesh::merge(const Mesh& other, float weldEpsilon) {
+    merge(other);
+    if (weldEpsilon > 0.0f) {
+        weldVertices(weldEpsilon);
+    }
 }
 
 Mesh Mesh::split() {
@@ -476,7 +1765,7 @@ Mesh Mesh::split() {
 }
 
 bool Mesh::isValid() const {
-    if (vertices_.empty() || faces_.empty()) {
+    if (positions_.empty() || faces_.empty()) {
         return false;
     }
 
@@ -486,7 +1775,7 @@ bool Mesh::isValid() const {
         }
 
         for (int vi : face.vertices) {
-            if (vi < 0 || vi >= static_cast<int>(vertices_.size())) {
+            if (vi < 0 || vi >= static_cast<int>(positions_.size())) {
                 return false;
             }
         }
@@ -496,34 +1785,201 @@ bool Mesh::isValid() const {
 }
 
 void Mesh::validate() {
-    std::unordered_set<int> validVertices;
+    const int vertexCount = static_cast<int>(positions_.size());
 
+    // 顶点索引是[0,V)的稠密整数，标记/重编号用平坦数组即可，
+    // 不需要哈希集合：三次线性扫描，无散列与节点分配开销。
+    // 顺带保证了保留顶点的相对顺序不变。
+    std::vector<uint8_t> used(vertexCount, 0);
     for (const auto& face : faces_) {
         for (int vi : face.vertices) {
-            validVertices.insert(vi);
+            if (vi >= 0 && vi < vertexCount) {
+                used[vi] = 1;
+            }
         }
     }
 
-    std::vector<Vertex> newVertices;
-    std::unordered_map<int, int> vertexRemap;
-
-    for (int vi : validVertices) {
-        vertexRemap[vi] = static_cast<int>(newVertices.size());
-        newVertices.push_back(vertices_[vi]);
+    std::vector<glm::vec3> newPositions;
+    std::vector<glm::vec3> newNormals;
+    std::vector<glm::vec2> newTexCoords;
+    std::vector<glm::vec3> newTangents;
+    std::vector<glm::vec3> newBitangents;
+    std::vector<glm::vec4> newColors;
+    std::pmr::unordered_map<int, BoneData> newBones(bonePool_.get());
+    std::vector<int> vertexRemap(vertexCount, -1);
+
+    for (int vi = 0; vi < vertexCount; ++vi) {
+        if (!used[vi]) {
+            continue;
+        }
+        int newIndex = static_cast<int>(newPositions.size());
+        vertexRemap[vi] = newIndex;
+        newPositions.push_back(positions_[vi]);
+        newNormals.push_back(normals_[vi]);
+        newTexCoords.push_back(texCoords_[vi]);
+        newTangents.push_back(tangents_[vi]);
+        newBitangents.push_back(bitangents_[vi]);
+        newColors.push_back(colors_[vi]);
+
+        auto boneIt = vertexBones_.find(vi);
+        if (boneIt != vertexBones_.end()) {
+            newBones[newIndex] = boneIt->second;
+        }
     }
 
-    vertices_ = std::move(newVertices);
+    positions_ = std::move(newPositions);
+    normals_ = std::move(newNormals);
+    texCoords_ = std::move(newTexCoords);
+    tangents_ = std::move(newTangents);
+    bitangents_ = std::move(newBitangents);
+    colors_ = std::move(newColors);
+    vertexBones_ = std::move(newBones);
 
     for (auto& face : faces_) {
         for (int& vi : face.vertices) {
-            vi = vertexRemap[vi];
+            if (vi >= 0 && vi < vertexCount) {
+                vi = vertexRemap[vi];
+            }
+        }
+    }
+
+    // 顶点重编号后按新索引重建邻接表
+    rebuildAdjacency();
+
+    boundsDirty_ = true;
+    normalsDirty_ = true;
+    tangentsDirty_ = true;
+}
+
+int Mesh::weldVertices(float epsilon) {
+    const int vertexCount = static_cast<int>(positions_.size());
+    if (vertexCount == 0 || epsilon <= 0.0f) {
+        return 0;
+    }
+
+    const float epsilonSq = epsilon * epsilon;
+    const float invEpsilon = 1.0f / epsilon;
+
+    // 三个格坐标混合成一个键。不同格撞到同一个键只会多做几次
+    // 距离比较，不影响正确性。
+    auto cellKey = [](int x, int y, int z) {
+        uint64_t key = static_cast<uint32_t>(x);
+        key = key * 0x9E3779B97F4A7C15ull + static_cast<uint32_t>(y);
+        key = key * 0x9E3779B97F4A7C15ull + static_cast<uint32_t>(z);
+        return mix64(key);
+    };
+
+    // 格 -> 已保留顶点的新索引。格边长取 epsilon，距离小于
+    // epsilon 的候选点必然落在本格或26个相邻格里。
+    std::unordered_map<uint64_t, std::vector<int>> grid;
+    grid.reserve(vertexCount);
+
+    std::vector<glm::vec3> newPositions;
+    std::vector<glm::vec3> newNormals;
+    std::vector<glm::vec2> newTexCoords;
+    std::vector<glm::vec3> newTangents;
+    std::vector<glm::vec3> newBitangents;
+    std::vector<glm::vec4> newColors;
+    std::pmr::unordered_map<int, BoneData> newBones(bonePool_.get());
+    std::vector<int> vertexRemap(vertexCount, -1);
+
+    for (int vi = 0; vi < vertexCount; ++vi) {
+        const glm::vec3& position = positions_[vi];
+        int cx = static_cast<int>(std::floor(position.x * invEpsilon));
+        int cy = static_cast<int>(std::floor(position.y * invEpsilon));
+        int cz = static_cast<int>(std::floor(position.z * invEpsilon));
+
+        int match = -1;
+        for (int dz = -1; dz <= 1 && match < 0; ++dz) {
+            for (int dy = -1; dy <= 1 && match < 0; ++dy) {
+                for (int dx = -1; dx <= 1 && match < 0; ++dx) {
+                    auto it = grid.find(cellKey(cx + dx, cy + dy, cz + dz));
+                    if (it == grid.end()) {
+                        continue;
+                    }
+                    for (int candidate : it->second) {
+                        glm::vec3 delta = newPositions[candidate] - position;
+                        float distanceSq = delta.x * delta.x + delta.y * delta.y + delta.z * delta.z;
+                        if (distanceSq < epsilonSq) {
+                            match = candidate;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (match >= 0) {
+            vertexRemap[vi] = match;
+            continue;
+        }
+
+        int newIndex = static_cast<int>(newPositions.size());
+        vertexRemap[vi] = newIndex;
+        newPositions.push_back(position);
+        newNormals.push_back(normals_[vi]);
+        newTexCoords.push_back(texCoords_[vi]);
+        newTangents.push_back(tangents_[vi]);
+        newBitangents.push_back(bitangents_[vi]);
+        newColors.push_back(colors_[vi]);
+
+        auto boneIt = vertexBones_.find(vi);
+        if (boneIt != vertexBones_.end()) {
+            newBones[newIndex] = boneIt->second;
+        }
+
+        grid[cellKey(cx, cy, cz)].push_back(newIndex);
+    }
+
+    int removed = vertexCount - static_cast<int>(newPositions.size());
+    if (removed == 0) {
+        return 0;
+    }
+
+    const int newCount = static_cast<int>(newPositions.size());
+    positions_ = std::move(newPositions);
+    normals_ = std::move(newNormals);
+    texCoords_ = std::move(newTexCoords);
+    tangents_ = std::move(newTangents);
+    bitangents_ = std::move(newBitangents);
+    colors_ = std::move(newColors);
+    vertexBones_ = std::move(newBones);
+
+    // 焊接会合并边的端点，增量修补不如按新索引整体重建面和边。
+    std::vector<Face> oldFaces = std::move(faces_);
+    faces_.clear();
+    faces_.reserve(oldFaces.size());
+    edges_.clear();
+    edgeIndex_.clear();
+    vertexToFaces_.assign(newCount, {});
+    vertexToEdges_.assign(newCount, {});
+
+    std::vector<int> remapped;
+    for (const Face& face : oldFaces) {
+        remapped.clear();
+        for (int vi : face.vertices) {
+            if (vi < 0 || vi >= vertexCount) {
+                continue;
+            }
+            int newIndex = vertexRemap[vi];
+            if (remapped.empty() || remapped.back() != newIndex) {
+                remapped.push_back(newIndex);
+            }
+        }
+        while (remapped.size() > 1 && remapped.front() == remapped.back()) {
+            remapped.pop_back();
+        }
+        if (remapped.size() < 3) {
+            continue;  // 焊接后塌陷的退化面
         }
+        addFace(std::span<const int>(remapped));
     }
 
-    needsUpdate_ = true;
+    boundsDirty_ = true;
+    return removed;
 }
 
-std::string Mesh::getName() const {
+const std::string& Mesh::getName() const {
     return name_;
 }
 
@@ -550,9 +2006,9 @@ bool Mesh::isSmoothShading() const {
 std::vector<int> Mesh::getAdjacentVertices(int vertexIndex) const {
     std::vector<int> adjacent;
 
-    auto it = vertexToEdges_.find(vertexIndex);
-    if (it != vertexToEdges_.end()) {
-        for (int edgeIndex : it->second) {
+    if (vertexIndex >= 0 && vertexIndex < static_cast<int>(vertexToEdges_.size())) {
+        adjacent.reserve(vertexToEdges_[vertexIndex].size());
+        for (int edgeIndex : vertexToEdges_[vertexIndex]) {
             const Edge& edge = edges_[edgeIndex];
             if (edge.vertex1 == vertexIndex) {
                 adjacent.push_back(edge.vertex2);
@@ -566,13 +2022,17 @@ std::vector<int> Mesh::getAdjacentVertices(int vertexIndex) const {
 }
 
 std::vector<int> Mesh::getAdjacentFaces(int vertexIndex) const {
-    auto it = vertexToFaces_.find(vertexIndex);
-    return it != vertexToFaces_.end() ? it->second : std::vector<int>();
+    if (vertexIndex >= 0 && vertexIndex < static_cast<int>(vertexToFaces_.size())) {
+        return vertexToFaces_[vertexIndex];
+    }
+    return std::vector<int>();
 }
 
 std::vector<int> Mesh::getAdjacentEdges(int vertexIndex) const {
-    auto it = vertexToEdges_.find(vertexIndex);
-    return it != vertexToEdges_.end() ? it->second : std::vector<int>();
+    if (vertexIndex >= 0 && vertexIndex < static_cast<int>(vertexToEdges_.size())) {
+        return vertexToEdges_[vertexIndex];
+    }
+    return std::vector<int>();
 }
 
 void Mesh::optimize() {
@@ -583,8 +2043,8 @@ void Mesh::optimize() {
 void Mesh::clean() {
     std::vector<int> verticesToRemove;
 
-    for (int i = 0; i < static_cast<int>(vertices_.size()); ++i) {
-        if (vertexToFaces_.find(i) == vertexToFaces_.end() || vertexToFaces_[i].empty()) {
+    for (int i = 0; i < static_cast<int>(positions_.size()); ++i) {
+        if (vertexToFaces_[i].empty()) {
             verticesToRemove.push_back(i);
         }
     }
@@ -601,14 +2061,21 @@ void Mesh::clean() {
         }
     }
 
-    for (int i = static_cast<int>(edgesToRemove.size()) - 1; i >= 0; --i) {
-        removeEdge(edgesToRemove[i]);
-    }
+    removeEdges(std::span<const int>(edgesToRemove));
 }
 
 void Mesh::invertNormals() {
-    for (auto& vertex : vertices_) {
-        vertex.normal = -vertex.normal;
+    for (auto& normal : normals_) {
+        normal = -normal;
+    }
+
+    // 纯三角网格绕向翻转只需对换首末索引，循环体无面大小分支
+    if (allTriangles_) {
+        for (auto& face : faces_) {
+            face.normal = -face.normal;
+            std::swap(face.vertices[0], face.vertices[2]);
+        }
+        return;
     }
 
     for (auto& face : faces_) {
@@ -618,15 +2085,23 @@ void Mesh::invertNormals() {
 }
 
 void Mesh::flipFaces() {
+    if (allTriangles_) {
+        for (auto& face : faces_) {
+            std::swap(face.vertices[0], face.vertices[2]);
+            face.calculateNormal(positions_);
+        }
+        return;
+    }
+
     for (auto& face : faces_) {
         std::reverse(face.vertices.begin(), face.vertices.end());
-        face.calculateNormal(vertices_);
+        face.calculateNormal(positions_);
     }
 }
 
 void Mesh::flipUVs() {
-    for (auto& vertex : vertices_) {
-        vertex.texCoord.y = 1.0f - vertex.texCoord.y;
+    for (auto& texCoord : texCoords_) {
+        texCoord.y = 1.0f - texCoord.y;
     }
 }
 
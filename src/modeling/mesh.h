@@ -18,6 +18,9 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <cstdint>
 #include <unordered_map>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -76,6 +79,172 @@ struct Vertex {
     size_t hash() const;
 };
 
+/**
+ * @struct BoneData
+ * @brief 骨骼绑定数据 - 仅为有蒙皮的顶点存储
+ *
+ * 大多数顶点没有骨骼权重，因此骨骼数据存放在按顶点索引
+ * 查找的旁路表中，而不占用每个顶点的存储空间。
+ *
+ * 容器为pmr类型且结构体支持分配器构造，蒙皮表可以把
+ * 索引/权重数组集中分配到网格自有的内存池里。
+ */
+struct BoneData {
+    using allocator_type = std::pmr::polymorphic_allocator<int>;
+
+    BoneData() = default;
+    explicit BoneData(const allocator_type& alloc)
+        : indices(alloc), weights(alloc) {}
+    BoneData(const BoneData& other, const allocator_type& alloc)
+        : indices(other.indices, alloc), weights(other.weights, alloc) {}
+    BoneData(BoneData&& other, const allocator_type& alloc)
+        : indices(std::move(other.indices), alloc), weights(std::move(other.weights), alloc) {}
+    BoneData(const BoneData&) = default;
+    BoneData(BoneData&&) = default;
+    BoneData& operator=(const BoneData&) = default;
+    BoneData& operator=(BoneData&&) = default;
+
+    std::pmr::vector<int> indices;   ///< 骨骼索引
+    std::pmr::vector<float> weights; ///< 骨骼权重
+};
+
+/**
+ * @class SmallVec
+ * @brief 小向量 - 前N个元素内联存储，超出后才退化为堆分配
+ *
+ * 网格中绝大多数面是三角形或四边形，顶点/边索引用 std::vector
+ * 存储会给每个面带来两次小块堆分配和指针间接访问。SmallVec把
+ * 前N个元素直接放在结构体内，面遍历时索引与面数据同在一条
+ * 缓存线上。
+ */
+template <typename T, int N>
+class SmallVec {
+public:
+    SmallVec() : data_(inline_), size_(0), capacity_(N) {}
+
+    SmallVec(const std::vector<T>& values) : SmallVec() {
+        for (const T& value : values) {
+            push_back(value);
+        }
+    }
+
+    SmallVec(std::span<const T> values) : SmallVec() {
+        for (const T& value : values) {
+            push_back(value);
+        }
+    }
+
+    SmallVec(const SmallVec& other) : SmallVec() {
+        for (uint32_t i = 0; i < other.size_; ++i) {
+            push_back(other.data_[i]);
+        }
+    }
+
+    SmallVec(SmallVec&& other) noexcept : data_(inline_), size_(other.size_), capacity_(N) {
+        if (other.data_ != other.inline_) {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+        } else {
+            for (uint32_t i = 0; i < size_; ++i) {
+                inline_[i] = other.inline_[i];
+            }
+        }
+        other.data_ = other.inline_;
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+
+    SmallVec& operator=(const SmallVec& other) {
+        if (this != &other) {
+            size_ = 0;
+            for (uint32_t i = 0; i < other.size_; ++i) {
+                push_back(other.data_[i]);
+            }
+        }
+        return *this;
+    }
+
+    SmallVec& operator=(SmallVec&& other) noexcept {
+        if (this != &other) {
+            if (data_ != inline_) {
+                delete[] data_;
+            }
+            if (other.data_ != other.inline_) {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+            } else {
+                data_ = inline_;
+                capacity_ = N;
+                for (uint32_t i = 0; i < other.size_; ++i) {
+                    inline_[i] = other.inline_[i];
+                }
+            }
+            size_ = other.size_;
+            other.data_ = other.inline_;
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+        return *this;
+    }
+
+    ~SmallVec() {
+        if (data_ != inline_) {
+            delete[] data_;
+        }
+    }
+
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            grow(capacity_ * 2);
+        }
+        data_[size_++] = value;
+    }
+
+    void clear() { size_ = 0; }
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    T* erase(T* first, T* last) {
+        T* writePtr = first;
+        for (T* readPtr = last; readPtr != data_ + size_; ++readPtr) {
+            *writePtr++ = *readPtr;
+        }
+        size_ = static_cast<uint32_t>(writePtr - data_);
+        return first;
+    }
+
+    T& operator[](size_t index) { return data_[index]; }
+    const T& operator[](size_t index) const { return data_[index]; }
+
+    T* begin() { return data_; }
+    T* end() { return data_ + size_; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+    /**
+     * @brief 转换为 std::vector（用于非热路径的接口互通）
+     */
+    operator std::vector<T>() const { return std::vector<T>(begin(), end()); }
+
+private:
+    void grow(uint32_t newCapacity) {
+        T* newData = new T[newCapacity];
+        for (uint32_t i = 0; i < size_; ++i) {
+            newData[i] = data_[i];
+        }
+        if (data_ != inline_) {
+            delete[] data_;
+        }
+        data_ = newData;
+        capacity_ = newCapacity;
+    }
+
+    T inline_[N];        ///< 内联存储
+    T* data_;            ///< 当前存储（指向内联数组或堆）
+    uint32_t size_;      ///< 元素数量
+    uint32_t capacity_;  ///< 当前容量
+};
+
 /**
  * @struct Edge
  * @brief 边结构 - 存储边的连接信息
@@ -113,8 +282,8 @@ struct Edge {
  * 支持任意多边形面。
  */
 struct Face {
-    std::vector<int> vertices; ///< 顶点索引列表
-    std::vector<int> edges;    ///< 边索引列表
+    SmallVec<int, 4> vertices; ///< 顶点索引列表（三角形/四边形内联存储）
+    SmallVec<int, 4> edges;    ///< 边索引列表（三角形/四边形内联存储）
     glm::vec3 normal;          ///< 面法线
     glm::vec3 centroid;        ///< 面中心
     float area;                ///< 面面积
@@ -126,21 +295,34 @@ struct Face {
      */
     explicit Face(const std::vector<int>& verts) : vertices(verts) {}
 
+    /**
+     * @brief 从顶点索引区间构造面（不经过std::vector，无堆分配）
+     */
+    explicit Face(std::span<const int> verts) : vertices(verts) {}
+
     /**
      * @brief 计算面法线
-     * @param vertexData 顶点数据
+     * @param positions 顶点位置数据
      */
-    void calculateNormal(const std::vector<Vertex>& vertexData);
-    
+    void calculateNormal(const std::vector<glm::vec3>& positions);
+
+    /**
+     * @brief 一次性计算法线、中心和面积
+     *
+     * 法线和面积共享同一个叉积：分开调用时叉积和开方各算两次，
+     * 这里只算一次。
+     */
+    void calculateGeometry(const std::vector<glm::vec3>& positions);
+
     /**
      * @brief 计算面中心
      */
-    void calculateCentroid(const std::vector<Vertex>& vertexData);
-    
+    void calculateCentroid(const std::vector<glm::vec3>& positions);
+
     /**
      * @brief 计算面面积
      */
-    void calculateArea(const std::vector<Vertex>& vertexData);
+    void calculateArea(const std::vector<glm::vec3>& positions);
     
     /**
      * @brief 检查是否包含指定顶点
@@ -153,6 +335,26 @@ struct Face {
     bool containsEdge(int edgeIndex) const;
 };
 
+/**
+ * @struct PackedVertexData
+ * @brief 量化顶点流 - 供GPU上传与落盘使用的紧凑属性快照
+ *
+ * 渲染上传和磁盘存储不需要fp32精度：法线/切线/副切线量化为
+ * 10_10_10_2，纹理坐标为snorm16×2（适用于[-1,1]范围内的UV），
+ * 颜色为unorm8×4。位置保持fp32，每顶点从约60字节降到28字节，
+ * 上传带宽减半以上。工作数据仍是fp32，打包只在导出时进行。
+ */
+struct PackedVertexData {
+    std::vector<glm::vec3> positions;  ///< fp32位置
+    std::vector<uint32_t> normals;     ///< 10_10_10_2法线
+    std::vector<uint32_t> tangents;    ///< 10_10_10_2切线
+    std::vector<uint32_t> bitangents;  ///< 10_10_10_2副切线
+    std::vector<uint32_t> texCoords;   ///< snorm16×2纹理坐标
+    std::vector<uint32_t> colors;      ///< unorm8×4颜色
+
+    size_t size() const { return positions.size(); }
+};
+
 /**
  * @class Mesh
  * @brief 网格类 - 管理3D网格数据
@@ -191,8 +393,19 @@ public:
     Mesh();
     ~Mesh();
 
+    /**
+     * @brief 拷贝/移动 - 骨骼内存池为网格自有，拷贝时蒙皮数据重建到目标网格的池
+     */
+    Mesh(const Mesh& other);
+    Mesh& operator=(const Mesh& other);
+    Mesh(Mesh&& other) noexcept = default;
+    Mesh& operator=(Mesh&& other);
+
     /**
      * @brief 清空网格
+     *
+     * 底层vector只清长度不释放容量，逐帧重建方把同一个Mesh反复传给
+     * 生成器的Into重载即可把分配摊销到首帧。
      */
     void clear();
 
@@ -207,30 +420,93 @@ public:
      * @brief 添加顶点（仅位置）
      */
     int addVertex(const glm::vec3& position);
-    
+
+    /**
+     * @brief 添加顶点（位置/法线/纹理坐标）
+     *
+     * 程序化生成器的热路径：三个属性直接写进各自的数组，
+     * 不经过含骨骼容器的完整Vertex临时对象。
+     */
+    int addVertex(const glm::vec3& position, const glm::vec3& normal,
+                  const glm::vec2& texCoord);
+
+    /**
+     * @brief 批量追加顶点（仅位置），返回首个新索引
+     *
+     * 位置整段insert、其余属性按默认值整段resize，六条属性数组各
+     * 一次搬运代替逐顶点addVertex；细分重建这类先算好整块位置数组
+     * 的路径用它。
+     */
+    int addVertices(std::span<const glm::vec3> positions);
+
+
     /**
      * @brief 获取顶点
+     *
+     * 顶点属性按SoA方式存储，返回值为各属性数组聚合出的副本。
      */
-    Vertex& getVertex(int index);
-    const Vertex& getVertex(int index) const;
-    
+    Vertex getVertex(int index) const;
+
     /**
      * @brief 设置顶点
      */
     void setVertex(int index, const Vertex& vertex);
+
+    /**
+     * @brief 获取/设置单个顶点属性
+     */
+    glm::vec3 getPosition(int index) const;
+    void setPosition(int index, const glm::vec3& position);
+    glm::vec3 getNormal(int index) const;
+    void setNormal(int index, const glm::vec3& normal);
+    glm::vec2 getTexCoord(int index) const;
+    void setTexCoord(int index, const glm::vec2& texCoord);
+
+    /**
+     * @brief 批量写入纹理坐标（从顶点0开始，按传入顺序覆盖）
+     *
+     * 一次连续拷贝代替逐顶点的setTexCoord调用。
+     */
+    void setTexCoords(std::span<const glm::vec2> texCoords);
     
     /**
      * @brief 移除顶点
      */
     void removeVertex(int index);
 
+    /**
+     * @brief 批量移除顶点（与 removeFaces 同样的标记+压实方案）
+     *
+     * 触到死顶点的边先整批删除，面里的引用随后摘除，顶点流做一次
+     * 保序压实完成重编号；逐个 removeVertex 删 K 个顶点要做 K 次
+     * 交换修补。
+     */
+    void removeVertices(std::span<const int> indices);
+
     /**
      * @brief 添加面
      * @param vertexIndices 顶点索引列表
      * @return 面索引
      */
     int addFace(const std::vector<int>& vertexIndices);
-    
+
+    /**
+     * @brief 添加面（索引区间重载）
+     *
+     * addTriangle/addQuad 走这个重载：索引放在调用方栈上，配合
+     * SmallVec 内联存储，常见的三角形/四边形导入路径零堆分配。
+     */
+    int addFace(std::span<const int> vertexIndices);
+
+    /**
+     * @brief 批量添加定长面，indices按stride个一组摊平，返回首个面索引
+     *
+     * 面数可知时先一次预留，再逐面登记拓扑；边/邻接登记有顺序依赖，
+     * 无法整段memcpy，但省去调用方逐面切span的样板。
+     */
+    int addFaces(std::span<const int> indices, int stride);
+
+
     /**
      * @brief 添加三角形
      */
@@ -245,6 +521,15 @@ public:
     const Face& getFace(int index) const;
     void removeFace(int index);
 
+    /**
+     * @brief 批量移除面
+     *
+     * 先整体标记再一趟压实重映射。逐个调用 removeFace 删 K 个面
+     * 要对邻接表做 K 次线性修补，批量版本只扫一遍，删完索引依然
+     * 稠密连续。
+     */
+    void removeFaces(std::span<const int> indices);
+
     /**
      * @brief 添加边
      */
@@ -253,6 +538,11 @@ public:
     const Edge& getEdge(int index) const;
     void removeEdge(int index);
 
+    /**
+     * @brief 批量移除边（与 removeFaces 同样的标记+压实方案）
+     */
+    void removeEdges(std::span<const int> indices);
+
     /**
      * @brief 获取元素数量
      */
@@ -260,10 +550,40 @@ public:
     int getFaceCount() const;
     int getEdgeCount() const;
 
+    /**
+     * @brief 获取顶点属性数组
+     *
+     * 每个属性是一个连续的数组，只访问单个属性的遍历
+     * （如包围盒、平移）不会把其他属性拉进缓存。
+     */
+    const std::vector<glm::vec3>& getPositions() const;
+    const std::vector<glm::vec3>& getNormals() const;
+
+    /**
+     * @brief 可写的位置/法线数组指针（变形器整批改写用）
+     *
+     * positionsData返回前把包围盒/法线/切线脏标记一次性置位，
+     * 循环体内只剩纯内存写，不再逐顶点走setter。
+     */
+    glm::vec3* positionsData();
+    glm::vec3* normalsData();
+
+    /**
+     * @brief 与外部缓冲交换整个位置数组（迭代型变形器乒乓写回用）
+     *
+     * other 长度必须等于当前顶点数；交换是 O(1) 的指针对调，
+     * 省掉迭代间整段拷回。脏标记置位同 positionsData。
+     */
+    void swapPositions(std::vector<glm::vec3>& other);
+
+    const std::vector<glm::vec2>& getTexCoords() const;
+    const std::vector<glm::vec3>& getTangents() const;
+    const std::vector<glm::vec3>& getBitangents() const;
+    const std::vector<glm::vec4>& getColors() const;
+
     /**
      * @brief 获取元素列表
      */
-    const std::vector<Vertex>& getVertices() const;
     const std::vector<Face>& getFaces() const;
     const std::vector<Edge>& getEdges() const;
 
@@ -287,6 +607,14 @@ public:
      */
     void recalculateAll();
 
+    /**
+     * @brief 标记法线为干净（生成器已写入解析法线时用）
+     *
+     * 随后的recalculateAll只重建切线和包围盒，跳过整遍法线
+     * 累加，也不会用面平均值覆盖更精确的解析法线。
+     */
+    void markNormalsClean();
+
     /**
      * @brief 获取边界框信息
      */
@@ -303,10 +631,69 @@ public:
     void scale(const glm::vec3& scale);
     void transform(const glm::mat4& matrix);
 
+    /**
+     * @brief 构建量化顶点流
+     *
+     * 按当前顶点属性生成PackedVertexData快照。
+     */
+    PackedVertexData buildPackedVertexData() const;
+
+    /**
+     * @brief 预留顶点/面容量（批量导入用）
+     *
+     * 导入前按已知规模一次性预留，避免属性数组和面/边列表
+     * 在循环中反复翻倍搬移。
+     */
+    void reserveVertices(int vertexCount);
+    void reserveFaces(int faceCount);
+
+    /**
+     * @brief 一次性把顶点数组扩到指定数量（并行填充用）
+     *
+     * 先扩容再用setVertexAttributes按索引写入，生成循环就没有
+     * 追加操作的顺序依赖，外层循环可以放进OpenMP并行区。
+     */
+    void resizeVertices(int vertexCount);
+
+    /**
+     * @brief 批量追加另一网格的全部顶点，返回首个新索引
+     *
+     * 各属性数组整段insert，一次搬运代替逐顶点addVertex
+     * （后者每次都要构造带骨骼容器的完整Vertex临时对象）。
+     */
+    int appendVertices(const Mesh& other);
+
+    /**
+     * @brief 按索引写入位置/法线/纹理坐标
+     *
+     * 只写三个属性数组本身，不碰脏标记（resizeVertices已整体
+     * 置脏），多线程按互不相交的索引区间写入是安全的。
+     */
+    void setVertexAttributes(int index, const glm::vec3& position,
+                             const glm::vec3& normal, const glm::vec2& texCoord);
+
+    /**
+     * @brief 批量导入后一次性重建邻接表
+     *
+     * 两遍扫描（计数+散布），每个顶点的邻接表按确切度数分配，
+     * 去掉增量追加留下的翻倍增长浪费。
+     */
+    void finalize();
+
     /**
      * @brief 合并另一个网格
      */
     void merge(const Mesh& other);
+
+    /**
+     * @brief 合并另一个网格并焊接拼接缝上的重合顶点
+     *
+     * 等价于 merge() 后跟一次 weldVertices(weldEpsilon)：两网格
+     * 边界相接时可省掉成倍的顶点与后续法线计算量。
+     *
+     * @param weldEpsilon 判定重合的距离阈值，非正值则不焊接
+     */
+    void merge(const Mesh& other, float weldEpsilon);
     
     /**
      * @brief 分离网格
@@ -323,10 +710,23 @@ public:
      */
     void validate();
 
+    /**
+     * @brief 按位置焊接重合顶点
+     *
+     * 用边长为 epsilon 的空间哈希网格找候选点，每个顶点只和本格
+     * 及26个相邻格内已保留的顶点比较距离，复杂度 O(V)，适合在
+     * merge() 之后去掉拼接缝上的重复顶点。焊接后塌陷的退化面会
+     * 被丢弃。
+     *
+     * @param epsilon 判定重合的距离阈值
+     * @return 被合并掉的顶点数
+     */
+    int weldVertices(float epsilon);
+
     /**
      * @brief 获取/设置名称
      */
-    std::string getName() const;
+    const std::string& getName() const;
     void setName(const std::string& name);
 
     /**
@@ -375,15 +775,33 @@ public:
 
 private:
     void updateEdgeFaceConnections();
+    void rebuildAdjacency();
     void buildEdgeList();
 
     std::string name_;                              ///< 网格名称
-    std::vector<Vertex> vertices_;                  ///< 顶点列表
+
+    // 顶点属性按SoA（数组结构）存储：每个属性一个连续数组，
+    // 热点遍历只流式读取相关属性，而不是整个约100字节的顶点。
+    std::vector<glm::vec3> positions_;              ///< 顶点位置
+    std::vector<glm::vec3> normals_;                ///< 顶点法线
+    std::vector<glm::vec2> texCoords_;              ///< 顶点纹理坐标
+    std::vector<glm::vec3> tangents_;               ///< 顶点切线
+    std::vector<glm::vec3> bitangents_;             ///< 顶点副切线
+    std::vector<glm::vec4> colors_;                 ///< 顶点颜色
+
+    // 蒙皮表的map节点和骨骼数组都是小块分配，集中到网格自有的
+    // 内存池避免散落堆上；池经unique_ptr持有以保持Mesh可移动。
+    std::unique_ptr<std::pmr::unsynchronized_pool_resource> bonePool_; ///< 骨骼数据内存池
+    std::pmr::unordered_map<int, BoneData> vertexBones_; ///< 蒙皮顶点的骨骼数据
+
     std::vector<Face> faces_;                       ///< 面列表
     std::vector<Edge> edges_;                       ///< 边列表
 
-    std::unordered_map<int, std::vector<int>> vertexToEdges_; ///< 顶点到边的映射
-    std::unordered_map<int, std::vector<int>> vertexToFaces_; ///< 顶点到面的映射
+    // 顶点索引是[0..V)的稠密整数，邻接表直接按索引寻址，
+    // 避免哈希表的散列与指针追踪开销。
+    std::vector<std::vector<int>> vertexToEdges_; ///< 顶点到边的映射
+    std::vector<std::vector<int>> vertexToFaces_; ///< 顶点到面的映射
+    std::unordered_map<uint64_t, int> edgeIndex_;             ///< 顶点对到边索引的映射
 
     glm::vec3 minBounds_;  ///< 最小边界
     glm::vec3 maxBounds_;  ///< 最大边界
@@ -392,7 +810,16 @@ private:
 
     int materialId_;       ///< 材质ID
     bool smoothShading_;   ///< 平滑着色标志
-    bool needsUpdate_;     ///< 需要更新标志
+
+    // 写时按派生数据分别失效：仅改拓扑不会让包围盒缓存失效，
+    // UV或材质修改不触发任何重算。
+    bool boundsDirty_;     ///< 包围盒需要重算
+    bool normalsDirty_;    ///< 顶点法线需要重算
+    bool tangentsDirty_;   ///< 切线/副切线需要重算
+
+    // 纯三角形标志：addFace遇到非三角面即置假，clear复位。
+    // 翻转类遍历据此走无分支的swap(v0,v2)快路径。
+    bool allTriangles_;    ///< 所有面均为三角形
 };
 
 }
@@ -1,10 +1,303 @@
 #include "mesh_builder.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace v3d {
 namespace modeling {
 
+namespace {
+
+// 环/段方向的角度每一行都在重复使用，预先算好一张(sin, cos)表，
+// 嵌套循环内只做查表：三角函数调用从 O(rings*segments) 次降到
+// O(rings+segments) 次。
+struct SinCosTable {
+    std::vector<float> sin;
+    std::vector<float> cos;
+
+    // count+1 个等分角，angle = range * i / count。填表循环按角度
+    // 数据并行，标成 simd 让编译器在允许的编译选项下直接调用
+    // 向量版 sin/cos（如 libmvec 的8路 sincosf），一次算8对。
+    SinCosTable(int count, float range) : sin(count + 1), cos(count + 1) {
+        float* sinOut = sin.data();
+        float* cosOut = cos.data();
+        float step = range / count;
+#pragma omp simd
+        for (int i = 0; i <= count; ++i) {
+            float angle = step * i;
+            sinOut[i] = std::sin(angle);
+            cosOut[i] = std::cos(angle);
+        }
+    }
+};
+
+// 只有单层角度循环的生成器不值得建整张表：等距角度序列满足
+// 切比雪夫两项递推 c_{i+1} = 2cosΔ·c_i − c_{i-1}（sin 同形），
+// 初始化时各调一次 libm，之后每步只剩两次乘加。误差随步数
+// 线性累积，在常用的几千段以内远小于浮点可见精度。
+struct AngleStepper {
+    float cos;
+    float sin;
+
+    AngleStepper(int count, float range)
+        : cos(1.0f)
+        , sin(0.0f)
+        , prevCos_(std::cos(range / count))
+        , prevSin_(-std::sin(range / count))
+        , twoCosDelta_(2.0f * std::cos(range / count)) {
+    }
+
+    void advance() {
+        float nextCos = twoCosDelta_ * cos - prevCos_;
+        float nextSin = twoCosDelta_ * sin - prevSin_;
+        prevCos_ = cos;
+        prevSin_ = sin;
+        cos = nextCos;
+        sin = nextSin;
+    }
+
+private:
+    float prevCos_;
+    float prevSin_;
+    float twoCosDelta_;
+};
+
+// 两行网格顶点之间的三角条带，球/环面/胶囊的格面发射共用一份代码
+void emitGridRow(Mesh& mesh, int base, int ring, int cols, int quads) {
+    int first = base + ring * cols;
+    int second = first + cols;
+
+    for (int q = 0; q < quads; ++q, ++first, ++second) {
+        mesh.addTriangle(first, second, first + 1);
+        mesh.addTriangle(second, second + 1, first + 1);
+    }
+}
+
+// 圆心扇形：环上顶点按 stride 间隔排列；reverse 翻转绕向
+void emitCapFan(Mesh& mesh, int centerIndex, int firstRingIndex, int segments,
+                int stride, bool reverse) {
+    for (int i = 0; i < segments; ++i) {
+        int cur = firstRingIndex + i * stride;
+        int next = cur + stride;
+
+        if (reverse) {
+            mesh.addTriangle(centerIndex, cur, next);
+        } else {
+            mesh.addTriangle(centerIndex, next, cur);
+        }
+    }
+}
+
+// 上下两圈柱面顶点（径向解析法线），圆柱侧壁和胶囊柱段共用；
+// 角度表由调用方提供，和同一网格的其它环形段共享一次表构建
+void fillCylinderBand(Mesh& mesh, float radius, float yTop, float yBottom,
+                      int segments, int startIndex,
+                      const float* phiSin, const float* phiCos) {
+    float invSegments = 1.0f / segments;
+
+    for (int i = 0; i <= segments; ++i) {
+        float cosPhi = phiCos[i];
+        float sinPhi = phiSin[i];
+        float x = cosPhi * radius;
+        float z = sinPhi * radius;
+        glm::vec3 sideNormal(cosPhi, 0.0f, sinPhi);
+        float u = i * invSegments;
+
+        mesh.setVertexAttributes(startIndex + i * 2, glm::vec3(x, yTop, z),
+                                 sideNormal, glm::vec2(u, 1.0f));
+        mesh.setVertexAttributes(startIndex + i * 2 + 1, glm::vec3(x, yBottom, z),
+                                 sideNormal, glm::vec2(u, 0.0f));
+    }
+}
+
+// 柱面侧壁四边形；第 segments+1 对顶点是接缝复制点，索引不回绕
+void emitBandQuads(Mesh& mesh, int startIndex, int segments) {
+    for (int i = 0; i < segments; ++i) {
+        int v0 = startIndex + i * 2;
+        mesh.addQuad(v0, v0 + 2, v0 + 3, v0 + 1);
+    }
+}
+
+// 编译期可用的 sin/cos：先把角度归约到 [-π, π]，再用泰勒级数
+// 展开到足够阶数，double 中间精度下误差远小于 float 最低位。
+// 只在 consteval 上下文里使用，运行时路径仍然走 libm。
+constexpr double kPiD = 3.14159265358979323846;
+
+constexpr double taylorSin(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n <= 10; ++n) {
+        term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double taylorCos(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n <= 10; ++n) {
+        term *= -x * x / ((2.0 * n - 1.0) * (2.0 * n));
+        sum += term;
+    }
+    return sum;
+}
+
+// SinCosTable 的编译期版本：常用细分档位的角度表直接固化进
+// .rodata，热路径调用时一次三角函数都不用算。
+template <int Count>
+struct StaticSinCosTable {
+    std::array<float, Count + 1> sin{};
+    std::array<float, Count + 1> cos{};
+
+    constexpr StaticSinCosTable(double range) {
+        for (int i = 0; i <= Count; ++i) {
+            double angle = range * i / Count;
+            double reduced = angle > kPiD ? angle - 2.0 * kPiD : angle;
+            sin[i] = static_cast<float>(taylorSin(reduced));
+            cos[i] = static_cast<float>(taylorCos(reduced));
+        }
+    }
+};
+
+// 球/环面的网格装配体，角度表由调用方提供（运行时表或编译期表）；
+// 输出网格由调用方持有，重复构建时复用其数组容量
+void buildSphereGrid(Mesh& mesh, float radius, int segments, int rings,
+                     const float* thetaSin, const float* thetaCos,
+                     const float* phiSin, const float* phiCos) {
+    int cols = segments + 1;
+    mesh.resizeVertices((rings + 1) * cols);
+    mesh.reserveFaces(rings * segments * 2);
+
+    // UV 用倒数乘法代替逐顶点除法，除法延迟是乘法的三倍左右
+    float invSegments = 1.0f / segments;
+    float invRings = 1.0f / rings;
+
+    // 每个(ring, seg)只写自己的索引，互不重叠，行与行之间可以并行；
+    // 角度表在循环外建好，线程内只读。
+    auto fillRow = [&](int ring) {
+        float sinTheta = thetaSin[ring];
+        float cosTheta = thetaCos[ring];
+        float v = ring * invRings;
+
+        for (int seg = 0; seg <= segments; ++seg) {
+            float sinPhi = phiSin[seg];
+            float cosPhi = phiCos[seg];
+
+            // 球面方向向量的模恒为1（sin²θ(cos²φ+sin²φ)+cos²θ），
+            // 它本身就是法线，位置只需再乘半径，不必逐顶点 normalize。
+            glm::vec3 unit(sinTheta * cosPhi, cosTheta, sinTheta * sinPhi);
+
+            float u = seg * invSegments;
+
+            mesh.setVertexAttributes(ring * cols + seg, unit * radius, unit,
+                                     glm::vec2(u, v));
+        }
+    };
+
+    if (rings * segments > 4096) {
+#pragma omp parallel for schedule(static)
+        for (int ring = 0; ring <= rings; ++ring) {
+            fillRow(ring);
+        }
+
+        for (int ring = 0; ring < rings; ++ring) {
+            emitGridRow(mesh, 0, ring, cols, segments);
+        }
+    } else {
+        // 单线程小网格把两个遍历融合：写完一行顶点立刻发射上一行
+        // 的面，面几何读位置时两行顶点都还热在缓存里。
+        fillRow(0);
+        for (int ring = 1; ring <= rings; ++ring) {
+            fillRow(ring);
+            emitGridRow(mesh, 0, ring - 1, cols, segments);
+        }
+    }
+
+    // 环内已写入解析球面法线，recalculateAll只需补切线和包围盒
+    mesh.markNormalsClean();
+    mesh.recalculateAll();
+}
+
+void buildTorusGrid(Mesh& mesh, float majorRadius, float minorRadius,
+                    int majorSegments, int minorSegments,
+                    const float* uSin, const float* uCos,
+                    const float* vSin, const float* vCos) {
+    int cols = minorSegments + 1;
+    mesh.resizeVertices((majorSegments + 1) * cols);
+    mesh.reserveFaces(majorSegments * minorSegments * 2);
+
+    float invMajor = 1.0f / majorSegments;
+    float invMinor = 1.0f / minorSegments;
+
+    auto fillRow = [&](int i) {
+        float cosU = uCos[i];
+        float sinU = uSin[i];
+        float u = i * invMajor;
+
+        for (int j = 0; j <= minorSegments; ++j) {
+            float cosV = vCos[j];
+            float sinV = vSin[j];
+
+            glm::vec3 position(
+                (majorRadius + minorRadius * cosV) * cosU,
+                minorRadius * sinV,
+                (majorRadius + minorRadius * cosV) * sinU
+            );
+
+            // cos²v(cos²u+sin²u)+sin²v = 1，法线向量天然是单位长度
+            mesh.setVertexAttributes(i * cols + j, position,
+                                     glm::vec3(cosV * cosU, sinV, cosV * sinU),
+                                     glm::vec2(u, j * invMinor));
+        }
+    };
+
+    if (majorSegments * minorSegments > 4096) {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i <= majorSegments; ++i) {
+            fillRow(i);
+        }
+
+        for (int i = 0; i < majorSegments; ++i) {
+            emitGridRow(mesh, 0, i, cols, minorSegments);
+        }
+    } else {
+        fillRow(0);
+        for (int i = 1; i <= majorSegments; ++i) {
+            fillRow(i);
+            emitGridRow(mesh, 0, i - 1, cols, minorSegments);
+        }
+    }
+
+    mesh.markNormalsClean();
+    mesh.recalculateAll();
+}
+
+// 常用细分档位：角度表是编译期常量，不做任何运行时三角函数
+template <int Segs, int Rings>
+void buildSphereFixed(Mesh& mesh, float radius) {
+    static constexpr StaticSinCosTable<Rings> theta(kPiD);
+    static constexpr StaticSinCosTable<Segs> phi(2.0 * kPiD);
+    buildSphereGrid(mesh, radius, Segs, Rings,
+                    theta.sin.data(), theta.cos.data(),
+                    phi.sin.data(), phi.cos.data());
+}
+
+template <int MajorSegs, int MinorSegs>
+void buildTorusFixed(Mesh& mesh, float majorRadius, float minorRadius) {
+    static constexpr StaticSinCosTable<MajorSegs> uTable(2.0 * kPiD);
+    static constexpr StaticSinCosTable<MinorSegs> vTable(2.0 * kPiD);
+    buildTorusGrid(mesh, majorRadius, minorRadius, MajorSegs, MinorSegs,
+                   uTable.sin.data(), uTable.cos.data(),
+                   vTable.sin.data(), vTable.cos.data());
+}
+
+}
+
 MeshBuilder::MeshBuilder()
     : generateNormals_(true)
     , generateTangents_(true)
@@ -20,42 +313,38 @@ void MeshBuilder::clear() {
 Mesh MeshBuilder::createBox(const glm::vec3& size) {
     Mesh mesh;
 
-    glm::vec3 halfSize = size * 0.5f;
+    // 单位立方体的顶点和面在编译期就定死了，运行时只按半尺寸缩放，
+    // 不再逐顶点拼字面量。
+    static constexpr std::array<glm::vec3, 8> kUnitBox = {
+        glm::vec3(-1.0f, -1.0f, 1.0f), glm::vec3(1.0f, -1.0f, 1.0f),
+        glm::vec3(1.0f, 1.0f, 1.0f), glm::vec3(-1.0f, 1.0f, 1.0f),
+        glm::vec3(-1.0f, -1.0f, -1.0f), glm::vec3(1.0f, -1.0f, -1.0f),
+        glm::vec3(1.0f, 1.0f, -1.0f), glm::vec3(-1.0f, 1.0f, -1.0f),
+    };
+    static constexpr int kBoxQuads[6][4] = {
+        {3, 2, 1, 0}, {6, 7, 4, 5}, {7, 3, 0, 4},
+        {2, 6, 5, 1}, {7, 6, 2, 3}, {0, 1, 5, 4},
+    };
 
-    int v0 = mesh.addVertex(glm::vec3(-halfSize.x, -halfSize.y, halfSize.z));
-    int v1 = mesh.addVertex(glm::vec3(halfSize.x, -halfSize.y, halfSize.z));
-    int v2 = mesh.addVertex(glm::vec3(halfSize.x, halfSize.y, halfSize.z));
-    int v3 = mesh.addVertex(glm::vec3(-halfSize.x, halfSize.y, halfSize.z));
-    int v4 = mesh.addVertex(glm::vec3(-halfSize.x, -halfSize.y, -halfSize.z));
-    int v5 = mesh.addVertex(glm::vec3(halfSize.x, -halfSize.y, -halfSize.z));
-    int v6 = mesh.addVertex(glm::vec3(halfSize.x, halfSize.y, -halfSize.z));
-    int v7 = mesh.addVertex(glm::vec3(-halfSize.x, halfSize.y, -halfSize.z));
+    glm::vec3 halfSize = size * 0.5f;
 
-    mesh.addQuad(v3, v2, v1, v0);
-    mesh.addQuad(v6, v7, v4, v5);
-    mesh.addQuad(v7, v3, v0, v4);
-    mesh.addQuad(v2, v6, v5, v1);
-    mesh.addQuad(v7, v6, v2, v3);
-    mesh.addQuad(v0, v1, v5, v4);
+    mesh.reserveVertices(8);
+    mesh.reserveFaces(6);
 
-    if (generateNormals_) {
-        mesh.calculateNormals();
+    for (const auto& corner : kUnitBox) {
+        mesh.addVertex(corner * halfSize);
     }
 
-    if (generateTangents_) {
-        mesh.calculateTangents();
+    for (const auto& quad : kBoxQuads) {
+        mesh.addQuad(quad[0], quad[1], quad[2], quad[3]);
     }
 
     if (generateUVs_) {
-        auto& vertices = const_cast<std::vector<Vertex>&>(mesh.getVertices());
-        vertices[v0].texCoord = glm::vec2(0.0f, 0.0f);
-        vertices[v1].texCoord = glm::vec2(1.0f, 0.0f);
-        vertices[v2].texCoord = glm::vec2(1.0f, 1.0f);
-        vertices[v3].texCoord = glm::vec2(0.0f, 1.0f);
-        vertices[v4].texCoord = glm::vec2(0.0f, 0.0f);
-        vertices[v5].texCoord = glm::vec2(1.0f, 0.0f);
-        vertices[v6].texCoord = glm::vec2(1.0f, 1.0f);
-        vertices[v7].texCoord = glm::vec2(0.0f, 1.0f);
+        static const glm::vec2 kBoxUVs[8] = {
+            {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f},
+            {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f},
+        };
+        mesh.setTexCoords(kBoxUVs);
     }
 
     mesh.recalculateAll();
@@ -64,46 +353,37 @@ Mesh MeshBuilder::createBox(const glm::vec3& size) {
 
 Mesh MeshBuilder::createSphere(float radius, int segments, int rings) {
     Mesh mesh;
+    createSphereInto(mesh, radius, segments, rings);
+    return mesh;
+}
 
-    for (int ring = 0; ring <= rings; ++ring) {
-        float theta = glm::pi<float>() * ring / rings;
-        float sinTheta = std::sin(theta);
-        float cosTheta = std::cos(theta);
-
-        for (int seg = 0; seg <= segments; ++seg) {
-            float phi = 2.0f * glm::pi<float>() * seg / segments;
-            float sinPhi = std::sin(phi);
-            float cosPhi = std::cos(phi);
-
-            glm::vec3 position(
-                radius * sinTheta * cosPhi,
-                radius * cosTheta,
-                radius * sinTheta * sinPhi
-            );
-
-            Vertex vertex(position);
-            vertex.normal = glm::normalize(position);
-
-            float u = static_cast<float>(seg) / segments;
-            float v = static_cast<float>(ring) / rings;
-            vertex.texCoord = glm::vec2(u, v);
+void MeshBuilder::createSphereInto(Mesh& mesh, float radius, int segments, int rings) {
+    mesh.clear();
 
-            mesh.addVertex(vertex);
-        }
+    // 资产管线反复请求的几档细分直接命中编译期角度表
+    if (segments == 32 && rings == 16) {
+        buildSphereFixed<32, 16>(mesh, radius);
+        return;
     }
-
-    for (int ring = 0; ring < rings; ++ring) {
-        for (int seg = 0; seg < segments; ++seg) {
-            int first = ring * (segments + 1) + seg;
-            int second = first + segments + 1;
-
-            mesh.addTriangle(first, second, first + 1);
-            mesh.addTriangle(second, second + 1, first + 1);
-        }
+    if (segments == 64 && rings == 32) {
+        buildSphereFixed<64, 32>(mesh, radius);
+        return;
+    }
+    if (segments == 16 && rings == 8) {
+        buildSphereFixed<16, 8>(mesh, radius);
+        return;
+    }
+    if (segments == 128 && rings == 64) {
+        buildSphereFixed<128, 64>(mesh, radius);
+        return;
     }
 
-    mesh.recalculateAll();
-    return mesh;
+    SinCosTable thetaTable(rings, glm::pi<float>());
+    SinCosTable phiTable(segments, 2.0f * glm::pi<float>());
+
+    buildSphereGrid(mesh, radius, segments, rings,
+                    thetaTable.sin.data(), thetaTable.cos.data(),
+                    phiTable.sin.data(), phiTable.cos.data());
 }
 
 Mesh MeshBuilder::createCylinder(float radius, float height, int segments) {
@@ -111,40 +391,27 @@ Mesh MeshBuilder::createCylinder(float radius, float height, int segments) {
 
     float halfHeight = height * 0.5f;
 
-    for (int i = 0; i <= segments; ++i) {
-        float angle = 2.0f * glm::pi<float>() * i / segments;
-        float x = std::cos(angle) * radius;
-        float z = std::sin(angle) * radius;
-
-        int v0 = mesh.addVertex(glm::vec3(x, halfHeight, z));
-        int v1 = mesh.addVertex(glm::vec3(x, -halfHeight, z));
-
-        auto& vertices = const_cast<std::vector<Vertex>&>(mesh.getVertices());
-        vertices[v0].texCoord = glm::vec2(static_cast<float>(i) / segments, 1.0f);
-        vertices[v1].texCoord = glm::vec2(static_cast<float>(i) / segments, 0.0f);
-    }
+    // 侧壁和胶囊柱段走同一个填充/发射内核，角度表在这里只建一次
+    SinCosTable phiTable(segments, 2.0f * glm::pi<float>());
 
-    for (int i = 0; i < segments; ++i) {
-        int v0 = i * 2;
-        int v1 = v0 + 1;
-        int v2 = ((i + 1) % (segments + 1)) * 2;
-        int v3 = v2 + 1;
+    int centerTop = (segments + 1) * 2;
+    int centerBottom = centerTop + 1;
 
-        mesh.addQuad(v0, v2, v3, v1);
-    }
+    mesh.resizeVertices(centerBottom + 1);
+    mesh.reserveFaces(segments * 3);
 
-    int centerTop = mesh.addVertex(glm::vec3(0.0f, halfHeight, 0.0f));
-    int centerBottom = mesh.addVertex(glm::vec3(0.0f, -halfHeight, 0.0f));
+    fillCylinderBand(mesh, radius, halfHeight, -halfHeight, segments, 0,
+                     phiTable.sin.data(), phiTable.cos.data());
 
-    for (int i = 0; i < segments; ++i) {
-        int v0 = i * 2;
-        int v1 = ((i + 1) % (segments + 1)) * 2;
-        mesh.addTriangle(centerTop, v1, v0);
+    mesh.setVertexAttributes(centerTop, glm::vec3(0.0f, halfHeight, 0.0f),
+                             glm::vec3(0.0f, 1.0f, 0.0f), glm::vec2(0.0f, 0.0f));
+    mesh.setVertexAttributes(centerBottom, glm::vec3(0.0f, -halfHeight, 0.0f),
+                             glm::vec3(0.0f, -1.0f, 0.0f), glm::vec2(0.0f, 0.0f));
 
-        int v2 = i * 2 + 1;
-        int v3 = ((i + 1) % (segments + 1)) * 2 + 1;
-        mesh.addTriangle(centerBottom, v2, v3);
-    }
+    emitBandQuads(mesh, 0, segments);
+    // 盖面和侧壁共享边缘顶点，顶点法线仍靠面累加平均，不标记干净
+    emitCapFan(mesh, centerTop, 0, segments, 2, false);
+    emitCapFan(mesh, centerBottom, 1, segments, 2, true);
 
     mesh.recalculateAll();
     return mesh;
@@ -157,22 +424,19 @@ Mesh MeshBuilder::createCone(float radius, float height, int segments) {
 
     int tip = mesh.addVertex(glm::vec3(0.0f, halfHeight, 0.0f));
     int baseCenter = mesh.addVertex(glm::vec3(0.0f, -halfHeight, 0.0f));
+    int baseStart = 2;
+    AngleStepper angle(segments, 2.0f * glm::pi<float>());
 
-    std::vector<int> baseVertices;
-
-    for (int i = 0; i <= segments; ++i) {
-        float angle = 2.0f * glm::pi<float>() * i / segments;
-        float x = std::cos(angle) * radius;
-        float z = std::sin(angle) * radius;
+    mesh.reserveVertices(segments + 3);
+    mesh.reserveFaces(segments * 2);
 
-        int v = mesh.addVertex(glm::vec3(x, -halfHeight, z));
-        baseVertices.push_back(v);
+    for (int i = 0; i <= segments; ++i, angle.advance()) {
+        mesh.addVertex(glm::vec3(angle.cos * radius, -halfHeight, angle.sin * radius));
     }
 
-    for (int i = 0; i < segments; ++i) {
-        mesh.addTriangle(tip, baseVertices[i + 1], baseVertices[i]);
-        mesh.addTriangle(baseCenter, baseVertices[i], baseVertices[i + 1]);
-    }
+    // 侧面是以锥尖为圆心的扇形，底面是反向绕行的同一个扇形
+    emitCapFan(mesh, tip, baseStart, segments, 1, false);
+    emitCapFan(mesh, baseCenter, baseStart, segments, 1, true);
 
     mesh.recalculateAll();
     return mesh;
@@ -180,76 +444,111 @@ Mesh MeshBuilder::createCone(float radius, float height, int segments) {
 
 Mesh MeshBuilder::createTorus(float majorRadius, float minorRadius, int majorSegments, int minorSegments) {
     Mesh mesh;
+    createTorusInto(mesh, majorRadius, minorRadius, majorSegments, minorSegments);
+    return mesh;
+}
 
-    for (int i = 0; i <= majorSegments; ++i) {
-        float u = 2.0f * glm::pi<float>() * i / majorSegments;
-        float cosU = std::cos(u);
-        float sinU = std::sin(u);
-
-        for (int j = 0; j <= minorSegments; ++j) {
-            float v = 2.0f * glm::pi<float>() * j / minorSegments;
-            float cosV = std::cos(v);
-            float sinV = std::sin(v);
-
-            glm::vec3 position(
-                (majorRadius + minorRadius * cosV) * cosU,
-                minorRadius * sinV,
-                (majorRadius + minorRadius * cosV) * sinU
-            );
-
-            Vertex vertex(position);
-            vertex.normal = glm::normalize(glm::vec3(cosV * cosU, sinV, cosV * sinU));
-            vertex.texCoord = glm::vec2(static_cast<float>(i) / majorSegments, static_cast<float>(j) / minorSegments);
+void MeshBuilder::createTorusInto(Mesh& mesh, float majorRadius, float minorRadius, int majorSegments, int minorSegments) {
+    mesh.clear();
 
-            mesh.addVertex(vertex);
-        }
+    if (majorSegments == 32 && minorSegments == 16) {
+        buildTorusFixed<32, 16>(mesh, majorRadius, minorRadius);
+        return;
     }
-
-    for (int i = 0; i < majorSegments; ++i) {
-        for (int j = 0; j < minorSegments; ++j) {
-            int first = i * (minorSegments + 1) + j;
-            int second = first + minorSegments + 1;
-
-            mesh.addTriangle(first, second, first + 1);
-            mesh.addTriangle(second, second + 1, first + 1);
-        }
+    if (majorSegments == 64 && minorSegments == 32) {
+        buildTorusFixed<64, 32>(mesh, majorRadius, minorRadius);
+        return;
     }
 
-    mesh.recalculateAll();
-    return mesh;
+    SinCosTable uTable(majorSegments, 2.0f * glm::pi<float>());
+    SinCosTable vTable(minorSegments, 2.0f * glm::pi<float>());
+
+    buildTorusGrid(mesh, majorRadius, minorRadius, majorSegments, minorSegments,
+                   uTable.sin.data(), uTable.cos.data(),
+                   vTable.sin.data(), vTable.cos.data());
 }
 
 Mesh MeshBuilder::createPlane(const glm::vec2& size, int segmentsX, int segmentsY) {
     Mesh mesh;
+    createPlaneInto(mesh, size, segmentsX, segmentsY);
+    return mesh;
+}
 
-    glm::vec2 halfSize = size * 0.5f;
+void MeshBuilder::createPlaneInto(Mesh& mesh, const glm::vec2& size, int segmentsX, int segmentsY) {
+    mesh.clear();
+
+    int cols = segmentsX + 1;
+    mesh.resizeVertices(cols * (segmentsY + 1));
+    mesh.reserveFaces(segmentsX * segmentsY);
+
+    // x 方向的坐标和 u 值在每一行都完全相同，先用 AVX2 一次算 8 个
+    // 填进连续的行表，嵌套循环内只做查表；除法也只在广播常量时做一次。
+    std::vector<float> rowPx(segmentsX + 1);
+    std::vector<float> rowU(segmentsX + 1);
+#if defined(__AVX2__)
+    {
+        const __m256 lane = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f,
+                                           4.0f, 5.0f, 6.0f, 7.0f);
+        const __m256 invSx = _mm256_set1_ps(1.0f / segmentsX);
+        const __m256 sizeX = _mm256_set1_ps(size.x);
+        const __m256 half = _mm256_set1_ps(0.5f);
+
+        int x = 0;
+        for (; x + 8 <= segmentsX + 1; x += 8) {
+            __m256 xi = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), lane);
+            __m256 u = _mm256_mul_ps(xi, invSx);
+            __m256 px = _mm256_mul_ps(_mm256_sub_ps(u, half), sizeX);
+            _mm256_storeu_ps(&rowU[x], u);
+            _mm256_storeu_ps(&rowPx[x], px);
+        }
+        float invSxTail = 1.0f / segmentsX;
+        for (; x <= segmentsX; ++x) {
+            rowU[x] = x * invSxTail;
+            rowPx[x] = (rowU[x] - 0.5f) * size.x;
+        }
+    }
+#else
+    float invSx = 1.0f / segmentsX;
+    for (int x = 0; x <= segmentsX; ++x) {
+        rowU[x] = x * invSx;
+        rowPx[x] = (rowU[x] - 0.5f) * size.x;
+    }
+#endif
 
-    for (int y = 0; y <= segmentsY; ++y) {
-        for (int x = 0; x <= segmentsX; ++x) {
-            float px = (static_cast<float>(x) / segmentsX - 0.5f) * size.x;
-            float py = (static_cast<float>(y) / segmentsY - 0.5f) * size.y;
+    float invSy = 1.0f / segmentsY;
 
-            Vertex vertex(glm::vec3(px, 0.0f, py));
-            vertex.normal = glm::vec3(0.0f, 1.0f, 0.0f);
-            vertex.texCoord = glm::vec2(static_cast<float>(x) / segmentsX, static_cast<float>(y) / segmentsY);
+    // 直接按索引写属性数组，省掉逐顶点 addVertex 的六路 push_back
+    auto fillRow = [&](int y) {
+        float v = y * invSy;
+        float py = (v - 0.5f) * size.y;
+        int base = y * cols;
 
-            mesh.addVertex(vertex);
+        for (int x = 0; x <= segmentsX; ++x) {
+            mesh.setVertexAttributes(base + x, glm::vec3(rowPx[x], 0.0f, py),
+                                     glm::vec3(0.0f, 1.0f, 0.0f),
+                                     glm::vec2(rowU[x], v));
         }
-    }
+    };
 
-    for (int y = 0; y < segmentsY; ++y) {
-        for (int x = 0; x < segmentsX; ++x) {
-            int v0 = y * (segmentsX + 1) + x;
-            int v1 = v0 + 1;
-            int v2 = (y + 1) * (segmentsX + 1) + x;
-            int v3 = v2 + 1;
+    // 索引模板是纯步进模式：行基址每行算一次，列内只做递增
+    auto emitRow = [&](int y) {
+        int v0 = y * cols;
+        int v2 = v0 + cols;
 
-            mesh.addQuad(v0, v2, v3, v1);
+        for (int x = 0; x < segmentsX; ++x, ++v0, ++v2) {
+            mesh.addQuad(v0, v2, v2 + 1, v0 + 1);
         }
+    };
+
+    // 顶点行和面行交替推进，发射面时两行顶点还在缓存里
+    fillRow(0);
+    for (int y = 1; y <= segmentsY; ++y) {
+        fillRow(y);
+        emitRow(y - 1);
     }
 
+    mesh.markNormalsClean();
     mesh.recalculateAll();
-    return mesh;
 }
 
 Mesh MeshBuilder::createGrid(const glm::vec2& size, int divisionsX, int divisionsY) {
@@ -259,19 +558,20 @@ Mesh MeshBuilder::createGrid(const glm::vec2& size, int divisionsX, int division
 Mesh MeshBuilder::createCircle(float radius, int segments) {
     Mesh mesh;
 
+    mesh.reserveVertices(segments + 2);
+    mesh.reserveFaces(segments);
+
     int center = mesh.addVertex(glm::vec3(0.0f, 0.0f, 0.0f));
+    AngleStepper angle(segments, 2.0f * glm::pi<float>());
 
-    for (int i = 0; i <= segments; ++i) {
-        float angle = 2.0f * glm::pi<float>() * i / segments;
-        float x = std::cos(angle) * radius;
-        float z = std::sin(angle) * radius;
+    for (int i = 0; i <= segments; ++i, angle.advance()) {
+        float x = angle.cos * radius;
+        float z = angle.sin * radius;
 
         mesh.addVertex(glm::vec3(x, 0.0f, z));
     }
 
-    for (int i = 0; i < segments; ++i) {
-        mesh.addTriangle(center, i + 1, i + 2);
-    }
+    emitCapFan(mesh, center, center + 1, segments, 1, true);
 
     mesh.recalculateAll();
     return mesh;
@@ -279,11 +579,21 @@ Mesh MeshBuilder::createCircle(float radius, int segments) {
 
 Mesh MeshBuilder::createRing(float innerRadius, float outerRadius, int segments) {
     Mesh mesh;
+    createRingInto(mesh, innerRadius, outerRadius, segments);
+    return mesh;
+}
 
-    for (int i = 0; i <= segments; ++i) {
-        float angle = 2.0f * glm::pi<float>() * i / segments;
-        float cosAngle = std::cos(angle);
-        float sinAngle = std::sin(angle);
+void MeshBuilder::createRingInto(Mesh& mesh, float innerRadius, float outerRadius, int segments) {
+    mesh.clear();
+
+    AngleStepper angle(segments, 2.0f * glm::pi<float>());
+
+    mesh.reserveVertices((segments + 1) * 2);
+    mesh.reserveFaces(segments);
+
+    for (int i = 0; i <= segments; ++i, angle.advance()) {
+        float cosAngle = angle.cos;
+        float sinAngle = angle.sin;
 
         glm::vec3 innerPos(innerRadius * cosAngle, 0.0f, innerRadius * sinAngle);
         glm::vec3 outerPos(outerRadius * cosAngle, 0.0f, outerRadius * sinAngle);
@@ -292,17 +602,9 @@ Mesh MeshBuilder::createRing(float innerRadius, float outerRadius, int segments)
         mesh.addVertex(outerPos);
     }
 
-    for (int i = 0; i < segments; ++i) {
-        int v0 = i * 2;
-        int v1 = v0 + 1;
-        int v2 = ((i + 1) % (segments + 1)) * 2;
-        int v3 = v2 + 1;
-
-        mesh.addQuad(v0, v2, v3, v1);
-    }
+    emitBandQuads(mesh, 0, segments);
 
     mesh.recalculateAll();
-    return mesh;
 }
 
 Mesh MeshBuilder::createCapsule(float radius, float height, int segments, int rings) {
@@ -311,100 +613,80 @@ Mesh MeshBuilder::createCapsule(float radius, float height, int segments, int ri
     float cylinderHeight = height - 2.0f * radius;
     float halfCylinderHeight = cylinderHeight * 0.5f;
 
-    for (int ring = 0; ring <= rings; ++ring) {
-        float theta = glm::pi<float>() * ring / rings;
-        float sinTheta = std::sin(theta);
-        float cosTheta = std::cos(theta);
+    // 两个半球和中段柱面共享同一组角度表
+    SinCosTable thetaTable(rings, glm::pi<float>());
+    SinCosTable phiTable(segments, 2.0f * glm::pi<float>());
 
-        for (int seg = 0; seg <= segments; ++seg) {
-            float phi = 2.0f * glm::pi<float>() * seg / segments;
-            float sinPhi = std::sin(phi);
-            float cosPhi = std::cos(phi);
+    int cols = segments + 1;
+    int hemisphereVerts = (rings + 1) * cols;
+    int cylinderStart = hemisphereVerts;
+    int bottomSphereStart = cylinderStart + cols * 2;
+    float invSegments = 1.0f / segments;
+    float invRings = 1.0f / rings;
 
-            glm::vec3 position(
-                radius * sinTheta * cosPhi,
-                halfCylinderHeight + radius * cosTheta,
-                radius * sinTheta * sinPhi
-            );
+    mesh.resizeVertices(bottomSphereStart + hemisphereVerts);
+    mesh.reserveFaces(rings * segments * 4 + segments);
 
-            Vertex vertex(position);
-            vertex.normal = glm::normalize(position - glm::vec3(0.0f, halfCylinderHeight, 0.0f));
-            vertex.texCoord = glm::vec2(static_cast<float>(seg) / segments, static_cast<float>(ring) / rings);
+    auto fillHemiRow = [&](int ring, int base, float ySign) {
+        float sinTheta = thetaTable.sin[ring];
+        float cosTheta = thetaTable.cos[ring];
+        float v = ring * invRings;
 
-            mesh.addVertex(vertex);
-        }
-    }
+        for (int seg = 0; seg <= segments; ++seg) {
+            float sinPhi = phiTable.sin[seg];
+            float cosPhi = phiTable.cos[seg];
 
-    for (int ring = 0; ring < rings; ++ring) {
-        for (int seg = 0; seg < segments; ++seg) {
-            int first = ring * (segments + 1) + seg;
-            int second = first + segments + 1;
+            // 相对球心的方向向量模恒为1，直接作法线，省掉逐顶点 normalize
+            glm::vec3 unit(sinTheta * cosPhi, ySign * cosTheta, sinTheta * sinPhi);
+            glm::vec3 position = unit * radius
+                               + glm::vec3(0.0f, ySign * halfCylinderHeight, 0.0f);
 
-            mesh.addTriangle(first, second, first + 1);
-            mesh.addTriangle(second, second + 1, first + 1);
+            mesh.setVertexAttributes(base + ring * cols + seg, position, unit,
+                                     glm::vec2(seg * invSegments, v));
         }
-    }
-
-    int cylinderStart = mesh.getVertexCount();
-
-    for (int i = 0; i <= segments; ++i) {
-        float angle = 2.0f * glm::pi<float>() * i / segments;
-        float x = std::cos(angle) * radius;
-        float z = std::sin(angle) * radius;
-
-        int v0 = mesh.addVertex(glm::vec3(x, halfCylinderHeight, z));
-        int v1 = mesh.addVertex(glm::vec3(x, -halfCylinderHeight, z));
-
-        auto& vertices = const_cast<std::vector<Vertex>&>(mesh.getVertices());
-        vertices[v0].texCoord = glm::vec2(static_cast<float>(i) / segments, 1.0f);
-        vertices[v1].texCoord = glm::vec2(static_cast<float>(i) / segments, 0.0f);
-    }
-
-    for (int i = 0; i < segments; ++i) {
-        int v0 = cylinderStart + i * 2;
-        int v1 = v0 + 1;
-        int v2 = cylinderStart + ((i + 1) % (segments + 1)) * 2;
-        int v3 = v2 + 1;
-
-        mesh.addQuad(v0, v2, v3, v1);
-    }
-
-    int bottomSphereStart = mesh.getVertexCount();
-
-    for (int ring = 0; ring <= rings; ++ring) {
-        float theta = glm::pi<float>() * ring / rings;
-        float sinTheta = std::sin(theta);
-        float cosTheta = std::cos(theta);
+    };
 
-        for (int seg = 0; seg <= segments; ++seg) {
-            float phi = 2.0f * glm::pi<float>() * seg / segments;
-            float sinPhi = std::sin(phi);
-            float cosPhi = std::cos(phi);
+    if (rings * segments > 4096) {
+#pragma omp parallel for schedule(static)
+        for (int ring = 0; ring <= rings; ++ring) {
+            fillHemiRow(ring, 0, 1.0f);
+            fillHemiRow(ring, bottomSphereStart, -1.0f);
+        }
 
-            glm::vec3 position(
-                radius * sinTheta * cosPhi,
-                -halfCylinderHeight - radius * cosTheta,
-                radius * sinTheta * sinPhi
-            );
+        for (int ring = 0; ring < rings; ++ring) {
+            emitGridRow(mesh, 0, ring, cols, segments);
+        }
 
-            Vertex vertex(position);
-            vertex.normal = glm::normalize(position - glm::vec3(0.0f, -halfCylinderHeight, 0.0f));
-            vertex.texCoord = glm::vec2(static_cast<float>(seg) / segments, static_cast<float>(ring) / rings);
+        fillCylinderBand(mesh, radius, halfCylinderHeight, -halfCylinderHeight,
+                         segments, cylinderStart,
+                         phiTable.sin.data(), phiTable.cos.data());
+        emitBandQuads(mesh, cylinderStart, segments);
 
-            mesh.addVertex(vertex);
+        for (int ring = 0; ring < rings; ++ring) {
+            emitGridRow(mesh, bottomSphereStart, ring, cols, segments);
+        }
+    } else {
+        // 小网格单线程走融合路径：每写完一行顶点立即发射上一行的面
+        fillHemiRow(0, 0, 1.0f);
+        for (int ring = 1; ring <= rings; ++ring) {
+            fillHemiRow(ring, 0, 1.0f);
+            emitGridRow(mesh, 0, ring - 1, cols, segments);
         }
-    }
 
-    for (int ring = 0; ring < rings; ++ring) {
-        for (int seg = 0; seg < segments; ++seg) {
-            int first = bottomSphereStart + ring * (segments + 1) + seg;
-            int second = first + segments + 1;
+        fillCylinderBand(mesh, radius, halfCylinderHeight, -halfCylinderHeight,
+                         segments, cylinderStart,
+                         phiTable.sin.data(), phiTable.cos.data());
+        emitBandQuads(mesh, cylinderStart, segments);
 
-            mesh.addTriangle(first, second, first + 1);
-            mesh.addTriangle(second, second + 1, first + 1);
+        fillHemiRow(0, bottomSphereStart, -1.0f);
+        for (int ring = 1; ring <= rings; ++ring) {
+            fillHemiRow(ring, bottomSphereStart, -1.0f);
+            emitGridRow(mesh, bottomSphereStart, ring - 1, cols, segments);
         }
     }
 
+    // 半球与柱面段的法线都是解析值（径向/球向），无需再累加
+    mesh.markNormalsClean();
     mesh.recalculateAll();
     return mesh;
 }
@@ -412,26 +694,34 @@ Mesh MeshBuilder::createCapsule(float radius, float height, int segments, int ri
 Mesh MeshBuilder::createIcosahedron(float radius) {
     Mesh mesh;
 
-    float t = (1.0f + std::sqrt(5.0f)) / 2.0f;
-
-    std::vector<glm::vec3> positions = {
-        glm::vec3(-1, t, 0), glm::vec3(1, t, 0), glm::vec3(-1, -t, 0), glm::vec3(1, -t, 0),
-        glm::vec3(0, -1, t), glm::vec3(0, 1, t), glm::vec3(0, -1, -t), glm::vec3(0, 1, -t),
-        glm::vec3(t, 0, -1), glm::vec3(t, 0, 1), glm::vec3(-t, 0, -1), glm::vec3(-t, 0, 1)
+    // 顶点表在编译期就按 1/sqrt(1+t²)、t/sqrt(1+t²)（t 为黄金比）
+    // 归一化成单位向量，运行时只乘半径；面表同样是静态数据，
+    // 不再每次调用都堆分配一个 vector<vector<int>>。
+    constexpr float a = 0.52573111f;
+    constexpr float b = 0.85065081f;
+    static constexpr std::array<glm::vec3, 12> kIcosahedronVerts = {
+        glm::vec3(-a, b, 0.0f), glm::vec3(a, b, 0.0f),
+        glm::vec3(-a, -b, 0.0f), glm::vec3(a, -b, 0.0f),
+        glm::vec3(0.0f, -a, b), glm::vec3(0.0f, a, b),
+        glm::vec3(0.0f, -a, -b), glm::vec3(0.0f, a, -b),
+        glm::vec3(b, 0.0f, -a), glm::vec3(b, 0.0f, a),
+        glm::vec3(-b, 0.0f, -a), glm::vec3(-b, 0.0f, a),
     };
-
-    for (const auto& pos : positions) {
-        mesh.addVertex(glm::normalize(pos) * radius);
-    }
-
-    std::vector<std::vector<int>> faces = {
+    static constexpr int kIcosahedronFaces[20][3] = {
         {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
         {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
         {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
-        {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}
+        {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1},
     };
 
-    for (const auto& face : faces) {
+    mesh.reserveVertices(12);
+    mesh.reserveFaces(20);
+
+    for (const auto& pos : kIcosahedronVerts) {
+        mesh.addVertex(pos * radius);
+    }
+
+    for (const auto& face : kIcosahedronFaces) {
         mesh.addTriangle(face[0], face[1], face[2]);
     }
 
@@ -442,19 +732,28 @@ Mesh MeshBuilder::createIcosahedron(float radius) {
 Mesh MeshBuilder::createDodecahedron(float radius) {
     Mesh mesh;
 
-    float phi = (1.0f + std::sqrt(5.0f)) / 2.0f;
-    float invPhi = 1.0f / phi;
-
-    std::vector<glm::vec3> positions = {
-        glm::vec3(1, 1, 1), glm::vec3(1, 1, -1), glm::vec3(1, -1, 1), glm::vec3(1, -1, -1),
-        glm::vec3(-1, 1, 1), glm::vec3(-1, 1, -1), glm::vec3(-1, -1, 1), glm::vec3(-1, -1, -1),
-        glm::vec3(0, invPhi, phi), glm::vec3(0, invPhi, -phi), glm::vec3(0, -invPhi, phi), glm::vec3(0, -invPhi, -phi),
-        glm::vec3(invPhi, phi, 0), glm::vec3(invPhi, -phi, 0), glm::vec3(-invPhi, phi, 0), glm::vec3(-invPhi, -phi, 0),
-        glm::vec3(phi, 0, invPhi), glm::vec3(phi, 0, -invPhi), glm::vec3(-phi, 0, invPhi), glm::vec3(-phi, 0, -invPhi)
+    // 20个顶点到原点的距离都是 sqrt(3)（φ²+1/φ²=3），表在编译期
+    // 就除好了：c=1/sqrt(3)，p=φ/sqrt(3)，q=1/(φ·sqrt(3))。
+    constexpr float c = 0.57735027f;
+    constexpr float p = 0.93417236f;
+    constexpr float q = 0.35682209f;
+    static constexpr std::array<glm::vec3, 20> kDodecahedronVerts = {
+        glm::vec3(c, c, c), glm::vec3(c, c, -c),
+        glm::vec3(c, -c, c), glm::vec3(c, -c, -c),
+        glm::vec3(-c, c, c), glm::vec3(-c, c, -c),
+        glm::vec3(-c, -c, c), glm::vec3(-c, -c, -c),
+        glm::vec3(0.0f, q, p), glm::vec3(0.0f, q, -p),
+        glm::vec3(0.0f, -q, p), glm::vec3(0.0f, -q, -p),
+        glm::vec3(q, p, 0.0f), glm::vec3(q, -p, 0.0f),
+        glm::vec3(-q, p, 0.0f), glm::vec3(-q, -p, 0.0f),
+        glm::vec3(p, 0.0f, q), glm::vec3(p, 0.0f, -q),
+        glm::vec3(-p, 0.0f, q), glm::vec3(-p, 0.0f, -q),
     };
 
-    for (const auto& pos : positions) {
-        mesh.addVertex(glm::normalize(pos) * radius);
+    mesh.reserveVertices(20);
+
+    for (const auto& pos : kDodecahedronVerts) {
+        mesh.addVertex(pos * radius);
     }
 
     mesh.recalculateAll();
@@ -464,22 +763,24 @@ Mesh MeshBuilder::createDodecahedron(float radius) {
 Mesh MeshBuilder::createOctahedron(float radius) {
     Mesh mesh;
 
-    std::vector<glm::vec3> positions = {
-        glm::vec3(1, 0, 0), glm::vec3(-1, 0, 0),
-        glm::vec3(0, 1, 0), glm::vec3(0, -1, 0),
-        glm::vec3(0, 0, 1), glm::vec3(0, 0, -1)
+    mesh.reserveVertices(6);
+    mesh.reserveFaces(8);
+
+    static constexpr std::array<glm::vec3, 6> kOctahedronVerts = {
+        glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f),
+        glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+        glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+    };
+    static constexpr int kOctahedronFaces[8][3] = {
+        {0, 2, 4}, {0, 4, 3}, {0, 3, 5}, {0, 5, 2},
+        {1, 4, 2}, {1, 3, 4}, {1, 5, 3}, {1, 2, 5},
     };
 
-    for (const auto& pos : positions) {
+    for (const auto& pos : kOctahedronVerts) {
         mesh.addVertex(pos * radius);
     }
 
-    std::vector<std::vector<int>> faces = {
-        {0, 2, 4}, {0, 4, 3}, {0, 3, 5}, {0, 5, 2},
-        {1, 4, 2}, {1, 3, 4}, {1, 5, 3}, {1, 2, 5}
-    };
-
-    for (const auto& face : faces) {
+    for (const auto& face : kOctahedronFaces) {
         mesh.addTriangle(face[0], face[1], face[2]);
     }
 
@@ -490,16 +791,19 @@ Mesh MeshBuilder::createOctahedron(float radius) {
 Mesh MeshBuilder::createTetrahedron(float radius) {
     Mesh mesh;
 
-    float a = 1.0f / std::sqrt(3.0f);
-
-    std::vector<glm::vec3> positions = {
+    // a = 1/sqrt(3)，表在编译期已归一化
+    constexpr float a = 0.57735027f;
+    static constexpr std::array<glm::vec3, 4> kTetrahedronVerts = {
         glm::vec3(a, a, a),
         glm::vec3(-a, -a, a),
         glm::vec3(-a, a, -a),
-        glm::vec3(a, -a, -a)
+        glm::vec3(a, -a, -a),
     };
 
-    for (const auto& pos : positions) {
+    mesh.reserveVertices(4);
+    mesh.reserveFaces(4);
+
+    for (const auto& pos : kTetrahedronVerts) {
         mesh.addVertex(pos * radius);
     }
 
@@ -521,27 +825,37 @@ Mesh MeshBuilder::createExtrusion(const std::vector<glm::vec2>& profile, float d
 
     float halfDepth = depth * 0.5f;
 
-    for (int seg = 0; seg <= segments; ++seg) {
-        float z = (static_cast<float>(seg) / segments - 0.5f) * depth;
+    mesh.reserveVertices((segments + 1) * static_cast<int>(profile.size()));
+    mesh.reserveFaces(segments * static_cast<int>(profile.size()));
+
+    int profileSize = static_cast<int>(profile.size());
+    float invSegments = 1.0f / segments;
+
+    auto fillRow = [&](int seg) {
+        float z = (seg * invSegments - 0.5f) * depth;
 
         for (const auto& point : profile) {
-            Vertex vertex(glm::vec3(point.x, point.y, z));
-            vertex.texCoord = glm::vec2(point.x, point.y);
-            mesh.addVertex(vertex);
+            mesh.addVertex(glm::vec3(point.x, point.y, z),
+                           glm::vec3(0.0f, 0.0f, 1.0f),
+                           glm::vec2(point.x, point.y));
         }
-    }
+    };
 
-    int profileSize = static_cast<int>(profile.size());
+    auto emitRow = [&](int seg) {
+        int rowBase = seg * profileSize;
 
-    for (int seg = 0; seg < segments; ++seg) {
         for (int i = 0; i < profileSize; ++i) {
-            int v0 = seg * profileSize + i;
-            int v1 = v0 + profileSize;
-            int v2 = ((i + 1) % profileSize) + seg * profileSize;
-            int v3 = v2 + profileSize;
+            int v0 = rowBase + i;
+            int v2 = rowBase + (i + 1) % profileSize;
 
-            mesh.addQuad(v0, v2, v3, v1);
+            mesh.addQuad(v0, v2, v2 + profileSize, v0 + profileSize);
         }
+    };
+
+    fillRow(0);
+    for (int seg = 1; seg <= segments; ++seg) {
+        fillRow(seg);
+        emitRow(seg - 1);
     }
 
     mesh.recalculateAll();
@@ -556,37 +870,55 @@ Mesh MeshBuilder::createLathe(const std::vector<glm::vec2>& profile, int segment
     }
 
     float angleRad = glm::radians(angle);
+    SinCosTable thetaTable(segments, angleRad);
 
-    for (int seg = 0; seg <= segments; ++seg) {
-        float theta = angleRad * seg / segments;
-        float cosTheta = std::cos(theta);
-        float sinTheta = std::sin(theta);
+    int profileSize = static_cast<int>(profile.size());
 
-        for (const auto& point : profile) {
-            glm::vec3 position(
-                point.x * cosTheta,
-                point.y,
-                point.x * sinTheta
-            );
+    mesh.resizeVertices((segments + 1) * profileSize);
+    mesh.reserveFaces(segments * (profileSize - 1));
+
+    float invSegments = 1.0f / segments;
 
-            Vertex vertex(position);
-            vertex.normal = glm::normalize(glm::vec3(cosTheta, 0.0f, sinTheta));
-            vertex.texCoord = glm::vec2(static_cast<float>(seg) / segments, point.y);
+    auto fillRow = [&](int seg) {
+        float cosTheta = thetaTable.cos[seg];
+        float sinTheta = thetaTable.sin[seg];
+        // (cosθ, 0, sinθ) 本身就是单位向量
+        glm::vec3 normal(cosTheta, 0.0f, sinTheta);
+        float u = seg * invSegments;
+        int base = seg * profileSize;
+
+        for (int i = 0; i < profileSize; ++i) {
+            const glm::vec2& point = profile[i];
 
-            mesh.addVertex(vertex);
+            mesh.setVertexAttributes(base + i,
+                                     glm::vec3(point.x * cosTheta, point.y,
+                                               point.x * sinTheta),
+                                     normal, glm::vec2(u, point.y));
         }
-    }
+    };
 
-    int profileSize = static_cast<int>(profile.size());
+    auto emitRow = [&](int seg) {
+        int v0 = seg * profileSize;
+
+        for (int i = 0; i < profileSize - 1; ++i, ++v0) {
+            mesh.addQuad(v0, v0 + 1, v0 + profileSize + 1, v0 + profileSize);
+        }
+    };
 
-    for (int seg = 0; seg < segments; ++seg) {
-        for (int i = 0; i < profileSize - 1; ++i) {
-            int v0 = seg * profileSize + i;
-            int v1 = v0 + profileSize;
-            int v2 = seg * profileSize + i + 1;
-            int v3 = v2 + profileSize;
+    if (segments * profileSize > 4096) {
+#pragma omp parallel for schedule(static)
+        for (int seg = 0; seg <= segments; ++seg) {
+            fillRow(seg);
+        }
 
-            mesh.addQuad(v0, v2, v3, v1);
+        for (int seg = 0; seg < segments; ++seg) {
+            emitRow(seg);
+        }
+    } else {
+        fillRow(0);
+        for (int seg = 1; seg <= segments; ++seg) {
+            fillRow(seg);
+            emitRow(seg - 1);
         }
     }
 
@@ -601,6 +933,55 @@ Mesh MeshBuilder::createRevolution(const std::vector<glm::vec2>& profile, int se
 Mesh MeshBuilder::createText(const std::string& text, float size, float depth) {
     Mesh mesh;
 
+    if (text.empty()) {
+        return mesh;
+    }
+
+    // 字形轮廓三角化尚未接入：规划是把贝塞尔控制点整批上传，由计算
+    // 着色器按字形分组细分（或 Loop-Blinn 片元内测），而不是在CPU上
+    // 逐轮廓耳切。在此之前先返回等宽占位方块——调用方拿到的不再是
+    // 静默空网格，排版宽度和包围盒可用，忘记走缓存的误用也能及早暴露。
+    Mesh glyph = createBox(glm::vec3(size * 0.6f, size, depth));
+    const std::vector<glm::vec3>& glyphPositions = glyph.getPositions();
+
+    int glyphCount = 0;
+    for (char c : text) {
+        if (c != ' ' && c != '\t' && c != '\n') {
+            ++glyphCount;
+        }
+    }
+    mesh.reserveVertices(glyphCount * glyph.getVertexCount());
+    mesh.reserveFaces(glyphCount * glyph.getFaceCount());
+
+    float advance = size * 0.7f;
+    float penX = 0.0f;
+
+    for (char c : text) {
+        if (c == ' ' || c == '\t' || c == '\n') {
+            penX += advance;
+            continue;
+        }
+
+        int base = mesh.appendVertices(glyph);
+        glm::vec3 offset(penX + size * 0.3f, size * 0.5f, 0.0f);
+
+        for (size_t j = 0; j < glyphPositions.size(); ++j) {
+            mesh.setPosition(base + static_cast<int>(j), glyphPositions[j] + offset);
+        }
+
+        for (const Face& face : glyph.getFaces()) {
+            std::vector<int> indices;
+            indices.reserve(face.vertices.size());
+            for (int vertexIndex : face.vertices) {
+                indices.push_back(base + vertexIndex);
+            }
+            mesh.addFace(indices);
+        }
+
+        penX += advance;
+    }
+
+    mesh.recalculateAll();
     return mesh;
 }
 
@@ -24,6 +24,13 @@ public:
     Mesh createRing(float innerRadius = 0.5f, float outerRadius = 1.0f, int segments = 32);
     Mesh createCapsule(float radius = 1.0f, float height = 2.0f, int segments = 32, int rings = 8);
 
+    // 逐帧重建（LOD切换、编辑器拖参数）用的就地版本：复用 out 里已有
+    // 的数组容量，稳态下整次重建零分配；返回值版本是其薄封装。
+    void createSphereInto(Mesh& out, float radius = 1.0f, int segments = 32, int rings = 16);
+    void createTorusInto(Mesh& out, float majorRadius = 1.0f, float minorRadius = 0.3f, int majorSegments = 32, int minorSegments = 16);
+    void createPlaneInto(Mesh& out, const glm::vec2& size = glm::vec2(1.0f), int segmentsX = 1, int segmentsY = 1);
+    void createRingInto(Mesh& out, float innerRadius = 0.5f, float outerRadius = 1.0f, int segments = 32);
+
     Mesh createIcosahedron(float radius = 1.0f);
     Mesh createDodecahedron(float radius = 1.0f);
     Mesh createOctahedron(float radius = 1.0f);
@@ -33,6 +40,8 @@ public:
     Mesh createLathe(const std::vector<glm::vec2>& profile, int segments = 32, float angle = 360.0f);
     Mesh createRevolution(const std::vector<glm::vec2>& profile, int segments = 32);
 
+    // 文本是唯一不该逐帧调用的生成器：字形三角化的开销远高于基本体，
+    // 调用方必须经 {字体, 字符串, 字号} 为键的缓存复用结果。
     Mesh createText(const std::string& text, float size = 1.0f, float depth = 0.2f);
 
     void setGenerateNormals(bool generate);
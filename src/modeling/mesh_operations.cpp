@@ -1,22 +1,179 @@
 #include "mesh_operations.h"
 #include <algorithm>
-#include <unordered_set>
-#include <random>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace v3d {
 namespace modeling {
 
+#if defined(__AVX2__)
+namespace {
+
+// 与 mesh.cpp 的 normalizeVec3Stream 同一套通道收集方案：把交错 xyz
+// 流里连续 8 个向量解成 x/y/z 各一个寄存器，逐通道算完再交错写回。
+// 投影/锥化这类逐顶点仿射变换在通道布局下全部退化成乘加。
+struct Vec3x8 {
+    __m256 x;
+    __m256 y;
+    __m256 z;
+};
+
+inline Vec3x8 loadVec3x8(const float* data) {
+    const __m256i gatherXA = _mm256_setr_epi32(0, 3, 6, 0, 0, 0, 0, 0);
+    const __m256i gatherXB = _mm256_setr_epi32(0, 0, 0, 1, 4, 7, 0, 0);
+    const __m256i gatherXC = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 2, 5);
+    const __m256i gatherYA = _mm256_setr_epi32(1, 4, 7, 0, 0, 0, 0, 0);
+    const __m256i gatherYB = _mm256_setr_epi32(0, 0, 0, 2, 5, 0, 0, 0);
+    const __m256i gatherYC = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 3, 6);
+    const __m256i gatherZA = _mm256_setr_epi32(2, 5, 0, 0, 0, 0, 0, 0);
+    const __m256i gatherZB = _mm256_setr_epi32(0, 0, 0, 3, 6, 0, 0, 0);
+    const __m256i gatherZC = _mm256_setr_epi32(0, 0, 0, 0, 0, 1, 4, 7);
+
+    __m256 a = _mm256_loadu_ps(data);
+    __m256 b = _mm256_loadu_ps(data + 8);
+    __m256 c = _mm256_loadu_ps(data + 16);
+
+    Vec3x8 v;
+    v.x = _mm256_blend_ps(
+        _mm256_blend_ps(_mm256_permutevar8x32_ps(a, gatherXA),
+                        _mm256_permutevar8x32_ps(b, gatherXB), 0x38),
+        _mm256_permutevar8x32_ps(c, gatherXC), 0xC0);
+    v.y = _mm256_blend_ps(
+        _mm256_blend_ps(_mm256_permutevar8x32_ps(a, gatherYA),
+                        _mm256_permutevar8x32_ps(b, gatherYB), 0x18),
+        _mm256_permutevar8x32_ps(c, gatherYC), 0xE0);
+    v.z = _mm256_blend_ps(
+        _mm256_blend_ps(_mm256_permutevar8x32_ps(a, gatherZA),
+                        _mm256_permutevar8x32_ps(b, gatherZB), 0x1C),
+        _mm256_permutevar8x32_ps(c, gatherZC), 0xE0);
+    return v;
+}
+
+// loadVec3x8 的逆置换：通道寄存器交错回 xyz 流
+inline void storeVec3x8(float* data, const Vec3x8& v) {
+    const __m256i scatterXA = _mm256_setr_epi32(0, 0, 0, 1, 0, 0, 2, 0);
+    const __m256i scatterYA = _mm256_setr_epi32(0, 0, 0, 0, 1, 0, 0, 2);
+    const __m256i scatterZA = _mm256_setr_epi32(0, 0, 0, 0, 0, 1, 0, 0);
+    const __m256i scatterXB = _mm256_setr_epi32(0, 3, 0, 0, 4, 0, 0, 5);
+    const __m256i scatterYB = _mm256_setr_epi32(0, 0, 3, 0, 0, 4, 0, 0);
+    const __m256i scatterZB = _mm256_setr_epi32(2, 0, 0, 3, 0, 0, 4, 0);
+    const __m256i scatterXC = _mm256_setr_epi32(0, 0, 6, 0, 0, 7, 0, 0);
+    const __m256i scatterYC = _mm256_setr_epi32(5, 0, 0, 6, 0, 0, 7, 0);
+    const __m256i scatterZC = _mm256_setr_epi32(0, 5, 0, 0, 6, 0, 0, 7);
+
+    __m256 a = _mm256_blend_ps(
+        _mm256_blend_ps(_mm256_permutevar8x32_ps(v.x, scatterXA),
+                        _mm256_permutevar8x32_ps(v.y, scatterYA), 0x92),
+        _mm256_permutevar8x32_ps(v.z, scatterZA), 0x24);
+    __m256 b = _mm256_blend_ps(
+        _mm256_blend_ps(_mm256_permutevar8x32_ps(v.x, scatterXB),
+                        _mm256_permutevar8x32_ps(v.y, scatterYB), 0x24),
+        _mm256_permutevar8x32_ps(v.z, scatterZB), 0x49);
+    __m256 c = _mm256_blend_ps(
+        _mm256_blend_ps(_mm256_permutevar8x32_ps(v.x, scatterXC),
+                        _mm256_permutevar8x32_ps(v.y, scatterYC), 0x49),
+        _mm256_permutevar8x32_ps(v.z, scatterZC), 0x92);
+
+    _mm256_storeu_ps(data, a);
+    _mm256_storeu_ps(data + 8, b);
+    _mm256_storeu_ps(data + 16, c);
+}
+
+// 与常量向量的点积：通道布局下是三次乘加
+inline __m256 dotWithConst(const Vec3x8& v, __m256 cx, __m256 cy, __m256 cz) {
+    return _mm256_add_ps(_mm256_mul_ps(v.x, cx),
+                         _mm256_add_ps(_mm256_mul_ps(v.y, cy),
+                                       _mm256_mul_ps(v.z, cz)));
+}
+
+// rsqrt 近似加一步牛顿迭代，精度方案与 normalizeVec3Stream 一致
+inline __m256 rsqrtNewton(__m256 value) {
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    __m256 guess = _mm256_rsqrt_ps(value);
+    __m256 guessSq = _mm256_mul_ps(guess, guess);
+    return _mm256_mul_ps(guess,
+        _mm256_sub_ps(threeHalves,
+                      _mm256_mul_ps(_mm256_mul_ps(half, value), guessSq)));
+}
+
+// 8通道并行的xoshiro128+：每步产出8个uint32，吞吐远高于逐标量的
+// 梅森旋转器。noise把输出按int32解释后乘1/2^31，直接得到[-1,1)的
+// 均匀浮点数，省掉uniform_real_distribution里的除法。
+struct Xoshiro128x8 {
+    __m256i s0;
+    __m256i s1;
+    __m256i s2;
+    __m256i s3;
+
+    explicit Xoshiro128x8(uint32_t seed) {
+        // splitmix32逐通道展开种子，各通道状态互不相关
+        uint32_t lanes[4][8];
+        for (int lane = 0; lane < 8; ++lane) {
+            uint32_t x = seed + static_cast<uint32_t>(lane) * 0x9E3779B9u;
+            for (int word = 0; word < 4; ++word) {
+                x += 0x9E3779B9u;
+                uint32_t z = x;
+                z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+                z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+                lanes[word][lane] = z ^ (z >> 16);
+            }
+        }
+        s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes[0]));
+        s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes[1]));
+        s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes[2]));
+        s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes[3]));
+    }
+
+    __m256i next() {
+        __m256i result = _mm256_add_epi32(s0, s3);
+        __m256i t = _mm256_slli_epi32(s1, 9);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+        return result;
+    }
+
+    // [-1,1)均匀浮点：符号位保留，int32转float后乘1/2^31
+    __m256 nextSigned() {
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(next()),
+                             _mm256_set1_ps(1.0f / 2147483648.0f));
+    }
+};
+
+}
+#endif
+
 void MeshOperations::extrude(Mesh& mesh, const std::vector<int>& faceIndices, float distance) {
-    std::unordered_set<int> verticesToExtrude;
+    // 顶点索引本就是[0,V)的稠密整数，稠密标志+平面映射数组代替哈希容器：
+    // 查询退化成一次下标读取，新顶点也按首次出现的确定顺序编号。
+    int vertexCount = mesh.getVertexCount();
+    std::vector<uint8_t> marked(vertexCount, 0);
+    std::vector<int> verticesToExtrude;
 
     for (int faceIndex : faceIndices) {
         const Face& face = mesh.getFace(faceIndex);
         for (int vertexIndex : face.vertices) {
-            verticesToExtrude.insert(vertexIndex);
+            if (!marked[vertexIndex]) {
+                marked[vertexIndex] = 1;
+                verticesToExtrude.push_back(vertexIndex);
+            }
         }
     }
 
-    std::unordered_map<int, int> vertexMap;
+    std::vector<int> vertexMap(vertexCount, -1);
     for (int vertexIndex : verticesToExtrude) {
         const Vertex& vertex = mesh.getVertex(vertexIndex);
         Vertex newVertex = vertex;
@@ -25,9 +182,11 @@ void MeshOperations::extrude(Mesh& mesh, const std::vector<int>& faceIndices, fl
         vertexMap[vertexIndex] = newIndex;
     }
 
+    // 索引缓冲提到面循环外，clear只清长度，容量跨面复用
+    std::vector<int> newVertices;
     for (int faceIndex : faceIndices) {
         const Face& face = mesh.getFace(faceIndex);
-        std::vector<int> newVertices;
+        newVertices.clear();
         for (int vertexIndex : face.vertices) {
             newVertices.push_back(vertexMap[vertexIndex]);
         }
@@ -36,7 +195,9 @@ void MeshOperations::extrude(Mesh& mesh, const std::vector<int>& faceIndices, fl
 }
 
 void MeshOperations::extrude(Mesh& mesh, const std::vector<int>& vertexIndices, const glm::vec3& direction, float distance) {
-    std::unordered_map<int, int> vertexMap;
+    // 平面映射数组代替哈希表，同时兼作选中标志：vertexMap[v] != -1
+    // 即"v在选区里"，不再单独维护一份标志数组。
+    std::vector<int> vertexMap(mesh.getVertexCount(), -1);
     for (int vertexIndex : vertexIndices) {
         const Vertex& vertex = mesh.getVertex(vertexIndex);
         Vertex newVertex = vertex;
@@ -45,20 +206,26 @@ void MeshOperations::extrude(Mesh& mesh, const std::vector<int>& vertexIndices,
         vertexMap[vertexIndex] = newIndex;
     }
 
-    std::unordered_set<int> vertexSet(vertexIndices.begin(), vertexIndices.end());
+    // 候选面只可能关联在所选顶点上，从顶点到面的映射收集即可，
+    // 不必扫整张面表；排序去重保持原先升序遍历的加面顺序。
+    std::vector<int> candidateFaces;
+    for (int vertexIndex : vertexIndices) {
+        std::vector<int> adjacentFaces = mesh.getAdjacentFaces(vertexIndex);
+        candidateFaces.insert(candidateFaces.end(), adjacentFaces.begin(), adjacentFaces.end());
+    }
+    std::sort(candidateFaces.begin(), candidateFaces.end());
+    candidateFaces.erase(std::unique(candidateFaces.begin(), candidateFaces.end()), candidateFaces.end());
 
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
+    std::vector<int> newVertices;
+    for (int i : candidateFaces) {
         const Face& face = mesh.getFace(i);
-        bool allVerticesInSet = true;
+        uint8_t allVerticesInSet = 1;
         for (int vertexIndex : face.vertices) {
-            if (vertexSet.find(vertexIndex) == vertexSet.end()) {
-                allVerticesInSet = false;
-                break;
-            }
+            allVerticesInSet &= static_cast<uint8_t>(vertexMap[vertexIndex] != -1);
         }
 
         if (allVerticesInSet) {
-            std::vector<int> newVertices;
+            newVertices.clear();
             for (int vertexIndex : face.vertices) {
                 newVertices.push_back(vertexMap[vertexIndex]);
             }
@@ -68,15 +235,22 @@ void MeshOperations::extrude(Mesh& mesh, const std::vector<int>& vertexIndices,
 }
 
 void MeshOperations::bevelEdges(Mesh& mesh, const std::vector<int>& edgeIndices, float amount) {
-    std::unordered_set<int> verticesToBevel;
+    // 与 extrude 同一套稠密标志+平面映射方案
+    int vertexCount = mesh.getVertexCount();
+    std::vector<uint8_t> marked(vertexCount, 0);
+    std::vector<int> verticesToBevel;
 
     for (int edgeIndex : edgeIndices) {
         const Edge& edge = mesh.getEdge(edgeIndex);
-        verticesToBevel.insert(edge.vertex1);
-        verticesToBevel.insert(edge.vertex2);
+        for (int vertexIndex : {edge.vertex1, edge.vertex2}) {
+            if (!marked[vertexIndex]) {
+                marked[vertexIndex] = 1;
+                verticesToBevel.push_back(vertexIndex);
+            }
+        }
     }
 
-    std::unordered_map<int, int> vertexMap;
+    std::vector<int> vertexMap(vertexCount, -1);
     for (int vertexIndex : verticesToBevel) {
         const Vertex& vertex = mesh.getVertex(vertexIndex);
         Vertex newVertex = vertex;
@@ -98,18 +272,16 @@ void MeshOperations::bevelEdges(Mesh& mesh, const std::vector<int>& edgeIndices,
 }
 
 void MeshOperations::bevelVertices(Mesh& mesh, const std::vector<int>& vertexIndices, float amount) {
+    std::vector<int> newFaceVertices;
     for (int vertexIndex : vertexIndices) {
         const Vertex& vertex = mesh.getVertex(vertexIndex);
         glm::vec3 offset = vertex.normal * amount;
 
-        std::vector<int> adjacentVertices = mesh.getAdjacentVertices(vertexIndex);
         std::vector<int> adjacentFaces = mesh.getAdjacentFaces(vertexIndex);
 
-        std::unordered_set<int> adjacentVertexSet(adjacentVertices.begin(), adjacentVertices.end());
-
         for (int faceIndex : adjacentFaces) {
             const Face& face = mesh.getFace(faceIndex);
-            std::vector<int> newFaceVertices;
+            newFaceVertices.clear();
 
             for (int fv : face.vertices) {
                 if (fv == vertexIndex) {
@@ -128,12 +300,13 @@ void MeshOperations::bevelVertices(Mesh& mesh, const std::vector<int>& vertexInd
 }
 
 void MeshOperations::inset(Mesh& mesh, const std::vector<int>& faceIndices, float amount) {
+    std::vector<int> newVertices;
     for (int faceIndex : faceIndices) {
         const Face& face = mesh.getFace(faceIndex);
         glm::vec3 centroid = face.centroid;
         glm::vec3 normal = face.normal;
 
-        std::vector<int> newVertices;
+        newVertices.clear();
         for (int vertexIndex : face.vertices) {
             const Vertex& vertex = mesh.getVertex(vertexIndex);
             glm::vec3 direction = glm::normalize(vertex.position - centroid);
@@ -182,25 +355,65 @@ void MeshOperations::booleanDifference(Mesh& result, const Mesh& a, const Mesh&
 }
 
 void MeshOperations::mergeVertices(Mesh& mesh, float threshold) {
-    std::vector<int> verticesToRemove;
+    int vertexCount = mesh.getVertexCount();
+    if (vertexCount == 0 || threshold <= 0.0f) {
+        return;
+    }
+
+    const std::vector<glm::vec3>& positions = mesh.getPositions();
+    float thresholdSq = threshold * threshold;
+    float invCell = 1.0f / threshold;
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        for (int j = i + 1; j < mesh.getVertexCount(); ++j) {
-            const Vertex& v1 = mesh.getVertex(i);
-            const Vertex& v2 = mesh.getVertex(j);
+    // 体素哈希：格边长取threshold，阈值内的点只可能落在自身或26个
+    // 相邻格里。每个顶点只和这些格里已插入的点比平方距离（省掉逐对
+    // sqrt），期望复杂度从全对扫描的O(N²)降到O(N)。
+    auto packCell = [](int x, int y, int z) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x) & 0x1FFFFF) << 42)
+             | (static_cast<uint64_t>(static_cast<uint32_t>(y) & 0x1FFFFF) << 21)
+             | (static_cast<uint64_t>(static_cast<uint32_t>(z) & 0x1FFFFF));
+    };
 
-            if (glm::length(v1.position - v2.position) < threshold) {
-                verticesToRemove.push_back(j);
+    std::unordered_map<uint64_t, std::vector<int>> grid;
+    grid.reserve(vertexCount);
+
+    std::vector<int> verticesToRemove;
+
+    for (int i = 0; i < vertexCount; ++i) {
+        const glm::vec3& position = positions[i];
+        int cellX = static_cast<int>(std::floor(position.x * invCell));
+        int cellY = static_cast<int>(std::floor(position.y * invCell));
+        int cellZ = static_cast<int>(std::floor(position.z * invCell));
+
+        bool duplicate = false;
+        for (int dx = -1; dx <= 1 && !duplicate; ++dx) {
+            for (int dy = -1; dy <= 1 && !duplicate; ++dy) {
+                for (int dz = -1; dz <= 1 && !duplicate; ++dz) {
+                    auto it = grid.find(packCell(cellX + dx, cellY + dy, cellZ + dz));
+                    if (it == grid.end()) {
+                        continue;
+                    }
+                    for (int j : it->second) {
+                        glm::vec3 delta = positions[j] - position;
+                        if (glm::dot(delta, delta) < thresholdSq) {
+                            duplicate = true;
+                            break;
+                        }
+                    }
+                }
             }
         }
-    }
-
-    std::sort(verticesToRemove.begin(), verticesToRemove.end());
-    verticesToRemove.erase(std::unique(verticesToRemove.begin(), verticesToRemove.end()), verticesToRemove.end());
 
-    for (int i = static_cast<int>(verticesToRemove.size()) - 1; i >= 0; --i) {
-        mesh.removeVertex(verticesToRemove[i]);
+        if (duplicate) {
+            verticesToRemove.push_back(i);
+        }
+        // 被判为重复的顶点也要入格：原全对扫描里它们同样充当后续
+        // 顶点的比较基准，保持合并结果一致。
+        grid[packCell(cellX, cellY, cellZ)].push_back(i);
     }
+
+    // verticesToRemove 按索引升序构建，直接倒序删除
+    // 整批标记+压实，一次完成重编号，不再逐个交换删除
+    mesh.removeVertices(std::span<const int>(verticesToRemove));
 }
 
 void MeshOperations::mergeVertices(Mesh& mesh, const std::vector<int>& vertices) {
@@ -234,9 +447,7 @@ void MeshOperations::mergeVertices(Mesh& mesh, const std::vector<int>& vertices)
         }
     }
 
-    for (size_t i = 1; i < vertices.size(); ++i) {
-        mesh.removeVertex(vertices[i]);
-    }
+    mesh.removeVertices(std::span<const int>(vertices.data() + 1, vertices.size() - 1));
 }
 
 void MeshOperations::splitEdge(Mesh& mesh, int edgeIndex) {
@@ -251,17 +462,20 @@ void MeshOperations::splitEdge(Mesh& mesh, int edgeIndex) {
 
     int newVertexIndex = mesh.addVertex(newVertex);
 
+    // Edge自带两侧面引用，就是现成的边→面表：O(1)直取，
+    // 不再在顶点关联面里逐个containsEdge过滤。
     std::vector<int> facesToUpdate;
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        const Face& face = mesh.getFace(i);
-        if (face.containsEdge(edgeIndex)) {
+    for (int i : {edge.face1, edge.face2}) {
+        if (i != -1) {
             facesToUpdate.push_back(i);
         }
     }
+    std::sort(facesToUpdate.begin(), facesToUpdate.end());
 
+    std::vector<int> newVertices;
     for (int faceIndex : facesToUpdate) {
         const Face& face = mesh.getFace(faceIndex);
-        std::vector<int> newVertices;
+        newVertices.clear();
 
         for (int fv : face.vertices) {
             newVertices.push_back(fv);
@@ -311,13 +525,8 @@ void MeshOperations::collapseEdge(Mesh& mesh, int edgeIndex) {
     mergedVertex.texCoord = newTexCoord;
     mesh.setVertex(v1, mergedVertex);
 
-    std::vector<int> facesToUpdate;
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        const Face& face = mesh.getFace(i);
-        if (face.containsVertex(v2)) {
-            facesToUpdate.push_back(i);
-        }
-    }
+    // 含v2的面直接取顶点到面的映射，不再扫整张面表。
+    std::vector<int> facesToUpdate = mesh.getAdjacentFaces(v2);
 
     for (int faceIndex : facesToUpdate) {
         Face& face = mesh.getFace(faceIndex);
@@ -363,12 +572,10 @@ void MeshOperations::dissolveEdge(Mesh& mesh, int edgeIndex) {
         return;
     }
 
+    // 边界边只贴着face1一张面，边上的面引用直取即可
     std::vector<int> facesToRemove;
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        const Face& face = mesh.getFace(i);
-        if (face.containsEdge(edgeIndex)) {
-            facesToRemove.push_back(i);
-        }
+    if (edge.face1 != -1) {
+        facesToRemove.push_back(edge.face1);
     }
 
     for (int faceIndex : facesToRemove) {
@@ -388,77 +595,112 @@ void MeshOperations::bridgeLoops(Mesh& mesh, const std::vector<int>& loop1, cons
     bridge(mesh, loop1, loop2);
 }
 
+namespace {
+
+// 顶点邻接一次性摊平成CSR（行偏移+邻居平铺）。smooth/sharpen/relax
+// 的迭代核心是均匀拉普拉斯的稀疏矩阵乘向量：预先摊平后，迭代内
+// 零分配，邻居索引连续顺读，不再每顶点每迭代构造一个临时vector。
+void buildAdjacencyCsr(const Mesh& mesh, std::vector<int>& rowStart,
+                       std::vector<int>& neighbors) {
+    int vertexCount = mesh.getVertexCount();
+    rowStart.resize(vertexCount + 1);
+    rowStart[0] = 0;
+    neighbors.clear();
+    for (int i = 0; i < vertexCount; ++i) {
+        std::vector<int> adjacent = mesh.getAdjacentVertices(i);
+        neighbors.insert(neighbors.end(), adjacent.begin(), adjacent.end());
+        rowStart[i + 1] = static_cast<int>(neighbors.size());
+    }
+}
+
+}
+
 void MeshOperations::smooth(Mesh& mesh, int iterations, float factor) {
-    for (int iter = 0; iter < iterations; ++iter) {
-        std::vector<glm::vec3> newPositions(mesh.getVertexCount());
+    int vertexCount = mesh.getVertexCount();
+    std::vector<glm::vec3> newPositions(vertexCount);
 
-        for (int i = 0; i < mesh.getVertexCount(); ++i) {
-            const Vertex& vertex = mesh.getVertex(i);
-            std::vector<int> adjacentVertices = mesh.getAdjacentVertices(i);
+    std::vector<int> rowStart;
+    std::vector<int> neighbors;
+    buildAdjacencyCsr(mesh, rowStart, neighbors);
 
-            if (adjacentVertices.empty()) {
-                newPositions[i] = vertex.position;
+    for (int iter = 0; iter < iterations; ++iter) {
+        // 循环只读写位置数组，不再为每个顶点装配完整Vertex。
+        // 采集阶段只写 newPositions[i]，顶点之间无写冲突，可并行；
+        // 小网格沿用生成器的4096阈值，免得并行开销反超收益。
+        const std::vector<glm::vec3>& positions = mesh.getPositions();
+
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int i = 0; i < vertexCount; ++i) {
+            int rowBegin = rowStart[i];
+            int rowEnd = rowStart[i + 1];
+
+            if (rowBegin == rowEnd) {
+                newPositions[i] = positions[i];
                 continue;
             }
 
             glm::vec3 average(0.0f);
-            for (int av : adjacentVertices) {
-                average += mesh.getVertex(av).position;
+            for (int k = rowBegin; k < rowEnd; ++k) {
+                average += positions[neighbors[k]];
             }
-            average /= static_cast<float>(adjacentVertices.size());
-
-            newPositions[i] = glm::mix(vertex.position, average, factor);
-        }
+            average /= static_cast<float>(rowEnd - rowBegin);
 
-        for (int i = 0; i < mesh.getVertexCount(); ++i) {
-            Vertex vertex = mesh.getVertex(i);
-            vertex.position = newPositions[i];
-            mesh.setVertex(i, vertex);
+            newPositions[i] = glm::mix(positions[i], average, factor);
         }
 
-        mesh.calculateNormals();
+        // O(1)乒乓交换代替整段拷回；迭代中间没人读法线，
+        // 面表扫描只在收敛后做一次。
+        mesh.swapPositions(newPositions);
     }
+    mesh.calculateNormals();
 }
 
 void MeshOperations::sharpen(Mesh& mesh, int iterations, float factor) {
+    int vertexCount = mesh.getVertexCount();
+    std::vector<glm::vec3> newPositions(vertexCount);
+
+    std::vector<int> rowStart;
+    std::vector<int> neighbors;
+    buildAdjacencyCsr(mesh, rowStart, neighbors);
+
     for (int iter = 0; iter < iterations; ++iter) {
-        std::vector<glm::vec3> newPositions(mesh.getVertexCount());
+        const std::vector<glm::vec3>& positions = mesh.getPositions();
 
-        for (int i = 0; i < mesh.getVertexCount(); ++i) {
-            const Vertex& vertex = mesh.getVertex(i);
-            std::vector<int> adjacentVertices = mesh.getAdjacentVertices(i);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int i = 0; i < vertexCount; ++i) {
+            int rowBegin = rowStart[i];
+            int rowEnd = rowStart[i + 1];
 
-            if (adjacentVertices.empty()) {
-                newPositions[i] = vertex.position;
+            if (rowBegin == rowEnd) {
+                newPositions[i] = positions[i];
                 continue;
             }
 
             glm::vec3 average(0.0f);
-            for (int av : adjacentVertices) {
-                average += mesh.getVertex(av).position;
+            for (int k = rowBegin; k < rowEnd; ++k) {
+                average += positions[neighbors[k]];
             }
-            average /= static_cast<float>(adjacentVertices.size());
+            average /= static_cast<float>(rowEnd - rowBegin);
 
-            glm::vec3 direction = vertex.position - average;
-            newPositions[i] = vertex.position + direction * factor;
+            glm::vec3 direction = positions[i] - average;
+            newPositions[i] = positions[i] + direction * factor;
         }
 
-        for (int i = 0; i < mesh.getVertexCount(); ++i) {
-            Vertex vertex = mesh.getVertex(i);
-            vertex.position = newPositions[i];
-            mesh.setVertex(i, vertex);
-        }
-
-        mesh.calculateNormals();
+        // O(1)乒乓交换代替整段拷回；迭代中间没人读法线，
+        // 面表扫描只在收敛后做一次。
+        mesh.swapPositions(newPositions);
     }
+    mesh.calculateNormals();
 }
 
 void MeshOperations::deform(Mesh& mesh, std::function<void(glm::vec3&)> deformer) {
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
-        deformer(vertex.position);
-        mesh.setVertex(i, vertex);
-    }
+    // ABI兼容的薄转发；新代码直接走模板重载让变形体内联进循环
+    deform<const std::function<void(glm::vec3&)>&>(mesh, deformer);
+}
+
+void MeshOperations::deformPositions(Mesh& mesh, std::span<const glm::vec3> newPositions) {
+    int count = std::min(mesh.getVertexCount(), static_cast<int>(newPositions.size()));
+    std::memcpy(mesh.positionsData(), newPositions.data(), count * sizeof(glm::vec3));
     mesh.calculateNormals();
 }
 
@@ -466,24 +708,33 @@ void MeshOperations::twist(Mesh& mesh, const glm::vec3& axis, float angle, float
     glm::vec3 normalizedAxis = glm::normalize(axis);
     glm::vec3 center = mesh.getCenter();
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+
+    // falloff为0时整个网格共用同一旋转角，三角函数只在环外算一次
+    float sinAngle = std::sin(angle);
+    float cosAngle = std::cos(angle);
 
-        glm::vec3 toVertex = vertex.position - center;
+    // 每次迭代只写第 i 个位置，跨顶点无依赖
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 toVertex = positions[i] - center;
         float distance = glm::length(toVertex);
         glm::vec3 projection = glm::dot(toVertex, normalizedAxis) * normalizedAxis;
         glm::vec3 perpendicular = toVertex - projection;
 
-        float twistAngle = angle;
+        float sinTwist = sinAngle;
+        float cosTwist = cosAngle;
         if (falloff > 0.0f) {
-            twistAngle *= std::exp(-distance * falloff);
+            float twistAngle = angle * std::exp(-distance * falloff);
+            sinTwist = std::sin(twistAngle);
+            cosTwist = std::cos(twistAngle);
         }
 
-        glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), twistAngle, normalizedAxis);
-        glm::vec4 rotatedPerp = rotation * glm::vec4(perpendicular, 1.0f);
-
-        vertex.position = center + projection + glm::vec3(rotatedPerp);
-        mesh.setVertex(i, vertex);
+        // perpendicular 与旋转轴正交，Rodrigues展开的轴向项恒为零，
+        // 不必每顶点构造一个4x4旋转矩阵再做矩阵乘。
+        positions[i] = center + projection + perpendicular * cosTwist
+                     + glm::cross(normalizedAxis, perpendicular) * sinTwist;
     }
 
     mesh.calculateNormals();
@@ -493,24 +744,29 @@ void MeshOperations::bend(Mesh& mesh, const glm::vec3& axis, float angle, float
     glm::vec3 normalizedAxis = glm::normalize(axis);
     glm::vec3 center = mesh.getCenter();
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+
+    float sinAngle = std::sin(angle);
+    float cosAngle = std::cos(angle);
 
-        glm::vec3 toVertex = vertex.position - center;
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 toVertex = positions[i] - center;
         float distance = glm::length(toVertex);
         glm::vec3 projection = glm::dot(toVertex, normalizedAxis) * normalizedAxis;
         glm::vec3 perpendicular = toVertex - projection;
 
-        float bendAngle = angle;
+        float sinBend = sinAngle;
+        float cosBend = cosAngle;
         if (falloff > 0.0f) {
-            bendAngle *= std::exp(-distance * falloff);
+            float bendAngle = angle * std::exp(-distance * falloff);
+            sinBend = std::sin(bendAngle);
+            cosBend = std::cos(bendAngle);
         }
 
-        glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), bendAngle, normalizedAxis);
-        glm::vec4 rotatedPerp = rotation * glm::vec4(perpendicular, 1.0f);
-
-        vertex.position = center + projection + glm::vec3(rotatedPerp);
-        mesh.setVertex(i, vertex);
+        positions[i] = center + projection + perpendicular * cosBend
+                     + glm::cross(normalizedAxis, perpendicular) * sinBend;
     }
 
     mesh.calculateNormals();
@@ -520,97 +776,266 @@ void MeshOperations::taper(Mesh& mesh, const glm::vec3& axis, float factor) {
     glm::vec3 normalizedAxis = glm::normalize(axis);
     glm::vec3 center = mesh.getCenter();
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+    int i = 0;
+
+#if defined(__AVX2__)
+    if (vertexCount >= 8) {
+        float* data = &positions[0].x;
+        const __m256 ax = _mm256_set1_ps(normalizedAxis.x);
+        const __m256 ay = _mm256_set1_ps(normalizedAxis.y);
+        const __m256 az = _mm256_set1_ps(normalizedAxis.z);
+        const __m256 cx = _mm256_set1_ps(center.x);
+        const __m256 cy = _mm256_set1_ps(center.y);
+        const __m256 cz = _mm256_set1_ps(center.z);
+        const __m256 factorV = _mm256_set1_ps(factor);
+        const __m256 one = _mm256_set1_ps(1.0f);
+
+        int simdBlocks = vertexCount / 8;
+
+        // 8 顶点一块互不重叠，块间可以并行
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int block = 0; block < simdBlocks; ++block) {
+            int i = block * 8;
+            Vec3x8 p = loadVec3x8(data + i * 3);
+            Vec3x8 t{_mm256_sub_ps(p.x, cx),
+                     _mm256_sub_ps(p.y, cy),
+                     _mm256_sub_ps(p.z, cz)};
+            __m256 distance = dotWithConst(t, ax, ay, az);
+            __m256 scale = _mm256_add_ps(one, _mm256_mul_ps(factorV, distance));
+
+            // center + proj + perp*scale，逐通道都是乘加
+            __m256 projX = _mm256_mul_ps(distance, ax);
+            __m256 projY = _mm256_mul_ps(distance, ay);
+            __m256 projZ = _mm256_mul_ps(distance, az);
+            p.x = _mm256_add_ps(cx, _mm256_add_ps(projX,
+                  _mm256_mul_ps(_mm256_sub_ps(t.x, projX), scale)));
+            p.y = _mm256_add_ps(cy, _mm256_add_ps(projY,
+                  _mm256_mul_ps(_mm256_sub_ps(t.y, projY), scale)));
+            p.z = _mm256_add_ps(cz, _mm256_add_ps(projZ,
+                  _mm256_mul_ps(_mm256_sub_ps(t.z, projZ), scale)));
+            storeVec3x8(data + i * 3, p);
+        }
+
+        i = simdBlocks * 8;
+    }
+#endif
 
-        glm::vec3 toVertex = vertex.position - center;
+    for (; i < vertexCount; ++i) {
+        glm::vec3 toVertex = positions[i] - center;
         float distance = glm::dot(toVertex, normalizedAxis);
         glm::vec3 projection = distance * normalizedAxis;
         glm::vec3 perpendicular = toVertex - projection;
 
         float scale = 1.0f + factor * distance;
 
-        vertex.position = center + projection + perpendicular * scale;
-        mesh.setVertex(i, vertex);
+        positions[i] = center + projection + perpendicular * scale;
     }
 
     mesh.calculateNormals();
 }
 
 void MeshOperations::bulge(Mesh& mesh, const glm::vec3& center, float radius, float strength) {
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
-
-        glm::vec3 toVertex = vertex.position - center;
-        float distance = glm::length(toVertex);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+    int i = 0;
+
+#if defined(__AVX2__)
+    if (vertexCount >= 8) {
+        float* data = &positions[0].x;
+        const __m256 cx = _mm256_set1_ps(center.x);
+        const __m256 cy = _mm256_set1_ps(center.y);
+        const __m256 cz = _mm256_set1_ps(center.z);
+        const __m256 radius2 = _mm256_set1_ps(radius * radius);
+        const __m256 invRadius = _mm256_set1_ps(1.0f / radius);
+        const __m256 strengthV = _mm256_set1_ps(strength);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 three = _mm256_set1_ps(3.0f);
+        const __m256 two = _mm256_set1_ps(2.0f);
+
+        int simdBlocks = vertexCount / 8;
+
+        // 8 顶点一块互不重叠，块间可以并行
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int block = 0; block < simdBlocks; ++block) {
+            int i = block * 8;
+            Vec3x8 p = loadVec3x8(data + i * 3);
+            Vec3x8 t{_mm256_sub_ps(p.x, cx),
+                     _mm256_sub_ps(p.y, cy),
+                     _mm256_sub_ps(p.z, cz)};
+            __m256 dist2 = dotWithConst(t, t.x, t.y, t.z);
+            __m256 invLen = rsqrtNewton(dist2);
+            __m256 distance = _mm256_mul_ps(dist2, invLen);
+
+            // smoothstep 衰减；半径外的车道用掩码保持原位置
+            __m256 f = _mm256_sub_ps(one, _mm256_mul_ps(distance, invRadius));
+            __m256 smooth = _mm256_mul_ps(_mm256_mul_ps(f, f),
+                            _mm256_sub_ps(three, _mm256_mul_ps(two, f)));
+            __m256 amount = _mm256_mul_ps(_mm256_mul_ps(strengthV, smooth), invLen);
+            __m256 inside = _mm256_cmp_ps(dist2, radius2, _CMP_LT_OQ);
+
+            p.x = _mm256_blendv_ps(p.x,
+                  _mm256_add_ps(p.x, _mm256_mul_ps(t.x, amount)), inside);
+            p.y = _mm256_blendv_ps(p.y,
+                  _mm256_add_ps(p.y, _mm256_mul_ps(t.y, amount)), inside);
+            p.z = _mm256_blendv_ps(p.z,
+                  _mm256_add_ps(p.z, _mm256_mul_ps(t.z, amount)), inside);
+            storeVec3x8(data + i * 3, p);
+        }
 
-        if (distance < radius) {
-            float falloff = 1.0f - (distance / radius);
+        i = simdBlocks * 8;
+    }
+#endif
+
+    // 先比平方距离，半径外的顶点一次sqrt都不花；半径内只开一次方，
+    // 归一化折进除法里，不再走第二次sqrt的normalize
+    float invRadius = 1.0f / radius;
+    float radiusSq = radius * radius;
+    for (; i < vertexCount; ++i) {
+        glm::vec3 toVertex = positions[i] - center;
+        float distSq = glm::dot(toVertex, toVertex);
+
+        if (distSq < radiusSq) {
+            float distance = std::sqrt(distSq);
+            float falloff = 1.0f - distance * invRadius;
             falloff = falloff * falloff * (3.0f - 2.0f * falloff);
 
-            glm::vec3 direction = glm::normalize(toVertex);
-            vertex.position += direction * strength * falloff;
-            mesh.setVertex(i, vertex);
+            positions[i] += toVertex * (strength * falloff / distance);
         }
     }
 
     mesh.calculateNormals();
 }
 
-void MeshOperations::noise(Mesh& mesh, float strength, int seed) {
-    std::mt19937 gen(seed);
-    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+namespace {
+
+// 计数器式随机数：对(种子,序号)做一次splitmix32混淆。无状态、零
+// 初始化开销（梅森旋转器每次构造要铺2.5KB状态表），同一(种子,顶点)
+// 的结果与线程数和调度方式无关，帧间可复现。
+inline float hashToSignedFloat(uint32_t seed, uint32_t index) {
+    uint32_t z = seed + index * 0x9E3779B9u;
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    z ^= z >> 16;
+    return static_cast<float>(static_cast<int32_t>(z)) * (1.0f / 2147483648.0f);
+}
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+}
 
-        glm::vec3 noise(
-            dist(gen),
-            dist(gen),
-            dist(gen)
-        );
+void MeshOperations::noise(Mesh& mesh, float strength, int seed) {
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+
+#if defined(__AVX2__)
+    // 噪声逐分量独立同分布，交错xyz流不用解交错：每块8个顶点共
+    // 24个float，三次next正好喂满，读-改-写一趟完成。每个线程一台
+    // 独立的8通道生成器，种子混入线程号，无共享状态争用。
+    int simdBlocks = vertexCount / 8;
+    if (simdBlocks > 0) {
+        float* data = &positions[0].x;
+        const __m256 strengthVec = _mm256_set1_ps(strength);
+
+#pragma omp parallel
+        {
+            unsigned int threadSeed = static_cast<unsigned int>(seed);
+#if defined(_OPENMP)
+            threadSeed ^= static_cast<unsigned int>(omp_get_thread_num()) * 0x9E3779B9u;
+#endif
+            Xoshiro128x8 gen(threadSeed);
+
+#pragma omp for schedule(static)
+            for (int block = 0; block < simdBlocks; ++block) {
+                float* blockData = data + block * 24;
+                for (int part = 0; part < 3; ++part) {
+                    __m256 values = _mm256_loadu_ps(blockData + part * 8);
+                    values = _mm256_add_ps(values,
+                        _mm256_mul_ps(gen.nextSigned(), strengthVec));
+                    _mm256_storeu_ps(blockData + part * 8, values);
+                }
+            }
+        }
+    }
 
-        vertex.position += noise * strength;
-        mesh.setVertex(i, vertex);
+    // 标量尾巴最多7个顶点，用计数器式混淆补完
+    uint32_t hashSeed = static_cast<uint32_t>(seed);
+    for (int i = simdBlocks * 8; i < vertexCount; ++i) {
+        uint32_t base = static_cast<uint32_t>(i) * 3u;
+        positions[i] += glm::vec3(hashToSignedFloat(hashSeed, base),
+                                  hashToSignedFloat(hashSeed, base + 1),
+                                  hashToSignedFloat(hashSeed, base + 2)) * strength;
+    }
+#else
+    // 无AVX2的构建走计数器式混淆：无引擎状态要初始化或共享，
+    // 循环可直接并行，结果与线程数无关。
+    uint32_t hashSeed = static_cast<uint32_t>(seed);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        uint32_t base = static_cast<uint32_t>(i) * 3u;
+        positions[i] += glm::vec3(hashToSignedFloat(hashSeed, base),
+                                  hashToSignedFloat(hashSeed, base + 1),
+                                  hashToSignedFloat(hashSeed, base + 2)) * strength;
     }
+#endif
 
     mesh.calculateNormals();
 }
 
-void MeshOperations::mirror(Mesh& mesh, const glm::vec3& axis, bool merge) {
-    glm::vec3 normalizedAxis = glm::normalize(axis);
-
-    std::vector<int> originalVertexIndices;
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        originalVertexIndices.push_back(i);
+namespace {
+
+// Householder反射 v' = v - 2(v·n̂)n̂，就地作用在stream的[start,end)区间
+void reflectStream(glm::vec3* stream, int start, int end, const glm::vec3& axis) {
+    int i = start;
+#if defined(__AVX2__)
+    if (end - start >= 8) {
+        float* data = &stream[start].x;
+        const __m256 axisX = _mm256_set1_ps(axis.x);
+        const __m256 axisY = _mm256_set1_ps(axis.y);
+        const __m256 axisZ = _mm256_set1_ps(axis.z);
+        const __m256 negTwo = _mm256_set1_ps(-2.0f);
+
+        int simdBlocks = (end - start) / 8;
+        for (int block = 0; block < simdBlocks; ++block) {
+            Vec3x8 v = loadVec3x8(data + block * 24);
+            __m256 scale = _mm256_mul_ps(negTwo, dotWithConst(v, axisX, axisY, axisZ));
+            v.x = _mm256_add_ps(v.x, _mm256_mul_ps(scale, axisX));
+            v.y = _mm256_add_ps(v.y, _mm256_mul_ps(scale, axisY));
+            v.z = _mm256_add_ps(v.z, _mm256_mul_ps(scale, axisZ));
+            storeVec3x8(data + block * 24, v);
+        }
+        i = start + simdBlocks * 8;
+    }
+#endif
+    for (; i < end; ++i) {
+        glm::vec3& value = stream[i];
+        value -= 2.0f * glm::dot(value, axis) * axis;
     }
+}
 
-    std::unordered_map<int, int> vertexMap;
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        const Vertex& vertex = mesh.getVertex(i);
+}
 
-        glm::vec3 reflectedPosition = vertex.position - 2.0f * glm::dot(vertex.position, normalizedAxis) * normalizedAxis;
-        glm::vec3 reflectedNormal = vertex.normal - 2.0f * glm::dot(vertex.normal, normalizedAxis) * normalizedAxis;
+void MeshOperations::mirror(Mesh& mesh, const glm::vec3& axis, bool merge) {
+    glm::vec3 normalizedAxis = glm::normalize(axis);
 
-        Vertex newVertex;
-        newVertex.position = reflectedPosition;
-        newVertex.normal = reflectedNormal;
-        newVertex.texCoord = vertex.texCoord;
-        newVertex.tangent = vertex.tangent;
-        newVertex.bitangent = vertex.bitangent;
-        newVertex.color = vertex.color;
+    int originalVertexCount = mesh.getVertexCount();
 
-        int newIndex = mesh.addVertex(newVertex);
-        vertexMap[i] = newIndex;
-    }
+    // 六条属性流整段自我翻倍；纹理坐标/切线/颜色镜像后原样复用，
+    // 只有位置和法线要在追加出的后半段上就地做反射
+    mesh.appendVertices(mesh);
+    reflectStream(mesh.positionsData(), originalVertexCount,
+                  originalVertexCount * 2, normalizedAxis);
+    reflectStream(mesh.normalsData(), originalVertexCount,
+                  originalVertexCount * 2, normalizedAxis);
 
+    // 镜像顶点按原顺序追加，索引恒为 originalVertexCount + fv，无需映射表
     int originalFaceCount = mesh.getFaceCount();
+    std::vector<int> newVertices;
     for (int i = 0; i < originalFaceCount; ++i) {
         const Face& face = mesh.getFace(i);
-        std::vector<int> newVertices;
+        newVertices.clear();
 
         for (int fv : face.vertices) {
-            newVertices.push_back(vertexMap[fv]);
+            newVertices.push_back(originalVertexCount + fv);
         }
 
         std::reverse(newVertices.begin(), newVertices.end());
@@ -627,31 +1052,50 @@ void MeshOperations::array(Mesh& mesh, const glm::vec3& offset, int count) {
         return;
     }
 
+    int originalFaceCount = mesh.getFaceCount();
+
+    // 快照只需要属性流和面索引表：顶点整段批量拷进一个无面的Mesh，
+    // 面索引摊平进连续缓冲，不再为快照逐面重建几何/边表/邻接。
     Mesh originalMesh;
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        originalMesh.addVertex(mesh.getVertex(i));
-    }
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        originalMesh.addFace(mesh.getFace(i).vertices);
+    originalMesh.appendVertices(mesh);
+
+    std::vector<int> faceOffsets;
+    faceOffsets.reserve(originalFaceCount + 1);
+    faceOffsets.push_back(0);
+    std::vector<int> faceIndices;
+    for (int i = 0; i < originalFaceCount; ++i) {
+        const Face& face = mesh.getFace(i);
+        faceIndices.insert(faceIndices.end(), face.vertices.begin(), face.vertices.end());
+        faceOffsets.push_back(static_cast<int>(faceIndices.size()));
     }
 
+    const std::vector<glm::vec3>& originalPositions = originalMesh.getPositions();
+    int originalVertexCount = originalMesh.getVertexCount();
+
+    // 终态大小已知，一次预留到位，追加过程中零次扩容
+    mesh.reserveVertices(originalVertexCount * count);
+    mesh.reserveFaces(originalFaceCount * count);
+
+    std::vector<int> shiftedIndices(faceIndices.size());
+
     for (int i = 1; i < count; ++i) {
         glm::vec3 currentOffset = offset * static_cast<float>(i);
 
-        for (int j = 0; j < originalMesh.getVertexCount(); ++j) {
-            Vertex vertex = originalMesh.getVertex(j);
-            vertex.position += currentOffset;
-            mesh.addVertex(vertex);
+        // 整段复制一份顶点流，再只平移位置属性
+        int base = mesh.appendVertices(originalMesh);
+        glm::vec3* positions = mesh.positionsData();
+        for (int j = 0; j < originalVertexCount; ++j) {
+            positions[base + j] = originalPositions[j] + currentOffset;
         }
 
-        int vertexOffset = i * originalMesh.getVertexCount();
-        for (int j = 0; j < originalMesh.getFaceCount(); ++j) {
-            const Face& face = originalMesh.getFace(j);
-            std::vector<int> newVertices;
-            for (int fv : face.vertices) {
-                newVertices.push_back(fv + vertexOffset);
-            }
-            mesh.addFace(newVertices);
+        // 索引平移对整个摊平缓冲做一遍，再按偏移表切成面
+        int vertexOffset = i * originalVertexCount;
+        for (size_t k = 0; k < faceIndices.size(); ++k) {
+            shiftedIndices[k] = faceIndices[k] + vertexOffset;
+        }
+        for (int j = 0; j < originalFaceCount; ++j) {
+            mesh.addFace(std::span<const int>(shiftedIndices.data() + faceOffsets[j],
+                                              faceOffsets[j + 1] - faceOffsets[j]));
         }
     }
 }
@@ -664,35 +1108,66 @@ void MeshOperations::radialArray(Mesh& mesh, const glm::vec3& axis, int count, f
     glm::vec3 normalizedAxis = glm::normalize(axis);
     float angleStep = glm::radians(angle) / static_cast<float>(count);
 
+    int originalFaceCount = mesh.getFaceCount();
+
+    // 快照只需要属性流和面索引表：顶点整段批量拷进一个无面的Mesh，
+    // 面索引摊平进连续缓冲，不再为快照逐面重建几何/边表/邻接。
     Mesh originalMesh;
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        originalMesh.addVertex(mesh.getVertex(i));
-    }
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        originalMesh.addFace(mesh.getFace(i).vertices);
+    originalMesh.appendVertices(mesh);
+
+    std::vector<int> faceOffsets;
+    faceOffsets.reserve(originalFaceCount + 1);
+    faceOffsets.push_back(0);
+    std::vector<int> faceIndices;
+    for (int i = 0; i < originalFaceCount; ++i) {
+        const Face& face = mesh.getFace(i);
+        faceIndices.insert(faceIndices.end(), face.vertices.begin(), face.vertices.end());
+        faceOffsets.push_back(static_cast<int>(faceIndices.size()));
     }
 
+    const std::vector<glm::vec3>& originalPositions = originalMesh.getPositions();
+    const std::vector<glm::vec3>& originalNormals = originalMesh.getNormals();
+    int originalVertexCount = originalMesh.getVertexCount();
+
+    mesh.reserveVertices(originalVertexCount * count);
+    mesh.reserveFaces(originalFaceCount * count);
+
+    std::vector<int> shiftedIndices(faceIndices.size());
+
     for (int i = 1; i < count; ++i) {
         float currentAngle = angleStep * static_cast<float>(i);
-        glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), currentAngle, normalizedAxis);
-
-        for (int j = 0; j < originalMesh.getVertexCount(); ++j) {
-            Vertex vertex = originalMesh.getVertex(j);
-            glm::vec4 rotatedPos = rotation * glm::vec4(vertex.position, 1.0f);
-            glm::vec4 rotatedNorm = rotation * glm::vec4(vertex.normal, 0.0f);
-            vertex.position = glm::vec3(rotatedPos);
-            vertex.normal = glm::normalize(glm::vec3(rotatedNorm));
-            mesh.addVertex(vertex);
+        // 每个实例的旋转角是常量：用Rodrigues公式直接拼3x3矩阵并提升到顶点循环外，
+        // 循环内只剩mat3*vec3。旋转正交保长，法线转完不需要再归一化。
+        float sinA = std::sin(currentAngle);
+        float cosA = std::cos(currentAngle);
+        float oneMinusCos = 1.0f - cosA;
+        const glm::vec3& k = normalizedAxis;
+        glm::mat3 rotation(
+            glm::vec3(cosA + oneMinusCos * k.x * k.x,
+                      oneMinusCos * k.x * k.y + sinA * k.z,
+                      oneMinusCos * k.x * k.z - sinA * k.y),
+            glm::vec3(oneMinusCos * k.x * k.y - sinA * k.z,
+                      cosA + oneMinusCos * k.y * k.y,
+                      oneMinusCos * k.y * k.z + sinA * k.x),
+            glm::vec3(oneMinusCos * k.x * k.z + sinA * k.y,
+                      oneMinusCos * k.y * k.z - sinA * k.x,
+                      cosA + oneMinusCos * k.z * k.z));
+
+        int base = mesh.appendVertices(originalMesh);
+        glm::vec3* positions = mesh.positionsData();
+        glm::vec3* normals = mesh.normalsData();
+        for (int j = 0; j < originalVertexCount; ++j) {
+            positions[base + j] = rotation * originalPositions[j];
+            normals[base + j] = rotation * originalNormals[j];
         }
 
-        int vertexOffset = i * originalMesh.getVertexCount();
-        for (int j = 0; j < originalMesh.getFaceCount(); ++j) {
-            const Face& face = originalMesh.getFace(j);
-            std::vector<int> newVertices;
-            for (int fv : face.vertices) {
-                newVertices.push_back(fv + vertexOffset);
-            }
-            mesh.addFace(newVertices);
+        int vertexOffset = i * originalVertexCount;
+        for (size_t k = 0; k < faceIndices.size(); ++k) {
+            shiftedIndices[k] = faceIndices[k] + vertexOffset;
+        }
+        for (int j = 0; j < originalFaceCount; ++j) {
+            mesh.addFace(std::span<const int>(shiftedIndices.data() + faceOffsets[j],
+                                              faceOffsets[j + 1] - faceOffsets[j]));
         }
     }
 }
@@ -700,29 +1175,94 @@ void MeshOperations::radialArray(Mesh& mesh, const glm::vec3& axis, int count, f
 void MeshOperations::projectToPlane(Mesh& mesh, const glm::vec3& point, const glm::vec3& normal) {
     glm::vec3 normalizedNormal = glm::normalize(normal);
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+    int i = 0;
+
+#if defined(__AVX2__)
+    if (vertexCount >= 8) {
+        float* data = &positions[0].x;
+        const __m256 nx = _mm256_set1_ps(normalizedNormal.x);
+        const __m256 ny = _mm256_set1_ps(normalizedNormal.y);
+        const __m256 nz = _mm256_set1_ps(normalizedNormal.z);
+        const __m256 planeD = _mm256_set1_ps(glm::dot(point, normalizedNormal));
+
+        int simdBlocks = vertexCount / 8;
+
+        // 8 顶点一块互不重叠，块间可以并行
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int block = 0; block < simdBlocks; ++block) {
+            int i = block * 8;
+            Vec3x8 p = loadVec3x8(data + i * 3);
+            __m256 distance = _mm256_sub_ps(dotWithConst(p, nx, ny, nz), planeD);
+            p.x = _mm256_sub_ps(p.x, _mm256_mul_ps(distance, nx));
+            p.y = _mm256_sub_ps(p.y, _mm256_mul_ps(distance, ny));
+            p.z = _mm256_sub_ps(p.z, _mm256_mul_ps(distance, nz));
+            storeVec3x8(data + i * 3, p);
+        }
 
-        glm::vec3 toVertex = vertex.position - point;
+        i = simdBlocks * 8;
+    }
+#endif
+
+    for (; i < vertexCount; ++i) {
+        glm::vec3 toVertex = positions[i] - point;
         float distance = glm::dot(toVertex, normalizedNormal);
 
-        vertex.position -= normalizedNormal * distance;
-        mesh.setVertex(i, vertex);
+        positions[i] -= normalizedNormal * distance;
     }
 
     mesh.calculateNormals();
 }
 
 void MeshOperations::projectToSphere(Mesh& mesh, const glm::vec3& center, float radius) {
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+    int i = 0;
+
+#if defined(__AVX2__)
+    if (vertexCount >= 8) {
+        float* data = &positions[0].x;
+        const __m256 cx = _mm256_set1_ps(center.x);
+        const __m256 cy = _mm256_set1_ps(center.y);
+        const __m256 cz = _mm256_set1_ps(center.z);
+        const __m256 radiusV = _mm256_set1_ps(radius);
+        // 标量路径的阈值 distance > 1e-4 等价于平方距离 > 1e-8
+        const __m256 minDist2 = _mm256_set1_ps(1e-8f);
+
+        int simdBlocks = vertexCount / 8;
+
+        // 8 顶点一块互不重叠，块间可以并行
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int block = 0; block < simdBlocks; ++block) {
+            int i = block * 8;
+            Vec3x8 p = loadVec3x8(data + i * 3);
+            Vec3x8 t{_mm256_sub_ps(p.x, cx),
+                     _mm256_sub_ps(p.y, cy),
+                     _mm256_sub_ps(p.z, cz)};
+            __m256 dist2 = dotWithConst(t, t.x, t.y, t.z);
+            __m256 scale = _mm256_mul_ps(rsqrtNewton(dist2), radiusV);
+            __m256 valid = _mm256_cmp_ps(dist2, minDist2, _CMP_GT_OQ);
+
+            p.x = _mm256_blendv_ps(p.x,
+                  _mm256_add_ps(cx, _mm256_mul_ps(t.x, scale)), valid);
+            p.y = _mm256_blendv_ps(p.y,
+                  _mm256_add_ps(cy, _mm256_mul_ps(t.y, scale)), valid);
+            p.z = _mm256_blendv_ps(p.z,
+                  _mm256_add_ps(cz, _mm256_mul_ps(t.z, scale)), valid);
+            storeVec3x8(data + i * 3, p);
+        }
+
+        i = simdBlocks * 8;
+    }
+#endif
 
-        glm::vec3 toVertex = vertex.position - center;
+    for (; i < vertexCount; ++i) {
+        glm::vec3 toVertex = positions[i] - center;
         float distance = glm::length(toVertex);
 
         if (distance > 0.0001f) {
-            vertex.position = center + glm::normalize(toVertex) * radius;
-            mesh.setVertex(i, vertex);
+            positions[i] = center + glm::normalize(toVertex) * radius;
         }
     }
 
@@ -732,19 +1272,59 @@ void MeshOperations::projectToSphere(Mesh& mesh, const glm::vec3& center, float
 void MeshOperations::projectToCylinder(Mesh& mesh, const glm::vec3& axis, float radius) {
     glm::vec3 normalizedAxis = glm::normalize(axis);
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
+    int i = 0;
+
+#if defined(__AVX2__)
+    if (vertexCount >= 8) {
+        float* data = &positions[0].x;
+        const __m256 ax = _mm256_set1_ps(normalizedAxis.x);
+        const __m256 ay = _mm256_set1_ps(normalizedAxis.y);
+        const __m256 az = _mm256_set1_ps(normalizedAxis.z);
+        const __m256 radiusV = _mm256_set1_ps(radius);
+        const __m256 minPerp2 = _mm256_set1_ps(1e-8f);
+
+        int simdBlocks = vertexCount / 8;
+
+        // 8 顶点一块互不重叠，块间可以并行
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int block = 0; block < simdBlocks; ++block) {
+            int i = block * 8;
+            Vec3x8 p = loadVec3x8(data + i * 3);
+            __m256 projection = dotWithConst(p, ax, ay, az);
+            __m256 projX = _mm256_mul_ps(projection, ax);
+            __m256 projY = _mm256_mul_ps(projection, ay);
+            __m256 projZ = _mm256_mul_ps(projection, az);
+            Vec3x8 perp{_mm256_sub_ps(p.x, projX),
+                        _mm256_sub_ps(p.y, projY),
+                        _mm256_sub_ps(p.z, projZ)};
+            __m256 perp2 = dotWithConst(perp, perp.x, perp.y, perp.z);
+            __m256 scale = _mm256_mul_ps(rsqrtNewton(perp2), radiusV);
+            __m256 valid = _mm256_cmp_ps(perp2, minPerp2, _CMP_GT_OQ);
+
+            p.x = _mm256_blendv_ps(p.x,
+                  _mm256_add_ps(projX, _mm256_mul_ps(perp.x, scale)), valid);
+            p.y = _mm256_blendv_ps(p.y,
+                  _mm256_add_ps(projY, _mm256_mul_ps(perp.y, scale)), valid);
+            p.z = _mm256_blendv_ps(p.z,
+                  _mm256_add_ps(projZ, _mm256_mul_ps(perp.z, scale)), valid);
+            storeVec3x8(data + i * 3, p);
+        }
 
-        glm::vec3 toVertex = vertex.position;
-        float projection = glm::dot(toVertex, normalizedAxis);
+        i = simdBlocks * 8;
+    }
+#endif
+
+    for (; i < vertexCount; ++i) {
+        float projection = glm::dot(positions[i], normalizedAxis);
         glm::vec3 projectionVec = projection * normalizedAxis;
-        glm::vec3 perpendicular = toVertex - projectionVec;
+        glm::vec3 perpendicular = positions[i] - projectionVec;
 
         float perpendicularLength = glm::length(perpendicular);
 
         if (perpendicularLength > 0.0001f) {
-            vertex.position = projectionVec + glm::normalize(perpendicular) * radius;
-            mesh.setVertex(i, vertex);
+            positions[i] = projectionVec + glm::normalize(perpendicular) * radius;
         }
     }
 
@@ -766,47 +1346,226 @@ void MeshOperations::triangulate(Mesh& mesh) {
         }
     }
 
-    for (int i = static_cast<int>(facesToRemove.size()) - 1; i >= 0; --i) {
-        mesh.removeFace(facesToRemove[i]);
-    }
+    mesh.removeFaces(std::span<const int>(facesToRemove));
 }
 
 void MeshOperations::quadrangulate(Mesh& mesh) {
 }
 
+namespace {
+
+// Forsyth评分：缓存位置得分（最近三个顶点定值，其余随深度幂衰减）
+// 加上价数加成（未发射面越少越优先，尽快关账）。activeFaces为0的
+// 顶点不会再被引用，给负分让它不影响候选。
+float cacheVertexScore(int cachePosition, int activeFaces) {
+    if (activeFaces == 0) {
+        return -1.0f;
+    }
+
+    const int cacheSize = 32;
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            score = 0.75f;
+        } else {
+            float scaled = 1.0f - static_cast<float>(cachePosition - 3)
+                                / static_cast<float>(cacheSize - 3);
+            score = scaled * std::sqrt(scaled);
+        }
+    }
+    return score + 2.0f / std::sqrt(static_cast<float>(activeFaces));
+}
+
+}
+
+void MeshOperations::optimizeForVertexCache(Mesh& mesh) {
+    int vertexCount = mesh.getVertexCount();
+    int faceCount = mesh.getFaceCount();
+    if (vertexCount == 0 || faceCount == 0) {
+        return;
+    }
+
+    const int cacheSize = 32;
+
+    // 面索引摊平 + 顶点→面 CSR，贪心过程里零分配
+    std::vector<int> faceOffsets(faceCount + 1, 0);
+    std::vector<int> faceIndices;
+    for (int i = 0; i < faceCount; ++i) {
+        const Face& face = mesh.getFace(i);
+        faceIndices.insert(faceIndices.end(), face.vertices.begin(), face.vertices.end());
+        faceOffsets[i + 1] = static_cast<int>(faceIndices.size());
+    }
+
+    std::vector<int> vertexFaceStart(vertexCount + 1, 0);
+    for (int fv : faceIndices) {
+        ++vertexFaceStart[fv + 1];
+    }
+    for (int v = 0; v < vertexCount; ++v) {
+        vertexFaceStart[v + 1] += vertexFaceStart[v];
+    }
+    std::vector<int> vertexFaces(faceIndices.size());
+    std::vector<int> fill(vertexFaceStart.begin(), vertexFaceStart.end() - 1);
+    for (int i = 0; i < faceCount; ++i) {
+        for (int k = faceOffsets[i]; k < faceOffsets[i + 1]; ++k) {
+            vertexFaces[fill[faceIndices[k]]++] = i;
+        }
+    }
+
+    std::vector<int> activeFaces(vertexCount, 0);
+    for (int v = 0; v < vertexCount; ++v) {
+        activeFaces[v] = vertexFaceStart[v + 1] - vertexFaceStart[v];
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (int v = 0; v < vertexCount; ++v) {
+        vertexScore[v] = cacheVertexScore(-1, activeFaces[v]);
+    }
+    std::vector<float> faceScore(faceCount, 0.0f);
+    for (int i = 0; i < faceCount; ++i) {
+        for (int k = faceOffsets[i]; k < faceOffsets[i + 1]; ++k) {
+            faceScore[i] += vertexScore[faceIndices[k]];
+        }
+    }
+
+    std::vector<uint8_t> emitted(faceCount, 0);
+    std::vector<int> emitOrder;
+    emitOrder.reserve(faceCount);
+    std::vector<int> cache;
+    cache.reserve(cacheSize * 2);
+    std::vector<int> scratch;
+
+    int bestFace = -1;
+    for (int emit = 0; emit < faceCount; ++emit) {
+        // 缓存邻域里没有候选时整表重扫一次（冷启动/连通分量切换）
+        if (bestFace == -1) {
+            float best = -1e30f;
+            for (int i = 0; i < faceCount; ++i) {
+                if (!emitted[i] && faceScore[i] > best) {
+                    best = faceScore[i];
+                    bestFace = i;
+                }
+            }
+        }
+
+        int face = bestFace;
+        emitted[face] = 1;
+        emitOrder.push_back(face);
+
+        // 发射面的顶点提到缓存最前端（MRU），溢出的从尾部逐出
+        scratch.assign(faceIndices.begin() + faceOffsets[face],
+                       faceIndices.begin() + faceOffsets[face + 1]);
+        for (int v : scratch) {
+            --activeFaces[v];
+            cache.erase(std::remove(cache.begin(), cache.end(), v), cache.end());
+        }
+        cache.insert(cache.begin(), scratch.begin(), scratch.end());
+
+        for (size_t pos = 0; pos < cache.size(); ++pos) {
+            int v = cache[pos];
+            cachePosition[v] = pos < static_cast<size_t>(cacheSize)
+                             ? static_cast<int>(pos) : -1;
+        }
+        if (cache.size() > static_cast<size_t>(cacheSize)) {
+            cache.resize(cacheSize);
+        }
+
+        // 重算缓存内顶点的得分，并在它们的关联面里挑下一个最佳面
+        bestFace = -1;
+        float best = -1e30f;
+        for (int v : cache) {
+            float updated = cacheVertexScore(cachePosition[v], activeFaces[v]);
+            float delta = updated - vertexScore[v];
+            vertexScore[v] = updated;
+            for (int k = vertexFaceStart[v]; k < vertexFaceStart[v + 1]; ++k) {
+                int fi = vertexFaces[k];
+                faceScore[fi] += delta;
+                if (!emitted[fi] && faceScore[fi] > best) {
+                    best = faceScore[fi];
+                    bestFace = fi;
+                }
+            }
+        }
+    }
+
+    // 第二遍：顶点按新面序的首次引用重排，索引访问即线性访问；
+    // 没被任何面引用的孤立顶点排到末尾
+    std::vector<int> remap(vertexCount, -1);
+    int nextIndex = 0;
+    for (int face : emitOrder) {
+        for (int k = faceOffsets[face]; k < faceOffsets[face + 1]; ++k) {
+            int v = faceIndices[k];
+            if (remap[v] == -1) {
+                remap[v] = nextIndex++;
+            }
+        }
+    }
+    for (int v = 0; v < vertexCount; ++v) {
+        if (remap[v] == -1) {
+            remap[v] = nextIndex++;
+        }
+    }
+
+    std::vector<int> inverse(vertexCount);
+    for (int v = 0; v < vertexCount; ++v) {
+        inverse[remap[v]] = v;
+    }
+
+    Mesh optimized;
+    optimized.reserveVertices(vertexCount);
+    optimized.reserveFaces(faceCount);
+    for (int v = 0; v < vertexCount; ++v) {
+        optimized.addVertex(mesh.getVertex(inverse[v]));
+    }
+    for (int face : emitOrder) {
+        scratch.clear();
+        for (int k = faceOffsets[face]; k < faceOffsets[face + 1]; ++k) {
+            scratch.push_back(remap[faceIndices[k]]);
+        }
+        optimized.addFace(scratch);
+    }
+
+    mesh = std::move(optimized);
+}
+
 void MeshOperations::calculateConvexHull(Mesh& mesh) {
 }
 
 void MeshOperations::relax(Mesh& mesh, int iterations) {
+    int vertexCount = mesh.getVertexCount();
+    std::vector<glm::vec3> newPositions(vertexCount);
+
+    std::vector<int> rowStart;
+    std::vector<int> neighbors;
+    buildAdjacencyCsr(mesh, rowStart, neighbors);
+
+    // 与 smooth 同一套方案：只读位置流采集，乒乓交换写回
     for (int iter = 0; iter < iterations; ++iter) {
-        std::vector<glm::vec3> newPositions(mesh.getVertexCount());
+        const std::vector<glm::vec3>& positions = mesh.getPositions();
 
-        for (int i = 0; i < mesh.getVertexCount(); ++i) {
-            const Vertex& vertex = mesh.getVertex(i);
-            std::vector<int> adjacentVertices = mesh.getAdjacentVertices(i);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+        for (int i = 0; i < vertexCount; ++i) {
+            int rowBegin = rowStart[i];
+            int rowEnd = rowStart[i + 1];
 
-            if (adjacentVertices.empty()) {
-                newPositions[i] = vertex.position;
+            if (rowBegin == rowEnd) {
+                newPositions[i] = positions[i];
                 continue;
             }
 
             glm::vec3 average(0.0f);
-            for (int av : adjacentVertices) {
-                average += mesh.getVertex(av).position;
+            for (int k = rowBegin; k < rowEnd; ++k) {
+                average += positions[neighbors[k]];
             }
-            average /= static_cast<float>(adjacentVertices.size());
 
-            newPositions[i] = average;
+            newPositions[i] = average / static_cast<float>(rowEnd - rowBegin);
         }
 
-        for (int i = 0; i < mesh.getVertexCount(); ++i) {
-            Vertex vertex = mesh.getVertex(i);
-            vertex.position = newPositions[i];
-            mesh.setVertex(i, vertex);
-        }
-
-        mesh.calculateNormals();
+        // O(1)乒乓交换代替整段拷回；迭代中间没人读法线，
+        // 面表扫描只在收敛后做一次。
+        mesh.swapPositions(newPositions);
     }
+    mesh.calculateNormals();
 }
 
 void MeshOperations::uniformRelax(Mesh& mesh, int iterations) {
@@ -816,14 +1575,15 @@ void MeshOperations::uniformRelax(Mesh& mesh, int iterations) {
 void MeshOperations::shrink(Mesh& mesh, float amount) {
     glm::vec3 center = mesh.getCenter();
 
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        Vertex vertex = mesh.getVertex(i);
+    glm::vec3* positions = mesh.positionsData();
+    int vertexCount = mesh.getVertexCount();
 
-        glm::vec3 toVertex = vertex.position - center;
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 toVertex = positions[i] - center;
         glm::vec3 direction = glm::normalize(toVertex);
 
-        vertex.position = center + direction * (glm::length(toVertex) - amount);
-        mesh.setVertex(i, vertex);
+        positions[i] = center + direction * (glm::length(toVertex) - amount);
     }
 
     mesh.calculateNormals();
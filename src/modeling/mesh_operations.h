@@ -44,7 +44,18 @@ public:
     static void smooth(Mesh& mesh, int iterations = 1, float factor = 0.5f);
     static void sharpen(Mesh& mesh, int iterations = 1, float factor = 0.5f);
 
+    template<typename F>
+    static void deform(Mesh& mesh, F&& deformer) {
+        glm::vec3* positions = mesh.positionsData();
+        int vertexCount = mesh.getVertexCount();
+
+        for (int i = 0; i < vertexCount; ++i) {
+            deformer(positions[i]);
+        }
+        mesh.calculateNormals();
+    }
     static void deform(Mesh& mesh, std::function<void(glm::vec3&)> deformer);
+    static void deformPositions(Mesh& mesh, std::span<const glm::vec3> newPositions);
     static void twist(Mesh& mesh, const glm::vec3& axis, float angle, float falloff = 0.0f);
     static void bend(Mesh& mesh, const glm::vec3& axis, float angle, float falloff = 0.0f);
     static void taper(Mesh& mesh, const glm::vec3& axis, float factor);
@@ -53,6 +64,13 @@ public:
 
     static void mirror(Mesh& mesh, const glm::vec3& axis, bool merge = true);
     static void array(Mesh& mesh, const glm::vec3& offset, int count);
+    template<int Count>
+    static void arrayN(Mesh& mesh, const glm::vec3& offset) {
+        static_assert(Count >= 1, "arrayN requires at least one instance");
+        if constexpr (Count > 1) {
+            array(mesh, offset, Count);
+        }
+    }
     static void radialArray(Mesh& mesh, const glm::vec3& axis, int count, float angle = 360.0f);
 
     static void projectToPlane(Mesh& mesh, const glm::vec3& point, const glm::vec3& normal);
@@ -62,6 +80,8 @@ public:
     static void triangulate(Mesh& mesh);
     static void quadrangulate(Mesh& mesh);
 
+    static void optimizeForVertexCache(Mesh& mesh);
+
     static void calculateConvexHull(Mesh& mesh);
 
     static void relax(Mesh& mesh, int iterations = 10);
@@ -1,10 +1,246 @@
 #include "subdivision.h"
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <span>
 #include <unordered_map>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace v3d {
 namespace modeling {
 
+namespace {
+
+// 细分步内的边查找表：(min,max)压成64位键，一次建表后面循环里O(1)命中，
+// 取代对整张边表的线性匹配。
+uint64_t edgeLookupKey(int v1, int v2) {
+    uint32_t lo = static_cast<uint32_t>(std::min(v1, v2));
+    uint32_t hi = static_cast<uint32_t>(std::max(v1, v2));
+    return (static_cast<uint64_t>(lo) << 32) | hi;
+}
+
+std::unordered_map<uint64_t, int> buildEdgeLookup(const std::vector<Edge>& edges) {
+    std::unordered_map<uint64_t, int> lookup;
+    lookup.reserve(edges.size() * 2);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        lookup[edgeLookupKey(edges[i].vertex1, edges[i].vertex2)] = static_cast<int>(i);
+    }
+    return lookup;
+}
+
+// 细分一步之后面的边数就固定了（Catmull-Clark出四边面、Loop出三角面）：
+// 面边数全网格一致时把它提成模板常量实例化发射趟，j循环整段展开，
+// 回卷判断和变长循环边界都在编译期折掉。KnownSize=0为混合边数的通用路径。
+int uniformFaceSize(const std::vector<Face>& faces) {
+    if (faces.empty()) {
+        return 0;
+    }
+    size_t size = faces[0].vertices.size();
+    for (const Face& face : faces) {
+        if (face.vertices.size() != size) {
+            return 0;
+        }
+    }
+    return static_cast<int>(size);
+}
+
+// 面点生成趟：四边面（首层CC之后的全部输入）走SSE通道——每个顶点一条
+// 128位非对齐载入覆盖x,y,z加下一顶点的x，四次加法一次乘法出结果，第4
+// 通道是搭载数据、落盘时丢弃。末顶点的载入会越过位置数组末尾，这类面
+// 和非四边面走标量求和。
+void computeFacePoints(const std::vector<Face>& faces,
+                       const std::vector<glm::vec3>& positions,
+                       std::vector<glm::vec3>& facePoints) {
+    int faceCount = static_cast<int>(faces.size());
+#if defined(__AVX2__)
+    const float* base = positions.empty() ? nullptr : &positions[0].x;
+    int lastVertex = static_cast<int>(positions.size()) - 1;
+#pragma omp parallel for schedule(dynamic, 1024) if (faceCount > 4096)
+    for (int i = 0; i < faceCount; ++i) {
+        const Face& face = faces[i];
+        const auto& fv = face.vertices;
+        if (fv.size() == 4 && fv[0] < lastVertex && fv[1] < lastVertex &&
+            fv[2] < lastVertex && fv[3] < lastVertex) {
+            // 按标量路径的顺序依次累加（而非两两配对），结果与标量逐位一致；
+            // 乘0.25与除以4在二进制下等价
+            __m128 sum = _mm_loadu_ps(base + static_cast<size_t>(fv[0]) * 3);
+            sum = _mm_add_ps(sum, _mm_loadu_ps(base + static_cast<size_t>(fv[1]) * 3));
+            sum = _mm_add_ps(sum, _mm_loadu_ps(base + static_cast<size_t>(fv[2]) * 3));
+            sum = _mm_add_ps(sum, _mm_loadu_ps(base + static_cast<size_t>(fv[3]) * 3));
+            sum = _mm_mul_ps(sum, _mm_set1_ps(0.25f));
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, sum);
+            facePoints[i] = glm::vec3(lanes[0], lanes[1], lanes[2]);
+        } else {
+            glm::vec3 scalarSum(0.0f);
+            for (int vi : fv) {
+                scalarSum += positions[vi];
+            }
+            facePoints[i] = scalarSum / static_cast<float>(fv.size());
+        }
+    }
+#else
+#pragma omp parallel for schedule(dynamic, 1024) if (faceCount > 4096)
+    for (int i = 0; i < faceCount; ++i) {
+        const Face& face = faces[i];
+        glm::vec3 sum(0.0f);
+        for (int vi : face.vertices) {
+            sum += positions[vi];
+        }
+        facePoints[i] = sum / static_cast<float>(face.vertices.size());
+    }
+#endif
+}
+
+// [DOC 6]式两数组无向边表示：EMAP[faceEmitOffset[f]+c]直接给出面f第c条
+// 有向边对应的去重边索引。建表时每条有向边查一次哈希表，发射趟里原先
+// 每角1~2次的哈希探查就全部变成顺序数组读取
+std::vector<int> buildDirectedEdgeMap(const std::vector<Face>& faces,
+                                      const std::vector<int>& faceEmitOffset,
+                                      const std::unordered_map<uint64_t, int>& edgeLookup) {
+    int faceCount = static_cast<int>(faces.size());
+    std::vector<int> directedEdgeMap(faceEmitOffset[faceCount]);
+#pragma omp parallel for schedule(static) if (faceCount > 4096)
+    for (int i = 0; i < faceCount; ++i) {
+        const Face& face = faces[i];
+        size_t count = face.vertices.size();
+        for (size_t j = 0; j < count; ++j) {
+            size_t j1 = (j + 1 == count) ? 0 : j + 1;
+            directedEdgeMap[faceEmitOffset[i] + j] =
+                edgeLookup.at(edgeLookupKey(face.vertices[j], face.vertices[j1]));
+        }
+    }
+    return directedEdgeMap;
+}
+
+template<int KnownSize>
+void emitCatmullClarkQuads(const std::vector<Face>& faces,
+                           const std::vector<int>& directedEdgeMap,
+                           const std::vector<int>& facePointMap,
+                           const std::vector<int>& edgePointMap,
+                           const std::vector<int>& vertexPointMap,
+                           const std::vector<int>& faceEmitOffset,
+                           std::vector<int>& newQuads) {
+    int faceCount = static_cast<int>(faces.size());
+#pragma omp parallel for schedule(dynamic, 1024) if (faceCount > 4096)
+    for (int i = 0; i < faceCount; ++i) {
+        const Face& face = faces[i];
+        int facePointIndex = facePointMap[i];
+
+        // 环绕索引用条件回卷代替取模：每条边两次整数除法在高细分级别下
+        // 累积可观，条件形式编译成cmov；KnownSize>0时整个判断是编译期常量
+        size_t count = KnownSize > 0 ? static_cast<size_t>(KnownSize) : face.vertices.size();
+        for (size_t j = 0; j < count; ++j) {
+            size_t j1 = (j + 1 == count) ? 0 : j + 1;
+            int v0 = face.vertices[j];
+
+            int edgeIndex = directedEdgeMap[faceEmitOffset[i] + j];
+            int edgePointIndex = edgePointMap[edgeIndex];
+            int vertexPointIndex = vertexPointMap[v0];
+
+            int nextEdgeIndex = directedEdgeMap[faceEmitOffset[i] + j1];
+            int nextEdgePointIndex = edgePointMap[nextEdgeIndex];
+
+            size_t base = (static_cast<size_t>(faceEmitOffset[i]) + j) * 4;
+            newQuads[base] = vertexPointIndex;
+            newQuads[base + 1] = edgePointIndex;
+            newQuads[base + 2] = facePointIndex;
+            newQuads[base + 3] = nextEdgePointIndex;
+        }
+    }
+}
+
+template<int KnownSize>
+void emitLoopTris(const std::vector<Face>& faces,
+                  const std::vector<int>& directedEdgeMap,
+                  const std::vector<int>& edgePointMap,
+                  const std::vector<int>& vertexPointMap,
+                  const std::vector<int>& faceEmitOffset,
+                  std::vector<int>& newTris) {
+    int faceCount = static_cast<int>(faces.size());
+#pragma omp parallel for schedule(dynamic, 1024) if (faceCount > 4096)
+    for (int i = 0; i < faceCount; ++i) {
+        const Face& face = faces[i];
+
+        // 同emitCatmullClarkQuads：条件回卷代替取模
+        size_t count = KnownSize > 0 ? static_cast<size_t>(KnownSize) : face.vertices.size();
+        for (size_t j = 0; j < count; ++j) {
+            size_t j1 = (j + 1 == count) ? 0 : j + 1;
+            int v0 = face.vertices[j];
+
+            int edgeIndex1 = directedEdgeMap[faceEmitOffset[i] + j];
+            int edgeIndex2 = directedEdgeMap[faceEmitOffset[i] + j1];
+
+            size_t base = (static_cast<size_t>(faceEmitOffset[i]) + j) * 3;
+            newTris[base] = vertexPointMap[v0];
+            newTris[base + 1] = edgePointMap[edgeIndex1];
+            newTris[base + 2] = edgePointMap[edgeIndex2];
+        }
+    }
+}
+
+// 细分结果缓存：位置流+面索引+方法+层数的FNV-1a指纹作键。静态网格
+// 逐帧重复走subdivide()时直接复用上次的结果，只有指纹变了才重算；
+// 容量收得很小，按访问顺序淘汰最久未用的条目。
+constexpr size_t kSubdivisionCacheCapacity = 8;
+
+uint64_t fnv1aAppend(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t subdivisionCacheKey(const Mesh& mesh, SubdivisionMethod method, int levels) {
+    uint64_t hash = 14695981039346656037ull;
+    const std::vector<glm::vec3>& positions = mesh.getPositions();
+    hash = fnv1aAppend(hash, positions.data(), positions.size() * sizeof(glm::vec3));
+    for (int i = 0; i < mesh.getFaceCount(); ++i) {
+        const Face& face = mesh.getFace(i);
+        int vertexCount = static_cast<int>(face.vertices.size());
+        hash = fnv1aAppend(hash, &vertexCount, sizeof(vertexCount));
+        hash = fnv1aAppend(hash, face.vertices.begin(), face.vertices.size() * sizeof(int));
+    }
+    uint8_t tag[2] = { static_cast<uint8_t>(method), static_cast<uint8_t>(levels) };
+    hash = fnv1aAppend(hash, tag, sizeof(tag));
+    return hash;
+}
+
+std::mutex subdivisionCacheMutex;
+std::unordered_map<uint64_t, Mesh> subdivisionCache;
+std::vector<uint64_t> subdivisionCacheOrder;
+
+void touchSubdivisionCacheKey(uint64_t key) {
+    auto it = std::find(subdivisionCacheOrder.begin(), subdivisionCacheOrder.end(), key);
+    if (it != subdivisionCacheOrder.end()) {
+        subdivisionCacheOrder.erase(it);
+    }
+    subdivisionCacheOrder.push_back(key);
+}
+
+}
+
 void Subdivision::subdivide(Mesh& mesh, SubdivisionMethod method, int levels) {
+    if (levels <= 0 || mesh.getFaceCount() == 0) {
+        return;
+    }
+
+    uint64_t cacheKey = subdivisionCacheKey(mesh, method, levels);
+    {
+        std::lock_guard<std::mutex> lock(subdivisionCacheMutex);
+        auto it = subdivisionCache.find(cacheKey);
+        if (it != subdivisionCache.end()) {
+            touchSubdivisionCacheKey(cacheKey);
+            mesh = it->second;
+            return;
+        }
+    }
+
     for (int i = 0; i < levels; ++i) {
         switch (method) {
             case SubdivisionMethod::CatmullClark:
@@ -24,18 +260,34 @@ void Subdivision::subdivide(Mesh& mesh, SubdivisionMethod method, int levels) {
                 break;
         }
     }
+
+    std::lock_guard<std::mutex> lock(subdivisionCacheMutex);
+    if (subdivisionCache.size() >= kSubdivisionCacheCapacity && !subdivisionCacheOrder.empty()) {
+        subdivisionCache.erase(subdivisionCacheOrder.front());
+        subdivisionCacheOrder.erase(subdivisionCacheOrder.begin());
+    }
+    subdivisionCache.emplace(cacheKey, mesh);
+    subdivisionCacheOrder.push_back(cacheKey);
 }
 
 void Subdivision::catmullClark(Mesh& mesh, int levels) {
+    // 中间层的顶点法线没有消费方（各Step只读位置与拓扑），
+    // 法线只在最后一层算一次，levels-1趟法线遍历省掉
     for (int i = 0; i < levels; ++i) {
         catmullClarkStep(mesh);
     }
+    if (levels > 0) {
+        mesh.calculateNormals();
+    }
 }
 
 void Subdivision::loop(Mesh& mesh, int levels) {
     for (int i = 0; i < levels; ++i) {
         loopStep(mesh);
     }
+    if (levels > 0) {
+        mesh.calculateNormals();
+    }
 }
 
 void Subdivision::dooSabin(Mesh& mesh, int levels) {
@@ -48,18 +300,27 @@ void Subdivision::midpoint(Mesh& mesh, int levels) {
     for (int i = 0; i < levels; ++i) {
         midpointStep(mesh);
     }
+    if (levels > 0) {
+        mesh.calculateNormals();
+    }
 }
 
 void Subdivision::linear(Mesh& mesh, int levels) {
     for (int i = 0; i < levels; ++i) {
         linearStep(mesh);
     }
+    if (levels > 0) {
+        mesh.calculateNormals();
+    }
 }
 
 void Subdivision::smooth(Mesh& mesh, int iterations) {
     for (int i = 0; i < iterations; ++i) {
         catmullClarkStep(mesh);
     }
+    if (iterations > 0) {
+        mesh.calculateNormals();
+    }
 }
 
 void Subdivision::sharpen(Mesh& mesh, int iterations) {
@@ -69,486 +330,474 @@ void Subdivision::tessellate(Mesh& mesh, int iterations) {
     for (int i = 0; i < iterations; ++i) {
         linearStep(mesh);
     }
+    if (iterations > 0) {
+        mesh.calculateNormals();
+    }
 }
 
 void Subdivision::catmullClarkStep(Mesh& mesh) {
-    std::unordered_map<int, int> facePointMap;
-    std::unordered_map<int, int> edgePointMap;
-
-    const auto& vertices = mesh.getVertices();
-    const auto& faces = mesh.getFaces();
-    const auto& edges = mesh.getEdges();
-
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        const Face& face = faces[i];
-        glm::vec3 facePoint = calculateFacePoint(face, vertices);
-
-        Vertex newVertex;
-        newVertex.position = facePoint;
-        int newVertexIndex = mesh.addVertex(newVertex);
-        facePointMap[i] = newVertexIndex;
-    }
-
-    for (int i = 0; i < mesh.getEdgeCount(); ++i) {
-        const Edge& edge = edges[i];
-        glm::vec3 edgePoint = calculateEdgePoint(edge, vertices, faces);
-
-        Vertex newVertex;
-        newVertex.position = edgePoint;
-        int newVertexIndex = mesh.addVertex(newVertex);
-        edgePointMap[i] = newVertexIndex;
+    const std::vector<glm::vec3> positions = mesh.getPositions();
+    const std::vector<Face> faces = mesh.getFaces();
+    const std::vector<Edge> edges = mesh.getEdges();
+    std::unordered_map<uint64_t, int> edgeLookup = buildEdgeLookup(edges);
+
+    int originalVertexCount = static_cast<int>(positions.size());
+    int faceCount = static_cast<int>(faces.size());
+    int edgeCount = static_cast<int>(edges.size());
+
+    // 三类细分点都写预定大小的数组、按索引落位，迭代间彼此独立，
+    // 生成趟可以直接并行；旧索引编号改为纯算术推导，不再靠往待
+    // 清空的网格里添加占位顶点来分配。小网格沿用4096阈值走串行，
+    // 免得线程编组开销反超收益。
+    std::vector<glm::vec3> facePoints(faceCount);
+    computeFacePoints(faces, positions, facePoints);
+
+    std::vector<glm::vec3> edgePoints(edgeCount);
+#pragma omp parallel for schedule(static) if (edgeCount > 4096)
+    for (int i = 0; i < edgeCount; ++i) {
+        edgePoints[i] = calculateEdgePoint(edges[i], positions, facePoints);
+    }
+
+    // 顶点→面 / 顶点→边 的CSR邻接各建一次（计数、前缀和、回填三趟），
+    // 顶点点趟按行切片取用，不再每个顶点查询邻接并分配临时vector
+    std::vector<int> vertexFaceOffsets(originalVertexCount + 1, 0);
+    for (const Face& face : faces) {
+        for (int fv : face.vertices) {
+            ++vertexFaceOffsets[fv + 1];
+        }
     }
-
-    std::unordered_map<int, int> vertexPointMap;
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        glm::vec3 vertexPoint = calculateVertexPoint(i, mesh);
-
-        Vertex newVertex;
-        newVertex.position = vertexPoint;
-        int newVertexIndex = mesh.addVertex(newVertex);
-        vertexPointMap[i] = newVertexIndex;
+    for (int i = 0; i < originalVertexCount; ++i) {
+        vertexFaceOffsets[i + 1] += vertexFaceOffsets[i];
     }
-
-    std::vector<std::vector<int>> newFaces;
-
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        const Face& face = faces[i];
-        int facePointIndex = facePointMap[i];
-
-        for (size_t j = 0; j < face.vertices.size(); ++j) {
-            int v0 = face.vertices[j];
-            int v1 = face.vertices[(j + 1) % face.vertices.size()];
-
-            int edgeIndex = -1;
-            for (int ei = 0; ei < mesh.getEdgeCount(); ++ei) {
-                const Edge& edge = edges[ei];
-                if ((edge.vertex1 == v0 && edge.vertex2 == v1) ||
-                    (edge.vertex1 == v1 && edge.vertex2 == v0)) {
-                    edgeIndex = ei;
-                    break;
-                }
-            }
-
-            int edgePointIndex = edgePointMap[edgeIndex];
-            int vertexPointIndex = vertexPointMap[v0];
-
-            int nextEdgeIndex = -1;
-            int nextV0 = v1;
-            int nextV1 = face.vertices[(j + 2) % face.vertices.size()];
-            for (int ei = 0; ei < mesh.getEdgeCount(); ++ei) {
-                const Edge& edge = edges[ei];
-                if ((edge.vertex1 == nextV0 && edge.vertex2 == nextV1) ||
-                    (edge.vertex1 == nextV1 && edge.vertex2 == nextV0)) {
-                    nextEdgeIndex = ei;
-                    break;
-                }
+    std::vector<int> vertexFaceList(vertexFaceOffsets[originalVertexCount]);
+    {
+        std::vector<int> fill(vertexFaceOffsets.begin(), vertexFaceOffsets.end() - 1);
+        for (int f = 0; f < faceCount; ++f) {
+            for (int fv : faces[f].vertices) {
+                vertexFaceList[fill[fv]++] = f;
             }
-            int nextEdgePointIndex = edgePointMap[nextEdgeIndex];
-
-            newFaces.push_back({vertexPointIndex, edgePointIndex, facePointIndex, nextEdgePointIndex});
         }
     }
 
-    mesh.clear();
-
-    for (const auto& pair : vertexPointMap) {
-        mesh.addVertex(vertices[pair.first]);
-    }
-
-    for (const auto& pair : facePointMap) {
-        const Face& face = faces[pair.first];
-        glm::vec3 facePoint = calculateFacePoint(face, vertices);
-        mesh.addVertex(Vertex(facePoint));
+    std::vector<int> vertexEdgeOffsets(originalVertexCount + 1, 0);
+    for (const Edge& edge : edges) {
+        ++vertexEdgeOffsets[edge.vertex1 + 1];
+        ++vertexEdgeOffsets[edge.vertex2 + 1];
     }
-
-    for (const auto& pair : edgePointMap) {
-        const Edge& edge = edges[pair.first];
-        glm::vec3 edgePoint = calculateEdgePoint(edge, vertices, faces);
-        mesh.addVertex(Vertex(edgePoint));
+    for (int i = 0; i < originalVertexCount; ++i) {
+        vertexEdgeOffsets[i + 1] += vertexEdgeOffsets[i];
     }
-
-    for (const auto& newFace : newFaces) {
-        mesh.addFace(newFace);
+    std::vector<int> vertexEdgeList(vertexEdgeOffsets[originalVertexCount]);
+    {
+        std::vector<int> fill(vertexEdgeOffsets.begin(), vertexEdgeOffsets.end() - 1);
+        for (int e = 0; e < edgeCount; ++e) {
+            vertexEdgeList[fill[edges[e].vertex1]++] = e;
+            vertexEdgeList[fill[edges[e].vertex2]++] = e;
+        }
     }
 
-    mesh.calculateNormals();
+    std::vector<glm::vec3> vertexPoints(originalVertexCount);
+#pragma omp parallel for schedule(dynamic, 1024) if (originalVertexCount > 4096)
+    for (int i = 0; i < originalVertexCount; ++i) {
+        std::span<const int> adjacentFaces(vertexFaceList.data() + vertexFaceOffsets[i],
+                                           vertexFaceOffsets[i + 1] - vertexFaceOffsets[i]);
+        std::span<const int> adjacentEdges(vertexEdgeList.data() + vertexEdgeOffsets[i],
+                                           vertexEdgeOffsets[i + 1] - vertexEdgeOffsets[i]);
+        vertexPoints[i] = calculateVertexPoint(i, positions, adjacentFaces, adjacentEdges,
+                                               facePoints, edgePoints);
+    }
+
+    // 键就是0..N-1的稠密索引，直接用数组当映射表，省掉哈希和桶分配
+    std::vector<int> facePointMap(faceCount);
+    std::vector<int> edgePointMap(edgeCount);
+    std::vector<int> vertexPointMap(originalVertexCount);
+    for (int i = 0; i < faceCount; ++i) {
+        facePointMap[i] = originalVertexCount + i;
+    }
+    for (int i = 0; i < edgeCount; ++i) {
+        edgePointMap[i] = originalVertexCount + faceCount + i;
+    }
+    for (int i = 0; i < originalVertexCount; ++i) {
+        vertexPointMap[i] = originalVertexCount + faceCount + edgeCount + i;
+    }
+
+    // 每个k边面固定产出k个子面，输出槽位提前算好，面循环并行
+    // 按槽位写入，发射顺序与串行版一致。edgeLookup在并行段里只读，
+    // 用at()查询：operator[]的隐式插入在这里就是数据竞争。
+    std::vector<int> faceEmitOffset(faceCount + 1, 0);
+    for (int i = 0; i < faceCount; ++i) {
+        faceEmitOffset[i + 1] = faceEmitOffset[i] + static_cast<int>(faces[i].vertices.size());
+    }
+
+    // Catmull-Clark固定产出四边面：子面索引摊平进一条stride=4的
+    // 连续缓冲，不再每个子面挂一个小vector
+    std::vector<int> newQuads(static_cast<size_t>(faceEmitOffset[faceCount]) * 4);
+
+    std::vector<int> directedEdgeMap = buildDirectedEdgeMap(faces, faceEmitOffset, edgeLookup);
+
+    // 第一层之后输入必然全是四边面，三角面网格首层也常见：两者走
+    // 编译期定长实例，其余混合边数网格落回通用路径
+    switch (uniformFaceSize(faces)) {
+        case 4:
+            emitCatmullClarkQuads<4>(faces, directedEdgeMap, facePointMap, edgePointMap,
+                                     vertexPointMap, faceEmitOffset, newQuads);
+            break;
+        case 3:
+            emitCatmullClarkQuads<3>(faces, directedEdgeMap, facePointMap, edgePointMap,
+                                     vertexPointMap, faceEmitOffset, newQuads);
+            break;
+        default:
+            emitCatmullClarkQuads<0>(faces, directedEdgeMap, facePointMap, edgePointMap,
+                                     vertexPointMap, faceEmitOffset, newQuads);
+            break;
+    }
+
+    // 细分结果搭进新Mesh再整体move回去：clear()后在旧对象上重新
+    // 生长会经历一轮缩容再扩容，这里终态大小已知，一次预留到位。
+    // 顶点按添加时的索引顺序排列：面点、边点、顶点点依次排列，
+    // 与newFaces里记录的旧索引只差一个原始顶点数的统一偏移。
+    Mesh newMesh;
+    newMesh.reserveVertices(faceCount + edgeCount + originalVertexCount);
+    newMesh.reserveFaces(faceEmitOffset[faceCount]);
+
+    newMesh.addVertices(facePoints);
+    newMesh.addVertices(edgePoints);
+    newMesh.addVertices(vertexPoints);
+
+    for (int& v : newQuads) {
+        v -= originalVertexCount;
+    }
+    newMesh.addFaces(newQuads, 4);
+
+    mesh = std::move(newMesh);
 }
 
 void Subdivision::loopStep(Mesh& mesh) {
-    const auto& vertices = mesh.getVertices();
-    const auto& faces = mesh.getFaces();
-    const auto& edges = mesh.getEdges();
-
-    std::unordered_map<int, int> edgePointMap;
-
-    for (int i = 0; i < mesh.getEdgeCount(); ++i) {
+    const std::vector<glm::vec3> positions = mesh.getPositions();
+    const std::vector<Face> faces = mesh.getFaces();
+    const std::vector<Edge> edges = mesh.getEdges();
+    std::unordered_map<uint64_t, int> edgeLookup = buildEdgeLookup(edges);
+
+    int originalVertexCount = static_cast<int>(positions.size());
+    int faceCount = static_cast<int>(faces.size());
+    int edgeCount = static_cast<int>(edges.size());
+
+    // 同catmullClarkStep：各生成趟写预定大小数组，按索引落位并行。
+    // 边界/内部分支先折成每边权重与对顶索引（边界取w2=0、对顶取别名vertex1，
+    // 读取安全且贡献为零），算术趟变成无分支直线代码，混合网格上不再抖动分支预测
+    std::vector<int> oppositeVertex1(edgeCount);
+    std::vector<int> oppositeVertex2(edgeCount);
+    std::vector<float> edgeWeight1(edgeCount);
+    std::vector<float> edgeWeight2(edgeCount);
+#pragma omp parallel for schedule(static) if (edgeCount > 4096)
+    for (int i = 0; i < edgeCount; ++i) {
         const Edge& edge = edges[i];
+        bool boundary = edge.isBoundary();
 
-        if (edge.isBoundary()) {
-            const Vertex& v1 = vertices[edge.vertex1];
-            const Vertex& v2 = vertices[edge.vertex2];
-
-            glm::vec3 edgePoint = (v1.position + v2.position) * 0.5f;
-
-            Vertex newVertex;
-            newVertex.position = edgePoint;
-            int newVertexIndex = mesh.addVertex(newVertex);
-            edgePointMap[i] = newVertexIndex;
-        } else {
-            const Face& face1 = faces[edge.face1];
-            const Face& face2 = faces[edge.face2];
-
-            int oppositeVertex1 = -1;
-            int oppositeVertex2 = -1;
-
-            for (int fv : face1.vertices) {
+        int opposite1 = edge.vertex1;
+        int opposite2 = edge.vertex1;
+        if (!boundary) {
+            for (int fv : faces[edge.face1].vertices) {
                 if (fv != edge.vertex1 && fv != edge.vertex2) {
-                    oppositeVertex1 = fv;
+                    opposite1 = fv;
                     break;
                 }
             }
-
-            for (int fv : face2.vertices) {
+            for (int fv : faces[edge.face2].vertices) {
                 if (fv != edge.vertex1 && fv != edge.vertex2) {
-                    oppositeVertex2 = fv;
+                    opposite2 = fv;
                     break;
                 }
             }
+        }
 
-            const Vertex& v1 = vertices[edge.vertex1];
-            const Vertex& v2 = vertices[edge.vertex2];
-            const Vertex& v3 = vertices[oppositeVertex1];
-            const Vertex& v4 = vertices[oppositeVertex2];
-
-            glm::vec3 edgePoint = (v1.position + v2.position) * 0.375f +
-                                 (v3.position + v4.position) * 0.125f;
+        oppositeVertex1[i] = opposite1;
+        oppositeVertex2[i] = opposite2;
+        edgeWeight1[i] = boundary ? 0.5f : 0.375f;
+        edgeWeight2[i] = boundary ? 0.0f : 0.125f;
+    }
 
-            Vertex newVertex;
-            newVertex.position = edgePoint;
-            int newVertexIndex = mesh.addVertex(newVertex);
-            edgePointMap[i] = newVertexIndex;
+    std::vector<glm::vec3> edgePoints(edgeCount);
+#pragma omp parallel for schedule(static) if (edgeCount > 4096)
+    for (int i = 0; i < edgeCount; ++i) {
+        const Edge& edge = edges[i];
+        edgePoints[i] = (positions[edge.vertex1] + positions[edge.vertex2]) * edgeWeight1[i] +
+                        (positions[oppositeVertex1[i]] + positions[oppositeVertex2[i]]) * edgeWeight2[i];
+    }
+
+    // 顶点→邻顶点CSR建一次，顶点点趟按行取用，省掉每顶点的
+    // getAdjacentVertices查询和临时vector
+    std::vector<int> adjOffsets(originalVertexCount + 1, 0);
+    for (const Edge& edge : edges) {
+        ++adjOffsets[edge.vertex1 + 1];
+        ++adjOffsets[edge.vertex2 + 1];
+    }
+    for (int i = 0; i < originalVertexCount; ++i) {
+        adjOffsets[i + 1] += adjOffsets[i];
+    }
+    std::vector<int> adjVertices(adjOffsets[originalVertexCount]);
+    {
+        std::vector<int> fill(adjOffsets.begin(), adjOffsets.end() - 1);
+        for (const Edge& edge : edges) {
+            adjVertices[fill[edge.vertex1]++] = edge.vertex2;
+            adjVertices[fill[edge.vertex2]++] = edge.vertex1;
         }
     }
 
-    std::unordered_map<int, int> vertexPointMap;
-    for (int i = 0; i < mesh.getVertexCount(); ++i) {
-        const Vertex& vertex = vertices[i];
-        std::vector<int> adjacentVertices = mesh.getAdjacentVertices(i);
+    std::vector<glm::vec3> vertexPoints(originalVertexCount);
+#pragma omp parallel for schedule(dynamic, 1024) if (originalVertexCount > 4096)
+    for (int i = 0; i < originalVertexCount; ++i) {
+        int rowBegin = adjOffsets[i];
+        int rowEnd = adjOffsets[i + 1];
+        size_t valence = static_cast<size_t>(rowEnd - rowBegin);
 
         float beta = 0.0f;
-        if (adjacentVertices.size() == 3) {
+        if (valence == 3) {
             beta = 3.0f / 16.0f;
         } else {
-            beta = 3.0f / (8.0f * adjacentVertices.size());
+            beta = 3.0f / (8.0f * valence);
         }
 
         glm::vec3 sum(0.0f);
-        for (int av : adjacentVertices) {
-            sum += vertices[av].position;
+        for (int k = rowBegin; k < rowEnd; ++k) {
+            sum += positions[adjVertices[k]];
         }
 
-        glm::vec3 vertexPoint = vertex.position * (1.0f - adjacentVertices.size() * beta) +
-                                sum * beta;
-
-        Vertex newVertex;
-        newVertex.position = vertexPoint;
-        int newVertexIndex = mesh.addVertex(newVertex);
-        vertexPointMap[i] = newVertexIndex;
+        vertexPoints[i] = positions[i] * (1.0f - valence * beta) +
+                          sum * beta;
     }
 
-    std::vector<std::vector<int>> newFaces;
-
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        const Face& face = faces[i];
-
-        for (size_t j = 0; j < face.vertices.size(); ++j) {
-            int v0 = face.vertices[j];
-            int v1 = face.vertices[(j + 1) % face.vertices.size()];
-            int v2 = face.vertices[(j + 2) % face.vertices.size()];
-
-            int edgeIndex1 = -1;
-            int edgeIndex2 = -1;
-
-            for (int ei = 0; ei < mesh.getEdgeCount(); ++ei) {
-                const Edge& edge = edges[ei];
-                if ((edge.vertex1 == v0 && edge.vertex2 == v1) ||
-                    (edge.vertex1 == v1 && edge.vertex2 == v0)) {
-                    edgeIndex1 = ei;
-                }
-                if ((edge.vertex1 == v1 && edge.vertex2 == v2) ||
-                    (edge.vertex1 == v2 && edge.vertex2 == v1)) {
-                    edgeIndex2 = ei;
-                }
-            }
-
-            int vertexPoint0 = vertexPointMap[v0];
-            int edgePoint1 = edgePointMap[edgeIndex1];
-            int edgePoint2 = edgePointMap[edgeIndex2];
-
-            newFaces.push_back({vertexPoint0, edgePoint1, edgePoint2});
-        }
+    // 同catmullClarkStep：稠密索引映射用数组
+    std::vector<int> edgePointMap(edgeCount);
+    std::vector<int> vertexPointMap(originalVertexCount);
+    for (int i = 0; i < edgeCount; ++i) {
+        edgePointMap[i] = originalVertexCount + i;
+    }
+    for (int i = 0; i < originalVertexCount; ++i) {
+        vertexPointMap[i] = originalVertexCount + edgeCount + i;
     }
 
-    mesh.clear();
-
-    for (const auto& pair : vertexPointMap) {
-        mesh.addVertex(vertices[pair.first]);
+    std::vector<int> faceEmitOffset(faceCount + 1, 0);
+    for (int i = 0; i < faceCount; ++i) {
+        faceEmitOffset[i + 1] = faceEmitOffset[i] + static_cast<int>(faces[i].vertices.size());
     }
 
-    for (const auto& pair : edgePointMap) {
-        const Edge& edge = edges[pair.first];
+    // 同catmullClarkStep：固定三角面，摊平进stride=3的连续缓冲
+    std::vector<int> newTris(static_cast<size_t>(faceEmitOffset[faceCount]) * 3);
 
-        if (edge.isBoundary()) {
-            const Vertex& v1 = vertices[edge.vertex1];
-            const Vertex& v2 = vertices[edge.vertex2];
-            glm::vec3 edgePoint = (v1.position + v2.position) * 0.5f;
-            mesh.addVertex(Vertex(edgePoint));
-        } else {
-            const Face& face1 = faces[edge.face1];
-            const Face& face2 = faces[edge.face2];
+    std::vector<int> directedEdgeMap = buildDirectedEdgeMap(faces, faceEmitOffset, edgeLookup);
 
-            int oppositeVertex1 = -1;
-            int oppositeVertex2 = -1;
-
-            for (int fv : face1.vertices) {
-                if (fv != edge.vertex1 && fv != edge.vertex2) {
-                    oppositeVertex1 = fv;
-                    break;
-                }
-            }
-
-            for (int fv : face2.vertices) {
-                if (fv != edge.vertex1 && fv != edge.vertex2) {
-                    oppositeVertex2 = fv;
-                    break;
-                }
-            }
+    // Loop细分的输入按理全是三角面：走编译期定长实例，混合网格兜底
+    if (uniformFaceSize(faces) == 3) {
+        emitLoopTris<3>(faces, directedEdgeMap, edgePointMap, vertexPointMap,
+                        faceEmitOffset, newTris);
+    } else {
+        emitLoopTris<0>(faces, directedEdgeMap, edgePointMap, vertexPointMap,
+                        faceEmitOffset, newTris);
+    }
 
-            const Vertex& v1 = vertices[edge.vertex1];
-            const Vertex& v2 = vertices[edge.vertex2];
-            const Vertex& v3 = vertices[oppositeVertex1];
-            const Vertex& v4 = vertices[oppositeVertex2];
+    // 同catmullClarkStep：搭进预留好的新Mesh（边点在前、顶点点在后），
+    // newFaces的旧索引统一减去原始顶点数即可对上。
+    Mesh newMesh;
+    newMesh.reserveVertices(edgeCount + originalVertexCount);
+    newMesh.reserveFaces(faceEmitOffset[faceCount]);
 
-            glm::vec3 edgePoint = (v1.position + v2.position) * 0.375f +
-                                 (v3.position + v4.position) * 0.125f;
-            mesh.addVertex(Vertex(edgePoint));
-        }
-    }
+    newMesh.addVertices(edgePoints);
+    newMesh.addVertices(vertexPoints);
 
-    for (const auto& newFace : newFaces) {
-        mesh.addFace(newFace);
+    for (int& v : newTris) {
+        v -= originalVertexCount;
     }
+    newMesh.addFaces(newTris, 3);
 
-    mesh.calculateNormals();
+    mesh = std::move(newMesh);
 }
 
 void Subdivision::dooSabinStep(Mesh& mesh) {
 }
 
 void Subdivision::midpointStep(Mesh& mesh) {
-    const auto& vertices = mesh.getVertices();
-    const auto& faces = mesh.getFaces();
-    const auto& edges = mesh.getEdges();
-
-    std::unordered_map<int, int> edgePointMap;
-
-    for (int i = 0; i < mesh.getEdgeCount(); ++i) {
+    const std::vector<glm::vec3> positions = mesh.getPositions();
+    const std::vector<Face> faces = mesh.getFaces();
+    const std::vector<Edge> edges = mesh.getEdges();
+    std::unordered_map<uint64_t, int> edgeLookup = buildEdgeLookup(edges);
+
+    int originalVertexCount = static_cast<int>(positions.size());
+    int faceCount = static_cast<int>(faces.size());
+    int edgeCount = static_cast<int>(edges.size());
+
+    // 同catmullClarkStep：边点/面点并行写预定大小数组
+    std::vector<glm::vec3> edgePoints(edgeCount);
+#pragma omp parallel for schedule(static) if (edgeCount > 4096)
+    for (int i = 0; i < edgeCount; ++i) {
         const Edge& edge = edges[i];
-        const Vertex& v1 = vertices[edge.vertex1];
-        const Vertex& v2 = vertices[edge.vertex2];
+        edgePoints[i] = (positions[edge.vertex1] + positions[edge.vertex2]) * 0.5f;
+    }
 
-        glm::vec3 edgePoint = (v1.position + v2.position) * 0.5f;
+    std::vector<glm::vec3> facePoints(faceCount);
+    computeFacePoints(faces, positions, facePoints);
 
-        Vertex newVertex;
-        newVertex.position = edgePoint;
-        int newVertexIndex = mesh.addVertex(newVertex);
-        edgePointMap[i] = newVertexIndex;
+    // 同catmullClarkStep：稠密索引映射用数组
+    std::vector<int> edgePointMap(edgeCount);
+    std::vector<int> facePointMap(faceCount);
+    for (int i = 0; i < edgeCount; ++i) {
+        edgePointMap[i] = originalVertexCount + i;
+    }
+    for (int i = 0; i < faceCount; ++i) {
+        facePointMap[i] = originalVertexCount + edgeCount + i;
     }
 
-    std::unordered_map<int, int> facePointMap;
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
-        const Face& face = faces[i];
-        glm::vec3 facePoint = calculateFacePoint(face, vertices);
-
-        Vertex newVertex;
-        newVertex.position = facePoint;
-        int newVertexIndex = mesh.addVertex(newVertex);
-        facePointMap[i] = newVertexIndex;
+    std::vector<int> faceEmitOffset(faceCount + 1, 0);
+    for (int i = 0; i < faceCount; ++i) {
+        faceEmitOffset[i + 1] = faceEmitOffset[i] + static_cast<int>(faces[i].vertices.size());
     }
 
-    std::vector<std::vector<int>> newFaces;
+    // 同catmullClarkStep：固定三角面，摊平进stride=3的连续缓冲
+    std::vector<int> newTris(static_cast<size_t>(faceEmitOffset[faceCount]) * 3);
+    std::vector<int> directedEdgeMap = buildDirectedEdgeMap(faces, faceEmitOffset, edgeLookup);
 
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
+#pragma omp parallel for schedule(dynamic, 1024) if (faceCount > 4096)
+    for (int i = 0; i < faceCount; ++i) {
         const Face& face = faces[i];
         int facePointIndex = facePointMap[i];
 
-        for (size_t j = 0; j < face.vertices.size(); ++j) {
+        // 同catmullClarkStep：条件回卷代替取模
+        size_t count = face.vertices.size();
+        for (size_t j = 0; j < count; ++j) {
             int v0 = face.vertices[j];
-            int v1 = face.vertices[(j + 1) % face.vertices.size()];
-
-            int edgeIndex = -1;
-            for (int ei = 0; ei < mesh.getEdgeCount(); ++ei) {
-                const Edge& edge = edges[ei];
-                if ((edge.vertex1 == v0 && edge.vertex2 == v1) ||
-                    (edge.vertex1 == v1 && edge.vertex2 == v0)) {
-                    edgeIndex = ei;
-                    break;
-                }
-            }
 
-            int edgePointIndex = edgePointMap[edgeIndex];
+            int edgeIndex = directedEdgeMap[faceEmitOffset[i] + j];
 
-            newFaces.push_back({v0, edgePointIndex, facePointIndex});
+            size_t base = (static_cast<size_t>(faceEmitOffset[i]) + j) * 3;
+            newTris[base] = v0;
+            newTris[base + 1] = edgePointMap[edgeIndex];
+            newTris[base + 2] = facePointIndex;
         }
     }
 
-    mesh.clear();
+    // 同catmullClarkStep：搭进预留好的新Mesh，原始顶点、边点、
+    // 面点按索引顺序排列，对上newFaces引用的编号
+    Mesh newMesh;
+    newMesh.reserveVertices(originalVertexCount + edgeCount + faceCount);
+    newMesh.reserveFaces(faceEmitOffset[faceCount]);
 
-    for (const auto& vertex : vertices) {
-        mesh.addVertex(vertex);
-    }
-
-    for (const auto& pair : edgePointMap) {
-        const Edge& edge = edges[pair.first];
-        const Vertex& v1 = vertices[edge.vertex1];
-        const Vertex& v2 = vertices[edge.vertex2];
-        glm::vec3 edgePoint = (v1.position + v2.position) * 0.5f;
-        mesh.addVertex(Vertex(edgePoint));
-    }
+    newMesh.addVertices(positions);
+    newMesh.addVertices(edgePoints);
+    newMesh.addVertices(facePoints);
 
-    for (const auto& pair : facePointMap) {
-        const Face& face = faces[pair.first];
-        glm::vec3 facePoint = calculateFacePoint(face, vertices);
-        mesh.addVertex(Vertex(facePoint));
-    }
-
-    for (const auto& newFace : newFaces) {
-        mesh.addFace(newFace);
-    }
+    newMesh.addFaces(newTris, 3);
 
-    mesh.calculateNormals();
+    mesh = std::move(newMesh);
 }
 
 void Subdivision::linearStep(Mesh& mesh) {
-    const auto& vertices = mesh.getVertices();
-    const auto& faces = mesh.getFaces();
-    const auto& edges = mesh.getEdges();
-
-    std::unordered_map<int, int> edgePointMap;
-
-    for (int i = 0; i < mesh.getEdgeCount(); ++i) {
+    const std::vector<glm::vec3> positions = mesh.getPositions();
+    const std::vector<Face> faces = mesh.getFaces();
+    const std::vector<Edge> edges = mesh.getEdges();
+    std::unordered_map<uint64_t, int> edgeLookup = buildEdgeLookup(edges);
+
+    int originalVertexCount = static_cast<int>(positions.size());
+    int faceCount = static_cast<int>(faces.size());
+    int edgeCount = static_cast<int>(edges.size());
+
+    // 同midpointStep：边点并行写预定大小数组
+    std::vector<glm::vec3> edgePoints(edgeCount);
+#pragma omp parallel for schedule(static) if (edgeCount > 4096)
+    for (int i = 0; i < edgeCount; ++i) {
         const Edge& edge = edges[i];
-        const Vertex& v1 = vertices[edge.vertex1];
-        const Vertex& v2 = vertices[edge.vertex2];
+        edgePoints[i] = (positions[edge.vertex1] + positions[edge.vertex2]) * 0.5f;
+    }
 
-        glm::vec3 edgePoint = (v1.position + v2.position) * 0.5f;
+    // 同midpointStep：稠密索引映射用数组
+    std::vector<int> edgePointMap(edgeCount);
+    for (int i = 0; i < edgeCount; ++i) {
+        edgePointMap[i] = originalVertexCount + i;
+    }
 
-        Vertex newVertex;
-        newVertex.position = edgePoint;
-        int newVertexIndex = mesh.addVertex(newVertex);
-        edgePointMap[i] = newVertexIndex;
+    std::vector<int> faceEmitOffset(faceCount + 1, 0);
+    for (int i = 0; i < faceCount; ++i) {
+        faceEmitOffset[i + 1] = faceEmitOffset[i] + static_cast<int>(faces[i].vertices.size());
     }
 
-    std::vector<std::vector<int>> newFaces;
+    // 同midpointStep：固定三角面，摊平进stride=3的连续缓冲
+    std::vector<int> newTris(static_cast<size_t>(faceEmitOffset[faceCount]) * 3);
+    std::vector<int> directedEdgeMap = buildDirectedEdgeMap(faces, faceEmitOffset, edgeLookup);
 
-    for (int i = 0; i < mesh.getFaceCount(); ++i) {
+#pragma omp parallel for schedule(dynamic, 1024) if (faceCount > 4096)
+    for (int i = 0; i < faceCount; ++i) {
         const Face& face = faces[i];
 
-        for (size_t j = 0; j < face.vertices.size(); ++j) {
+        // 同catmullClarkStep：条件回卷代替取模
+        size_t count = face.vertices.size();
+        for (size_t j = 0; j < count; ++j) {
+            size_t j1 = (j + 1 == count) ? 0 : j + 1;
             int v0 = face.vertices[j];
-            int v1 = face.vertices[(j + 1) % face.vertices.size()];
-            int v2 = face.vertices[(j + 2) % face.vertices.size()];
 
-            int edgeIndex1 = -1;
-            int edgeIndex2 = -1;
+            int edgeIndex1 = directedEdgeMap[faceEmitOffset[i] + j];
+            int edgeIndex2 = directedEdgeMap[faceEmitOffset[i] + j1];
 
-            for (int ei = 0; ei < mesh.getEdgeCount(); ++ei) {
-                const Edge& edge = edges[ei];
-                if ((edge.vertex1 == v0 && edge.vertex2 == v1) ||
-                    (edge.vertex1 == v1 && edge.vertex2 == v0)) {
-                    edgeIndex1 = ei;
-                }
-                if ((edge.vertex1 == v1 && edge.vertex2 == v2) ||
-                    (edge.vertex1 == v2 && edge.vertex2 == v1)) {
-                    edgeIndex2 = ei;
-                }
-            }
-
-            int edgePoint1 = edgePointMap[edgeIndex1];
-            int edgePoint2 = edgePointMap[edgeIndex2];
-
-            newFaces.push_back({v0, edgePoint1, edgePoint2});
+            size_t base = (static_cast<size_t>(faceEmitOffset[i]) + j) * 3;
+            newTris[base] = v0;
+            newTris[base + 1] = edgePointMap[edgeIndex1];
+            newTris[base + 2] = edgePointMap[edgeIndex2];
         }
     }
 
-    mesh.clear();
+    // 同midpointStep：搭进预留好的新Mesh
+    Mesh newMesh;
+    newMesh.reserveVertices(originalVertexCount + edgeCount);
+    newMesh.reserveFaces(faceEmitOffset[faceCount]);
 
-    for (const auto& vertex : vertices) {
-        mesh.addVertex(vertex);
-    }
+    newMesh.addVertices(positions);
+    newMesh.addVertices(edgePoints);
 
-    for (const auto& pair : edgePointMap) {
-        const Edge& edge = edges[pair.first];
-        const Vertex& v1 = vertices[edge.vertex1];
-        const Vertex& v2 = vertices[edge.vertex2];
-        glm::vec3 edgePoint = (v1.position + v2.position) * 0.5f;
-        mesh.addVertex(Vertex(edgePoint));
-    }
+    newMesh.addFaces(newTris, 3);
 
-    for (const auto& newFace : newFaces) {
-        mesh.addFace(newFace);
-    }
-
-    mesh.calculateNormals();
+    mesh = std::move(newMesh);
 }
 
-glm::vec3 Subdivision::calculateFacePoint(const Face& face, const std::vector<Vertex>& vertices) {
+glm::vec3 Subdivision::calculateFacePoint(const Face& face, const std::vector<glm::vec3>& positions) {
     glm::vec3 sum(0.0f);
     for (int vi : face.vertices) {
-        sum += vertices[vi].position;
+        sum += positions[vi];
     }
     return sum / static_cast<float>(face.vertices.size());
 }
 
-glm::vec3 Subdivision::calculateEdgePoint(const Edge& edge, const std::vector<Vertex>& vertices, const std::vector<Face>& faces) {
-    const Vertex& v1 = vertices[edge.vertex1];
-    const Vertex& v2 = vertices[edge.vertex2];
+glm::vec3 Subdivision::calculateEdgePoint(const Edge& edge, const std::vector<glm::vec3>& positions,
+                                          const std::vector<glm::vec3>& facePoints) {
+    const glm::vec3& p1 = positions[edge.vertex1];
+    const glm::vec3& p2 = positions[edge.vertex2];
 
     if (edge.isBoundary()) {
-        return (v1.position + v2.position) * 0.5f;
+        return (p1 + p2) * 0.5f;
     }
 
-    const Face& face1 = faces[edge.face1];
-    const Face& face2 = faces[edge.face2];
-
-    glm::vec3 facePoint1 = calculateFacePoint(face1, vertices);
-    glm::vec3 facePoint2 = calculateFacePoint(face2, vertices);
-
-    return (v1.position + v2.position + facePoint1 + facePoint2) * 0.25f;
+    // 面点由调用方整趟预计算传入；内部边的两个面各被多条边共享，
+    // 在这里现算等于每个面点重复算一次以上
+    return (p1 + p2 + facePoints[edge.face1] + facePoints[edge.face2]) * 0.25f;
 }
 
-glm::vec3 Subdivision::calculateVertexPoint(int vertexIndex, const Mesh& mesh) {
-    const Vertex& vertex = mesh.getVertex(vertexIndex);
-    std::vector<int> adjacentFaces = mesh.getAdjacentFaces(vertexIndex);
-
+glm::vec3 Subdivision::calculateVertexPoint(int vertexIndex, const std::vector<glm::vec3>& positions,
+                                            std::span<const int> adjacentFaces,
+                                            std::span<const int> adjacentEdges,
+                                            const std::vector<glm::vec3>& facePoints,
+                                            const std::vector<glm::vec3>& edgePoints) {
     glm::vec3 facePointSum(0.0f);
     for (int fi : adjacentFaces) {
-        const Face& face = mesh.getFace(fi);
-        facePointSum += calculateFacePoint(face, mesh.getVertices());
+        facePointSum += facePoints[fi];
     }
 
-    std::vector<int> adjacentEdges = mesh.getAdjacentEdges(vertexIndex);
     glm::vec3 edgePointSum(0.0f);
     for (int ei : adjacentEdges) {
-        const Edge& edge = mesh.getEdge(ei);
-        edgePointSum += calculateEdgePoint(edge, mesh.getVertices(), mesh.getFaces());
+        edgePointSum += edgePoints[ei];
     }
 
     float n = static_cast<float>(adjacentFaces.size());
 
     glm::vec3 Q = facePointSum / n;
     glm::vec3 R = edgePointSum / n;
-    glm::vec3 S = vertex.position;
+    glm::vec3 S = positions[vertexIndex];
 
     return (Q / n) + (2.0f * R / n) + (S * (n - 3.0f) / n);
 }
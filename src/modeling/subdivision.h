@@ -35,9 +35,13 @@ private:
     static void midpointStep(Mesh& mesh);
     static void linearStep(Mesh& mesh);
 
-    static glm::vec3 calculateFacePoint(const Face& face, const std::vector<Vertex>& vertices);
-    static glm::vec3 calculateEdgePoint(const Edge& edge, const std::vector<Vertex>& vertices, const std::vector<Face>& faces);
-    static glm::vec3 calculateVertexPoint(int vertexIndex, const Mesh& mesh);
+    static glm::vec3 calculateFacePoint(const Face& face, const std::vector<glm::vec3>& positions);
+    static glm::vec3 calculateEdgePoint(const Edge& edge, const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& facePoints);
+    static glm::vec3 calculateVertexPoint(int vertexIndex, const std::vector<glm::vec3>& positions,
+                                          std::span<const int> adjacentFaces,
+                                          std::span<const int> adjacentEdges,
+                                          const std::vector<glm::vec3>& facePoints,
+                                          const std::vector<glm::vec3>& edgePoints);
 };
 
 }
@@ -1,11 +1,77 @@
 #include "uv_editor.h"
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <glm/glm.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace v3d {
 namespace modeling {
 
+#if defined(__AVX2__)
+namespace {
+
+// 球面UV的热点是每顶点一次atan2+asin（libc的atan2f约百余周期）。
+// 这里用[0,1]区间上的三次多项式atan近似（最大误差约0.005弧度，摊到
+// UV上不足千分之一，贴图采样不可辨），8顶点一批无分支算完。标量
+// 版本给尾段用，保证整条UV流走同一套近似，不在批尾留精度接缝。
+constexpr float kAtanCoefA = -0.0464964749f;
+constexpr float kAtanCoefB = 0.15931422f;
+constexpr float kAtanCoefC = -0.327622764f;
+
+inline float atan2Approx(float z, float x) {
+    float absX = std::abs(x);
+    float absZ = std::abs(z);
+    float lo = std::min(absX, absZ);
+    float hi = std::max(absX, absZ);
+    float a = lo / std::max(hi, std::numeric_limits<float>::min());
+    float r = ((kAtanCoefA * a + kAtanCoefB) * a + kAtanCoefC) * a * a * a + a;
+    if (absZ > absX) {
+        r = glm::half_pi<float>() - r;
+    }
+    // 象限修正看符号位而不是比较：x为-0.0时atan2按负半轴处理
+    if (std::signbit(x)) {
+        r = glm::pi<float>() - r;
+    }
+    return z < 0.0f ? -r : r;
+}
+
+inline float asinApprox(float y) {
+    return atan2Approx(y, std::sqrt(std::max(0.0f, 1.0f - y * y)));
+}
+
+// 8通道版：商限到[0,1]后套同一多项式，象限修正全部走blendv/符号位
+// 运算，无数据相关分支
+inline __m256 atan2Batch(__m256 z, __m256 x) {
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    __m256 absX = _mm256_andnot_ps(signBit, x);
+    __m256 absZ = _mm256_andnot_ps(signBit, z);
+    __m256 lo = _mm256_min_ps(absX, absZ);
+    __m256 hi = _mm256_max_ps(absX, absZ);
+    __m256 a = _mm256_div_ps(lo,
+        _mm256_max_ps(hi, _mm256_set1_ps(std::numeric_limits<float>::min())));
+
+    __m256 poly = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(kAtanCoefA), a),
+                                _mm256_set1_ps(kAtanCoefB));
+    poly = _mm256_add_ps(_mm256_mul_ps(poly, a), _mm256_set1_ps(kAtanCoefC));
+    __m256 cube = _mm256_mul_ps(_mm256_mul_ps(a, a), a);
+    __m256 r = _mm256_add_ps(_mm256_mul_ps(poly, cube), a);
+
+    __m256 swapped = _mm256_cmp_ps(absZ, absX, _CMP_GT_OQ);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(glm::half_pi<float>()), r), swapped);
+    // 同标量版：算术右移把符号位扩成整通道掩码，-0.0也落进负半轴
+    __m256 negativeX = _mm256_castsi256_ps(
+        _mm256_srai_epi32(_mm256_castps_si256(x), 31));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(glm::pi<float>()), r), negativeX);
+    return _mm256_or_ps(r, _mm256_and_ps(z, signBit));
+}
+
+}
+#endif
+
 UVEditor::UVEditor()
     : mesh_(nullptr)
     , currentUVChannel_(0)
@@ -21,10 +87,44 @@ void UVEditor::setMesh(Mesh* mesh) {
     islandsDirty_ = true;
 
     if (mesh_) {
-        uvChannels_[0].resize(mesh_->getVertexCount());
-        for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-            uvChannels_[0][i] = mesh_->getVertex(i).texCoord;
-        }
+        // 纹理坐标流整段赋值，不走逐顶点的完整Vertex聚合拷贝
+        uvChannels_[0] = mesh_->getTexCoords();
+    }
+
+    rebuildVertexAdjacency();
+}
+
+void UVEditor::rebuildVertexAdjacency() {
+    adjOffset_.clear();
+    adjList_.clear();
+    vertexFaceOffset_.clear();
+    vertexFaceList_.clear();
+
+    if (!mesh_) {
+        return;
+    }
+
+    // 邻接多重集与逐次调用getAdjacentVertices完全一致（含重复项），
+    // 只是换了存储形态，平滑结果不变
+    int vertexCount = mesh_->getVertexCount();
+    adjOffset_.reserve(vertexCount + 1);
+    adjOffset_.push_back(0);
+    adjList_.reserve(mesh_->getEdges().size() * 2);
+
+    for (int i = 0; i < vertexCount; ++i) {
+        std::vector<int> adjacent = mesh_->getAdjacentVertices(i);
+        adjList_.insert(adjList_.end(), adjacent.begin(), adjacent.end());
+        adjOffset_.push_back(static_cast<int>(adjList_.size()));
+    }
+
+    // 顶点→面同样物化成CSR，岛提取的BFS不再逐次分配getAdjacentFaces
+    vertexFaceOffset_.reserve(vertexCount + 1);
+    vertexFaceOffset_.push_back(0);
+
+    for (int i = 0; i < vertexCount; ++i) {
+        std::vector<int> adjacentFaces = mesh_->getAdjacentFaces(i);
+        vertexFaceList_.insert(vertexFaceList_.end(), adjacentFaces.begin(), adjacentFaces.end());
+        vertexFaceOffset_.push_back(static_cast<int>(vertexFaceList_.size()));
     }
 }
 
@@ -63,10 +163,76 @@ void UVEditor::generateBoxUVs() {
 
     glm::vec3 center = mesh_->getCenter();
     glm::vec3 size = mesh_->getSize();
+    int vertexCount = mesh_->getVertexCount();
+    const std::vector<glm::vec3>& positions = mesh_->getPositions();
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+
+#if defined(__AVX2__)
+    // 三路if/else在有机网格上主导轴随面乱跳，分支预测吃亏。
+    // 改成比较掩码+blend的无分支选择：u取xDom?z:x，v取yDom?z:y，
+    // 翻号用掩码下的符号位异或，8顶点一拍
+    std::vector<float> soaX(vertexCount);
+    std::vector<float> soaY(vertexCount);
+    std::vector<float> soaZ(vertexCount);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        soaX[i] = positions[i].x - center.x;
+        soaY[i] = positions[i].y - center.y;
+        soaZ[i] = positions[i].z - center.z;
+    }
+
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 halfSizeX = _mm256_set1_ps(size.x * 0.5f);
+    const __m256 halfSizeY = _mm256_set1_ps(size.y * 0.5f);
+    const __m256 sizeX = _mm256_set1_ps(size.x);
+    const __m256 sizeY = _mm256_set1_ps(size.y);
+
+    int blockEnd = vertexCount & ~7;
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < blockEnd; i += 8) {
+        __m256 x = _mm256_loadu_ps(soaX.data() + i);
+        __m256 y = _mm256_loadu_ps(soaY.data() + i);
+        __m256 z = _mm256_loadu_ps(soaZ.data() + i);
+
+        __m256 ax = _mm256_andnot_ps(signBit, x);
+        __m256 ay = _mm256_andnot_ps(signBit, y);
+        __m256 az = _mm256_andnot_ps(signBit, z);
+
+        __m256 xDom = _mm256_and_ps(_mm256_cmp_ps(ax, ay, _CMP_GT_OQ),
+                                    _mm256_cmp_ps(ax, az, _CMP_GT_OQ));
+        __m256 yDom = _mm256_andnot_ps(xDom,
+            _mm256_and_ps(_mm256_cmp_ps(ay, ax, _CMP_GT_OQ),
+                          _mm256_cmp_ps(ay, az, _CMP_GT_OQ)));
+        __m256 zDom = _mm256_andnot_ps(xDom, _mm256_andnot_ps(yDom,
+            _mm256_castsi256_ps(_mm256_set1_epi32(-1))));
+
+        __m256 u = _mm256_blendv_ps(x, z, xDom);
+        __m256 v = _mm256_blendv_ps(y, z, yDom);
+
+        // 翻号条件与标量一致：主导轴坐标严格小于0（-0.0不翻）
+        __m256 flipU = _mm256_or_ps(
+            _mm256_and_ps(xDom, _mm256_cmp_ps(x, zero, _CMP_LT_OQ)),
+            _mm256_and_ps(zDom, _mm256_cmp_ps(z, zero, _CMP_LT_OQ)));
+        __m256 flipV = _mm256_and_ps(yDom, _mm256_cmp_ps(y, zero, _CMP_LT_OQ));
+
+        u = _mm256_xor_ps(u, _mm256_and_ps(flipU, signBit));
+        v = _mm256_xor_ps(v, _mm256_and_ps(flipV, signBit));
+
+        u = _mm256_div_ps(_mm256_add_ps(u, halfSizeX), sizeX);
+        v = _mm256_div_ps(_mm256_add_ps(v, halfSizeY), sizeY);
+
+        alignas(32) float uLanes[8];
+        alignas(32) float vLanes[8];
+        _mm256_store_ps(uLanes, u);
+        _mm256_store_ps(vLanes, v);
+        for (int k = 0; k < 8; ++k) {
+            uvs[i + k] = glm::vec2(uLanes[k], vLanes[k]);
+        }
+    }
 
-    for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-        Vertex vertex = mesh_->getVertex(i);
-        glm::vec3 pos = vertex.position - center;
+    for (int i = blockEnd; i < vertexCount; ++i) {
+        glm::vec3 pos(soaX[i], soaY[i], soaZ[i]);
 
         glm::vec3 absPos = glm::abs(pos);
         glm::vec2 uv;
@@ -89,8 +255,40 @@ void UVEditor::generateBoxUVs() {
         }
 
         uv = (uv + glm::vec2(size.x, size.y) * 0.5f) / glm::vec2(size.x, size.y);
-        uvChannels_[currentUVChannel_][i] = uv;
+        uvs[i] = uv;
     }
+#else
+    // 逐顶点独立写各自的下标，按顶点并行；小网格沿用4096阈值
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 pos = positions[i] - center;
+
+        glm::vec3 absPos = glm::abs(pos);
+        glm::vec2 uv;
+
+        if (absPos.x > absPos.y && absPos.x > absPos.z) {
+            uv = glm::vec2(pos.z, pos.y);
+            if (pos.x < 0) {
+                uv.x = -uv.x;
+            }
+        } else if (absPos.y > absPos.x && absPos.y > absPos.z) {
+            uv = glm::vec2(pos.x, pos.z);
+            if (pos.y < 0) {
+                uv.y = -uv.y;
+            }
+        } else {
+            uv = glm::vec2(pos.x, pos.y);
+            if (pos.z < 0) {
+                uv.x = -uv.x;
+            }
+        }
+
+        uv = (uv + glm::vec2(size.x, size.y) * 0.5f) / glm::vec2(size.x, size.y);
+        uvs[i] = uv;
+    }
+#endif
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::generateSphericalUVs() {
@@ -99,17 +297,84 @@ void UVEditor::generateSphericalUVs() {
     }
 
     glm::vec3 center = mesh_->getCenter();
-    float radius = glm::length(mesh_->getSize()) * 0.5f;
+    int vertexCount = mesh_->getVertexCount();
+    const std::vector<glm::vec3>& positions = mesh_->getPositions();
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+
+#if defined(__AVX2__)
+    // atan2(z,x)对缩放不变，asin只吃归一化后的y：整条向量不必归一化，
+    // 倒数平方根只为y算。先散集成SoA，再8顶点一批
+    std::vector<float> soaX(vertexCount);
+    std::vector<float> soaY(vertexCount);
+    std::vector<float> soaZ(vertexCount);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        soaX[i] = positions[i].x - center.x;
+        soaY[i] = positions[i].y - center.y;
+        soaZ[i] = positions[i].z - center.z;
+    }
+
+    const __m256 invTwoPi = _mm256_set1_ps(1.0f / glm::two_pi<float>());
+    const __m256 invPi = _mm256_set1_ps(1.0f / glm::pi<float>());
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    // 8顶点一批互不重叠，批与批之间再按线程切分
+    int blockEnd = vertexCount & ~7;
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < blockEnd; i += 8) {
+        __m256 x = _mm256_loadu_ps(soaX.data() + i);
+        __m256 y = _mm256_loadu_ps(soaY.data() + i);
+        __m256 z = _mm256_loadu_ps(soaZ.data() + i);
+
+        __m256 lengthSq = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+            _mm256_mul_ps(z, z));
+        // rsqrt加一步牛顿迭代，精度到位又避开sqrt+div的长延迟
+        __m256 invLength = _mm256_rsqrt_ps(lengthSq);
+        invLength = _mm256_mul_ps(invLength,
+            _mm256_sub_ps(_mm256_set1_ps(1.5f),
+                _mm256_mul_ps(_mm256_mul_ps(half, lengthSq),
+                              _mm256_mul_ps(invLength, invLength))));
+        __m256 normalY = _mm256_mul_ps(y, invLength);
+
+        __m256 azimuth = atan2Batch(z, x);
+        __m256 clampedSq = _mm256_max_ps(_mm256_setzero_ps(),
+            _mm256_sub_ps(one, _mm256_mul_ps(normalY, normalY)));
+        __m256 elevation = atan2Batch(normalY, _mm256_sqrt_ps(clampedSq));
+
+        __m256 u = _mm256_add_ps(_mm256_mul_ps(azimuth, invTwoPi), half);
+        __m256 v = _mm256_add_ps(_mm256_mul_ps(elevation, invPi), half);
+
+        alignas(32) float uLanes[8];
+        alignas(32) float vLanes[8];
+        _mm256_store_ps(uLanes, u);
+        _mm256_store_ps(vLanes, v);
+        for (int k = 0; k < 8; ++k) {
+            uvs[i + k] = glm::vec2(uLanes[k], vLanes[k]);
+        }
+    }
 
-    for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-        Vertex vertex = mesh_->getVertex(i);
-        glm::vec3 pos = glm::normalize(vertex.position - center);
+    for (int i = blockEnd; i < vertexCount; ++i) {
+        float lengthSq = soaX[i] * soaX[i] + soaY[i] * soaY[i] + soaZ[i] * soaZ[i];
+        float normalY = lengthSq > 0.0f ? soaY[i] / std::sqrt(lengthSq) : 0.0f;
+        float u = atan2Approx(soaZ[i], soaX[i]) / glm::two_pi<float>() + 0.5f;
+        float v = asinApprox(normalY) / glm::pi<float>() + 0.5f;
+        uvs[i] = glm::vec2(u, v);
+    }
+#else
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 pos = glm::normalize(positions[i] - center);
 
         float u = std::atan2(pos.z, pos.x) / (2.0f * glm::pi<float>()) + 0.5f;
         float v = std::asin(pos.y) / glm::pi<float>() + 0.5f;
 
-        uvChannels_[currentUVChannel_][i] = glm::vec2(u, v);
+        uvs[i] = glm::vec2(u, v);
     }
+#endif
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::generateCylindricalUVs() {
@@ -120,16 +385,65 @@ void UVEditor::generateCylindricalUVs() {
     glm::vec3 center = mesh_->getCenter();
     glm::vec3 size = mesh_->getSize();
     float radius = std::max(size.x, size.z) * 0.5f;
+    int vertexCount = mesh_->getVertexCount();
+    const std::vector<glm::vec3>& positions = mesh_->getPositions();
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+
+#if defined(__AVX2__)
+    // 柱面u与球面同款：方位角走多项式atan2批量版，v只是线性映射
+    std::vector<float> soaX(vertexCount);
+    std::vector<float> soaY(vertexCount);
+    std::vector<float> soaZ(vertexCount);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        soaX[i] = positions[i].x - center.x;
+        soaY[i] = positions[i].y - center.y;
+        soaZ[i] = positions[i].z - center.z;
+    }
+
+    const __m256 invTwoPi = _mm256_set1_ps(1.0f / glm::two_pi<float>());
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 halfHeight = _mm256_set1_ps(size.y * 0.5f);
+    const __m256 height = _mm256_set1_ps(size.y);
+
+    int blockEnd = vertexCount & ~7;
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < blockEnd; i += 8) {
+        __m256 x = _mm256_loadu_ps(soaX.data() + i);
+        __m256 y = _mm256_loadu_ps(soaY.data() + i);
+        __m256 z = _mm256_loadu_ps(soaZ.data() + i);
+
+        __m256 u = _mm256_add_ps(_mm256_mul_ps(atan2Batch(z, x), invTwoPi), half);
+        // v除法保留：和标量尾段逐位一致
+        __m256 v = _mm256_div_ps(_mm256_add_ps(y, halfHeight), height);
+
+        alignas(32) float uLanes[8];
+        alignas(32) float vLanes[8];
+        _mm256_store_ps(uLanes, u);
+        _mm256_store_ps(vLanes, v);
+        for (int k = 0; k < 8; ++k) {
+            uvs[i + k] = glm::vec2(uLanes[k], vLanes[k]);
+        }
+    }
 
-    for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-        Vertex vertex = mesh_->getVertex(i);
-        glm::vec3 pos = vertex.position - center;
+    for (int i = blockEnd; i < vertexCount; ++i) {
+        float u = atan2Approx(soaZ[i], soaX[i]) / glm::two_pi<float>() + 0.5f;
+        float v = (soaY[i] + size.y * 0.5f) / size.y;
+        uvs[i] = glm::vec2(u, v);
+    }
+#else
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 pos = positions[i] - center;
 
         float u = std::atan2(pos.z, pos.x) / (2.0f * glm::pi<float>()) + 0.5f;
         float v = (pos.y + size.y * 0.5f) / size.y;
 
-        uvChannels_[currentUVChannel_][i] = glm::vec2(u, v);
+        uvs[i] = glm::vec2(u, v);
     }
+#endif
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::generatePlanarUVs(const glm::vec3& axis) {
@@ -154,15 +468,69 @@ void UVEditor::generatePlanarUVs(const glm::vec3& axis) {
         vAxis = glm::vec3(0.0f, 1.0f, 0.0f);
     }
 
-    for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-        Vertex vertex = mesh_->getVertex(i);
-        glm::vec3 pos = vertex.position - center;
+    int vertexCount = mesh_->getVertexCount();
+    const std::vector<glm::vec3>& positions = mesh_->getPositions();
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+
+#if defined(__AVX2__)
+    // 与projectUVs同款双点积内核；基向量轴对齐时乘零项由硬件白给
+    std::vector<float> soaX(vertexCount);
+    std::vector<float> soaY(vertexCount);
+    std::vector<float> soaZ(vertexCount);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        soaX[i] = positions[i].x - center.x;
+        soaY[i] = positions[i].y - center.y;
+        soaZ[i] = positions[i].z - center.z;
+    }
+
+    const __m256 uAxisX = _mm256_set1_ps(uAxis.x);
+    const __m256 uAxisY = _mm256_set1_ps(uAxis.y);
+    const __m256 uAxisZ = _mm256_set1_ps(uAxis.z);
+    const __m256 vAxisX = _mm256_set1_ps(vAxis.x);
+    const __m256 vAxisY = _mm256_set1_ps(vAxis.y);
+    const __m256 vAxisZ = _mm256_set1_ps(vAxis.z);
+
+    int blockEnd = vertexCount & ~7;
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < blockEnd; i += 8) {
+        __m256 x = _mm256_loadu_ps(soaX.data() + i);
+        __m256 y = _mm256_loadu_ps(soaY.data() + i);
+        __m256 z = _mm256_loadu_ps(soaZ.data() + i);
+
+        __m256 u = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(x, uAxisX), _mm256_mul_ps(y, uAxisY)),
+            _mm256_mul_ps(z, uAxisZ));
+        __m256 v = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(x, vAxisX), _mm256_mul_ps(y, vAxisY)),
+            _mm256_mul_ps(z, vAxisZ));
+
+        alignas(32) float uLanes[8];
+        alignas(32) float vLanes[8];
+        _mm256_store_ps(uLanes, u);
+        _mm256_store_ps(vLanes, v);
+        for (int k = 0; k < 8; ++k) {
+            uvs[i + k] = glm::vec2(uLanes[k], vLanes[k]);
+        }
+    }
+
+    for (int i = blockEnd; i < vertexCount; ++i) {
+        glm::vec3 pos(soaX[i], soaY[i], soaZ[i]);
+        uvs[i] = glm::vec2(glm::dot(pos, uAxis), glm::dot(pos, vAxis));
+    }
+#else
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 pos = positions[i] - center;
 
         float u = glm::dot(pos, uAxis);
         float v = glm::dot(pos, vAxis);
 
-        uvChannels_[currentUVChannel_][i] = glm::vec2(u, v);
+        uvs[i] = glm::vec2(u, v);
     }
+#endif
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::unwrapUVs(int iterations) {
@@ -170,27 +538,40 @@ void UVEditor::unwrapUVs(int iterations) {
         return;
     }
 
-    for (int iter = 0; iter < iterations; ++iter) {
-        std::vector<glm::vec2> newUVs = uvChannels_[currentUVChannel_];
+    int vertexCount = mesh_->getVertexCount();
+    if (static_cast<int>(adjOffset_.size()) != vertexCount + 1) {
+        rebuildVertexAdjacency();
+    }
 
-        for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-            std::vector<int> adjacentVertices = mesh_->getAdjacentVertices(i);
+    // 乒乓缓冲：两块buffer逐轮std::swap，取代每轮一次的整通道拷贝分配
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    std::vector<glm::vec2> scratch = uvs;
 
-            if (adjacentVertices.empty()) {
+    for (int iter = 0; iter < iterations; ++iter) {
+        // 每轮只读uvs写scratch，顶点之间无依赖；按CSR行长不均衡用dynamic
+#pragma omp parallel for schedule(dynamic, 1024) if (vertexCount > 4096)
+        for (int i = 0; i < vertexCount; ++i) {
+            int begin = adjOffset_[i];
+            int end = adjOffset_[i + 1];
+
+            if (begin == end) {
+                scratch[i] = uvs[i];
                 continue;
             }
 
             glm::vec2 sum(0.0f);
-            for (int av : adjacentVertices) {
-                sum += uvChannels_[currentUVChannel_][av];
+            for (int k = begin; k < end; ++k) {
+                sum += uvs[adjList_[k]];
             }
-            sum /= static_cast<float>(adjacentVertices.size());
+            sum /= static_cast<float>(end - begin);
 
-            newUVs[i] = glm::mix(uvChannels_[currentUVChannel_][i], sum, 0.5f);
+            scratch[i] = glm::mix(uvs[i], sum, 0.5f);
         }
 
-        uvChannels_[currentUVChannel_] = newUVs;
+        std::swap(uvs, scratch);
     }
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::relaxUVs(int iterations) {
@@ -204,55 +585,160 @@ void UVEditor::packUVs(float padding) {
 
     calculateUVIslands();
 
+    if (uvIslands_.empty()) {
+        return;
+    }
+
     struct PackedIsland {
         int index;
         glm::vec2 position;
         glm::vec2 size;
+        bool rotated;
     };
 
+    // 预缩放：岛总面积归一到单位方，货架式堆到1以上再靠末尾归一化
+    // 抢救的老路不再是常态
+    float totalArea = 0.0f;
+    for (const UVIsland& island : uvIslands_) {
+        glm::vec2 size = island.maxUV - island.minUV + padding * 2.0f;
+        totalArea += size.x * size.y;
+    }
+    if (totalArea <= 0.0f) {
+        return;
+    }
+    float scale = 1.0f / std::sqrt(totalArea);
+
     std::vector<PackedIsland> packedIslands;
+    packedIslands.reserve(uvIslands_.size());
 
     for (size_t i = 0; i < uvIslands_.size(); ++i) {
         PackedIsland packed;
         packed.index = static_cast<int>(i);
-        packed.size = uvIslands_[i].maxUV - uvIslands_[i].minUV;
-        packed.size += padding * 2.0f;
+        packed.size = (uvIslands_[i].maxUV - uvIslands_[i].minUV + padding * 2.0f) * scale;
+        packed.rotated = false;
         packedIslands.push_back(packed);
     }
 
+    // 大岛先摆：按最长边降序
     std::sort(packedIslands.begin(), packedIslands.end(),
         [](const PackedIsland& a, const PackedIsland& b) {
-            return a.size.x * a.size.y > b.size.x * b.size.y;
+            return std::max(a.size.x, a.size.y) > std::max(b.size.x, b.size.y);
         });
 
-    glm::vec2 cursor(0.0f, 0.0f);
-    float rowHeight = 0.0f;
+    // MaxRects最佳短边适配（Jylänki）：空闲矩形列表从整个单位方出发，
+    // 每次放置后把所有相交的空闲矩形切成至多4块，再剔除被包含的
+    struct Rect {
+        float x, y, w, h;
+    };
+
+    const float eps = 1e-6f;
+    auto contains = [eps](const Rect& outer, const Rect& inner) {
+        return outer.x <= inner.x + eps && outer.y <= inner.y + eps &&
+               outer.x + outer.w >= inner.x + inner.w - eps &&
+               outer.y + outer.h >= inner.y + inner.h - eps;
+    };
+
+    std::vector<Rect> freeRects = {{0.0f, 0.0f, 1.0f, 1.0f}};
+    float overflowY = 1.0f;
 
     for (auto& packed : packedIslands) {
-        packed.position = cursor;
+        int bestRect = -1;
+        bool bestRotated = false;
+        float bestScore = std::numeric_limits<float>::max();
+
+        for (size_t r = 0; r < freeRects.size(); ++r) {
+            for (int rotation = 0; rotation < 2; ++rotation) {
+                float w = rotation ? packed.size.y : packed.size.x;
+                float h = rotation ? packed.size.x : packed.size.y;
+
+                if (w <= freeRects[r].w + eps && h <= freeRects[r].h + eps) {
+                    float score = std::min(freeRects[r].w - w, freeRects[r].h - h);
+                    if (score < bestScore) {
+                        bestScore = score;
+                        bestRect = static_cast<int>(r);
+                        bestRotated = rotation != 0;
+                    }
+                }
+            }
+        }
 
-        cursor.x += packed.size.x;
-        rowHeight = std::max(rowHeight, packed.size.y);
+        if (bestRect < 0) {
+            // 数值边角放不进去时退到单位方上方堆叠，normalizeUVs兜底
+            packed.position = glm::vec2(0.0f, overflowY);
+            overflowY += packed.size.y;
+            continue;
+        }
+
+        packed.rotated = bestRotated;
+        packed.position = glm::vec2(freeRects[bestRect].x, freeRects[bestRect].y);
+
+        Rect used;
+        used.x = packed.position.x;
+        used.y = packed.position.y;
+        used.w = bestRotated ? packed.size.y : packed.size.x;
+        used.h = bestRotated ? packed.size.x : packed.size.y;
+
+        std::vector<Rect> next;
+        next.reserve(freeRects.size() + 3);
+        for (const Rect& fr : freeRects) {
+            if (used.x >= fr.x + fr.w - eps || used.x + used.w <= fr.x + eps ||
+                used.y >= fr.y + fr.h - eps || used.y + used.h <= fr.y + eps) {
+                next.push_back(fr);
+                continue;
+            }
+            if (used.x > fr.x + eps) {
+                next.push_back({fr.x, fr.y, used.x - fr.x, fr.h});
+            }
+            if (used.x + used.w < fr.x + fr.w - eps) {
+                next.push_back({used.x + used.w, fr.y, fr.x + fr.w - used.x - used.w, fr.h});
+            }
+            if (used.y > fr.y + eps) {
+                next.push_back({fr.x, fr.y, fr.w, used.y - fr.y});
+            }
+            if (used.y + used.h < fr.y + fr.h - eps) {
+                next.push_back({fr.x, used.y + used.h, fr.w, fr.y + fr.h - used.y - used.h});
+            }
+        }
 
-        if (cursor.x > 1.0f) {
-            cursor.x = 0.0f;
-            cursor.y += rowHeight;
-            rowHeight = 0.0f;
+        for (size_t a = 0; a < next.size(); ++a) {
+            for (size_t b = a + 1; b < next.size(); ++b) {
+                if (contains(next[b], next[a])) {
+                    next.erase(next.begin() + a);
+                    --a;
+                    break;
+                }
+                if (contains(next[a], next[b])) {
+                    next.erase(next.begin() + b);
+                    --b;
+                }
+            }
         }
+
+        freeRects = std::move(next);
     }
 
-    for (const auto& packed : packedIslands) {
+    // 摆放保持串行；坐标回写按岛并行——岛按共享顶点连通划分，
+    // 岛与岛的顶点集互不相交。去重顶点表一趟线性扫，不再经面间接
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    int packedCount = static_cast<int>(packedIslands.size());
+
+#pragma omp parallel for schedule(dynamic, 1) if (packedCount > 8)
+    for (int p = 0; p < packedCount; ++p) {
+        const PackedIsland& packed = packedIslands[p];
         const UVIsland& island = uvIslands_[packed.index];
-        glm::vec2 offset = packed.position - island.minUV + padding;
+        glm::vec2 base = packed.position + padding * scale;
+        float islandWidth = island.maxUV.x - island.minUV.x;
 
-        for (int faceIndex : island.faceIndices) {
-            const Face& face = mesh_->getFace(faceIndex);
-            for (int vertexIndex : face.vertices) {
-                uvChannels_[currentUVChannel_][vertexIndex] += offset;
+        for (int vertexIndex : island.vertexIndices) {
+            glm::vec2 local = uvs[vertexIndex] - island.minUV;
+            if (packed.rotated) {
+                local = glm::vec2(local.y, islandWidth - local.x);
             }
+            uvs[vertexIndex] = base + local * scale;
         }
     }
 
+    markAllIslandBoundsDirty();
     normalizeUVs();
 }
 
@@ -261,9 +747,7 @@ void UVEditor::scaleUVs(const glm::vec2& scale) {
         return;
     }
 
-    for (auto& uv : uvChannels_[currentUVChannel_]) {
-        uv *= scale;
-    }
+    applyAffine2D(scale.x, 0.0f, 0.0f, scale.y, 0.0f, 0.0f);
 }
 
 void UVEditor::translateUVs(const glm::vec2& offset) {
@@ -271,9 +755,7 @@ void UVEditor::translateUVs(const glm::vec2& offset) {
         return;
     }
 
-    for (auto& uv : uvChannels_[currentUVChannel_]) {
-        uv += offset;
-    }
+    applyAffine2D(1.0f, 0.0f, 0.0f, 1.0f, offset.x, offset.y);
 }
 
 void UVEditor::rotateUVs(float angle) {
@@ -283,13 +765,7 @@ void UVEditor::rotateUVs(float angle) {
 
     float cosAngle = std::cos(angle);
     float sinAngle = std::sin(angle);
-
-    for (auto& uv : uvChannels_[currentUVChannel_]) {
-        glm::vec2 rotated;
-        rotated.x = uv.x * cosAngle - uv.y * sinAngle;
-        rotated.y = uv.x * sinAngle + uv.y * cosAngle;
-        uv = rotated;
-    }
+    applyAffine2D(cosAngle, -sinAngle, sinAngle, cosAngle, 0.0f, 0.0f);
 }
 
 void UVEditor::flipUVs(bool horizontal, bool vertical) {
@@ -297,14 +773,17 @@ void UVEditor::flipUVs(bool horizontal, bool vertical) {
         return;
     }
 
-    for (auto& uv : uvChannels_[currentUVChannel_]) {
-        if (horizontal) {
-            uv.x = 1.0f - uv.x;
-        }
-        if (vertical) {
-            uv.y = 1.0f - uv.y;
-        }
+    if (!horizontal && !vertical) {
+        return;
     }
+
+    // 翻转折成uv' = bias - uv：不翻的分量取sign=1、bias=0，
+    // 翻的取sign=-1、bias=1，组成对角仿射一趟走完
+    float signU = horizontal ? -1.0f : 1.0f;
+    float biasU = horizontal ? 1.0f : 0.0f;
+    float signV = vertical ? -1.0f : 1.0f;
+    float biasV = vertical ? 1.0f : 0.0f;
+    applyAffine2D(signU, 0.0f, 0.0f, signV, biasU, biasV);
 }
 
 void UVEditor::selectUVs(const std::vector<int>& indices) {
@@ -316,40 +795,114 @@ void UVEditor::deselectUVs() {
 }
 
 void UVEditor::invertSelection() {
-    std::vector<int> allIndices;
-    if (!uvChannels_.empty()) {
-        allIndices.resize(uvChannels_[currentUVChannel_].size());
-        for (size_t i = 0; i < allIndices.size(); ++i) {
-            allIndices[i] = static_cast<int>(i);
+    size_t count = uvChannels_.empty() ? 0 : uvChannels_[currentUVChannel_].size();
+    if (count == 0) {
+        selectedUVs_.clear();
+        return;
+    }
+
+    // 逐索引std::find是O(N·S)：选择集先物化成位图，成员判定变成
+    // 一次移位与运算，再按未置位的位展开成新选择
+    std::vector<uint64_t> mask((count + 63) / 64, 0);
+    for (int index : selectedUVs_) {
+        if (index >= 0 && index < static_cast<int>(count)) {
+            mask[index >> 6] |= uint64_t(1) << (index & 63);
         }
     }
 
     std::vector<int> newSelection;
-    for (int index : allIndices) {
-        if (std::find(selectedUVs_.begin(), selectedUVs_.end(), index) == selectedUVs_.end()) {
-            newSelection.push_back(index);
+    newSelection.reserve(count - std::min(count, selectedUVs_.size()));
+    for (size_t w = 0; w < mask.size(); ++w) {
+        uint64_t unselected = ~mask[w];
+        if (w == mask.size() - 1 && (count & 63) != 0) {
+            unselected &= (uint64_t(1) << (count & 63)) - 1;
+        }
+        while (unselected != 0) {
+            int bit = std::countr_zero(unselected);
+            newSelection.push_back(static_cast<int>(w * 64) + bit);
+            unselected &= unselected - 1;
         }
     }
 
-    selectedUVs_ = newSelection;
+    selectedUVs_ = std::move(newSelection);
 }
 
-std::vector<int> UVEditor::getSelectedUVs() const {
+const std::vector<int>& UVEditor::getSelectedUVs() const {
     return selectedUVs_;
 }
 
 void UVEditor::weldUVs(float threshold) {
-    if (uvChannels_.empty()) {
+    if (uvChannels_.empty() || threshold <= 0.0f) {
+        return;
+    }
+
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    size_t count = uvs.size();
+    if (count < 2) {
         return;
     }
 
-    for (size_t i = 0; i < uvChannels_[currentUVChannel_].size(); ++i) {
-        for (size_t j = i + 1; j < uvChannels_[currentUVChannel_].size(); ++j) {
-            if (glm::length(uvChannels_[currentUVChannel_][i] - uvChannels_[currentUVChannel_][j]) < threshold) {
-                uvChannels_[currentUVChannel_][j] = uvChannels_[currentUVChannel_][i];
+    // 逐对比较是O(N²)：改成边长=threshold的均匀网格哈希，每个UV只和
+    // 周围9格的候选做真实距离判定。并查集让焊接可传递且与遍历顺序
+    // 无关，根取组内最小索引，保持"先出现的UV说了算"的旧语义。
+    auto cellKey = [threshold](const glm::vec2& uv) {
+        int32_t cellU = static_cast<int32_t>(std::floor(uv.x / threshold));
+        int32_t cellV = static_cast<int32_t>(std::floor(uv.y / threshold));
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cellU)) << 32) |
+               static_cast<uint32_t>(cellV);
+    };
+
+    std::vector<int> parent(count);
+    for (size_t i = 0; i < count; ++i) {
+        parent[i] = static_cast<int>(i);
+    }
+    auto findRoot = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    std::unordered_map<uint64_t, std::vector<int>> grid;
+    grid.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        int32_t cellU = static_cast<int32_t>(std::floor(uvs[i].x / threshold));
+        int32_t cellV = static_cast<int32_t>(std::floor(uvs[i].y / threshold));
+
+        for (int32_t du = -1; du <= 1; ++du) {
+            for (int32_t dv = -1; dv <= 1; ++dv) {
+                uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(cellU + du)) << 32) |
+                               static_cast<uint32_t>(cellV + dv);
+                auto it = grid.find(key);
+                if (it == grid.end()) {
+                    continue;
+                }
+                for (int j : it->second) {
+                    if (glm::length(uvs[i] - uvs[j]) < threshold) {
+                        int rootI = findRoot(static_cast<int>(i));
+                        int rootJ = findRoot(j);
+                        if (rootI != rootJ) {
+                            // 较小索引做根
+                            parent[std::max(rootI, rootJ)] = std::min(rootI, rootJ);
+                        }
+                    }
+                }
             }
         }
+
+        grid[cellKey(uvs[i])].push_back(static_cast<int>(i));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        int root = findRoot(static_cast<int>(i));
+        if (root != static_cast<int>(i)) {
+            uvs[i] = uvs[root];
+        }
     }
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::splitUVs(const std::vector<int>& indices) {
@@ -357,14 +910,47 @@ void UVEditor::splitUVs(const std::vector<int>& indices) {
         return;
     }
 
-    for (int index : indices) {
-        if (index >= 0 && index < static_cast<int>(uvChannels_[currentUVChannel_].size())) {
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    int uvCount = static_cast<int>(uvs.size());
+
+    // 排序去重：同一下标出现两次不再裂出两份副本
+    std::vector<int> uniqueIndices(indices);
+    std::sort(uniqueIndices.begin(), uniqueIndices.end());
+    uniqueIndices.erase(std::unique(uniqueIndices.begin(), uniqueIndices.end()),
+                        uniqueIndices.end());
+
+    // 容量一次预留到位，push_back途中不再翻倍搬迁
+    uvs.reserve(uvs.size() + uniqueIndices.size());
+    mesh_->reserveVertices(mesh_->getVertexCount() + static_cast<int>(uniqueIndices.size()));
+
+    for (int index : uniqueIndices) {
+        if (index >= 0 && index < uvCount) {
             Vertex vertex = mesh_->getVertex(index);
-            vertex.texCoord = uvChannels_[currentUVChannel_][index];
-            int newIndex = mesh_->addVertex(vertex);
-            uvChannels_[currentUVChannel_].push_back(uvChannels_[currentUVChannel_][index]);
+            vertex.texCoord = uvs[index];
+            mesh_->addVertex(vertex);
+            uvs.push_back(uvs[index]);
+        }
+    }
+
+    // 顶点数变了，岛划分必须整库重建
+    islandsDirty_ = true;
+}
+
+std::span<const int> UVEditor::sanitizeSelection() {
+    sanitizedSelection_.clear();
+
+    if (uvChannels_.empty()) {
+        return sanitizedSelection_;
+    }
+
+    int uvCount = static_cast<int>(uvChannels_[currentUVChannel_].size());
+    sanitizedSelection_.reserve(selectedUVs_.size());
+    for (int index : selectedUVs_) {
+        if (index >= 0 && index < uvCount) {
+            sanitizedSelection_.push_back(index);
         }
     }
+    return sanitizedSelection_;
 }
 
 void UVEditor::stitchUVs(const std::vector<int>& indices) {
@@ -372,19 +958,29 @@ void UVEditor::stitchUVs(const std::vector<int>& indices) {
         return;
     }
 
-    glm::vec2 average(0.0f);
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    int uvCount = static_cast<int>(uvs.size());
+
+    // 越界过滤一次；平均仍按传入个数除，保持原有语义
+    std::vector<int> valid;
+    valid.reserve(indices.size());
     for (int index : indices) {
-        if (index >= 0 && index < static_cast<int>(uvChannels_[currentUVChannel_].size())) {
-            average += uvChannels_[currentUVChannel_][index];
+        if (index >= 0 && index < uvCount) {
+            valid.push_back(index);
         }
     }
+
+    glm::vec2 average(0.0f);
+    for (int index : valid) {
+        average += uvs[index];
+    }
     average /= static_cast<float>(indices.size());
 
-    for (int index : indices) {
-        if (index >= 0 && index < static_cast<int>(uvChannels_[currentUVChannel_].size())) {
-            uvChannels_[currentUVChannel_][index] = average;
-        }
+    for (int index : valid) {
+        uvs[index] = average;
     }
+
+    markIslandBoundsDirty(valid);
 }
 
 void UVEditor::alignUVs(const glm::vec2& direction) {
@@ -394,27 +990,64 @@ void UVEditor::alignUVs(const glm::vec2& direction) {
 
     glm::vec2 normalizedDir = glm::normalize(direction);
 
+    std::span<const int> selection = sanitizeSelection();
+    if (selection.empty()) {
+        return;
+    }
+
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+
     float minProjection = std::numeric_limits<float>::max();
     float maxProjection = std::numeric_limits<float>::lowest();
 
-    for (int index : selectedUVs_) {
-        if (index >= 0 && index < static_cast<int>(uvChannels_[currentUVChannel_].size())) {
-            float projection = glm::dot(uvChannels_[currentUVChannel_][index], normalizedDir);
-            minProjection = std::min(minProjection, projection);
-            maxProjection = std::max(maxProjection, projection);
-        }
+    size_t i = 0;
+#if defined(__AVX2__)
+    // 投影极值归约走gather：u在2*idx、v在2*idx+1，8个一批mul/add后
+    // min/max累加，最后128位半归约收尾
+    const float* data = &uvs[0].x;
+    const __m256 dirU = _mm256_set1_ps(normalizedDir.x);
+    const __m256 dirV = _mm256_set1_ps(normalizedDir.y);
+    __m256 minAcc = _mm256_set1_ps(std::numeric_limits<float>::max());
+    __m256 maxAcc = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+
+    for (; i + 8 <= selection.size(); i += 8) {
+        __m256i indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(selection.data() + i));
+        __m256i uIndices = _mm256_slli_epi32(indices, 1);
+        __m256 u = _mm256_i32gather_ps(data, uIndices, 4);
+        __m256 v = _mm256_i32gather_ps(data, _mm256_add_epi32(uIndices, _mm256_set1_epi32(1)), 4);
+
+        __m256 projection = _mm256_add_ps(_mm256_mul_ps(u, dirU), _mm256_mul_ps(v, dirV));
+        minAcc = _mm256_min_ps(minAcc, projection);
+        maxAcc = _mm256_max_ps(maxAcc, projection);
+    }
+
+    __m128 minHalf = _mm_min_ps(_mm256_castps256_ps128(minAcc), _mm256_extractf128_ps(minAcc, 1));
+    minHalf = _mm_min_ps(minHalf, _mm_movehl_ps(minHalf, minHalf));
+    minHalf = _mm_min_ss(minHalf, _mm_shuffle_ps(minHalf, minHalf, 1));
+    minProjection = _mm_cvtss_f32(minHalf);
+
+    __m128 maxHalf = _mm_max_ps(_mm256_castps256_ps128(maxAcc), _mm256_extractf128_ps(maxAcc, 1));
+    maxHalf = _mm_max_ps(maxHalf, _mm_movehl_ps(maxHalf, maxHalf));
+    maxHalf = _mm_max_ss(maxHalf, _mm_shuffle_ps(maxHalf, maxHalf, 1));
+    maxProjection = _mm_cvtss_f32(maxHalf);
+#endif
+    for (; i < selection.size(); ++i) {
+        float projection = glm::dot(uvs[selection[i]], normalizedDir);
+        minProjection = std::min(minProjection, projection);
+        maxProjection = std::max(maxProjection, projection);
     }
 
     float targetProjection = (minProjection + maxProjection) * 0.5f;
 
-    for (int index : selectedUVs_) {
-        if (index >= 0 && index < static_cast<int>(uvChannels_[currentUVChannel_].size())) {
-            glm::vec2 uv = uvChannels_[currentUVChannel_][index];
-            float currentProjection = glm::dot(uv, normalizedDir);
-            uv += (targetProjection - currentProjection) * normalizedDir;
-            uvChannels_[currentUVChannel_][index] = uv;
-        }
+    // AVX2没有scatter，回写保持标量
+    for (int index : selection) {
+        glm::vec2 uv = uvs[index];
+        float currentProjection = glm::dot(uv, normalizedDir);
+        uv += (targetProjection - currentProjection) * normalizedDir;
+        uvs[index] = uv;
     }
+
+    markIslandBoundsDirty(selection);
 }
 
 void UVEditor::distributeUVs(const glm::vec2& direction) {
@@ -424,12 +1057,17 @@ void UVEditor::distributeUVs(const glm::vec2& direction) {
 
     glm::vec2 normalizedDir = glm::normalize(direction);
 
+    std::span<const int> selection = sanitizeSelection();
+
     std::vector<std::pair<float, int>> projections;
-    for (int index : selectedUVs_) {
-        if (index >= 0 && index < static_cast<int>(uvChannels_[currentUVChannel_].size())) {
-            float projection = glm::dot(uvChannels_[currentUVChannel_][index], normalizedDir);
-            projections.push_back({projection, index});
-        }
+    projections.reserve(selection.size());
+    for (int index : selection) {
+        float projection = glm::dot(uvChannels_[currentUVChannel_][index], normalizedDir);
+        projections.push_back({projection, index});
+    }
+
+    if (projections.size() < 2) {
+        return;
     }
 
     std::sort(projections.begin(), projections.end());
@@ -451,6 +1089,8 @@ void UVEditor::distributeUVs(const glm::vec2& direction) {
         uv += (targetProjection - currentProjection) * normalizedDir;
         uvChannels_[currentUVChannel_][index] = uv;
     }
+
+    markIslandBoundsDirty(selection);
 }
 
 void UVEditor::straightenUVs() {
@@ -458,16 +1098,24 @@ void UVEditor::straightenUVs() {
         return;
     }
 
-    glm::vec2 start = uvChannels_[currentUVChannel_][selectedUVs_[0]];
-    glm::vec2 end = uvChannels_[currentUVChannel_][selectedUVs_.back()];
+    std::span<const int> selection = sanitizeSelection();
+    if (selection.size() < 2) {
+        return;
+    }
+
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    glm::vec2 start = uvs[selection.front()];
+    glm::vec2 end = uvs[selection.back()];
 
     glm::vec2 direction = glm::normalize(end - start);
 
-    for (size_t i = 1; i < selectedUVs_.size() - 1; ++i) {
-        int index = selectedUVs_[i];
-        float t = static_cast<float>(i) / (selectedUVs_.size() - 1);
-        uvChannels_[currentUVChannel_][index] = start + direction * t * glm::length(end - start);
+    for (size_t i = 1; i < selection.size() - 1; ++i) {
+        int index = selection[i];
+        float t = static_cast<float>(i) / (selection.size() - 1);
+        uvs[index] = start + direction * t * glm::length(end - start);
     }
+
+    markIslandBoundsDirty(selection);
 }
 
 void UVEditor::relaxSelectedUVs(int iterations) {
@@ -475,21 +1123,42 @@ void UVEditor::relaxSelectedUVs(int iterations) {
         return;
     }
 
+    // 邻顶点的成员判定从线性std::find换成位图：选择集物化一次，
+    // 迭代循环里每次判定只剩移位与运算
+    int vertexCount = mesh_->getVertexCount();
+    std::vector<uint64_t> selectedMask((static_cast<size_t>(vertexCount) + 63) / 64, 0);
+    for (int index : selectedUVs_) {
+        if (index >= 0 && index < vertexCount) {
+            selectedMask[index >> 6] |= uint64_t(1) << (index & 63);
+        }
+    }
+
+    if (static_cast<int>(adjOffset_.size()) != vertexCount + 1) {
+        rebuildVertexAdjacency();
+    }
+
     for (int iter = 0; iter < iterations; ++iter) {
         std::unordered_map<int, glm::vec2> newUVs;
 
         for (int index : selectedUVs_) {
-            std::vector<int> adjacentVertices = mesh_->getAdjacentVertices(index);
+            if (index < 0 || index >= vertexCount) {
+                continue;
+            }
+
+            int begin = adjOffset_[index];
+            int end = adjOffset_[index + 1];
 
-            if (adjacentVertices.empty()) {
+            if (begin == end) {
                 continue;
             }
 
             glm::vec2 sum(0.0f);
             int count = 0;
 
-            for (int av : adjacentVertices) {
-                if (std::find(selectedUVs_.begin(), selectedUVs_.end(), av) != selectedUVs_.end()) {
+            for (int k = begin; k < end; ++k) {
+                int av = adjList_[k];
+                if (av >= 0 && av < vertexCount &&
+                    ((selectedMask[av >> 6] >> (av & 63)) & 1) != 0) {
                     sum += uvChannels_[currentUVChannel_][av];
                     count++;
                 }
@@ -504,6 +1173,8 @@ void UVEditor::relaxSelectedUVs(int iterations) {
             uvChannels_[currentUVChannel_][pair.first] = pair.second;
         }
     }
+
+    markIslandBoundsDirty(selectedUVs_);
 }
 
 void UVEditor::projectUVs(const glm::vec3& axis, const glm::vec3& up) {
@@ -518,15 +1189,70 @@ void UVEditor::projectUVs(const glm::vec3& axis, const glm::vec3& up) {
     glm::vec3 center = mesh_->getCenter();
     glm::vec3 size = mesh_->getSize();
 
-    for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-        Vertex vertex = mesh_->getVertex(i);
-        glm::vec3 pos = vertex.position - center;
+    int vertexCount = mesh_->getVertexCount();
+    const std::vector<glm::vec3>& positions = mesh_->getPositions();
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+
+#if defined(__AVX2__)
+    // 两组点积共用一份SoA：基向量广播后mul/add三连，加法顺序与
+    // glm::dot一致，结果逐位不变
+    std::vector<float> soaX(vertexCount);
+    std::vector<float> soaY(vertexCount);
+    std::vector<float> soaZ(vertexCount);
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        soaX[i] = positions[i].x - center.x;
+        soaY[i] = positions[i].y - center.y;
+        soaZ[i] = positions[i].z - center.z;
+    }
+
+    const __m256 rightX = _mm256_set1_ps(right.x);
+    const __m256 rightY = _mm256_set1_ps(right.y);
+    const __m256 rightZ = _mm256_set1_ps(right.z);
+    const __m256 upX = _mm256_set1_ps(normalizedUp.x);
+    const __m256 upY = _mm256_set1_ps(normalizedUp.y);
+    const __m256 upZ = _mm256_set1_ps(normalizedUp.z);
+
+    int blockEnd = vertexCount & ~7;
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < blockEnd; i += 8) {
+        __m256 x = _mm256_loadu_ps(soaX.data() + i);
+        __m256 y = _mm256_loadu_ps(soaY.data() + i);
+        __m256 z = _mm256_loadu_ps(soaZ.data() + i);
+
+        __m256 u = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(x, rightX), _mm256_mul_ps(y, rightY)),
+            _mm256_mul_ps(z, rightZ));
+        __m256 v = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(x, upX), _mm256_mul_ps(y, upY)),
+            _mm256_mul_ps(z, upZ));
+
+        alignas(32) float uLanes[8];
+        alignas(32) float vLanes[8];
+        _mm256_store_ps(uLanes, u);
+        _mm256_store_ps(vLanes, v);
+        for (int k = 0; k < 8; ++k) {
+            uvs[i + k] = glm::vec2(uLanes[k], vLanes[k]);
+        }
+    }
+
+    for (int i = blockEnd; i < vertexCount; ++i) {
+        glm::vec3 pos(soaX[i], soaY[i], soaZ[i]);
+        uvs[i] = glm::vec2(glm::dot(pos, right), glm::dot(pos, normalizedUp));
+    }
+#else
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        glm::vec3 pos = positions[i] - center;
 
         float u = glm::dot(pos, right);
         float v = glm::dot(pos, normalizedUp);
 
-        uvChannels_[currentUVChannel_][i] = glm::vec2(u, v);
+        uvs[i] = glm::vec2(u, v);
     }
+#endif
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::createUVIsland(const std::vector<int>& faceIndices) {
@@ -543,27 +1269,20 @@ void UVEditor::separateUVIslands() {
         UVIsland& island = uvIslands_[i];
         glm::vec2 offset = glm::vec2(static_cast<float>(i) * 0.1f, 0.0f);
 
-        for (int faceIndex : island.faceIndices) {
-            const Face& face = mesh_->getFace(faceIndex);
-            for (int vertexIndex : face.vertices) {
-                uvChannels_[currentUVChannel_][vertexIndex] += offset;
-            }
+        // 去重顶点表保证共享顶点只加一次偏移
+        for (int vertexIndex : island.vertexIndices) {
+            uvChannels_[currentUVChannel_][vertexIndex] += offset;
         }
     }
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::mergeUVIslands(const std::vector<int>& islandIndices) {
 }
 
-std::vector<std::vector<int>> UVEditor::getUVIslands() const {
-    std::vector<std::vector<int>> islands;
-
-    for (const auto& uvIsland : uvIslands_) {
-        std::vector<int> islandFaces = uvIsland.faceIndices;
-        islands.push_back(islandFaces);
-    }
-
-    return islands;
+const std::vector<UVEditor::UVIsland>& UVEditor::getUVIslands() const {
+    return uvIslands_;
 }
 
 void UVEditor::optimizeUVLayout() {
@@ -577,6 +1296,8 @@ void UVEditor::minimizeUVDistortion() {
 void UVEditor::setUVChannel(int channel) {
     if (channel >= 0 && channel < static_cast<int>(uvChannels_.size())) {
         currentUVChannel_ = channel;
+        // 包围盒是按当前通道算的，切通道后需要补算
+        markAllIslandBoundsDirty();
     }
 }
 
@@ -588,10 +1309,8 @@ void UVEditor::addUVChannel() {
     uvChannels_.push_back(std::vector<glm::vec2>());
 
     if (mesh_) {
-        uvChannels_.back().resize(mesh_->getVertexCount());
-        for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-            uvChannels_.back()[i] = mesh_->getVertex(i).texCoord;
-        }
+        // 同setMesh：纹理坐标流整段赋值
+        uvChannels_.back() = mesh_->getTexCoords();
     }
 }
 
@@ -621,21 +1340,61 @@ void UVEditor::normalizeUVs() {
         return;
     }
 
+    const std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    if (uvs.empty()) {
+        return;
+    }
+
     glm::vec2 minUV(std::numeric_limits<float>::max());
     glm::vec2 maxUV(std::numeric_limits<float>::lowest());
 
-    for (const auto& uv : uvChannels_[currentUVChannel_]) {
-        minUV = glm::min(minUV, uv);
-        maxUV = glm::max(maxUV, uv);
+    size_t i = 0;
+#if defined(__AVX2__)
+    // 极值归约8浮点一批；交织(u,v)流上128位半折+movehl再折，
+    // 正好收到一对(u,v)
+    const float* data = &uvs[0].x;
+    size_t floatCount = uvs.size() * 2;
+    __m256 minAcc = _mm256_set1_ps(std::numeric_limits<float>::max());
+    __m256 maxAcc = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+
+    for (; i + 8 <= floatCount; i += 8) {
+        __m256 values = _mm256_loadu_ps(data + i);
+        minAcc = _mm256_min_ps(minAcc, values);
+        maxAcc = _mm256_max_ps(maxAcc, values);
+    }
+
+    __m128 minHalf = _mm_min_ps(_mm256_castps256_ps128(minAcc), _mm256_extractf128_ps(minAcc, 1));
+    minHalf = _mm_min_ps(minHalf, _mm_movehl_ps(minHalf, minHalf));
+    minUV = glm::vec2(_mm_cvtss_f32(minHalf),
+                      _mm_cvtss_f32(_mm_shuffle_ps(minHalf, minHalf, 1)));
+
+    __m128 maxHalf = _mm_max_ps(_mm256_castps256_ps128(maxAcc), _mm256_extractf128_ps(maxAcc, 1));
+    maxHalf = _mm_max_ps(maxHalf, _mm_movehl_ps(maxHalf, maxHalf));
+    maxUV = glm::vec2(_mm_cvtss_f32(maxHalf),
+                      _mm_cvtss_f32(_mm_shuffle_ps(maxHalf, maxHalf, 1)));
+
+    i /= 2;
+#endif
+    for (; i < uvs.size(); ++i) {
+        minUV = glm::min(minUV, uvs[i]);
+        maxUV = glm::max(maxUV, uvs[i]);
+    }
+
+    // 已经贴在[0,1]上就不再走第二遍改写
+    const float eps = 1e-6f;
+    if (std::fabs(minUV.x) <= eps && std::fabs(minUV.y) <= eps &&
+        std::fabs(maxUV.x - 1.0f) <= eps && std::fabs(maxUV.y - 1.0f) <= eps) {
+        return;
     }
 
     glm::vec2 range = maxUV - minUV;
     if (range.x < 0.0001f) range.x = 1.0f;
     if (range.y < 0.0001f) range.y = 1.0f;
 
-    for (auto& uv : uvChannels_[currentUVChannel_]) {
-        uv = (uv - minUV) / range;
-    }
+    // (uv-min)/range折成一趟仿射：uv*(1/range) - min/range
+    glm::vec2 invRange(1.0f / range.x, 1.0f / range.y);
+    applyAffine2D(invRange.x, 0.0f, 0.0f, invRange.y,
+                  -minUV.x * invRange.x, -minUV.y * invRange.y);
 }
 
 void UVEditor::centerUVs() {
@@ -643,17 +1402,49 @@ void UVEditor::centerUVs() {
         return;
     }
 
-    glm::vec2 sum(0.0f);
-    for (const auto& uv : uvChannels_[currentUVChannel_]) {
-        sum += uv;
+    const std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    if (uvs.empty()) {
+        return;
     }
 
-    glm::vec2 center = sum / static_cast<float>(uvChannels_[currentUVChannel_].size());
+    glm::vec2 sum(0.0f);
+    size_t i = 0;
+#if defined(__AVX2__)
+    // 百万顶点级的朴素累加会丢低位，8路Kahan补偿求和兜住精度
+    const float* data = &uvs[0].x;
+    size_t floatCount = uvs.size() * 2;
+    __m256 sumAcc = _mm256_setzero_ps();
+    __m256 compensation = _mm256_setzero_ps();
+
+    for (; i + 8 <= floatCount; i += 8) {
+        __m256 values = _mm256_loadu_ps(data + i);
+        __m256 adjusted = _mm256_sub_ps(values, compensation);
+        __m256 total = _mm256_add_ps(sumAcc, adjusted);
+        compensation = _mm256_sub_ps(_mm256_sub_ps(total, sumAcc), adjusted);
+        sumAcc = total;
+    }
+
+    __m128 sumHalf = _mm_add_ps(_mm256_castps256_ps128(sumAcc), _mm256_extractf128_ps(sumAcc, 1));
+    sumHalf = _mm_add_ps(sumHalf, _mm_movehl_ps(sumHalf, sumHalf));
+    sum = glm::vec2(_mm_cvtss_f32(sumHalf),
+                    _mm_cvtss_f32(_mm_shuffle_ps(sumHalf, sumHalf, 1)));
+
+    i /= 2;
+#endif
+    for (; i < uvs.size(); ++i) {
+        sum += uvs[i];
+    }
+
+    glm::vec2 center = sum / static_cast<float>(uvs.size());
     glm::vec2 offset = glm::vec2(0.5f) - center;
 
-    for (auto& uv : uvChannels_[currentUVChannel_]) {
-        uv += offset;
+    // 已经居中就省掉整遍平移
+    const float eps = 1e-6f;
+    if (std::fabs(offset.x) <= eps && std::fabs(offset.y) <= eps) {
+        return;
     }
+
+    applyAffine2D(1.0f, 0.0f, 0.0f, 1.0f, offset.x, offset.y);
 }
 
 void UVEditor::bakeLightmapUVs(float texelSize) {
@@ -664,10 +1455,27 @@ void UVEditor::validateUVs() {
         return;
     }
 
-    for (auto& uv : uvChannels_[currentUVChannel_]) {
-        uv.x = std::clamp(uv.x, 0.0f, 1.0f);
-        uv.y = std::clamp(uv.y, 0.0f, 1.0f);
+    // 两个分量同样夹取到[0,1]，平铺float视图一条min/max链扫完
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    if (uvs.empty()) {
+        return;
+    }
+    float* data = &uvs[0].x;
+    size_t floatCount = uvs.size() * 2;
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (; i + 8 <= floatCount; i += 8) {
+        _mm256_storeu_ps(data + i,
+            _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(data + i), zero), one));
     }
+#endif
+    for (; i < floatCount; ++i) {
+        data[i] = std::clamp(data[i], 0.0f, 1.0f);
+    }
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::fixUVSeams() {
@@ -675,81 +1483,200 @@ void UVEditor::fixUVSeams() {
         return;
     }
 
-    std::unordered_map<size_t, std::vector<int>> uvGroups;
+    // 哈希分组从unordered_map换成排序+游程：每顶点一次插入的散列与
+    // 小vector分配全省掉，等哈希相邻成段，一趟线性扫完。(hash,下标)
+    // 排序后段内下标仍升序，求和顺序与原先一致，平均值逐位不变
+    int vertexCount = mesh_->getVertexCount();
+    std::vector<std::pair<uint64_t, int>> hashes(vertexCount);
 
-    for (int i = 0; i < mesh_->getVertexCount(); ++i) {
-        const Vertex& vertex = mesh_->getVertex(i);
-        size_t hash = vertex.hash();
+#pragma omp parallel for schedule(static) if (vertexCount > 4096)
+    for (int i = 0; i < vertexCount; ++i) {
+        hashes[i] = {static_cast<uint64_t>(mesh_->getVertex(i).hash()), i};
+    }
+
+    std::sort(hashes.begin(), hashes.end());
 
-        if (uvGroups.find(hash) == uvGroups.end()) {
-            uvGroups[hash] = std::vector<int>();
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    size_t runStart = 0;
+    while (runStart < hashes.size()) {
+        size_t runEnd = runStart + 1;
+        while (runEnd < hashes.size() && hashes[runEnd].first == hashes[runStart].first) {
+            ++runEnd;
         }
-        uvGroups[hash].push_back(i);
-    }
 
-    for (const auto& pair : uvGroups) {
-        if (pair.second.size() > 1) {
+        if (runEnd - runStart > 1) {
             glm::vec2 averageUV(0.0f);
-            for (int index : pair.second) {
-                averageUV += uvChannels_[currentUVChannel_][index];
+            for (size_t k = runStart; k < runEnd; ++k) {
+                averageUV += uvs[hashes[k].second];
             }
-            averageUV /= static_cast<float>(pair.second.size());
+            averageUV /= static_cast<float>(runEnd - runStart);
 
-            for (int index : pair.second) {
-                uvChannels_[currentUVChannel_][index] = averageUV;
+            for (size_t k = runStart; k < runEnd; ++k) {
+                uvs[hashes[k].second] = averageUV;
             }
         }
+
+        runStart = runEnd;
+    }
+
+    markAllIslandBoundsDirty();
+}
+
+void UVEditor::applyAffine2D(float a, float b, float c, float d, float tx, float ty) {
+    if (uvChannels_.empty()) {
+        return;
+    }
+    std::vector<glm::vec2>& uvs = uvChannels_[currentUVChannel_];
+    if (uvs.empty()) {
+        return;
     }
+
+    float* data = &uvs[0].x;
+    size_t floatCount = uvs.size() * 2;
+    size_t i = 0;
+#if defined(__AVX2__)
+    // 交织(u,v)流上直接算：本通道乘(a,d)图样、邻通道换位后乘(b,c)图样
+    // 再加(tx,ty)，偶数通道得u'、奇数通道得v'，4个UV一拍
+    const __m256 diag = _mm256_setr_ps(a, d, a, d, a, d, a, d);
+    const __m256 cross = _mm256_setr_ps(b, c, b, c, b, c, b, c);
+    const __m256 translate = _mm256_setr_ps(tx, ty, tx, ty, tx, ty, tx, ty);
+    // 8192个float对应4096个UV，与其他逐顶点循环同一并行阈值
+    long long simdEnd = static_cast<long long>(floatCount & ~static_cast<size_t>(7));
+#pragma omp parallel for schedule(static) if (floatCount > 8192)
+    for (long long block = 0; block < simdEnd; block += 8) {
+        __m256 values = _mm256_loadu_ps(data + block);
+        __m256 swapped = _mm256_permute_ps(values, 0xB1);
+        __m256 result = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(values, diag), _mm256_mul_ps(swapped, cross)),
+            translate);
+        _mm256_storeu_ps(data + block, result);
+    }
+    i = static_cast<size_t>(simdEnd);
+#endif
+    for (; i + 2 <= floatCount; i += 2) {
+        float u = data[i];
+        float v = data[i + 1];
+        data[i] = a * u + b * v + tx;
+        data[i + 1] = c * u + d * v + ty;
+    }
+
+    markAllIslandBoundsDirty();
 }
 
 void UVEditor::calculateUVIslands() {
-    if (!mesh_ || !islandsDirty_) {
+    if (!mesh_) {
+        return;
+    }
+
+    if (!islandsDirty_) {
+        // 拓扑没动：只补算标脏的岛的包围盒
+        for (size_t i = 0; i < uvIslands_.size() && i < islandBoundsDirty_.size(); ++i) {
+            if (islandBoundsDirty_[i]) {
+                calculateIslandBounds(uvIslands_[i]);
+                islandBoundsDirty_[i] = 0;
+            }
+        }
         return;
     }
 
     uvIslands_.clear();
 
-    std::vector<bool> visited(mesh_->getFaceCount(), false);
+    int faceCount = mesh_->getFaceCount();
+    int vertexCount = mesh_->getVertexCount();
+    if (static_cast<int>(vertexFaceOffset_.size()) != vertexCount + 1) {
+        rebuildVertexAdjacency();
+    }
+
+    // 并查集替代BFS：每个顶点把CSR行里的面两两合并，单趟流式扫完，
+    // 无栈、无重复访问。路径减半压扁，始终让小面号当根
+    std::vector<int> parent(faceCount);
+    for (int i = 0; i < faceCount; ++i) {
+        parent[i] = i;
+    }
 
-    for (int i = 0; i < mesh_->getFaceCount(); ++i) {
-        if (visited[i]) {
-            continue;
+    auto findRoot = [&parent](int face) {
+        while (parent[face] != face) {
+            parent[face] = parent[parent[face]];
+            face = parent[face];
         }
+        return face;
+    };
 
-        UVIsland island;
-        std::vector<int> stack = {i};
-
-        while (!stack.empty()) {
-            int faceIndex = stack.back();
-            stack.pop_back();
+    for (int v = 0; v < vertexCount; ++v) {
+        int begin = vertexFaceOffset_[v];
+        int end = vertexFaceOffset_[v + 1];
+        if (end - begin < 2) {
+            continue;
+        }
 
-            if (visited[faceIndex]) {
-                continue;
+        int first = findRoot(vertexFaceList_[begin]);
+        for (int k = begin + 1; k < end; ++k) {
+            int other = findRoot(vertexFaceList_[k]);
+            if (other != first) {
+                if (other < first) {
+                    std::swap(other, first);
+                }
+                parent[other] = first;
             }
+        }
+    }
 
-            visited[faceIndex] = true;
-            island.faceIndices.push_back(faceIndex);
+    // 按面序归组：根第一次出现时开新岛，岛顺序仍按最小面号，
+    // 与原BFS外层循环一致。岛的顶点集互不相交，标记全程复用
+    std::vector<int> rootToIsland(faceCount, -1);
+    std::vector<uint8_t> vertexSeen(vertexCount, 0);
+    vertexToIsland_.assign(vertexCount, -1);
 
-            const Face& face = mesh_->getFace(faceIndex);
+    for (int f = 0; f < faceCount; ++f) {
+        int root = findRoot(f);
+        int islandIndex = rootToIsland[root];
+        if (islandIndex < 0) {
+            islandIndex = static_cast<int>(uvIslands_.size());
+            rootToIsland[root] = islandIndex;
+            uvIslands_.emplace_back();
+        }
 
-            for (int vertexIndex : face.vertices) {
-                std::vector<int> adjacentFaces = mesh_->getAdjacentFaces(vertexIndex);
+        UVIsland& island = uvIslands_[islandIndex];
+        island.faceIndices.push_back(f);
 
-                for (int adjacentFaceIndex : adjacentFaces) {
-                    if (!visited[adjacentFaceIndex]) {
-                        stack.push_back(adjacentFaceIndex);
-                    }
-                }
+        const Face& face = mesh_->getFace(f);
+        for (int vertexIndex : face.vertices) {
+            if (!vertexSeen[vertexIndex]) {
+                vertexSeen[vertexIndex] = 1;
+                island.vertexIndices.push_back(vertexIndex);
+                vertexToIsland_[vertexIndex] = islandIndex;
             }
         }
+    }
 
+    for (UVIsland& island : uvIslands_) {
         calculateIslandBounds(island);
-        uvIslands_.push_back(island);
     }
 
+    islandBoundsDirty_.assign(uvIslands_.size(), 0);
     islandsDirty_ = false;
 }
 
+void UVEditor::markIslandBoundsDirty(std::span<const int> uvIndices) {
+    if (islandsDirty_ || vertexToIsland_.empty()) {
+        return;
+    }
+
+    int vertexCount = static_cast<int>(vertexToIsland_.size());
+    for (int index : uvIndices) {
+        if (index >= 0 && index < vertexCount) {
+            int islandIndex = vertexToIsland_[index];
+            if (islandIndex >= 0 && islandIndex < static_cast<int>(islandBoundsDirty_.size())) {
+                islandBoundsDirty_[islandIndex] = 1;
+            }
+        }
+    }
+}
+
+void UVEditor::markAllIslandBoundsDirty() {
+    std::fill(islandBoundsDirty_.begin(), islandBoundsDirty_.end(), static_cast<uint8_t>(1));
+}
+
 void UVEditor::calculateIslandBounds(UVIsland& island) {
     if (!mesh_ || uvChannels_.empty()) {
         return;
@@ -758,13 +1685,11 @@ void UVEditor::calculateIslandBounds(UVIsland& island) {
     island.minUV = glm::vec2(std::numeric_limits<float>::max());
     island.maxUV = glm::vec2(std::numeric_limits<float>::lowest());
 
-    for (int faceIndex : island.faceIndices) {
-        const Face& face = mesh_->getFace(faceIndex);
-        for (int vertexIndex : face.vertices) {
-            const glm::vec2& uv = uvChannels_[currentUVChannel_][vertexIndex];
-            island.minUV = glm::min(island.minUV, uv);
-            island.maxUV = glm::max(island.maxUV, uv);
-        }
+    // 去重后的顶点表一趟线性扫，免去面→顶点的二级间接
+    for (int vertexIndex : island.vertexIndices) {
+        const glm::vec2& uv = uvChannels_[currentUVChannel_][vertexIndex];
+        island.minUV = glm::min(island.minUV, uv);
+        island.maxUV = glm::max(island.maxUV, uv);
     }
 
     island.center = (island.minUV + island.maxUV) * 0.5f;
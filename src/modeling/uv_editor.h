@@ -2,6 +2,7 @@
 
 #include "mesh.h"
 #include <glm/glm.hpp>
+#include <span>
 #include <vector>
 #include <unordered_map>
 
@@ -10,6 +11,16 @@ namespace modeling {
 
 class UVEditor {
 public:
+    struct UVIsland {
+        std::vector<int> faceIndices;
+        std::vector<int> vertexIndices;
+        glm::vec2 minUV;
+        glm::vec2 maxUV;
+        glm::vec2 center;
+        glm::vec2 size;
+        float area;
+    };
+
     UVEditor();
     ~UVEditor();
 
@@ -36,7 +47,7 @@ public:
     void deselectUVs();
     void invertSelection();
 
-    std::vector<int> getSelectedUVs() const;
+    const std::vector<int>& getSelectedUVs() const;
 
     void weldUVs(float threshold = 0.001f);
     void splitUVs(const std::vector<int>& indices);
@@ -54,7 +65,7 @@ public:
     void separateUVIslands();
     void mergeUVIslands(const std::vector<int>& islandIndices);
 
-    std::vector<std::vector<int>> getUVIslands() const;
+    const std::vector<UVIsland>& getUVIslands() const;
 
     void optimizeUVLayout();
     void minimizeUVDistortion();
@@ -77,24 +88,57 @@ public:
     void fixUVSeams();
 
 private:
-    struct UVIsland {
-        std::vector<int> faceIndices;
-        glm::vec2 minUV;
-        glm::vec2 maxUV;
-        glm::vec2 center;
-        glm::vec2 size;
-        float area;
-    };
-
     void calculateUVIslands();
     void calculateIslandBounds(UVIsland& island);
 
+    /**
+     * @brief 标记若干UV下标所属岛的包围盒失效
+     *
+     * 选择集级别的编辑只弄脏少数岛，calculateUVIslands按岛补算，
+     * 不整库重算。拓扑变化仍走islandsDirty_全量重建。
+     */
+    void markIslandBoundsDirty(std::span<const int> uvIndices);
+
+    /// @brief 整通道编辑后把所有岛的包围盒标脏
+    void markAllIslandBoundsDirty();
+
+    /**
+     * @brief 当前通道整体套一个2D仿射：u' = a*u + b*v + tx，v' = c*u + d*v + ty
+     *
+     * 缩放/平移/旋转/翻转都是它的特例，各自先组好系数再走这一个
+     * 流式内核，链式变换只付一趟内存带宽。
+     */
+    void applyAffine2D(float a, float b, float c, float d, float tx, float ty);
+
+    /**
+     * @brief 重建顶点邻接的CSR缓存（adjOffset_/adjList_与顶点→面两组）
+     *
+     * 把getAdjacentVertices/getAdjacentFaces逐顶点的返回值物化成扁平数组，
+     * 迭代平滑与岛提取按行区间索引，不再每顶点每轮分配临时vector。
+     */
+    void rebuildVertexAdjacency();
+
+    /**
+     * @brief 入口处把选择集过滤一遍越界下标
+     *
+     * 对齐/分布这类热循环不再逐元素做range check，循环体只剩纯算术，
+     * 编译器也好向量化。返回的span指向内部暂存，下次调用前有效。
+     */
+    std::span<const int> sanitizeSelection();
+
     Mesh* mesh_;
     std::vector<std::vector<glm::vec2>> uvChannels_;
     int currentUVChannel_;
     std::vector<int> selectedUVs_;
+    std::vector<int> sanitizedSelection_;
     std::vector<UVIsland> uvIslands_;
     bool islandsDirty_;
+    std::vector<int> vertexToIsland_;
+    std::vector<uint8_t> islandBoundsDirty_;
+    std::vector<int> adjOffset_;
+    std::vector<int> adjList_;
+    std::vector<int> vertexFaceOffset_;
+    std::vector<int> vertexFaceList_;
 };
 
 }
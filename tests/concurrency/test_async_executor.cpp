@@ -39,7 +39,7 @@ TEST_F(AsyncExecutorTest, ExecuteWithArguments) {
 
 TEST_F(AsyncExecutorTest, MultipleExecutions) {
     std::atomic<int> count(0);
-    std::vector<std::future<int>> futures;
+    std::vector<InlineFuture<int>> futures;
     
     for (int i = 0; i < 10; ++i) {
         futures.push_back(executor_->execute([&count, i]() {
@@ -104,7 +104,7 @@ TEST_F(AsyncExecutorTest, ExecuteFireAndForget) {
 TEST_F(AsyncExecutorTest, StressTest_ManyExecutions) {
     const int numTasks = 1000;
     std::atomic<int> count(0);
-    std::vector<std::future<int>> futures;
+    std::vector<InlineFuture<int>> futures;
     futures.reserve(numTasks);
     
     for (int i = 0; i < numTasks; ++i) {
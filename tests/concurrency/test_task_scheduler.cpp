@@ -14,9 +14,11 @@ protected:
         threadPool_ = std::make_unique<ThreadPool>(4);
         threadPool_->start();
         scheduler_->setThreadPool(threadPool_.get());
+        scheduler_->startTimerThread();
     }
 
     void TearDown() override {
+        scheduler_->stopTimerThread();
         if (threadPool_) {
             threadPool_->stop();
         }
@@ -69,6 +71,18 @@ TEST_F(TaskSchedulerTest, ScheduleDelayed) {
     EXPECT_GE(duration, 100);
 }
 
+TEST_F(TaskSchedulerTest, TimerThreadFiresWithoutUpdate) {
+    std::atomic<bool> executed(false);
+
+    // 定时线程精确睡到到期时刻，不依赖任何update()轮询
+    scheduler_->scheduleDelayed([&executed]() {
+        executed = true;
+    }, std::chrono::milliseconds(30));
+
+    TestUtils::sleepMs(100);
+    EXPECT_TRUE(executed);
+}
+
 TEST_F(TaskSchedulerTest, ScheduleRepeated) {
     std::atomic<int> count(0);
     
@@ -104,6 +118,27 @@ TEST_F(TaskSchedulerTest, MultipleDelayedTasks) {
     EXPECT_EQ(executionOrder[2], 2);
 }
 
+TEST_F(TaskSchedulerTest, MultipleDelayedTasksLockFree) {
+    AtomicRingBuffer<int, 8> ring;
+
+    scheduler_->scheduleDelayedInto(ring, []() { return 1; }, std::chrono::milliseconds(50));
+    scheduler_->scheduleDelayedInto(ring, []() { return 2; }, std::chrono::milliseconds(100));
+    scheduler_->scheduleDelayedInto(ring, []() { return 3; }, std::chrono::milliseconds(25));
+
+    TestUtils::sleepMs(150);
+
+    std::vector<int> executionOrder;
+    int value = 0;
+    while (ring.pop(value)) {
+        executionOrder.push_back(value);
+    }
+
+    EXPECT_EQ(executionOrder.size(), 3);
+    EXPECT_EQ(executionOrder[0], 3);
+    EXPECT_EQ(executionOrder[1], 1);
+    EXPECT_EQ(executionOrder[2], 2);
+}
+
 TEST_F(TaskSchedulerTest, MultipleRepeatedTasks) {
     std::atomic<int> count1(0);
     std::atomic<int> count2(0);
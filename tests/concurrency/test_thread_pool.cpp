@@ -41,7 +41,7 @@ TEST_F(ThreadPoolTest, BasicSubmit) {
 
 TEST_F(ThreadPoolTest, MultipleTasks) {
     std::atomic<int> count(0);
-    std::vector<std::future<int>> futures;
+    std::vector<InlineFuture<int>> futures;
     
     for (int i = 0; i < 10; ++i) {
         futures.push_back(threadPool_->submit([&count, i]() {
@@ -110,6 +110,34 @@ TEST_F(ThreadPoolTest, PriorityTasks) {
     EXPECT_EQ(executionOrder.size(), 5);
 }
 
+TEST_F(ThreadPoolTest, AffinityPolicy) {
+    auto pool = std::make_unique<ThreadPool>(2);
+    
+    EXPECT_EQ(pool->getAffinityPolicy(), ThreadPool::AffinityPolicy::None);
+    
+    pool->setAffinityPolicy(ThreadPool::AffinityPolicy::Packed);
+    EXPECT_EQ(pool->getAffinityPolicy(), ThreadPool::AffinityPolicy::Packed);
+    
+    pool->start();
+    
+    std::atomic<int> count(0);
+    std::vector<InlineFuture<void>> futures;
+    
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(pool->submit([&count]() {
+            count++;
+        }));
+    }
+    
+    for (auto& future : futures) {
+        future.get();
+    }
+    
+    EXPECT_EQ(count, 100);
+    
+    pool->stop();
+}
+
 TEST_F(ThreadPoolTest, StartStop) {
     auto pool = std::make_unique<ThreadPool>(2);
     
@@ -161,7 +189,7 @@ TEST_F(ThreadPoolTest, ThreadCount) {
 
 TEST_F(ThreadPoolTest, ActiveThreadCount) {
     std::atomic<int> activeCount(0);
-    std::vector<std::future<void>> futures;
+    std::vector<InlineFuture<void>> futures;
     
     for (int i = 0; i < 10; ++i) {
         futures.push_back(threadPool_->submit([&activeCount]() {
@@ -213,10 +241,25 @@ TEST_F(ThreadPoolTest, ClearQueue) {
     EXPECT_EQ(threadPool_->getPendingTaskCount(), 10);
     
     threadPool_->clearQueue();
-    
+
     EXPECT_EQ(threadPool_->getPendingTaskCount(), 0);
 }
 
+TEST_F(ThreadPoolTest, DiscardedTaskBreaksPromise) {
+    threadPool_->pause();
+
+    // 任务没执行就被clearQueue()丢弃：get()应抛broken_promise而不是永久阻塞
+    auto cleared = threadPool_->submit([]() { return 1; });
+    threadPool_->clearQueue();
+    EXPECT_THROW(cleared.get(), std::future_error);
+
+    // stop()后销毁线程池，仍在队列里的任务同样要断约唤醒等待者
+    auto stopped = threadPool_->submit([]() { return 2; });
+    threadPool_->stop();
+    threadPool_.reset();
+    EXPECT_THROW(stopped.get(), std::future_error);
+}
+
 TEST_F(ThreadPoolTest, TaskCancellation) {
     std::atomic<bool> taskExecuted(false);
     
@@ -238,7 +281,7 @@ TEST_F(ThreadPoolTest, StressTest_ManyTasks) {
     const int numTasks = 1000;
     std::atomic<int> count(0);
     
-    std::vector<std::future<int>> futures;
+    std::vector<InlineFuture<int>> futures;
     futures.reserve(numTasks);
     
     for (int i = 0; i < numTasks; ++i) {
@@ -258,7 +301,7 @@ TEST_F(ThreadPoolTest, StressTest_ManyTasks) {
 TEST_F(ThreadPoolTest, StressTest_LongRunningTasks) {
     const int numTasks = 100;
     std::atomic<int> count(0);
-    std::vector<std::future<void>> futures;
+    std::vector<InlineFuture<void>> futures;
     
     for (int i = 0; i < numTasks; ++i) {
         futures.push_back(threadPool_->submit([&count]() {
@@ -15,7 +15,7 @@ public:
     
     TestEvent(int v, const std::string& msg) : value(v), message(msg) {}
     
-    std::string getType() const override { return "TestEvent"; }
+    DEFINE_EVENT_TYPE(TestEvent)
     size_t getSize() const override { return sizeof(TestEvent); }
 };
 
@@ -25,10 +25,13 @@ public:
     
     AnotherEvent(float d) : data(d) {}
     
-    std::string getType() const override { return "AnotherEvent"; }
+    DEFINE_EVENT_TYPE(AnotherEvent)
     size_t getSize() const override { return sizeof(AnotherEvent); }
 };
 
+DEFINE_EVENT(TestEvent, 0);
+DEFINE_EVENT(AnotherEvent, 1);
+
 class EventSystemTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -128,10 +131,34 @@ TEST_F(EventSystemTest, EventBus_AsyncPublish) {
     eventBus_->publishAsync("async_channel", std::make_unique<TestEvent>(0, ""));
     
     eventBus_->processEvents();
-    
+
     EXPECT_EQ(receivedCount, 3);
 }
 
+TEST_F(EventSystemTest, EventBus_AsyncPublishByValue) {
+    std::atomic<int> receivedCount(0);
+    int receivedValue = 0;
+
+    eventBus_->subscribe("inline_channel", [&](const Event& e) {
+        receivedCount++;
+        if (e.getType() == "TestEvent") {
+            receivedValue = static_cast<const TestEvent&>(e).value;
+        }
+    });
+
+    // 小事件就地构造进队列槽位，不经过堆
+    eventBus_->publishAsync("inline_channel", TestEvent(7, "inline"));
+    eventBus_->publishAsync("inline_channel", AnotherEvent(1.0f));
+
+    ChannelId channelId = eventBus_->getChannelId("inline_channel");
+    eventBus_->publishAsync(channelId, TestEvent(9, "inline"));
+
+    eventBus_->processEvents();
+
+    EXPECT_EQ(receivedCount, 3);
+    EXPECT_EQ(receivedValue, 9);
+}
+
 TEST_F(EventSystemTest, EventBus_Clear) {
     std::atomic<int> count(0);
     
@@ -185,14 +212,45 @@ TEST_F(EventSystemTest, EventDispatcher_TypeSafety) {
     
     std::atomic<int> testEventCount(0);
     
-    dispatcher.addListener("TestEvent", [&](const Event&) { testEventCount++; });
-    
+    dispatcher.addListener<TestEvent>([&](const Event&) { testEventCount++; });
+
     TestEvent event(42, "Test");
-    
-    dispatcher.dispatch(static_cast<const Event&>(event));
-    dispatcher.dispatch(static_cast<const Event&>(event));
-    
+
+    dispatcher.dispatch(event);
+    dispatcher.dispatch(event);
+
+    EXPECT_EQ(testEventCount, 2);
+
+    dispatcher.clearListeners();
+}
+
+TEST_F(EventSystemTest, EventDispatcher_TypeIndexRouting) {
+    EventDispatcher& dispatcher = EventDispatcher::getInstance();
+
+    std::atomic<int> testEventCount(0);
+    std::atomic<int> anotherEventCount(0);
+
+    dispatcher.addListener<TestEvent>([&](const Event&) { testEventCount++; });
+    dispatcher.addListener<AnotherEvent>([&](const Event&) { anotherEventCount++; });
+
+    TestEvent testEvent(1, "");
+    AnotherEvent anotherEvent(2.0f);
+
+    dispatcher.dispatch(testEvent);
+    dispatcher.dispatch(anotherEvent);
+    dispatcher.dispatch(testEvent);
+
     EXPECT_EQ(testEventCount, 2);
+    EXPECT_EQ(anotherEventCount, 1);
+
+    dispatcher.removeAllListeners<TestEvent>();
+    dispatcher.dispatch(testEvent);
+    dispatcher.dispatch(anotherEvent);
+
+    EXPECT_EQ(testEventCount, 2);
+    EXPECT_EQ(anotherEventCount, 2);
+
+    dispatcher.clearListeners();
 }
 
 TEST_F(EventSystemTest, EventDispatcher_RemoveListener) {
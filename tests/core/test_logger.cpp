@@ -104,10 +104,32 @@ TEST_F(LoggerTest, RollingFileAppender) {
     }
     
     logger_->flush();
-    
+
     EXPECT_TRUE(TestUtils::fileExists(testLogPath_));
 }
 
+TEST_F(LoggerTest, MmapFileAppender) {
+    TestUtils::createDirectory("test_temp");
+
+    const size_t maxFileSize = 1024;
+    const int maxFiles = 3;
+
+    logger_->addAppender(std::make_shared<MmapFileAppender>(testLogPath_, maxFileSize, maxFiles));
+
+    std::string longMessage(100, 'A');
+
+    for (int i = 0; i < 10; ++i) {
+        logger_->info("Message {}: {}", i, longMessage);
+    }
+
+    logger_->flush();
+
+    // 文件预扩有尾部空洞，读取按内容查找
+    EXPECT_TRUE(TestUtils::fileExists(testLogPath_));
+    std::string content = readLogFile(testLogPath_);
+    EXPECT_TRUE(content.find("Message 9") != std::string::npos);
+}
+
 TEST_F(LoggerTest, ThreadSafety) {
     logger_->addAppender(std::make_shared<ConsoleAppender>());
     
@@ -117,7 +139,7 @@ TEST_F(LoggerTest, ThreadSafety) {
     
     auto logFunc = [this, &logCount, numLogsPerThread]() {
         for (int i = 0; i < numLogsPerThread; ++i) {
-            logger_->info("Thread log: " + std::to_string(i));
+            logger_->info("Thread log: {}", i);
             logCount++;
         }
     };
@@ -161,6 +183,36 @@ TEST_F(LoggerTest, Flush) {
     EXPECT_TRUE(content.find("Before flush") != std::string::npos);
 }
 
+TEST_F(LoggerTest, AsyncFileOutput) {
+    TestUtils::createDirectory("test_temp");
+    
+    logger_->addAppender(std::make_shared<AsyncFileAppender>(testLogPath_));
+    
+    const int numThreads = 4;
+    const int numLogsPerThread = 50;
+    
+    std::vector<std::thread> threads;
+    
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([this, numLogsPerThread]() {
+            for (int j = 0; j < numLogsPerThread; ++j) {
+                logger_->info("Async log: {}", j);
+            }
+        });
+    }
+    
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    logger_->flush();
+    
+    std::string content = readLogFile(testLogPath_);
+    
+    EXPECT_TRUE(content.find("Async log: 0") != std::string::npos);
+    EXPECT_TRUE(content.find("Async log: " + std::to_string(numLogsPerThread - 1)) != std::string::npos);
+}
+
 TEST_F(LoggerTest, LoggerName) {
     EXPECT_EQ(logger_->getName(), "test_logger");
 }
@@ -179,7 +231,7 @@ TEST_F(LoggerTest, StressTest_ManyLogs) {
     const int numLogs = 1000;
     
     for (int i = 0; i < numLogs; ++i) {
-        logger_->info("Log message number: " + std::to_string(i));
+        logger_->info("Log message number: {}", i);
     }
     
     SUCCEED();
@@ -197,7 +249,7 @@ TEST_F(LoggerTest, StressTest_ManyThreads) {
     for (int i = 0; i < numThreads; ++i) {
         threads.emplace_back([this, &logCount, numLogsPerThread]() {
             for (int j = 0; j < numLogsPerThread; ++j) {
-                logger_->info("Thread log: " + std::to_string(j));
+                logger_->info("Thread log: {}", j);
                 logCount++;
             }
         });
@@ -218,7 +270,7 @@ TEST_F(LoggerTest, Performance_FileLogging) {
     const int numLogs = 1000;
     
     for (int i = 0; i < numLogs; ++i) {
-        logger_->info("Performance test message: " + std::to_string(i));
+        logger_->info("Performance test message: {}", i);
     }
     
     logger_->flush();
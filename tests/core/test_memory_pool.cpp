@@ -4,6 +4,7 @@
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <memory_resource>
 
 using namespace v3d::core;
 using namespace v3d::test;
@@ -104,6 +105,7 @@ TEST_F(MemoryPoolTest, MemoryPool_ThreadSafety) {
     };
     
     std::vector<std::thread> threads;
+    threads.reserve(10);
     for (int i = 0; i < 10; ++i) {
         threads.emplace_back(allocateFunc);
     }
@@ -116,6 +118,86 @@ TEST_F(MemoryPoolTest, MemoryPool_ThreadSafety) {
     EXPECT_EQ(pool.getUsedCount(), 0);
 }
 
+TEST_F(MemoryPoolTest, MemoryPool_CrossThreadFree) {
+    MemoryPool<int, 1024> pool;
+    std::vector<int*> pointers;
+
+    // 分配线程建立所有权，释放发生在另一个线程（remote链慢路径）
+    std::thread allocThread([&pool, &pointers]() {
+        for (int i = 0; i < 200; ++i) {
+            int* ptr = pool.allocate();
+            *ptr = i;
+            pointers.push_back(ptr);
+        }
+    });
+    allocThread.join();
+
+    EXPECT_EQ(pool.getUsedCount(), 200);
+
+    std::thread freeThread([&pool, &pointers]() {
+        for (auto ptr : pointers) {
+            pool.deallocate(ptr);
+        }
+    });
+    freeThread.join();
+
+    EXPECT_EQ(pool.getUsedCount(), 0);
+}
+
+TEST_F(MemoryPoolTest, BitmapPool_AllocateDeallocate) {
+    BitmapPool<int, 128> pool;
+
+    EXPECT_EQ(pool.getCapacity(), 128);
+    EXPECT_EQ(pool.getUsedCount(), 0);
+
+    int* ptr1 = pool.allocate();
+    int* ptr2 = pool.allocate();
+
+    ASSERT_NE(ptr1, nullptr);
+    ASSERT_NE(ptr2, nullptr);
+    EXPECT_NE(ptr1, ptr2);
+    EXPECT_EQ(pool.getUsedCount(), 2);
+
+    *ptr1 = 1;
+    *ptr2 = 2;
+    EXPECT_EQ(*ptr1, 1);
+    EXPECT_EQ(*ptr2, 2);
+
+    pool.deallocate(ptr1);
+    pool.deallocate(ptr2);
+
+    EXPECT_EQ(pool.getUsedCount(), 0);
+}
+
+TEST_F(MemoryPoolTest, BitmapPool_FullPool) {
+    BitmapPool<int, 100> pool;
+
+    std::vector<int*> pointers;
+    for (size_t i = 0; i < pool.getCapacity(); ++i) {
+        int* ptr = pool.allocate();
+        ASSERT_NE(ptr, nullptr);
+        pointers.push_back(ptr);
+    }
+
+    EXPECT_EQ(pool.allocate(), nullptr);
+
+    pool.deallocate(pointers.back());
+
+    EXPECT_EQ(pool.allocate(), pointers.back());
+}
+
+TEST_F(MemoryPoolTest, BitmapPool_ReuseFreedSlot) {
+    BitmapPool<int, 64> pool;
+
+    int* ptr = pool.allocate();
+    *ptr = 42;
+
+    pool.deallocate(ptr);
+
+    EXPECT_EQ(pool.allocate(), ptr);
+    EXPECT_EQ(*ptr, 42);
+}
+
 TEST_F(MemoryPoolTest, ObjectPool_AcquireRelease) {
     ObjectPool<std::string> pool(10);
     
@@ -186,6 +268,21 @@ TEST_F(MemoryPoolTest, ObjectPool_Clear) {
     EXPECT_EQ(pool.getCapacity(), 0);
 }
 
+TEST_F(MemoryPoolTest, ObjectPool_PmrStrings) {
+    ObjectPool<std::pmr::string> pool(10);
+
+    // 元素分配器指向池的后备资源，串内容与节点板同一竞技场
+    std::pmr::string* str = pool.acquire(
+        "a string comfortably longer than any SSO buffer",
+        pool.memoryResource());
+
+    ASSERT_NE(str, nullptr);
+    EXPECT_EQ(*str, "a string comfortably longer than any SSO buffer");
+
+    pool.release(str);
+    EXPECT_EQ(pool.getUsedCount(), 0);
+}
+
 TEST_F(MemoryPoolTest, ObjectPool_Reserve) {
     ObjectPool<int> pool(10);
     
@@ -224,6 +321,18 @@ TEST_F(MemoryPoolTest, MemoryArena_Reset) {
     EXPECT_EQ(arena.getUsedMemory(), 0);
 }
 
+TEST_F(MemoryPoolTest, MemoryArena_ResetSecure) {
+    MemoryArena arena(1024);
+
+    int* value = static_cast<int*>(arena.allocate(sizeof(int)));
+    *value = 42;
+
+    arena.resetSecure();
+
+    EXPECT_EQ(arena.getUsedMemory(), 0);
+    EXPECT_EQ(*value, 0);
+}
+
 TEST_F(MemoryPoolTest, MemoryArena_Alignment) {
     MemoryArena arena(1024);
     
@@ -277,6 +386,38 @@ TEST_F(MemoryPoolTest, SmartPtr_Reset) {
     EXPECT_FALSE(ptr);
 }
 
+namespace {
+
+// 自带分配计数的类型，验证makeSmart只触发一次堆分配
+struct CountedPayload {
+    static int allocations;
+    int value;
+
+    explicit CountedPayload(int v) : value(v) {}
+
+    static void* operator new(size_t size) {
+        ++allocations;
+        return ::operator new(size);
+    }
+    static void operator delete(void* ptr) {
+        ::operator delete(ptr);
+    }
+};
+
+int CountedPayload::allocations = 0;
+
+}
+
+TEST_F(MemoryPoolTest, SmartPtr_MakeSmart) {
+    CountedPayload::allocations = 0;
+
+    auto ptr = makeSmart<CountedPayload>(42);
+
+    EXPECT_TRUE(ptr);
+    EXPECT_EQ(ptr->value, 42);
+    EXPECT_EQ(CountedPayload::allocations, 1);
+}
+
 TEST_F(MemoryPoolTest, SmartPtr_Release) {
     SmartPtr<int> ptr(new int(42));
     
@@ -291,10 +432,12 @@ TEST_F(MemoryPoolTest, SmartPtr_Release) {
 
 TEST_F(MemoryPoolTest, StressTest_MemoryPool) {
     MemoryPool<int, 1024> pool;
-    
-    TestUtils::measureTime("MemoryPool stress test", [&pool]() {
-        std::vector<int*> pointers;
-        
+
+    // 指针表在计时区外预留好，计时段不含vector扩容搬移
+    std::vector<int*> pointers;
+    pointers.reserve(10000);
+
+    TestUtils::measureTime("MemoryPool stress test", [&pool, &pointers]() {
         for (int i = 0; i < 10000; ++i) {
             int* ptr = pool.allocate();
             if (ptr != nullptr) {
@@ -313,10 +456,11 @@ TEST_F(MemoryPoolTest, StressTest_MemoryPool) {
 
 TEST_F(MemoryPoolTest, StressTest_ObjectPool) {
     ObjectPool<std::string> pool(100);
-    
-    TestUtils::measureTime("ObjectPool stress test", [&pool]() {
-        std::vector<std::string*> pointers;
-        
+
+    std::vector<std::string*> pointers;
+    pointers.reserve(10000);
+
+    TestUtils::measureTime("ObjectPool stress test", [&pool, &pointers]() {
         for (int i = 0; i < 10000; ++i) {
             std::string* ptr = pool.acquire("Test " + std::to_string(i));
             if (ptr != nullptr) {
@@ -334,10 +478,11 @@ TEST_F(MemoryPoolTest, StressTest_ObjectPool) {
 
 TEST_F(MemoryPoolTest, StressTest_MemoryArena) {
     MemoryArena arena(1024 * 1024);
-    
-    TestUtils::measureTime("MemoryArena stress test", [&arena]() {
-        std::vector<void*> pointers;
-        
+
+    std::vector<void*> pointers;
+    pointers.reserve(10000);
+
+    TestUtils::measureTime("MemoryArena stress test", [&arena, &pointers]() {
         for (int i = 0; i < 10000; ++i) {
             void* ptr = arena.allocate(100);
             if (ptr != nullptr) {
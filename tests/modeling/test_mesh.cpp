@@ -168,10 +168,21 @@ TEST_F(MeshTest, MergeMeshes) {
     int vertexCount2 = cube2->getVertexCount();
     
     cube1->merge(*cube2);
-    
+
     EXPECT_EQ(cube1->getVertexCount(), vertexCount1 + vertexCount2);
 }
 
+TEST_F(MeshTest, MergeMeshesWithWeld) {
+    auto cube1 = TestDataGenerator::createCubeMesh();
+    auto cube2 = TestDataGenerator::createCubeMesh();
+
+    // 两个立方体完全重合，按位置焊接后只剩8个角点
+    cube1->merge(*cube2, 0.001f);
+
+    EXPECT_EQ(cube1->getVertexCount(), 8);
+    EXPECT_EQ(cube1->getFaceCount(), 24);
+}
+
 TEST_F(MeshTest, IsValid) {
     auto cube = TestDataGenerator::createCubeMesh();
     
@@ -260,6 +271,81 @@ TEST_F(MeshTest, SmoothShading) {
     EXPECT_FALSE(mesh_->isSmoothShading());
 }
 
+TEST_F(MeshTest, RemoveFacesBatch) {
+    mesh_->addVertex(glm::vec3(0.0f, 0.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(1.0f, 0.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(1.0f, 1.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(0.0f, 1.0f, 0.0f));
+
+    mesh_->addTriangle(0, 1, 2);
+    mesh_->addTriangle(0, 2, 3);
+    mesh_->addTriangle(1, 3, 2);
+
+    std::vector<int> toRemove = {0, 2};
+    mesh_->removeFaces(toRemove);
+
+    EXPECT_EQ(mesh_->getFaceCount(), 1);
+
+    const Face& face = mesh_->getFace(0);
+    EXPECT_EQ(face.vertices[0], 0);
+    EXPECT_EQ(face.vertices[1], 2);
+    EXPECT_EQ(face.vertices[2], 3);
+
+    EXPECT_TRUE(mesh_->getAdjacentFaces(1).empty());
+}
+
+TEST_F(MeshTest, WeldVertices) {
+    mesh_->addVertex(glm::vec3(0.0f, 0.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(1.0f, 0.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(0.5f, 1.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(1.0000001f, 0.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(2.0f, 0.0f, 0.0f));
+
+    mesh_->addTriangle(0, 1, 2);
+    mesh_->addTriangle(3, 4, 2);
+
+    int removed = mesh_->weldVertices(0.001f);
+
+    EXPECT_EQ(removed, 1);
+    EXPECT_EQ(mesh_->getVertexCount(), 4);
+    EXPECT_EQ(mesh_->getFaceCount(), 2);
+
+    const Face& face = mesh_->getFace(1);
+    EXPECT_EQ(face.vertices[0], 1);
+    EXPECT_EQ(face.vertices[1], 3);
+    EXPECT_EQ(face.vertices[2], 2);
+}
+
+TEST_F(MeshTest, WeldVerticesDropsDegenerateFaces) {
+    mesh_->addVertex(glm::vec3(0.0f, 0.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(1.0f, 0.0f, 0.0f));
+    mesh_->addVertex(glm::vec3(1.0000001f, 0.0f, 0.0f));
+
+    mesh_->addTriangle(0, 1, 2);
+
+    int removed = mesh_->weldVertices(0.001f);
+
+    EXPECT_EQ(removed, 1);
+    EXPECT_EQ(mesh_->getFaceCount(), 0);
+}
+
+TEST_F(MeshTest, BuildPackedVertexData) {
+    Vertex vertex;
+    vertex.position = glm::vec3(1.0f, 2.0f, 3.0f);
+    vertex.normal = glm::vec3(0.0f, 0.0f, 1.0f);
+    vertex.texCoord = glm::vec2(1.0f, -1.0f);
+    vertex.color = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+    mesh_->addVertex(vertex);
+
+    PackedVertexData packed = mesh_->buildPackedVertexData();
+
+    EXPECT_EQ(packed.size(), 1);
+    EXPECT_EQ(packed.positions[0], vertex.position);
+    EXPECT_EQ(packed.normals[0], 511u << 20);
+    EXPECT_EQ(packed.texCoords[0], 0x80017FFFu);
+    EXPECT_EQ(packed.colors[0], 0xFF0000FFu);
+}
+
 TEST_F(MeshTest, LargeMesh) {
     const int segments = 100;
     
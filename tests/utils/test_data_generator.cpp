@@ -2,12 +2,120 @@
 #include "test_utils.h"
 #include <cmath>
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <random>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace v3d {
 namespace test {
 
+#if defined(__AVX2__)
+namespace {
+
+inline __m256 madd256(__m256 a, __m256 b, __m256 c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+// 每次迭代生成8个正弦采样：相位乘1/2π取整折回[-π,π]（2π拆成
+// 高低两段相减保住精度），超过±π/2的再反射回主区间，然后套
+// 11次多项式。相对标量std::sin逐样本调用，误差在1e-6量级。
+void sineWaveAvx2(float* data, size_t count, float omega) {
+    const __m256 omegaV = _mm256_set1_ps(omega);
+    const __m256 invTwoPi = _mm256_set1_ps(0.15915494309189535f);
+    const __m256 twoPiHi = _mm256_set1_ps(6.28125f);
+    const __m256 twoPiLo = _mm256_set1_ps(1.9353071795864769e-03f);
+    const __m256 lane = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    const __m256 c11 = _mm256_set1_ps(-2.3889859e-08f);
+    const __m256 c9 = _mm256_set1_ps(2.7525562e-06f);
+    const __m256 c7 = _mm256_set1_ps(-1.9840874e-04f);
+    const __m256 c5 = _mm256_set1_ps(8.3333310e-03f);
+    const __m256 c3 = _mm256_set1_ps(-1.6666667e-01f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 negZero = _mm256_set1_ps(-0.0f);
+    const __m256 pi = _mm256_set1_ps(3.14159265358979323846f);
+    const __m256 halfPi = _mm256_set1_ps(1.5707963267948966f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 index = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), lane);
+        __m256 phase = _mm256_mul_ps(index, omegaV);
+
+        __m256 cycles = _mm256_round_ps(_mm256_mul_ps(phase, invTwoPi),
+                                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256 x = _mm256_sub_ps(phase, _mm256_mul_ps(cycles, twoPiHi));
+        x = _mm256_sub_ps(x, _mm256_mul_ps(cycles, twoPiLo));
+
+        __m256 sign = _mm256_and_ps(x, negZero);
+        __m256 absX = _mm256_andnot_ps(negZero, x);
+        __m256 reflected = _mm256_sub_ps(_mm256_or_ps(pi, sign), x);
+        __m256 inRange = _mm256_cmp_ps(absX, halfPi, _CMP_LE_OQ);
+        x = _mm256_blendv_ps(reflected, x, inRange);
+
+        __m256 x2 = _mm256_mul_ps(x, x);
+        __m256 poly = madd256(c11, x2, c9);
+        poly = madd256(poly, x2, c7);
+        poly = madd256(poly, x2, c5);
+        poly = madd256(poly, x2, c3);
+        poly = madd256(poly, x2, one);
+        _mm256_storeu_ps(data + i, _mm256_mul_ps(poly, x));
+    }
+    for (; i < count; ++i) {
+        data[i] = std::sin(omega * static_cast<float>(i));
+    }
+}
+
+// Philox2x32-10计数器随机数：4个64位计数并行走10轮，每轮用
+// _mm256_mul_epu32做32×32→64乘法，高32位与c1、轮密钥异或。
+// 无状态依赖，8个uint32一次产出，测试数据够用的统计质量。
+inline __m256i philox2x32Avx2(__m256i counter, uint32_t key) {
+    const __m256i multiplier = _mm256_set1_epi64x(0xD256D193ULL);
+    const __m256i maskLo32 = _mm256_set1_epi64x(0xFFFFFFFFULL);
+    for (int round = 0; round < 10; ++round) {
+        __m256i keyVec = _mm256_set1_epi64x(key);
+        __m256i product = _mm256_mul_epu32(counter, multiplier);
+        __m256i hi = _mm256_srli_epi64(product, 32);
+        __m256i c1 = _mm256_srli_epi64(counter, 32);
+        __m256i newC0 = _mm256_xor_si256(_mm256_xor_si256(hi, c1), keyVec);
+        counter = _mm256_or_si256(_mm256_slli_epi64(product, 32),
+                                  _mm256_and_si256(newC0, maskLo32));
+        key += 0x9E3779B9u;
+    }
+    return counter;
+}
+
+// 8个样本一组填充[min,max]均匀随机数：cvtepi32_ps把位型当作有符号
+// 整数（区间对称居中），再用span/2^32缩放加偏置映射到目标区间
+void randomFloatsAvx2(float* data, size_t count, float min, float max, uint32_t key) {
+    const float span = max - min;
+    const __m256 scale = _mm256_set1_ps(span * (1.0f / 4294967296.0f));
+    const __m256 bias = _mm256_set1_ps(min + span * 0.5f);
+    const __m256i step = _mm256_set1_epi64x(4);
+    __m256i counter = _mm256_set_epi64x(3, 2, 1, 0);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i bits = philox2x32Avx2(counter, key);
+        counter = _mm256_add_epi64(counter, step);
+        _mm256_storeu_ps(data + i, madd256(_mm256_cvtepi32_ps(bits), scale, bias));
+    }
+    if (i < count) {
+        alignas(32) float tail[8];
+        __m256i bits = philox2x32Avx2(counter, key);
+        _mm256_store_ps(tail, madd256(_mm256_cvtepi32_ps(bits), scale, bias));
+        std::memcpy(data + i, tail, (count - i) * sizeof(float));
+    }
+}
+
+}
+#endif
+
 modeling::Vertex TestDataGenerator::createVertex(float x, float y, float z,
                                                 float nx, float ny, float nz,
                                                 float u, float v) {
@@ -80,6 +188,9 @@ std::shared_ptr<modeling::Mesh> TestDataGenerator::createSphereMesh(int segments
     const float radius = 0.5f;
     const int rings = segments;
 
+    mesh->reserveVertices((rings + 1) * (segments + 1));
+    mesh->reserveFaces(2 * rings * segments);
+
     for (int ring = 0; ring <= rings; ++ring) {
         float theta = static_cast<float>(ring) / rings * glm::pi<float>();
         float sinTheta = std::sin(theta);
@@ -130,6 +241,9 @@ std::shared_ptr<modeling::Mesh> TestDataGenerator::createPlaneMesh(int subdivisi
     const float halfSize = size / 2.0f;
     const float step = size / subdivisions;
 
+    mesh->reserveVertices((subdivisions + 1) * (subdivisions + 1));
+    mesh->reserveFaces(2 * subdivisions * subdivisions);
+
     for (int y = 0; y <= subdivisions; ++y) {
         for (int x = 0; x <= subdivisions; ++x) {
             float px = -halfSize + x * step;
@@ -364,10 +478,14 @@ std::shared_ptr<audio::AudioBuffer> TestDataGenerator::createSineWaveBuffer(floa
     auto buffer = std::make_shared<audio::AudioBuffer>(spec, frameCount);
 
     float* data = static_cast<float*>(buffer->getData());
+    const float omega = 2.0f * glm::pi<float>() * frequency / sampleRate;
+#if defined(__AVX2__)
+    sineWaveAvx2(data, frameCount, omega);
+#else
     for (size_t i = 0; i < frameCount; ++i) {
-        float t = static_cast<float>(i) / sampleRate;
-        data[i] = std::sin(2.0f * glm::pi<float>() * frequency * t);
+        data[i] = std::sin(omega * static_cast<float>(i));
     }
+#endif
 
     return buffer;
 }
@@ -381,14 +499,18 @@ std::shared_ptr<audio::AudioBuffer> TestDataGenerator::createNoiseBuffer(int sam
     size_t frameCount = static_cast<size_t>(sampleRate * duration);
     auto buffer = std::make_shared<audio::AudioBuffer>(spec, frameCount);
 
+    float* data = static_cast<float*>(buffer->getData());
+#if defined(__AVX2__)
+    randomFloatsAvx2(data, frameCount, -1.0f, 1.0f, std::random_device{}());
+#else
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
 
-    float* data = static_cast<float*>(buffer->getData());
     for (size_t i = 0; i < frameCount; ++i) {
         data[i] = dist(gen);
     }
+#endif
 
     return buffer;
 }
@@ -469,6 +591,10 @@ std::string TestDataGenerator::createTestBinaryFile(const std::vector<uint8_t>&
 }
 
 std::vector<float> TestDataGenerator::generateRandomFloats(size_t count, float min, float max) {
+#if defined(__AVX2__)
+    std::vector<float> result(count);
+    randomFloatsAvx2(result.data(), count, min, max, std::random_device{}());
+#else
     std::vector<float> result;
     result.reserve(count);
 
@@ -479,6 +605,7 @@ std::vector<float> TestDataGenerator::generateRandomFloats(size_t count, float m
     for (size_t i = 0; i < count; ++i) {
         result.push_back(dist(gen));
     }
+#endif
 
     return result;
 }
@@ -499,6 +626,12 @@ std::vector<int> TestDataGenerator::generateRandomInts(size_t count, int min, in
 }
 
 std::vector<glm::vec3> TestDataGenerator::generateRandomVec3s(size_t count, float min, float max) {
+#if defined(__AVX2__)
+    // glm::vec3是3个紧密排列的float，整块当作扁平float数组填充
+    std::vector<glm::vec3> result(count);
+    randomFloatsAvx2(reinterpret_cast<float*>(result.data()), count * 3, min, max,
+                     std::random_device{}());
+#else
     std::vector<glm::vec3> result;
     result.reserve(count);
 
@@ -509,6 +642,7 @@ std::vector<glm::vec3> TestDataGenerator::generateRandomVec3s(size_t count, floa
     for (size_t i = 0; i < count; ++i) {
         result.emplace_back(dist(gen), dist(gen), dist(gen));
     }
+#endif
 
     return result;
 }